@@ -105,6 +105,9 @@ static le_sem_Ref_t     BridgeSemaphore;
 static const le_atClient_DeviceRef_t  AtClientDeviceRef = (le_atClient_DeviceRef_t) 0x12345678;
 static le_atClient_UnsolicitedResponseHandlerFunc_t UnsolHandler = NULL;
 static void* UnsolHandlerContextPtr = NULL;
+static const le_atClient_CmdRef_t  AtClientCmdRef = (le_atClient_CmdRef_t) 0x87654321;
+static le_atClient_CommandResponseHandlerFunc_t RspHandler = NULL;
+static void* RspHandlerContextPtr = NULL;
 static int FdAtClient = -1;
 
 //--------------------------------------------------------------------------------------------------
@@ -191,46 +194,42 @@ le_atClient_DeviceRef_t le_atClient_Start
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function must be called to automatically set and send an AT Command.
+ * This function must be called to create a new AT command.
+ *
+ * @return pointer to the new AT Command reference
+ */
+//--------------------------------------------------------------------------------------------------
+le_atClient_CmdRef_t le_atClient_Create
+(
+    void
+)
+{
+    CurrentCmdPtr = NULL;
+
+    return AtClientCmdRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to set the AT command string to be sent.
  *
  * @return
- *      - LE_FAULT when function failed
- *      - LE_TIMEOUT when a timeout occur
  *      - LE_OK when function succeed
  *
- * @note This command creates a command reference when called
- *
- * @note In case of an Error the command reference will be deleted and though
- *       not usable. Make sure to test the return code and not use the reference
- *       in other functions.
- *
- * @note If the AT command is invalid, a fatal error occurs,
+ * @note If the AT Command reference is invalid, a fatal error occurs,
  *       the function won't return.
- *
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t le_atClient_SetCommandAndSend
+le_result_t le_atClient_SetCommand
 (
-    le_atClient_CmdRef_t* cmdRefPtr,
-        ///< [OUT] Command reference
-
-    le_atClient_DeviceRef_t devRef,
-        ///< [IN] Device reference
-
-    const char* commandPtr,
+    le_atClient_CmdRef_t cmdRef,
         ///< [IN] AT Command
 
-    const char* interRespPtr,
-        ///< [IN] Expected Intermediate Response
-
-    const char* finalRespPtr,
-        ///< [IN] Expected Final Response
-
-    uint32_t timeout
-        ///< [IN] Timeout
+    const char* commandPtr
+        ///< [IN] Set Command
 )
 {
-    LE_ASSERT(devRef == AtClientDeviceRef);
+    LE_ASSERT(cmdRef == AtClientCmdRef);
 
     int i = 0;
 
@@ -243,142 +242,202 @@ le_result_t le_atClient_SetCommandAndSend
             strlen(AtCommandList[i].commandNamePtr)) == 0)
         {
             CurrentCmdPtr = &AtCommandList[i];
-            *cmdRefPtr = (le_atClient_CmdRef_t) CurrentCmdPtr;
-            return LE_OK;
+            break;
         }
         i++;
     }
 
-    return LE_FAULT;
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is used to get the first intermediate response.
+ * This function must be called to set the device where the AT command will be sent.
  *
  * @return
  *      - LE_FAULT when function failed
  *      - LE_OK when function succeed
- *
- * @note If the AT Command reference is invalid, a fatal error occurs,
- *       the function won't return.
-*/
+ */
 //--------------------------------------------------------------------------------------------------
-le_result_t le_atClient_GetFirstIntermediateResponse
+le_result_t le_atClient_SetDevice
 (
     le_atClient_CmdRef_t cmdRef,
         ///< [IN] AT Command
 
-    char* intermediateRspPtr,
-        ///< [OUT] Get Next Line
-
-    size_t intermediateRspNumElements
-        ///< [IN]
+    le_atClient_DeviceRef_t devRef
+        ///< [IN] Device where the AT command has to be sent
 )
 {
-    LE_ASSERT(cmdRef == (le_atClient_CmdRef_t) CurrentCmdPtr);
-    LE_ASSERT(CurrentCmdPtr != NULL);
-    LE_ASSERT(CurrentCmdPtr->readIndex == 0);
+    LE_ASSERT(cmdRef == AtClientCmdRef);
+    LE_ASSERT(devRef == AtClientDeviceRef);
 
-    if (CurrentCmdPtr->intermediateRspPtr[0] != NULL)
-    {
-        snprintf(intermediateRspPtr,
-                 intermediateRspNumElements,
-                 "%s",
-                 CurrentCmdPtr->intermediateRspPtr[0]);
+    return LE_OK;
+}
 
-        CurrentCmdPtr->readIndex++;
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to set the intermediate response filter.
+ *
+ * @return
+ *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atClient_SetIntermediateResponse
+(
+    le_atClient_CmdRef_t cmdRef,
+        ///< [IN] AT Command
 
-        return LE_OK;
-    }
+    const char* intermediatePtr
+        ///< [IN] Set Intermediate
+)
+{
+    LE_ASSERT(cmdRef == AtClientCmdRef);
 
-    return LE_FAULT;
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is used to get the next intermediate response.
+ * This function is used to set the final response(s) of the AT command execution.
  *
  * @return
- *      - LE_NOT_FOUND when there are no further results.
  *      - LE_OK when function succeed
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atClient_SetFinalResponse
+(
+    le_atClient_CmdRef_t cmdRef,
+        ///< [IN] AT Command
+
+    const char* responsePtr
+        ///< [IN] Set Response
+)
+{
+    LE_ASSERT(cmdRef == AtClientCmdRef);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to set the timeout of the AT command execution.
  *
- * @note If the AT Command reference is invalid, a fatal error occurs,
- *       the function won't return.
+ * @return
+ *      - LE_OK when function succeed
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t le_atClient_GetNextIntermediateResponse
+le_result_t le_atClient_SetTimeout
 (
     le_atClient_CmdRef_t cmdRef,
         ///< [IN] AT Command
 
-    char* intermediateRspPtr,
-        ///< [OUT] Get Next Line
+    uint32_t timer
+        ///< [IN] Set Timer
+)
+{
+    LE_ASSERT(cmdRef == AtClientCmdRef);
+
+    return LE_OK;
+}
 
-    size_t intermediateRspNumElements
-        ///< [IN]
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the responses of the current command to the bridge, as the AT client does when the
+ * modem answers.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportResponses
+(
+    void* param1Ptr,
+    void* param2Ptr
 )
 {
-    LE_ASSERT(cmdRef == (le_atClient_CmdRef_t) CurrentCmdPtr);
-    LE_ASSERT(CurrentCmdPtr != NULL);
-    LE_ASSERT(CurrentCmdPtr->readIndex != 0);
+    AtCommandDesc_t* cmdPtr = param1Ptr;
 
-    if (CurrentCmdPtr->intermediateRspPtr[CurrentCmdPtr->readIndex] != NULL)
-    {
-        snprintf(intermediateRspPtr,
-                 intermediateRspNumElements,
-                 "%s",
-                 CurrentCmdPtr->intermediateRspPtr[CurrentCmdPtr->readIndex]);
+    LE_ASSERT(RspHandler != NULL);
 
-        CurrentCmdPtr->readIndex++;
+    while (cmdPtr->intermediateRspPtr[cmdPtr->readIndex] != NULL)
+    {
+        RspHandler(AtClientCmdRef,
+                   LE_IN_PROGRESS,
+                   cmdPtr->intermediateRspPtr[cmdPtr->readIndex],
+                   RspHandlerContextPtr);
 
-        return LE_OK;
+        cmdPtr->readIndex++;
     }
 
+    cmdPtr->readIndex = 0;
 
-    return LE_NOT_FOUND;
+    RspHandler(AtClientCmdRef, LE_OK, cmdPtr->finalRspPtr, RspHandlerContextPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is used to get the final response
+ * This function must be called to send an AT Command without waiting for its responses.
  *
  * @return
  *      - LE_FAULT when function failed
  *      - LE_OK when function succeed
- *
- * @note If the AT Command reference is invalid, a fatal error occurs,
- *       the function won't return.
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t le_atClient_GetFinalResponse
+le_result_t le_atClient_SendAsync
 (
-    le_atClient_CmdRef_t cmdRef,
+    le_atClient_CmdRef_t cmdRef
         ///< [IN] AT Command
+)
+{
+    LE_ASSERT(cmdRef == AtClientCmdRef);
 
-    char* finalRspPtr,
-        ///< [OUT] Get Final Line
+    if (NULL == CurrentCmdPtr)
+    {
+        return LE_FAULT;
+    }
+
+    le_event_QueueFunction(ReportResponses, CurrentCmdPtr, NULL);
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This event provides the responses of the commands sent with le_atClient_SendAsync() on a
+ * device.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+le_atClient_CommandResponseHandlerRef_t le_atClient_AddCommandResponseHandler
+(
+    le_atClient_DeviceRef_t devRef,
+        ///< [IN] Device to listen
 
-    size_t finalRspNumElements
+    le_atClient_CommandResponseHandlerFunc_t handlerPtr,
+        ///< [IN]
+
+    void* contextPtr
         ///< [IN]
 )
 {
-    LE_ASSERT(cmdRef == (le_atClient_CmdRef_t) CurrentCmdPtr);
-    LE_ASSERT(CurrentCmdPtr != NULL);
-
-    if (CurrentCmdPtr->finalRspPtr)
-    {
-        snprintf(finalRspPtr,
-                 finalRspNumElements,
-                 "%s",
-                 CurrentCmdPtr->finalRspPtr);
+    LE_ASSERT(devRef == AtClientDeviceRef);
 
-        CurrentCmdPtr->readIndex = 0;
+    RspHandler = handlerPtr;
+    RspHandlerContextPtr = contextPtr;
 
-        return LE_OK;
-    }
+    return (le_atClient_CommandResponseHandlerRef_t) RspHandler;
+}
 
-    return LE_FAULT;
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove handler function for EVENT 'le_atClient_CommandResponse'
+ */
+//--------------------------------------------------------------------------------------------------
+void le_atClient_RemoveCommandResponseHandler
+(
+    le_atClient_CommandResponseHandlerRef_t handlerRef
+        ///< [IN]
+)
+{
+    RspHandler = NULL;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -0,0 +1,469 @@
+/**
+ * Unit test and benchmark of the package decoding stage of the AirVantage connector.
+ *
+ * A synthetic package, made of compressible text and of incompressible data (as found in update
+ * packages holding already compressed files), is encoded in each supported format, decoded by the
+ * package decoder and compared with the original. The decoding throughput of each format is
+ * reported with the test results. The checkpoints recorded while decoding are checked against
+ * complete, partial and corrupted packages.
+ *
+ * The package format is detected from the event loop, so the tests are chained through the format
+ * detection handler.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "packageDecoder.h"
+
+#include <zlib.h>
+#include <bzlib.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the synthetic package.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PACKAGE_SIZE        (4 * 1024 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the synthetic package blocks, alternately text and random data.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PACKAGE_BLOCK_SIZE  (32 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checkpoint file used by the test.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHECKPOINT_FILE     "/tmp/packageDecoderTest/checkpoints"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Package formats tested, with the format the decoder should detect.
+ */
+//--------------------------------------------------------------------------------------------------
+static const struct
+{
+    const char* namePtr;
+    packageDecoder_Format_t format;
+}
+Formats[] =
+{
+    { "raw",                PACKAGE_FORMAT_RAW   },
+    { "zlib",               PACKAGE_FORMAT_ZLIB  },
+    { "gzip multi-member",  PACKAGE_FORMAT_ZLIB  },
+    { "bzip2",              PACKAGE_FORMAT_BZIP2 },
+    { "gzip",               PACKAGE_FORMAT_ZLIB  },
+};
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Index of the format being tested.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t FormatIndex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synthetic package, encoded package and decoded package.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t* PackagePtr;
+static uint8_t* EncodedPtr;
+static uint8_t* DecodedPtr;
+static size_t EncodedSize;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decoded package being read and start time of its decoding.
+ */
+//--------------------------------------------------------------------------------------------------
+static int DecodedFd;
+static le_clk_Time_t StartTime;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the synthetic package: three text blocks for one random block.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BuildPackage
+(
+    void
+)
+{
+    uint32_t seed = 12345;
+    size_t offset = 0;
+    unsigned int line = 0;
+
+    while (offset < PACKAGE_SIZE)
+    {
+        size_t end = offset + PACKAGE_BLOCK_SIZE;
+
+        if (((offset / PACKAGE_BLOCK_SIZE) % 4) == 3)
+        {
+            for (; offset < end; offset++)
+            {
+                seed = seed * 1103515245 + 12345;
+                PackagePtr[offset] = seed >> 24;
+            }
+        }
+        else
+        {
+            while (offset < end)
+            {
+                char text[64];
+                int len = snprintf(text, sizeof(text), "file/%05u/lib%u.so size=%u mode=0755\n",
+                                   line, line % 97, (line * 7919) % 100000);
+                line++;
+                for (int i = 0; (i < len) && (offset < end); i++)
+                {
+                    PackagePtr[offset++] = text[i];
+                }
+            }
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deflate a buffer with a zlib or gzip header.
+ *
+ * @return Encoded size.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t Deflate
+(
+    const uint8_t* dataPtr,
+    size_t size,
+    uint8_t* outPtr,
+    size_t outSize,
+    int windowBits
+)
+{
+    z_stream stream;
+
+    memset(&stream, 0, sizeof(stream));
+    LE_ASSERT(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8,
+                           Z_DEFAULT_STRATEGY) == Z_OK);
+    stream.next_in = (Bytef*)dataPtr;
+    stream.avail_in = size;
+    stream.next_out = outPtr;
+    stream.avail_out = outSize;
+    LE_ASSERT(deflate(&stream, Z_FINISH) == Z_STREAM_END);
+    deflateEnd(&stream);
+
+    return stream.total_out;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Encode the synthetic package.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Encode
+(
+    const char* formatPtr
+)
+{
+    size_t capacity = PACKAGE_SIZE + PACKAGE_SIZE / 10 + 1024;
+
+    if (strcmp(formatPtr, "raw") == 0)
+    {
+        memcpy(EncodedPtr, PackagePtr, PACKAGE_SIZE);
+        EncodedSize = PACKAGE_SIZE;
+    }
+    else if (strcmp(formatPtr, "zlib") == 0)
+    {
+        EncodedSize = Deflate(PackagePtr, PACKAGE_SIZE, EncodedPtr, capacity, 15);
+    }
+    else if (strcmp(formatPtr, "gzip") == 0)
+    {
+        EncodedSize = Deflate(PackagePtr, PACKAGE_SIZE, EncodedPtr, capacity, 15 + 16);
+    }
+    else if (strcmp(formatPtr, "gzip multi-member") == 0)
+    {
+        EncodedSize = Deflate(PackagePtr, PACKAGE_SIZE / 2, EncodedPtr, capacity, 15 + 16);
+        EncodedSize += Deflate(PackagePtr + PACKAGE_SIZE / 2, PACKAGE_SIZE / 2,
+                               EncodedPtr + EncodedSize, capacity - EncodedSize, 15 + 16);
+    }
+    else
+    {
+        unsigned int size = capacity;
+
+        LE_ASSERT(BZ2_bzBuffToBuffCompress((char*)EncodedPtr, &size, (char*)PackagePtr,
+                                           PACKAGE_SIZE, 9, 0, 0) == BZ_OK);
+        EncodedSize = size;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a buffer to a temporary file.
+ *
+ * @return File descriptor of the file, positioned at its start.
+ */
+//--------------------------------------------------------------------------------------------------
+static int WriteTempFile
+(
+    const uint8_t* dataPtr,
+    size_t size
+)
+{
+    char path[] = "/tmp/packageDecoderTestXXXXXX";
+    int fd = mkstemp(path);
+
+    LE_ASSERT(fd >= 0);
+    unlink(path);
+    LE_ASSERT(write(fd, dataPtr, size) == (ssize_t)size);
+    LE_ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+
+    return fd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start decoding a package.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartDecoding
+(
+    int fd,
+    packageDecoder_FormatHandlerFunc_t handlerFunc
+)
+{
+    StartTime = le_clk_GetRelativeTime();
+    LE_ASSERT(packageDecoder_Start(fd, CHECKPOINT_FILE, handlerFunc, NULL, &DecodedFd) == LE_OK);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the decoded package until the decoder closes it.
+ *
+ * @return Decoded size.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t ReadDecoded
+(
+    le_clk_Time_t* durationPtr
+)
+{
+    size_t size = 0;
+    ssize_t count;
+
+    do
+    {
+        count = read(DecodedFd, DecodedPtr + size, PACKAGE_SIZE + 1 - size);
+        if (count > 0)
+        {
+            size += count;
+        }
+    }
+    while ((count > 0) || ((count < 0) && (errno == EINTR)));
+
+    close(DecodedFd);
+    *durationPtr = le_clk_Sub(le_clk_GetRelativeTime(), StartTime);
+
+    return size;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the resume offsets computed from the checkpoints of a package whose decoding was
+ * interrupted after truncatedSize bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestCheckpoints
+(
+    size_t truncatedSize
+)
+{
+    off_t offset;
+    int pipeFds[2];
+    int fd;
+
+    // Whole package: the complete chunks decoded before the interruption match.
+    fd = WriteTempFile(EncodedPtr, EncodedSize);
+    LE_TEST(packageDecoder_GetResumeOffset(fd, CHECKPOINT_FILE, &offset) == LE_OK);
+    LE_TEST(offset == (off_t)(truncatedSize / PACKAGE_DECODER_CHUNK_SIZE *
+                              PACKAGE_DECODER_CHUNK_SIZE));
+    close(fd);
+
+    // Interrupted download: resume after the last complete chunk.
+    fd = WriteTempFile(EncodedPtr, 3 * PACKAGE_DECODER_CHUNK_SIZE + 100);
+    LE_TEST(packageDecoder_GetResumeOffset(fd, CHECKPOINT_FILE, &offset) == LE_OK);
+    LE_TEST(offset == 3 * PACKAGE_DECODER_CHUNK_SIZE);
+    close(fd);
+
+    // Corrupted download: resume from the corrupted chunk.
+    EncodedPtr[2 * PACKAGE_DECODER_CHUNK_SIZE + 5] ^= 0xFF;
+    fd = WriteTempFile(EncodedPtr, EncodedSize);
+    LE_TEST(packageDecoder_GetResumeOffset(fd, CHECKPOINT_FILE, &offset) == LE_OK);
+    LE_TEST(offset == 2 * PACKAGE_DECODER_CHUNK_SIZE);
+    close(fd);
+    EncodedPtr[2 * PACKAGE_DECODER_CHUNK_SIZE + 5] ^= 0xFF;
+
+    // A pipe can't be checked.
+    LE_ASSERT(pipe(pipeFds) == 0);
+    LE_TEST(packageDecoder_GetResumeOffset(pipeFds[0], CHECKPOINT_FILE, &offset)
+            == LE_UNSUPPORTED);
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that a truncated package is not decoded completely and that its checkpoints are kept,
+ * and end the test.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TruncatedHandler
+(
+    le_result_t result,
+    packageDecoder_Format_t format,
+    void* contextPtr
+)
+{
+    le_clk_Time_t duration;
+
+    LE_UNUSED(contextPtr);
+
+    LE_TEST((result == LE_OK) && (format == PACKAGE_FORMAT_BZIP2) &&
+            (ReadDecoded(&duration) < PACKAGE_SIZE));
+
+    TestCheckpoints(EncodedSize / 2);
+
+    free(PackagePtr);
+    free(EncodedPtr);
+    free(DecodedPtr);
+
+    LE_TEST_EXIT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Feed a package through a pipe, its first byte alone, as a slow download would.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* WriterThread
+(
+    void* contextPtr
+)
+{
+    int fd = (int)(intptr_t)contextPtr;
+
+    LE_ASSERT(write(fd, EncodedPtr, 1) == 1);
+    usleep(100000);
+    LE_ASSERT(write(fd, EncodedPtr + 1, EncodedSize - 1) == (ssize_t)(EncodedSize - 1));
+    close(fd);
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the package fed through a pipe, then test a truncated package.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PipeHandler
+(
+    le_result_t result,
+    packageDecoder_Format_t format,
+    void* contextPtr
+)
+{
+    le_clk_Time_t duration;
+
+    LE_UNUSED(contextPtr);
+
+    LE_TEST_OK((result == LE_OK) && (format == PACKAGE_FORMAT_ZLIB), "pipe: format detected");
+    LE_TEST_OK((ReadDecoded(&duration) == PACKAGE_SIZE) &&
+               (memcmp(DecodedPtr, PackagePtr, PACKAGE_SIZE) == 0), "pipe: package decoded");
+
+    Encode("bzip2");
+    StartDecoding(WriteTempFile(EncodedPtr, EncodedSize / 2), TruncatedHandler);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that the decoder doesn't wait for the package to be received: the format is detected
+ * once the first bytes of a package fed through a pipe are available.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestPipe
+(
+    void
+)
+{
+    int pipeFds[2];
+
+    Encode("gzip");
+
+    LE_ASSERT(pipe(pipeFds) == 0);
+    StartDecoding(pipeFds[0], PipeHandler);
+
+    le_thread_Start(le_thread_Create("PackageWriter", WriterThread,
+                                     (void*)(intptr_t)pipeFds[1]));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the decoded package of the tested format, then test the next format.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FormatHandler
+(
+    le_result_t result,
+    packageDecoder_Format_t format,
+    void* contextPtr
+)
+{
+    const char* namePtr = Formats[FormatIndex].namePtr;
+    le_clk_Time_t duration;
+
+    LE_UNUSED(contextPtr);
+
+    LE_TEST_OK((result == LE_OK) && (format == Formats[FormatIndex].format),
+               "%s: format detected", namePtr);
+
+    size_t size = ReadDecoded(&duration);
+
+    LE_TEST_OK((size == PACKAGE_SIZE) && (memcmp(DecodedPtr, PackagePtr, PACKAGE_SIZE) == 0),
+               "%s: package decoded", namePtr);
+
+    off_t offset;
+    LE_TEST_OK(packageDecoder_GetResumeOffset(0, CHECKPOINT_FILE, &offset) == LE_NOT_FOUND,
+               "%s: checkpoints removed", namePtr);
+
+    double seconds = duration.sec + duration.usec / 1000000.0;
+    LE_TEST_INFO("%s: %zu -> %d bytes in %.3f s (%.1f MB/s)", namePtr, EncodedSize,
+                 PACKAGE_SIZE, seconds, (PACKAGE_SIZE / (1024.0 * 1024.0)) / seconds);
+
+    FormatIndex++;
+    if (FormatIndex < NUM_ARRAY_MEMBERS(Formats))
+    {
+        Encode(Formats[FormatIndex].namePtr);
+        StartDecoding(WriteTempFile(EncodedPtr, EncodedSize), FormatHandler);
+    }
+    else
+    {
+        TestPipe();
+    }
+}
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(25);
+
+    PackagePtr = malloc(PACKAGE_SIZE);
+    EncodedPtr = malloc(PACKAGE_SIZE + PACKAGE_SIZE / 10 + 1024);
+    DecodedPtr = malloc(PACKAGE_SIZE + 1);
+    LE_ASSERT((PackagePtr != NULL) && (EncodedPtr != NULL) && (DecodedPtr != NULL));
+
+    BuildPackage();
+
+    Encode(Formats[FormatIndex].namePtr);
+    StartDecoding(WriteTempFile(EncodedPtr, EncodedSize), FormatHandler);
+}
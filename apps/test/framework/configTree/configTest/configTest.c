@@ -632,6 +632,27 @@ static void MultiTreeTest()
 
 
 
+static void GenerationTest()
+{
+    static char pathBuffer[LE_CFG_STR_LEN_BYTES] = "";
+    LE_ASSERT(snprintf(pathBuffer, LE_CFG_STR_LEN_BYTES, "%s/generationTest/value", TestRootDir)
+              <= LE_CFG_STR_LEN_BYTES);
+
+    uint32_t generation = le_cfg_GetTreeGeneration(pathBuffer);
+
+    // Other instances of the test may write to the tree at the same time.
+    if (le_arg_NumArgs() == 0)
+    {
+        le_cfg_QuickGetInt(pathBuffer, 0);
+        LE_TEST(le_cfg_GetTreeGeneration(pathBuffer) == generation);
+    }
+
+    le_cfg_QuickSetInt(pathBuffer, 1);
+    LE_TEST(le_cfg_GetTreeGeneration(pathBuffer) != generation);
+}
+
+
+
 static void ExistAndEmptyTest()
 {
     static char pathBuffer[LE_CFG_STR_LEN_BYTES] = "";
@@ -1006,6 +1027,7 @@ COMPONENT_INIT
     StringSizeTest();
     TestImportExport();
     MultiTreeTest();
+    GenerationTest();
     ExistAndEmptyTest();
     ListTreeTest();
     CallbackTest();
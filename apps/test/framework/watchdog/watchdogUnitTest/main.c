@@ -0,0 +1,194 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unit test of the watchdog daemon, run against fake client processes (see wdogStub.c).
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "wdogStub.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Watchdog timeout of the fake processes, long enough never to expire during the test (ms).
+ */
+//--------------------------------------------------------------------------------------------------
+#define LONG_TIMEOUT    10000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Watchdog group test: one member kicks, the other does not.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GROUP_APP       "groupApp"
+#define GROUP_TIMEOUT   200
+#define KICKING_PID     101
+#define STALE_PID       102
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * App pause test: the watchdog of a process of a paused app is held, and re-armed when the app is
+ * resumed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PAUSED_APP      "pausedApp"
+#define PAUSE_TIMEOUT   200
+#define PAUSED_PID      201
+
+
+static void TestGroupExpiry(void);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that only the member of the group which did not kick timed out.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckGroupExpiry
+(
+    le_timer_Ref_t timerRef
+)
+{
+    uint32_t kickCount = 0;
+    uint64_t minKickInterval, maxKickInterval, minMargin;
+
+    LE_TEST_OK(wdogStub_IsTimedOut(STALE_PID), "member which did not kick timed out");
+    LE_TEST_OK(!wdogStub_IsTimedOut(KICKING_PID), "member which kicked did not time out");
+
+    // The watchdog of the member which kicked is still there, with its statistics.
+    wdogStub_SetClient(KICKING_PID);
+    LE_TEST_OK(LE_OK == le_wdog_GetKickStatistics(&kickCount, &minKickInterval,
+                                                  &maxKickInterval, &minMargin),
+               "get kick statistics");
+    LE_TEST_OK(3 == kickCount, "%" PRIu32 " kicks recorded", kickCount);
+
+    le_timer_Delete(timerRef);
+    LE_TEST_EXIT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the watchdog group test.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestGroupExpiry
+(
+    void
+)
+{
+    le_timer_Ref_t timerRef;
+
+    LE_TEST_INFO("Watchdog group with a member which does not kick");
+
+    wdogStub_AddProc(KICKING_PID, GROUP_APP, LONG_TIMEOUT, GROUP_TIMEOUT);
+    wdogStub_AddProc(STALE_PID, GROUP_APP, LONG_TIMEOUT, GROUP_TIMEOUT);
+
+    // Both members join the group, and the round after the one they joined in is completed.
+    wdogStub_SetClient(KICKING_PID);
+    le_wdog_Kick();
+    wdogStub_SetClient(STALE_PID);
+    le_wdog_Kick();
+    wdogStub_SetClient(KICKING_PID);
+    le_wdog_Kick();
+
+    // Only one member kicks in the next round.
+    le_wdog_Kick();
+
+    timerRef = le_timer_Create("GroupExpiry");
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, GROUP_TIMEOUT * 2));
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, CheckGroupExpiry));
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that the watchdog of the resumed app expired, a full timeout after the app was resumed,
+ * then go on with the next test.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckResumedExpiry
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK(wdogStub_IsTimedOut(PAUSED_PID), "process of the resumed app timed out");
+
+    le_timer_Delete(timerRef);
+    TestGroupExpiry();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that the watchdog of the resumed app was re-armed with its full timeout.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckResumed
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK(!wdogStub_IsTimedOut(PAUSED_PID),
+               "process of the resumed app did not time out before its full timeout");
+
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, PAUSE_TIMEOUT));
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, CheckResumedExpiry));
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check that the watchdog of the paused app did not expire, and resume the app.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckPaused
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK(!wdogStub_IsTimedOut(PAUSED_PID), "process of the paused app did not time out");
+
+    wdogStub_PauseApp(PAUSED_APP, false);
+
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, PAUSE_TIMEOUT / 2));
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, CheckResumed));
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the app pause test.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestAppPause
+(
+    void
+)
+{
+    le_timer_Ref_t timerRef;
+
+    LE_TEST_INFO("Watchdog of a paused app");
+
+    wdogStub_AddProc(PAUSED_PID, PAUSED_APP, PAUSE_TIMEOUT, 0);
+
+    wdogStub_SetClient(PAUSED_PID);
+    le_wdog_Kick();
+
+    wdogStub_PauseApp(PAUSED_APP, true);
+
+    // Stay paused for longer than the timeout.
+    timerRef = le_timer_Create("AppPause");
+    LE_ASSERT_OK(le_timer_SetMsInterval(timerRef, PAUSE_TIMEOUT * 2));
+    LE_ASSERT_OK(le_timer_SetHandler(timerRef, CheckPaused));
+    LE_ASSERT_OK(le_timer_Start(timerRef));
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+
+    TestAppPause();
+}
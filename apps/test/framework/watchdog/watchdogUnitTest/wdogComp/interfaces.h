@@ -0,0 +1,67 @@
+#include "le_wdog_interface.h"
+#include "le_cfg_interface.h"
+#include "le_instStat_interface.h"
+#include "le_appInfo_interface.h"
+#include "wdog_interface.h"
+#include "frameworkWdog_interface.h"
+
+#undef LE_KILL_CLIENT
+#define LE_KILL_CLIENT LE_ERROR
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the server service reference
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_ServiceRef_t le_wdog_GetServiceRef
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the client session reference for the current message
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_SessionRef_t le_wdog_GetClientSessionRef
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Framework daemon watchdog interfaces, all bound to frameworkWdog.api.
+ */
+//--------------------------------------------------------------------------------------------------
+void supervisorWdog_ConnectService
+(
+    void
+);
+
+frameworkWdog_KickEventHandlerRef_t supervisorWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+);
+
+frameworkWdog_KickEventHandlerRef_t configTreeWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+);
+
+frameworkWdog_KickEventHandlerRef_t logDaemonWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+);
+
+frameworkWdog_KickEventHandlerRef_t updateDaemonWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+);
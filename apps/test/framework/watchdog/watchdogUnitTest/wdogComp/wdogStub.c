@@ -0,0 +1,537 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stubs of the services used by the watchdog daemon, and fake client processes.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "limit.h"
+#include "pa_wdog.h"
+#include "wdogStub.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fake client process.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    pid_t pid;
+    char appName[LIMIT_MAX_APP_NAME_BYTES];
+    int32_t timeout;            ///< Watchdog timeout of the app, in ms
+    int32_t groupTimeout;       ///< Watchdog group timeout of the app, in ms, or 0
+    bool isTimedOut;            ///< Reported to the supervisor as timed out
+}
+Proc_t;
+
+static Proc_t Procs[WDOG_STUB_MAX_PROCS];
+static size_t ProcCount;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Client process on whose behalf the le_wdog functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+static pid_t ClientPid;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * App pause handler registered by the watchdog daemon with the supervisor.
+ */
+//--------------------------------------------------------------------------------------------------
+static wdog_AppPauseHandlerFunc_t AppPauseHandler;
+static void* AppPauseContextPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Dummy non-NULL reference returned by the stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DUMMY_REF ((void*)0xD34DB33F)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a fake process.
+ */
+//--------------------------------------------------------------------------------------------------
+static Proc_t* FindProc
+(
+    pid_t pid
+)
+{
+    size_t i;
+
+    for (i = 0; i < ProcCount; i++)
+    {
+        if (Procs[i].pid == pid)
+        {
+            return &Procs[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find the first fake process of an app.
+ */
+//--------------------------------------------------------------------------------------------------
+static Proc_t* FindAppProc
+(
+    const char* appName,
+    size_t appNameLen
+)
+{
+    size_t i;
+
+    for (i = 0; i < ProcCount; i++)
+    {
+        if ((strlen(Procs[i].appName) == appNameLen) &&
+            (0 == strncmp(Procs[i].appName, appName, appNameLen)))
+        {
+            return &Procs[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declare a fake client process.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_AddProc
+(
+    pid_t pid,
+    const char* appName,
+    int32_t timeout,
+    int32_t groupTimeout
+)
+{
+    LE_ASSERT(ProcCount < WDOG_STUB_MAX_PROCS);
+
+    Proc_t* procPtr = &Procs[ProcCount++];
+
+    procPtr->pid = pid;
+    LE_ASSERT(LE_OK == le_utf8_Copy(procPtr->appName, appName, sizeof(procPtr->appName), NULL));
+    procPtr->timeout = timeout;
+    procPtr->groupTimeout = groupTimeout;
+    procPtr->isTimedOut = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the client process on whose behalf the le_wdog functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_SetClient
+(
+    pid_t pid
+)
+{
+    ClientPid = pid;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a process was reported to the supervisor as timed out.
+ */
+//--------------------------------------------------------------------------------------------------
+bool wdogStub_IsTimedOut
+(
+    pid_t pid
+)
+{
+    Proc_t* procPtr = FindProc(pid);
+
+    return (NULL != procPtr) && procPtr->isTimedOut;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report to the watchdog daemon that an app has been paused or resumed by the supervisor.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_PauseApp
+(
+    const char* appName,
+    bool isPaused
+)
+{
+    LE_ASSERT(NULL != AppPauseHandler);
+
+    AppPauseHandler(appName, isPaused, AppPauseContextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the application name of the process with the specified PID.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t GetAppNameFromPid
+(
+    int32_t pid,
+    char* appName,
+    size_t appNameNumElements
+)
+{
+    Proc_t* procPtr = FindProc(pid);
+
+    if (NULL == procPtr)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    return le_utf8_Copy(appName, procPtr->appName, appNameNumElements, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the name of the process with the specified PID.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t GetProcessNameFromPid
+(
+    pid_t pId,
+    char* name,
+    size_t length
+)
+{
+    if (NULL == FindProc(pId))
+    {
+        return LE_NOT_FOUND;
+    }
+
+    return (snprintf(name, length, "proc%d", pId) < length) ? LE_OK : LE_OVERFLOW;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * le_appInfo stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_appInfo_ConnectService
+(
+    void
+)
+{
+}
+
+le_result_t le_appInfo_GetName
+(
+    int32_t pid,
+    char* appName,
+    size_t appNameSize
+)
+{
+    return GetAppNameFromPid(pid, appName, appNameSize);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * le_cfg stubs.  Only the watchdog timeouts of the apps are set.
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t le_cfg_QuickGetInt
+(
+    const char* path,
+    int32_t defaultValue
+)
+{
+    // Only "apps/<app>/<node>" is set: no process level timeout is configured.
+    const char* appNamePtr;
+    const char* nodePtr;
+    Proc_t* procPtr;
+
+    if ('/' == path[0])
+    {
+        path++;
+    }
+    if (0 != strncmp(path, "apps/", sizeof("apps/") - 1))
+    {
+        return defaultValue;
+    }
+
+    appNamePtr = path + sizeof("apps/") - 1;
+    nodePtr = strchr(appNamePtr, '/');
+    if ((NULL == nodePtr) || (NULL == (procPtr = FindAppProc(appNamePtr, nodePtr - appNamePtr))))
+    {
+        return defaultValue;
+    }
+
+    if (0 == strcmp(nodePtr, "/watchdogTimeout"))
+    {
+        return procPtr->timeout;
+    }
+    if ((0 == strcmp(nodePtr, "/watchdogGroupTimeout")) && (procPtr->groupTimeout > 0))
+    {
+        return procPtr->groupTimeout;
+    }
+
+    return defaultValue;
+}
+
+le_cfg_IteratorRef_t le_cfg_CreateReadTxn
+(
+    const char* basePath
+)
+{
+    return DUMMY_REF;
+}
+
+void le_cfg_CancelTxn
+(
+    le_cfg_IteratorRef_t iteratorRef
+)
+{
+}
+
+int32_t le_cfg_GetInt
+(
+    le_cfg_IteratorRef_t iteratorRef,
+    const char* path,
+    int32_t defaultValue
+)
+{
+    return defaultValue;
+}
+
+bool le_cfg_GetBool
+(
+    le_cfg_IteratorRef_t iteratorRef,
+    const char* path,
+    bool defaultValue
+)
+{
+    return defaultValue;
+}
+
+le_result_t le_cfg_GetNodeName
+(
+    le_cfg_IteratorRef_t iteratorRef,
+    const char* path,
+    char* name,
+    size_t nameSize
+)
+{
+    return LE_NOT_FOUND;
+}
+
+void le_cfg_GoToNode
+(
+    le_cfg_IteratorRef_t iteratorRef,
+    const char* newPath
+)
+{
+}
+
+le_result_t le_cfg_GoToParent
+(
+    le_cfg_IteratorRef_t iteratorRef
+)
+{
+    return LE_NOT_FOUND;
+}
+
+le_result_t le_cfg_GoToFirstChild
+(
+    le_cfg_IteratorRef_t iteratorRef
+)
+{
+    return LE_NOT_FOUND;
+}
+
+le_result_t le_cfg_GoToNextSibling
+(
+    le_cfg_IteratorRef_t iteratorRef
+)
+{
+    return LE_NOT_FOUND;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * le_instStat stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+le_instStat_AppInstallEventHandlerRef_t le_instStat_AddAppInstallEventHandler
+(
+    le_instStat_AppInstallHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+le_instStat_AppUninstallEventHandlerRef_t le_instStat_AddAppUninstallEventHandler
+(
+    le_instStat_AppUninstallHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Supervisor stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdog_ConnectService
+(
+    void
+)
+{
+}
+
+void wdog_WatchdogTimedOut
+(
+    uint32_t procId
+)
+{
+    Proc_t* procPtr = FindProc(procId);
+
+    LE_INFO("proc %" PRIu32 " reported as timed out", procId);
+    if (NULL != procPtr)
+    {
+        procPtr->isTimedOut = true;
+    }
+}
+
+wdog_AppPauseHandlerRef_t wdog_AddAppPauseHandler
+(
+    wdog_AppPauseHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    AppPauseHandler = handlerPtr;
+    AppPauseContextPtr = contextPtr;
+
+    return DUMMY_REF;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Framework daemon watchdog stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+void supervisorWdog_ConnectService
+(
+    void
+)
+{
+}
+
+frameworkWdog_KickEventHandlerRef_t supervisorWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+frameworkWdog_KickEventHandlerRef_t configTreeWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+frameworkWdog_KickEventHandlerRef_t logDaemonWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+frameworkWdog_KickEventHandlerRef_t updateDaemonWdog_AddKickEventHandler
+(
+    uint32_t interval,
+    frameworkWdog_KickHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return DUMMY_REF;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * le_wdog service stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_ServiceRef_t le_wdog_GetServiceRef
+(
+    void
+)
+{
+    return NULL;
+}
+
+le_msg_SessionRef_t le_wdog_GetClientSessionRef
+(
+    void
+)
+{
+    return DUMMY_REF;
+}
+
+le_msg_SessionEventHandlerRef_t MsgAddServiceCloseHandler
+(
+    le_msg_ServiceRef_t serviceRef,
+    le_msg_SessionEventHandler_t handlerFunc,
+    void* contextPtr
+)
+{
+    return NULL;
+}
+
+le_result_t MsgGetClientProcessId
+(
+    le_msg_SessionRef_t sessionRef,
+    pid_t* processIdPtr
+)
+{
+    *processIdPtr = ClientPid;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Watchdog platform adaptor stubs.
+ */
+//--------------------------------------------------------------------------------------------------
+void pa_wdog_Init
+(
+    void
+)
+{
+}
+
+void pa_wdog_Kick
+(
+    void
+)
+{
+}
+
+void pa_wdog_Shutdown
+(
+    void
+)
+{
+    LE_FATAL("Watchdog shut the system down");
+}
@@ -0,0 +1,64 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Controls of the stubs of the watchdog daemon unit test.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef WDOG_STUB_H_INCLUDE_GUARD
+#define WDOG_STUB_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of fake client processes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define WDOG_STUB_MAX_PROCS 8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Declare a fake client process: the app it belongs to, and the timeouts configured for its
+ * watchdog and for the watchdog group of its app (0 for none).
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_AddProc
+(
+    pid_t pid,
+    const char* appName,
+    int32_t timeout,
+    int32_t groupTimeout
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the client process on whose behalf the le_wdog functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_SetClient
+(
+    pid_t pid
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a process was reported to the supervisor as timed out.
+ */
+//--------------------------------------------------------------------------------------------------
+bool wdogStub_IsTimedOut
+(
+    pid_t pid
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report to the watchdog daemon that an app has been paused or resumed by the supervisor.
+ */
+//--------------------------------------------------------------------------------------------------
+void wdogStub_PauseApp
+(
+    const char* appName,
+    bool isPaused
+);
+
+#endif // WDOG_STUB_H_INCLUDE_GUARD
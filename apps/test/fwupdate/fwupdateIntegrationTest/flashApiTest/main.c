@@ -50,6 +50,7 @@ static le_result_t FlashApiTest_Info(char **args);
 static le_result_t FlashApiTest_Dump(char **args);
 static le_result_t FlashApiTest_Flash(char **args);
 static le_result_t FlashApiTest_FlashErase(char **args);
+static le_result_t FlashApiTest_FlashStream(char **args);
 static le_result_t FlashApiTest_Copy(char **args);
 static le_result_t FlashApiTest_InfoUbi(char **args);
 static le_result_t FlashApiTest_DumpUbi(char **args);
@@ -78,6 +79,9 @@ static FlashApiTest_t FlashApiTest[] =
     { "flash-erase",    2, FlashApiTest_FlashErase,
       "flash-erase paritionName fileName: flash the file into the given"
            " partition and erase remaining blocks",                             },
+    { "flash-stream",   2, FlashApiTest_FlashStream,
+      "flash-stream paritionName fileName: stream the file into the given"
+           " partition, skipping unchanged blocks",                             },
     { "copy",           2, FlashApiTest_Copy,
       "copy sourceName destinationName: copy in raw the source to the"
            " destination",                                                      },
@@ -525,6 +529,63 @@ static le_result_t FlashApiTest_FlashErase
 }
 //! [FlashErase]
 
+//! [FlashStream]
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stream a file into a MTD partition. Blocks already holding the file content are not written.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FlashApiTest_FlashStream
+(
+    char **args
+)
+{
+    const char *partNameStr = args[0];
+    const char *fromFile = args[1];
+    le_flash_PartitionRef_t partRef = NULL;
+    le_result_t res;
+    uint32_t skippedBlock, writtenBlock, writeBadBlock;
+    int fromFd;
+
+    fromFd = open(fromFile, O_RDONLY);
+    if (-1 == fromFd)
+    {
+        LE_ERROR("Failed to open '%s': %m", fromFile);
+        return LE_FAULT;
+    }
+
+    // Open the given MTD partition in R/W: blocks are read back to be compared
+    res = le_flash_OpenMtd(partNameStr, LE_FLASH_READ_WRITE, &partRef);
+    LE_INFO("partition \"%s\" open ref %p, res %d", partNameStr, partRef, res);
+    if (LE_OK != res)
+    {
+        close(fromFd);
+        return res;
+    }
+
+    // The whole file is written from the block 0. The file descriptor is closed by the service.
+    res = le_flash_WriteFromFd(partRef, fromFd, 0, &skippedBlock, &writtenBlock, &writeBadBlock);
+    if (LE_OK != res)
+    {
+        LE_ERROR("le_flash_WriteFromFd failed: %d", res);
+        le_flash_Close(partRef);
+        return res;
+    }
+    LE_INFO("Written %u blocks, skipped %u blocks to partition \"%s\"",
+            writtenBlock, skippedBlock, partNameStr);
+    if (writeBadBlock)
+    {
+        LE_ERROR("New bad blocks marked during write: %u", writeBadBlock);
+    }
+
+    // Close the MTD
+    res = le_flash_Close(partRef);
+    LE_INFO("partition \"%s\" close ref %p, res %d", partNameStr, partRef, res);
+    return res;
+}
+//! [FlashStream]
+
 //! [Copy]
 //--------------------------------------------------------------------------------------------------
 /**
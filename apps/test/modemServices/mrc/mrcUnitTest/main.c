@@ -199,6 +199,21 @@ le_msg_SessionEventHandlerRef_t le_msg_AddServiceCloseHandler
     return NULL;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of indications queued for each session of a service.
+ * (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceTxQueueLimit
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      maxCount,   ///< [in] Maximum number of queued indications.
+    le_msg_TxOverflowPolicy_t   policy      ///< [in] What to do when the limit is reached.
+)
+{
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MRC Power Tests
@@ -440,6 +455,8 @@ void Testle_mrc_BandPreferences
  *  - le_mrc_SetManualRegisterMode()
  *  - le_mrc_GetRegisterMode()
  *  - le_mrc_GetCurrentNetworkName()
+ *  - le_mrc_GetCachedCurrentNetworkName()
+ *  - le_mrc_GetCachedNeighborCellsInfo()
  *  - le_mrc_GetNetRegState()
  */
 //--------------------------------------------------------------------------------------------------
@@ -454,6 +471,7 @@ void Testle_mrc_RegisterTest
     char mncStr[LE_MRC_MNC_BYTES] = {0};
     bool isManualOrigin, isManual;
     char nameStr[100] = {0};
+    char cachedNameStr[100] = {0};
     le_mrc_NetRegState_t value;
     le_mrc_NeighborCellsRef_t ngbrRef;
 
@@ -509,6 +527,14 @@ void Testle_mrc_RegisterTest
 
     ngbrRef = le_mrc_GetNeighborCellsInfo();
     LE_ASSERT(!ngbrRef);
+
+    // Cached information
+    LE_ASSERT(le_mrc_GetCachedCurrentNetworkName(10000, cachedNameStr, 1) == LE_OVERFLOW);
+    LE_ASSERT(le_mrc_GetCachedCurrentNetworkName(10000, cachedNameStr, 100) == LE_OK);
+    LE_ASSERT(strcmp(nameStr, cachedNameStr) == 0);
+
+    ngbrRef = le_mrc_GetCachedNeighborCellsInfo(10000);
+    LE_ASSERT(!ngbrRef);
 }
 
 //--------------------------------------------------------------------------------------------------
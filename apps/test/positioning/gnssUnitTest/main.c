@@ -11,6 +11,9 @@
 #include "pa_gnss_simu.h"
 #include "le_gnss_local.h"
 #include "le_log.h"
+#include "nmeaFanout.h"
+
+#include <sys/socket.h>
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -58,6 +61,16 @@
 //--------------------------------------------------------------------------------------------------
 #define SUPL_CERTIFICATE_ID          0x69
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * NMEA streams test: maximum length of a sentence, size of the read buffer, and number of GSV
+ * sentences of the epochs written to the slow reader.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_SENTENCE_TEST_LEN       100
+#define NMEA_STREAM_TEST_BUFFER_LEN  8192
+#define NMEA_STREAM_TEST_GSV_COUNT   40
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Maintain the certificate.
@@ -616,6 +629,22 @@ static void GnssPositionHandlerFunction
     LE_ASSERT((LE_OK == result) || (LE_OUT_OF_RANGE == result));
     LE_ASSERT(LE_FAULT == (le_gnss_GetDop(GnssPositionSampleRef, &hdopPtr, &vdopPtr, &pdopPtr)));
 
+    // Get the position snapshot, it must match the individual getters
+    le_gnss_PositionSnapshot_t snapshot;
+    LE_ASSERT_OK(le_gnss_GetPositionSnapshot(positionSampleRef,
+                                             LE_GNSS_SNAPSHOT_LOCATION | LE_GNSS_SNAPSHOT_DOP,
+                                             &snapshot));
+    LE_ASSERT(LE_GNSS_POSITION_SNAPSHOT_VERSION == snapshot.version);
+    LE_ASSERT(state == snapshot.fixState);
+    LE_ASSERT(0 == (snapshot.validFields & ~(LE_GNSS_SNAPSHOT_LOCATION | LE_GNSS_SNAPSHOT_DOP)));
+    LE_ASSERT(latitude == snapshot.latitude);
+    LE_ASSERT(longitude == snapshot.longitude);
+    LE_ASSERT(hAccuracy == snapshot.hAccuracy);
+    LE_ASSERT(0 == snapshot.hSpeed);
+    // Pass invalid sample reference
+    LE_ASSERT(LE_FAULT == (le_gnss_GetPositionSnapshot(GnssPositionSampleRef,
+                                                       LE_GNSS_SNAPSHOT_LOCATION, &snapshot)));
+
     // Satellites status
     uint8_t satsInViewCount;
     uint8_t satsTrackingCount;
@@ -1195,6 +1224,176 @@ static void Testle_gnss_GetLeapSeconds
     LE_ASSERT(nextLeapSec == INT32_MAX);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test: NMEA streams error cases
+ * Tested API: le_gnss_OpenNmeaStream, le_gnss_GetNmeaStreamDropCount
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_gnss_NmeaStream
+(
+    void
+)
+{
+    int streamFd = 0;
+    uint32_t dropCount;
+
+    LE_ASSERT(NULL == le_gnss_OpenNmeaStream(LE_GNSS_NMEA_MASK_GPGGA, NULL));
+    LE_ASSERT(NULL == le_gnss_OpenNmeaStream(~LE_GNSS_NMEA_SENTENCES_MAX, &streamFd));
+    LE_ASSERT(-1 == streamFd);
+
+    LE_ASSERT(LE_BAD_PARAMETER == le_gnss_GetNmeaStreamDropCount(NULL, &dropCount));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Feed one fix epoch to the NMEA flow distribution: a GGA and an RMC sentence carrying the epoch
+ * time, and satellite sentences which do not carry it.
+ *
+ * @return Number of sentences fed.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t FeedNmeaEpoch
+(
+    uint32_t epoch,             ///< [IN] Epoch number, giving the UTC time of the fix.
+    uint32_t gsvCount           ///< [IN] Number of GSV sentences in the epoch.
+)
+{
+    char sentence[NMEA_SENTENCE_TEST_LEN];
+    uint32_t i;
+
+    snprintf(sentence, sizeof(sentence),
+             "$GPGGA,%06" PRIu32 ".00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47",
+             epoch);
+    nmeaFanout_AddSentence(sentence);
+
+    for (i = 0; i < gsvCount; i++)
+    {
+        snprintf(sentence, sizeof(sentence),
+                 "$GPGSV,%" PRIu32 ",%" PRIu32 ",12,01,40,083,46,02,17,308,41,12,07,344,39*75",
+                 gsvCount, i + 1);
+        nmeaFanout_AddSentence(sentence);
+    }
+
+    snprintf(sentence, sizeof(sentence),
+             "$GPRMC,%06" PRIu32 ".00,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A",
+             epoch);
+    nmeaFanout_AddSentence(sentence);
+
+    return gsvCount + 2;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test: NMEA streams batching and slow reader
+ * Tested API: le_gnss_OpenNmeaStream, le_gnss_GetNmeaStreamDropCount, le_gnss_CloseNmeaStream
+ *
+ * The sentences of an epoch are written to a stream at once when the next epoch starts, filtered
+ * by the stream sentence filter. A reader which does not read its stream gets whole epochs
+ * dropped and counted, without affecting the other streams.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Testle_gnss_NmeaStreamFanout
+(
+    void
+)
+{
+    le_gnss_NmeaStreamRef_t ggaStreamRef;
+    le_gnss_NmeaStreamRef_t allStreamRef;
+    int ggaFd;
+    int allFd;
+    char buffer[NMEA_STREAM_TEST_BUFFER_LEN];
+    char expected[NMEA_STREAM_TEST_BUFFER_LEN];
+    char ggaSentence[NMEA_SENTENCE_TEST_LEN];
+    char rmcSentence[NMEA_SENTENCE_TEST_LEN];
+    size_t ggaLen;
+    size_t rmcLen;
+    ssize_t readLen;
+    uint32_t epochSentences;
+    uint32_t dropCount;
+    uint32_t epoch;
+
+    le_gnss_SetClientSimu(CLIENT1);
+
+    ggaStreamRef = le_gnss_OpenNmeaStream(LE_GNSS_NMEA_MASK_GPGGA | LE_GNSS_NMEA_MASK_GPRMC,
+                                          &ggaFd);
+    LE_ASSERT(NULL != ggaStreamRef);
+    LE_ASSERT(-1 != ggaFd);
+    allStreamRef = le_gnss_OpenNmeaStream(0, &allFd);
+    LE_ASSERT(NULL != allStreamRef);
+    LE_ASSERT(-1 != allFd);
+
+    // The new epoch writes the sentences gathered before the streams were opened, if any: discard
+    // them. The sentences of the new epoch are not written before it ends.
+    FeedNmeaEpoch(120000, 2);
+    (void)recv(ggaFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    (void)recv(allFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    LE_ASSERT(-1 == recv(ggaFd, buffer, sizeof(buffer), MSG_DONTWAIT));
+    LE_ASSERT(EAGAIN == errno);
+    LE_ASSERT(-1 == recv(allFd, buffer, sizeof(buffer), MSG_DONTWAIT));
+    LE_ASSERT(EAGAIN == errno);
+
+    // The first sentence of the next epoch writes the previous one.
+    FeedNmeaEpoch(120001, 2);
+
+    // The filtered stream receives GGA and RMC only, null terminators included.
+    snprintf(ggaSentence, sizeof(ggaSentence),
+             "$GPGGA,%06d.00,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47", 120000);
+    snprintf(rmcSentence, sizeof(rmcSentence),
+             "$GPRMC,%06d.00,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A", 120000);
+    ggaLen = strlen(ggaSentence) + 1;
+    rmcLen = strlen(rmcSentence) + 1;
+    memcpy(expected, ggaSentence, ggaLen);
+    memcpy(expected + ggaLen, rmcSentence, rmcLen);
+
+    readLen = recv(ggaFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    LE_ASSERT((ssize_t)(ggaLen + rmcLen) == readLen);
+    LE_ASSERT(0 == memcmp(buffer, expected, readLen));
+
+    // The unfiltered stream receives the whole epoch in order.
+    readLen = recv(allFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+    LE_ASSERT(readLen > (ssize_t)(ggaLen + rmcLen));
+    LE_ASSERT(0 == memcmp(buffer, ggaSentence, ggaLen));
+    LE_ASSERT(0 == memcmp(buffer + readLen - rmcLen, rmcSentence, rmcLen));
+    LE_ASSERT(NULL != memmem(buffer, readLen, "$GPGSV,2,2,", strlen("$GPGSV,2,2,")));
+
+    // The unfiltered stream is not read anymore: its socket buffer and its queue fill up, then
+    // whole epochs are dropped. The filtered stream, read after every epoch, loses nothing.
+    LE_ASSERT_OK(le_gnss_GetNmeaStreamDropCount(allStreamRef, &dropCount));
+    LE_ASSERT(0 == dropCount);
+
+    for (epoch = 120002; (epoch < 130000) && (0 == dropCount); epoch++)
+    {
+        epochSentences = FeedNmeaEpoch(epoch, NMEA_STREAM_TEST_GSV_COUNT);
+
+        readLen = recv(ggaFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        LE_ASSERT((ssize_t)(ggaLen + rmcLen) == readLen);
+
+        LE_ASSERT_OK(le_gnss_GetNmeaStreamDropCount(allStreamRef, &dropCount));
+    }
+    LE_ASSERT(0 != dropCount);
+    LE_ASSERT(0 == (dropCount % epochSentences));
+    LE_INFO("Slow NMEA reader dropped %" PRIu32 " sentences after %" PRIu32 " epochs",
+            dropCount, epoch - 120002);
+
+    LE_ASSERT_OK(le_gnss_GetNmeaStreamDropCount(ggaStreamRef, &dropCount));
+    LE_ASSERT(0 == dropCount);
+
+    // Only the session which opened a stream can use it.
+    le_gnss_SetClientSimu(CLIENT2);
+    LE_ASSERT(LE_BAD_PARAMETER == le_gnss_GetNmeaStreamDropCount(allStreamRef, &dropCount));
+    le_gnss_SetClientSimu(CLIENT1);
+
+    le_gnss_CloseNmeaStream(ggaStreamRef);
+    le_gnss_CloseNmeaStream(allStreamRef);
+    LE_ASSERT(LE_BAD_PARAMETER == le_gnss_GetNmeaStreamDropCount(allStreamRef, &dropCount));
+
+    // The service side is closed.
+    LE_ASSERT(0 == recv(ggaFd, buffer, sizeof(buffer), MSG_DONTWAIT));
+    close(ggaFd);
+    close(allFd);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * main of the test
@@ -1250,6 +1449,12 @@ COMPONENT_INIT
     LE_INFO("======== GNSS LeapSeconds ========");
     Testle_gnss_GetLeapSeconds();
 
+    LE_INFO("======== GNSS NMEA streams ========");
+    Testle_gnss_NmeaStream();
+
+    LE_INFO("======== GNSS NMEA streams fan-out ========");
+    Testle_gnss_NmeaStreamFanout();
+
     LE_INFO("======== GNSS Remove Position Handler========");
     Testle_gnss_RemoveHandlers();
 
@@ -72,6 +72,21 @@ le_msg_SessionEventHandlerRef_t MyAddServiceCloseHandler
     return NULL;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of indications queued for each session of a service.
+ * (STUBBED FUNCTION)
+ */
+//--------------------------------------------------------------------------------------------------
+void MySetServiceTxQueueLimit
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      maxCount,   ///< [in] Maximum number of queued indications.
+    le_msg_TxOverflowPolicy_t   policy      ///< [in] What to do when the limit is reached.
+)
+{
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Get the server service reference
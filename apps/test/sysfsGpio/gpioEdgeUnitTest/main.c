@@ -0,0 +1,295 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unit test of the edge filter of the sysfs GPIO service: edge trigger, lost pulses, debouncing
+ * and batching.  The interrupts are simulated by reporting the pin states directly to the filter.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "gpioSysfsEdge.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Debounce time of the debouncing test (us), and time waited for it to expire (ms).
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEBOUNCE_US         20000
+#define DEBOUNCE_WAIT_MS    100
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch period of the batching test (ms), and time waited for it to expire (ms).
+ */
+//--------------------------------------------------------------------------------------------------
+#define BATCH_PERIOD_MS     50
+#define BATCH_WAIT_MS       150
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Last batch delivered by the filter under test.
+ */
+//--------------------------------------------------------------------------------------------------
+static gpioSysfs_EdgeEvent_t BatchEvents[GPIOSYSFS_MAX_EDGE_BATCH];
+static size_t BatchEventCount;
+static uint32_t BatchDroppedCount;
+static int BatchCount;              ///< Number of batches delivered since the last reset
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Filter under test, and timer waiting for its timers to expire.
+ */
+//--------------------------------------------------------------------------------------------------
+static gpioSysfsEdge_FilterRef_t FilterRef;
+static le_timer_Ref_t WaitTimer;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Edge batch handler: records the batch.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EdgeBatchHandler
+(
+    const gpioSysfs_EdgeEvent_t* eventsPtr,
+    size_t eventsCount,
+    uint32_t droppedCount,
+    void* contextPtr
+)
+{
+    LE_ASSERT(eventsCount <= GPIOSYSFS_MAX_EDGE_BATCH);
+
+    memcpy(BatchEvents, eventsPtr, eventsCount * sizeof(gpioSysfs_EdgeEvent_t));
+    BatchEventCount = eventsCount;
+    BatchDroppedCount = droppedCount;
+    BatchCount++;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forget the batches delivered so far.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResetBatch
+(
+    void
+)
+{
+    BatchEventCount = 0;
+    BatchDroppedCount = 0;
+    BatchCount = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for the timers of the filter under test, then call a check function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WaitThen
+(
+    uint32_t ms,
+    le_timer_ExpiryHandler_t checkFunc
+)
+{
+    LE_ASSERT_OK(le_timer_SetMsInterval(WaitTimer, ms));
+    LE_ASSERT_OK(le_timer_SetHandler(WaitTimer, checkFunc));
+    LE_ASSERT_OK(le_timer_Start(WaitTimer));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Without debouncing and batching, each change of state is delivered at once and a state read
+ * twice accounts for a lost pulse.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestBothEdges
+(
+    void
+)
+{
+    LE_TEST_INFO("Both edges, no debouncing, no batching");
+
+    FilterRef = gpioSysfsEdge_Create("gpioTest", false, SYSFS_EDGE_SENSE_BOTH, 0, 0,
+                                     EdgeBatchHandler, NULL);
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, true, 1000);
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 1) && (BatchDroppedCount == 0),
+               "rising edge delivered at once");
+    LE_TEST_OK((BatchEvents[0].edge == SYSFS_EDGE_SENSE_RISING) &&
+               (BatchEvents[0].timestampNs == 1000), "rising edge and its time");
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, false, 2000);
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 1) &&
+               (BatchEvents[0].edge == SYSFS_EDGE_SENSE_FALLING), "falling edge delivered");
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, false, 3000);
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 0) && (BatchDroppedCount == 2),
+               "lost pulse accounted as two dropped edges");
+
+    gpioSysfsEdge_Delete(FilterRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Only the requested edge is delivered.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestRisingEdge
+(
+    void
+)
+{
+    LE_TEST_INFO("Rising edge only");
+
+    FilterRef = gpioSysfsEdge_Create("gpioTest", false, SYSFS_EDGE_SENSE_RISING, 0, 0,
+                                     EdgeBatchHandler, NULL);
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, true, 1000);
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 1) &&
+               (BatchEvents[0].edge == SYSFS_EDGE_SENSE_RISING), "rising edge delivered");
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, false, 2000);
+    LE_TEST_OK(BatchCount == 0, "falling edge filtered out");
+
+    gpioSysfsEdge_Report(FilterRef, false, 3000);
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 0) && (BatchDroppedCount == 1),
+               "lost pulse accounted as one dropped rising edge");
+
+    gpioSysfsEdge_Delete(FilterRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the end of the batching test: the edges were delivered together.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckBatchPeriod
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 3), "edges delivered in one batch");
+    LE_TEST_OK((BatchEvents[0].timestampNs == 1000) && (BatchEvents[2].timestampNs == 3000),
+               "edges delivered oldest first");
+
+    gpioSysfsEdge_Delete(FilterRef);
+    LE_TEST_EXIT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Edges are held for the batch period, unless the batch is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestBatching
+(
+    void
+)
+{
+    int i;
+
+    LE_TEST_INFO("Batching");
+
+    FilterRef = gpioSysfsEdge_Create("gpioTest", false, SYSFS_EDGE_SENSE_BOTH, 0,
+                                     BATCH_PERIOD_MS, EdgeBatchHandler, NULL);
+
+    ResetBatch();
+    for (i = 0; i < GPIOSYSFS_MAX_EDGE_BATCH; i++)
+    {
+        gpioSysfsEdge_Report(FilterRef, (i % 2) == 0, i);
+    }
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == GPIOSYSFS_MAX_EDGE_BATCH),
+               "full batch delivered at once");
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, true, 1000);
+    gpioSysfsEdge_Report(FilterRef, false, 2000);
+    gpioSysfsEdge_Report(FilterRef, true, 3000);
+    LE_TEST_OK(BatchCount == 0, "edges held for the batch period");
+
+    WaitThen(BATCH_WAIT_MS, CheckBatchPeriod);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the end of a glitch: it was filtered out.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckGlitch
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK(BatchCount == 0, "burst ending on the reported state filtered out");
+
+    gpioSysfsEdge_Delete(FilterRef);
+
+    TestBatching();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check the end of a bouncing edge: a single edge was delivered, with the time of the first one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckBounce
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_TEST_OK((BatchCount == 1) && (BatchEventCount == 1) && (BatchDroppedCount == 0),
+               "bouncing edge delivered once");
+    LE_TEST_OK((BatchEvents[0].edge == SYSFS_EDGE_SENSE_RISING) &&
+               (BatchEvents[0].timestampNs == 1000), "time of the first edge of the burst");
+
+    // A glitch: the pin goes back to the reported state within the debounce time.
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, false, 5000);
+    gpioSysfsEdge_Report(FilterRef, true, 6000);
+
+    WaitThen(DEBOUNCE_WAIT_MS, CheckGlitch);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A change of state is only delivered once the pin is stable for the debounce time.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestDebounce
+(
+    void
+)
+{
+    LE_TEST_INFO("Debouncing");
+
+    FilterRef = gpioSysfsEdge_Create("gpioTest", false, SYSFS_EDGE_SENSE_BOTH, DEBOUNCE_US, 0,
+                                     EdgeBatchHandler, NULL);
+
+    ResetBatch();
+    gpioSysfsEdge_Report(FilterRef, true, 1000);
+    gpioSysfsEdge_Report(FilterRef, false, 2000);
+    gpioSysfsEdge_Report(FilterRef, true, 3000);
+    LE_TEST_OK(BatchCount == 0, "edges held for the debounce time");
+
+    WaitThen(DEBOUNCE_WAIT_MS, CheckBounce);
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+
+    gpioSysfsEdge_Init();
+    WaitTimer = le_timer_Create("gpioEdgeTestWait");
+
+    TestBothEdges();
+    TestRisingEdge();
+    TestDebounce();
+}
@@ -64,6 +64,10 @@ static union
     {
         uint32_t num;
     } bootReasonAdc;
+    struct
+    {
+        uint32_t thresholdMs;
+    } holdTimeWarning;
 } Params;
 
 
@@ -91,6 +95,8 @@ static void PrintHelp
                 pmtool bootReason timer\n\
                 pmtool bootReason adc <adcNum>\n\
                 pmtool query\n\
+                pmtool stats\n\
+                pmtool warn <holdTimeMs>\n\
             \n\
             DESCRIPTION:\n\
                 pmtool help\n\
@@ -127,6 +133,14 @@ static void PrintHelp
             \n\
                 pmtool query\n\
                   - Query the current ultra-low power manager firmware version.\n\
+            \n\
+                pmtool stats\n\
+                  - Print the statistics of the wakeup sources: current holders, number of\n\
+                    acquisitions, total and maximum hold time in milliseconds.\n\
+            \n\
+                pmtool warn <holdTimeMs>\n\
+                  - Log a warning when a wakeup source is held longer than holdTimeMs\n\
+                    milliseconds. 0 disables the warnings.\n\
             \n\
                 For all bootReason subcommands, the exit code of the program is 0 if the given\n\
                 boot source was the reason the system booted or 2 otherwise.\n\
@@ -309,6 +323,70 @@ static void QueryVersion
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Print the wakeup source statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintStats
+(
+    void
+)
+{
+    char name[LE_PM_NAME_LEN_BYTES];
+    uint32_t heldCount, holders, acquireCount, maxHoldTimeMs, currentHoldTimeMs;
+    uint64_t totalHoldTimeMs;
+    uint32_t index;
+
+    if (le_pm_GetStats(&heldCount, &acquireCount, &totalHoldTimeMs) != LE_OK)
+    {
+        fprintf(stderr, "Failed to get the power manager statistics\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("Wakeup sources held: %" PRIu32 ", system kept awake %" PRIu32 " times for %" PRIu64
+           " ms\n\n", heldCount, acquireCount, totalHoldTimeMs);
+
+    printf("%-50s %7s %9s %12s %10s %10s\n",
+           "NAME", "HOLDERS", "ACQUIRED", "TOTAL(ms)", "MAX(ms)", "HELD(ms)");
+
+    for (index = 0;
+         le_pm_GetWakeupSourceStats(index, name, sizeof(name), &holders, &acquireCount,
+                                    &totalHoldTimeMs, &maxHoldTimeMs,
+                                    &currentHoldTimeMs) == LE_OK;
+         index++)
+    {
+        printf("%-50s %7" PRIu32 " %9" PRIu32 " %12" PRIu64 " %10" PRIu32 " %10" PRIu32 "\n",
+               name, holders, acquireCount, totalHoldTimeMs, maxHoldTimeMs, currentHoldTimeMs);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the wakeup source hold time warning threshold.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetHoldTimeWarning
+(
+    void
+)
+{
+    if (le_pm_SetHoldTimeWarning(Params.holdTimeWarning.thresholdMs) == LE_OK)
+    {
+        printf("SUCCESS!\n");
+        exit(EXIT_SUCCESS);
+    }
+    else
+    {
+        fprintf(stderr, "FAILED.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Initiate shutdown of MDM.
@@ -615,6 +693,24 @@ static void PosArgCbCheckAdcNum
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse the holdTimeMs argument of the "pmtool warn <holdTimeMs>" command.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PosArgCbSetHoldTimeWarning
+(
+    const char* arg
+)
+{
+    if (!ParseU32(arg, &Params.holdTimeWarning.thresholdMs))
+    {
+        fprintf(stderr, "Couldn't parse a hold time from \"%s\".\n", arg);
+        exit(EXIT_FAILURE);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Callback function to set boot source depending on command line arguments.
@@ -710,6 +806,15 @@ static void SetCommandHandler
     {
         CommandHandler = QueryVersion;
     }
+    else if (strcmp(argPtr, "stats") == 0)
+    {
+        CommandHandler = PrintStats;
+    }
+    else if (strcmp(argPtr, "warn") == 0)
+    {
+        CommandHandler = SetHoldTimeWarning;
+        le_arg_AddPositionalCallback(PosArgCbSetHoldTimeWarning);
+    }
     else
     {
         fprintf(stderr, "Unknown command: %s.\n", argPtr);
@@ -17,6 +17,7 @@
 #include "pa_avc.h"
 #include "avcUpdateShared.h"
 #include "avcFrameworkUpdate.h"
+#include "packageDecoder.h"
 
 
 
@@ -1269,13 +1270,27 @@ static void StartInstall
 //--------------------------------------------------------------------------------------------------
 {
     int firmwareFd;
+    int updateFd;
     LE_DEBUG("Install application from SWI FOTA.");
 
     le_result_t result = pa_avc_ReadImage(&firmwareFd);
 
     if (result == LE_OK)
     {
-        if (le_update_Start(firmwareFd) != LE_OK)
+        off_t resumeOffset;
+
+        // pa_avc hands over whole packages and can't resume a download from an offset: a package
+        // whose previous decoding was interrupted is decoded again from the start.
+        if ((packageDecoder_GetResumeOffset(firmwareFd, PACKAGE_CHECKPOINT_FILE, &resumeOffset)
+             == LE_OK) && (resumeOffset > 0))
+        {
+            LE_INFO("Package matches its checkpoints up to offset %jd, restarting from the start",
+                    (intmax_t)resumeOffset);
+        }
+
+        if ((packageDecoder_Start(firmwareFd, PACKAGE_CHECKPOINT_FILE, NULL, NULL, &updateFd)
+             != LE_OK)
+            || (le_update_Start(updateFd) != LE_OK))
         {
             LE_ERROR("Could not start update.");
             SetObj9State(CurrentObj9, US_INITIAL, UR_INSTALLATION_FAILURE, true);
@@ -20,6 +20,7 @@
 #include "avcUpdateShared.h"
 #include "avcUpdateShared.h"
 #include "avcFrameworkUpdate.h"
+#include "packageDecoder.h"
 
 
 
@@ -488,11 +489,25 @@ static void StartInstall
     LE_DEBUG("Install system update from SWI FOTA.");
 
     int firmwareFd;
+    int updateFd;
     le_result_t result = pa_avc_ReadImage(&firmwareFd);
 
     if (result == LE_OK)
     {
-        if (le_update_Start(firmwareFd) != LE_OK)
+        off_t resumeOffset;
+
+        // pa_avc hands over whole packages and can't resume a download from an offset: a package
+        // whose previous decoding was interrupted is decoded again from the start.
+        if ((packageDecoder_GetResumeOffset(firmwareFd, PACKAGE_CHECKPOINT_FILE, &resumeOffset)
+             == LE_OK) && (resumeOffset > 0))
+        {
+            LE_INFO("Package matches its checkpoints up to offset %jd, restarting from the start",
+                    (intmax_t)resumeOffset);
+        }
+
+        if ((packageDecoder_Start(firmwareFd, PACKAGE_CHECKPOINT_FILE, NULL, NULL, &updateFd)
+             != LE_OK)
+            || (le_update_Start(updateFd) != LE_OK))
         {
             LE_ERROR("Could not start update.");
 
@@ -35,6 +35,16 @@
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Checkpoint file of the last package whose decoding was interrupted.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PACKAGE_CHECKPOINT_FILE "/data/avc/packageCheckpoints"
+
+
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Called to register lwm2m object and field event handlers.
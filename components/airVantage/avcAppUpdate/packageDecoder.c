@@ -0,0 +1,905 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file packageDecoder.c
+ *
+ * Decoding stage of the packages downloaded by the AirVantage connector.
+ *
+ * The first bytes of the package are read from an fd monitor handler to detect its format. The
+ * package is then read by a dedicated thread which decodes it and writes the result to a pipe
+ * read by the update daemon. Decoding a package in a thread keeps the event loop of the
+ * AirVantage connector free while a large package is fed to the update daemon.
+ *
+ * The decoder thread also records the chunk checkpoints of the package. Checkpoint file layout: a
+ * CheckpointHeader_t followed by the CRC-32 of each complete chunk of the package, in package
+ * order. The CRC of the last, incomplete, chunk is not recorded.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "packageDecoder.h"
+
+#include <signal.h>
+#include <zlib.h>
+#include <bzlib.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of bytes needed to detect the package format.
+ */
+//--------------------------------------------------------------------------------------------------
+#define HEADER_BYTES            3
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the input and output buffers of the decoder.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DECODER_BUFFER_SIZE     (16 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checkpoint file signature ("PKCP").
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHECKPOINT_MAGIC        0x504B4350
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * zlib window size: maximum window, with automatic zlib or gzip header detection.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ZLIB_WINDOW_BITS        (15 + 32)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header of the checkpoint file.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;             ///< CHECKPOINT_MAGIC
+    uint32_t chunkSize;         ///< Size of the chunks covered by a checkpoint
+}
+CheckpointHeader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Package decoder.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int inFd;                           ///< Package, as downloaded
+    int outFd;                          ///< Decoded package
+    le_fdMonitor_Ref_t monitorRef;      ///< Monitor of the package, until the format is detected
+    packageDecoder_FormatHandlerFunc_t handlerFunc; ///< Format detection handler, may be NULL
+    void* handlerContextPtr;            ///< Context of the format detection handler
+    char checkpointPath[PATH_MAX];      ///< Checkpoint file, empty if not recorded
+    int checkpointFd;                   ///< Checkpoint file, -1 if not recorded
+    packageDecoder_Format_t format;     ///< Package format
+    bool streamEnded;                   ///< End of the compressed stream reached
+    uint32_t chunkCrc;                  ///< CRC-32 of the current chunk
+    size_t chunkFill;                   ///< Bytes of the current chunk received so far
+    uint64_t inSize;                    ///< Bytes of package read
+    uint64_t outSize;                   ///< Bytes of decoded package written
+    union
+    {
+        z_stream zlib;                  ///< zlib stream
+        bz_stream bzip2;                ///< bzip2 stream
+    }
+    stream;
+    size_t headerLen;                   ///< Bytes read to detect the format
+    uint8_t header[HEADER_BYTES];       ///< First bytes of the package
+    uint8_t inBuf[DECODER_BUFFER_SIZE]; ///< Input buffer
+    uint8_t outBuf[DECODER_BUFFER_SIZE];///< Output buffer
+}
+Decoder_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of decoders.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t DecoderPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read up to size bytes, stopping only at end of file.
+ *
+ * @return Number of bytes read, -1 on error.
+ */
+//--------------------------------------------------------------------------------------------------
+static ssize_t ReadFull
+(
+    int fd,                     ///< [IN] File descriptor
+    void* bufPtr,               ///< [OUT] Buffer
+    size_t size                 ///< [IN] Number of bytes to read
+)
+{
+    size_t total = 0;
+
+    while (total < size)
+    {
+        ssize_t count = read(fd, (uint8_t*)bufPtr + total, size - total);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return -1;
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        total += count;
+    }
+
+    return total;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a whole buffer.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteAll
+(
+    int fd,                     ///< [IN] File descriptor
+    const void* bufPtr,         ///< [IN] Buffer
+    size_t size                 ///< [IN] Number of bytes to write
+)
+{
+    const uint8_t* dataPtr = bufPtr;
+
+    while (size > 0)
+    {
+        ssize_t count = write(fd, dataPtr, size);
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return LE_FAULT;
+        }
+        dataPtr += count;
+        size -= count;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Detect the package format from its first bytes.
+ *
+ * @return The package format.
+ */
+//--------------------------------------------------------------------------------------------------
+static packageDecoder_Format_t DetectFormat
+(
+    const uint8_t* headerPtr,   ///< [IN] First bytes of the package
+    size_t headerLen            ///< [IN] Number of bytes
+)
+{
+    if (headerLen < 2)
+    {
+        return PACKAGE_FORMAT_RAW;
+    }
+
+    // gzip member
+    if ((headerPtr[0] == 0x1F) && (headerPtr[1] == 0x8B))
+    {
+        return PACKAGE_FORMAT_ZLIB;
+    }
+
+    // zlib stream: deflate method and header check bits (RFC 1950)
+    if (((headerPtr[0] & 0x0F) == Z_DEFLATED) &&
+        ((((headerPtr[0] << 8) | headerPtr[1]) % 31) == 0))
+    {
+        return PACKAGE_FORMAT_ZLIB;
+    }
+
+    if ((headerLen == HEADER_BYTES) && (memcmp(headerPtr, "BZh", HEADER_BYTES) == 0))
+    {
+        return PACKAGE_FORMAT_BZIP2;
+    }
+
+    return PACKAGE_FORMAT_RAW;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the checkpoint file and write its header.
+ *
+ * @return The file descriptor, -1 on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+static int OpenCheckpoints
+(
+    const char* pathPtr         ///< [IN] Checkpoint file
+)
+{
+    CheckpointHeader_t header = { .magic = CHECKPOINT_MAGIC,
+                                  .chunkSize = PACKAGE_DECODER_CHUNK_SIZE };
+    char dirPath[PATH_MAX];
+    int fd;
+
+    if ((le_path_GetDir(pathPtr, "/", dirPath, sizeof(dirPath)) == LE_OK) &&
+        (le_dir_MakePath(dirPath, S_IRWXU) != LE_OK))
+    {
+        LE_WARN("Unable to create checkpoint directory '%s'", dirPath);
+        return -1;
+    }
+
+    do
+    {
+        fd = open(pathPtr, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    }
+    while ((fd < 0) && (errno == EINTR));
+
+    if (fd < 0)
+    {
+        LE_WARN("Unable to open checkpoint file '%s': %m", pathPtr);
+        return -1;
+    }
+
+    if (WriteAll(fd, &header, sizeof(header)) != LE_OK)
+    {
+        LE_WARN("Unable to write checkpoint file '%s': %m", pathPtr);
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Account for package bytes in the chunk checkpoints.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RecordCheckpoints
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    const uint8_t* dataPtr,     ///< [IN] Package bytes
+    size_t len                  ///< [IN] Number of bytes
+)
+{
+    while (len > 0)
+    {
+        size_t count = PACKAGE_DECODER_CHUNK_SIZE - decoderPtr->chunkFill;
+
+        if (count > len)
+        {
+            count = len;
+        }
+
+        decoderPtr->chunkCrc = crc32(decoderPtr->chunkCrc, dataPtr, count);
+        decoderPtr->chunkFill += count;
+        dataPtr += count;
+        len -= count;
+
+        if (decoderPtr->chunkFill == PACKAGE_DECODER_CHUNK_SIZE)
+        {
+            uint32_t crc = decoderPtr->chunkCrc;
+
+            if ((decoderPtr->checkpointFd >= 0) &&
+                (WriteAll(decoderPtr->checkpointFd, &crc, sizeof(crc)) != LE_OK))
+            {
+                LE_WARN("Unable to record checkpoint: %m");
+                close(decoderPtr->checkpointFd);
+                decoderPtr->checkpointFd = -1;
+            }
+
+            decoderPtr->chunkCrc = crc32(0, Z_NULL, 0);
+            decoderPtr->chunkFill = 0;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write decoded bytes to the output.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteOutput
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    const uint8_t* dataPtr,     ///< [IN] Decoded bytes
+    size_t len                  ///< [IN] Number of bytes
+)
+{
+    if (WriteAll(decoderPtr->outFd, dataPtr, len) != LE_OK)
+    {
+        LE_ERROR("Unable to write decoded package: %m");
+        return LE_FAULT;
+    }
+
+    decoderPtr->outSize += len;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the decompression stream.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t InitStream
+(
+    Decoder_t* decoderPtr       ///< [IN] Decoder
+)
+{
+    memset(&decoderPtr->stream, 0, sizeof(decoderPtr->stream));
+
+    switch (decoderPtr->format)
+    {
+        case PACKAGE_FORMAT_ZLIB:
+            if (inflateInit2(&decoderPtr->stream.zlib, ZLIB_WINDOW_BITS) != Z_OK)
+            {
+                LE_ERROR("Unable to initialize zlib stream");
+                return LE_FAULT;
+            }
+            break;
+
+        case PACKAGE_FORMAT_BZIP2:
+            if (BZ2_bzDecompressInit(&decoderPtr->stream.bzip2, 0, 0) != BZ_OK)
+            {
+                LE_ERROR("Unable to initialize bzip2 stream");
+                return LE_FAULT;
+            }
+            break;
+
+        case PACKAGE_FORMAT_RAW:
+            break;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the decompression stream.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndStream
+(
+    Decoder_t* decoderPtr       ///< [IN] Decoder
+)
+{
+    switch (decoderPtr->format)
+    {
+        case PACKAGE_FORMAT_ZLIB:
+            inflateEnd(&decoderPtr->stream.zlib);
+            break;
+
+        case PACKAGE_FORMAT_BZIP2:
+            BZ2_bzDecompressEnd(&decoderPtr->stream.bzip2);
+            break;
+
+        case PACKAGE_FORMAT_RAW:
+            break;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode zlib or gzip package bytes. Concatenated streams, such as multi-member gzip files, are
+ * decoded one after the other.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DecodeZlib
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    const uint8_t* dataPtr,     ///< [IN] Package bytes
+    size_t len                  ///< [IN] Number of bytes
+)
+{
+    z_stream* streamPtr = &decoderPtr->stream.zlib;
+
+    streamPtr->next_in = (Bytef*)dataPtr;
+    streamPtr->avail_in = len;
+
+    for (;;)
+    {
+        if (decoderPtr->streamEnded)
+        {
+            if (streamPtr->avail_in == 0)
+            {
+                return LE_OK;
+            }
+            inflateReset(streamPtr);
+            decoderPtr->streamEnded = false;
+        }
+
+        streamPtr->next_out = decoderPtr->outBuf;
+        streamPtr->avail_out = sizeof(decoderPtr->outBuf);
+
+        int ret = inflate(streamPtr, Z_NO_FLUSH);
+        if (ret == Z_STREAM_END)
+        {
+            decoderPtr->streamEnded = true;
+        }
+        else if ((ret != Z_OK) && (ret != Z_BUF_ERROR))
+        {
+            LE_ERROR("Corrupted zlib package at offset %" PRIu64 ": %d",
+                     decoderPtr->inSize, ret);
+            return LE_FAULT;
+        }
+
+        if (WriteOutput(decoderPtr, decoderPtr->outBuf,
+                        sizeof(decoderPtr->outBuf) - streamPtr->avail_out) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+
+        // Output buffer not filled: all the input has been consumed.
+        if ((!decoderPtr->streamEnded) && (streamPtr->avail_in == 0) &&
+            (streamPtr->avail_out != 0))
+        {
+            return LE_OK;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decode bzip2 package bytes. Concatenated streams are decoded one after the other.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t DecodeBzip2
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    const uint8_t* dataPtr,     ///< [IN] Package bytes
+    size_t len                  ///< [IN] Number of bytes
+)
+{
+    bz_stream* streamPtr = &decoderPtr->stream.bzip2;
+
+    streamPtr->next_in = (char*)dataPtr;
+    streamPtr->avail_in = len;
+
+    for (;;)
+    {
+        if (decoderPtr->streamEnded)
+        {
+            if (streamPtr->avail_in == 0)
+            {
+                return LE_OK;
+            }
+
+            // bzip2 has no reset, restart the stream on the remaining input.
+            char* nextInPtr = streamPtr->next_in;
+            unsigned int availIn = streamPtr->avail_in;
+
+            BZ2_bzDecompressEnd(streamPtr);
+            memset(streamPtr, 0, sizeof(*streamPtr));
+            if (BZ2_bzDecompressInit(streamPtr, 0, 0) != BZ_OK)
+            {
+                LE_ERROR("Unable to initialize bzip2 stream");
+                return LE_FAULT;
+            }
+            streamPtr->next_in = nextInPtr;
+            streamPtr->avail_in = availIn;
+            decoderPtr->streamEnded = false;
+        }
+
+        streamPtr->next_out = (char*)decoderPtr->outBuf;
+        streamPtr->avail_out = sizeof(decoderPtr->outBuf);
+
+        int ret = BZ2_bzDecompress(streamPtr);
+        if (ret == BZ_STREAM_END)
+        {
+            decoderPtr->streamEnded = true;
+        }
+        else if (ret != BZ_OK)
+        {
+            LE_ERROR("Corrupted bzip2 package at offset %" PRIu64 ": %d",
+                     decoderPtr->inSize, ret);
+            return LE_FAULT;
+        }
+
+        if (WriteOutput(decoderPtr, decoderPtr->outBuf,
+                        sizeof(decoderPtr->outBuf) - streamPtr->avail_out) != LE_OK)
+        {
+            return LE_FAULT;
+        }
+
+        // Output buffer not filled: all the input has been consumed.
+        if ((!decoderPtr->streamEnded) && (streamPtr->avail_in == 0) &&
+            (streamPtr->avail_out != 0))
+        {
+            return LE_OK;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Feed package bytes to the decoder.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t Decode
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    const uint8_t* dataPtr,     ///< [IN] Package bytes
+    size_t len                  ///< [IN] Number of bytes
+)
+{
+    le_result_t result = LE_OK;
+
+    RecordCheckpoints(decoderPtr, dataPtr, len);
+
+    switch (decoderPtr->format)
+    {
+        case PACKAGE_FORMAT_ZLIB:
+            result = DecodeZlib(decoderPtr, dataPtr, len);
+            break;
+
+        case PACKAGE_FORMAT_BZIP2:
+            result = DecodeBzip2(decoderPtr, dataPtr, len);
+            break;
+
+        case PACKAGE_FORMAT_RAW:
+            result = WriteOutput(decoderPtr, dataPtr, len);
+            break;
+    }
+
+    decoderPtr->inSize += len;
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decoder thread main function.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* DecoderThread
+(
+    void* contextPtr            ///< [IN] Decoder
+)
+{
+    Decoder_t* decoderPtr = contextPtr;
+    le_result_t result;
+    sigset_t sigSet;
+
+    // The update daemon may stop reading the package at any time: report it as a write error.
+    sigemptyset(&sigSet);
+    sigaddset(&sigSet, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigSet, NULL);
+
+    if (decoderPtr->checkpointPath[0] != '\0')
+    {
+        decoderPtr->checkpointFd = OpenCheckpoints(decoderPtr->checkpointPath);
+    }
+
+    result = Decode(decoderPtr, decoderPtr->header, decoderPtr->headerLen);
+
+    while (result == LE_OK)
+    {
+        ssize_t count = read(decoderPtr->inFd, decoderPtr->inBuf, sizeof(decoderPtr->inBuf));
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            LE_ERROR("Unable to read package: %m");
+            result = LE_FAULT;
+        }
+        else if (count == 0)
+        {
+            break;
+        }
+        else
+        {
+            result = Decode(decoderPtr, decoderPtr->inBuf, count);
+        }
+    }
+
+    if ((result == LE_OK) && (decoderPtr->format != PACKAGE_FORMAT_RAW) &&
+        (!decoderPtr->streamEnded))
+    {
+        LE_ERROR("Truncated package");
+        result = LE_FAULT;
+    }
+
+    if (result == LE_OK)
+    {
+        LE_INFO("Package decoded: %" PRIu64 " bytes -> %" PRIu64 " bytes",
+                decoderPtr->inSize, decoderPtr->outSize);
+    }
+
+    EndStream(decoderPtr);
+
+    if (decoderPtr->checkpointFd >= 0)
+    {
+        // Only the checkpoints of a package whose decoding was interrupted are kept.
+        if (result == LE_OK)
+        {
+            unlink(decoderPtr->checkpointPath);
+        }
+        else
+        {
+            LE_WARN_IF(fdatasync(decoderPtr->checkpointFd) != 0,
+                       "Unable to sync checkpoints: %m");
+        }
+        close(decoderPtr->checkpointFd);
+    }
+    close(decoderPtr->inFd);
+    close(decoderPtr->outFd);
+
+    le_mem_Release(decoderPtr);
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the result of the format detection to the user of the decoder.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportFormat
+(
+    Decoder_t* decoderPtr,      ///< [IN] Decoder
+    le_result_t result          ///< [IN] Result of the format detection
+)
+{
+    if (decoderPtr->handlerFunc != NULL)
+    {
+        decoderPtr->handlerFunc(result, decoderPtr->format, decoderPtr->handlerContextPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Package monitor handler: accumulate the first bytes of the package, then start the decoder
+ * thread once the format is known. A single read is done per event, so the event loop never
+ * waits for the package to be received.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HeaderHandler
+(
+    int fd,                     ///< [IN] Package file descriptor
+    short events                ///< [IN] Poll events
+)
+{
+    Decoder_t* decoderPtr = le_fdMonitor_GetContextPtr();
+    ssize_t count;
+
+    LE_UNUSED(events);
+
+    count = read(fd, decoderPtr->header + decoderPtr->headerLen,
+                 sizeof(decoderPtr->header) - decoderPtr->headerLen);
+    if (count < 0)
+    {
+        if ((errno == EINTR) || (errno == EAGAIN))
+        {
+            return;
+        }
+        LE_ERROR("Unable to read package: %m");
+        goto error;
+    }
+
+    decoderPtr->headerLen += count;
+    if ((count > 0) && (decoderPtr->headerLen < sizeof(decoderPtr->header)))
+    {
+        return;
+    }
+
+    // Whole header read, or package shorter than the header.
+    le_fdMonitor_Delete(decoderPtr->monitorRef);
+    decoderPtr->monitorRef = NULL;
+
+    decoderPtr->format = DetectFormat(decoderPtr->header, decoderPtr->headerLen);
+    if (InitStream(decoderPtr) != LE_OK)
+    {
+        goto error;
+    }
+
+    LE_INFO("Decoding package, format %d", decoderPtr->format);
+
+    le_thread_Start(le_thread_Create("PackageDecoder", DecoderThread, decoderPtr));
+
+    ReportFormat(decoderPtr, LE_OK);
+    return;
+
+error:
+    if (decoderPtr->monitorRef != NULL)
+    {
+        le_fdMonitor_Delete(decoderPtr->monitorRef);
+    }
+
+    // The reader sees an incomplete package.
+    close(decoderPtr->inFd);
+    close(decoderPtr->outFd);
+
+    ReportFormat(decoderPtr, LE_FAULT);
+    le_mem_Release(decoderPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start decoding a package.
+ *
+ * The format of the package is detected from the event loop of the calling thread, as soon as its
+ * first bytes are available, and decoding is then done by a dedicated thread. The decoded package
+ * is read from the returned file descriptor. The input file descriptor is owned by the decoder and
+ * closed once the package has been decoded. If the package can't be read, or is corrupted or
+ * truncated, the output is closed early, so that the reader sees an incomplete package.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t packageDecoder_Start
+(
+    int inFd,                           ///< [IN] Package, as downloaded
+    const char* checkpointPathPtr,      ///< [IN] Checkpoint file, NULL not to record checkpoints
+    packageDecoder_FormatHandlerFunc_t handlerFunc, ///< [IN] Format detection handler, or NULL
+    void* contextPtr,                   ///< [IN] Context of the format detection handler
+    int* outFdPtr                       ///< [OUT] Decoded package, ready for reading
+)
+{
+    Decoder_t* decoderPtr;
+    int pipeFds[2];
+
+    if (DecoderPool == NULL)
+    {
+        DecoderPool = le_mem_CreatePool("PackageDecoderPool", sizeof(Decoder_t));
+    }
+
+    if (pipe2(pipeFds, O_CLOEXEC) != 0)
+    {
+        LE_ERROR("Unable to create pipe: %m");
+        close(inFd);
+        return LE_FAULT;
+    }
+
+    decoderPtr = le_mem_ForceAlloc(DecoderPool);
+    memset(decoderPtr, 0, sizeof(Decoder_t));
+
+    decoderPtr->inFd = inFd;
+    decoderPtr->outFd = pipeFds[1];
+    decoderPtr->handlerFunc = handlerFunc;
+    decoderPtr->handlerContextPtr = contextPtr;
+    decoderPtr->checkpointFd = -1;
+    decoderPtr->chunkCrc = crc32(0, Z_NULL, 0);
+    if ((checkpointPathPtr != NULL) &&
+        (le_utf8_Copy(decoderPtr->checkpointPath, checkpointPathPtr,
+                      sizeof(decoderPtr->checkpointPath), NULL) != LE_OK))
+    {
+        LE_WARN("Checkpoint file path too long: checkpoints not recorded");
+        decoderPtr->checkpointPath[0] = '\0';
+    }
+    decoderPtr->monitorRef = le_fdMonitor_Create("PackageDecoder", inFd, HeaderHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(decoderPtr->monitorRef, decoderPtr);
+
+    *outFdPtr = pipeFds[0];
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check a package against the checkpoints recorded when its decoding was interrupted.
+ *
+ * @return
+ *  - LE_OK on success, offsetPtr is the size of the package which matches the checkpoints
+ *  - LE_NOT_FOUND if there is no valid checkpoint file
+ *  - LE_UNSUPPORTED if the package can't be read at a given offset, e.g. it is a pipe
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t packageDecoder_GetResumeOffset
+(
+    int fd,                             ///< [IN] Package, or partially downloaded package
+    const char* checkpointPathPtr,      ///< [IN] Checkpoint file
+    off_t* offsetPtr                    ///< [OUT] Offset the download can resume from
+)
+{
+    CheckpointHeader_t header;
+    uint8_t buf[DECODER_BUFFER_SIZE];
+    uint32_t crc;
+    off_t offset = 0;
+    le_result_t result = LE_OK;
+    int checkpointFd;
+
+    do
+    {
+        checkpointFd = open(checkpointPathPtr, O_RDONLY | O_CLOEXEC);
+    }
+    while ((checkpointFd < 0) && (errno == EINTR));
+
+    if (checkpointFd < 0)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    if ((ReadFull(checkpointFd, &header, sizeof(header)) != sizeof(header)) ||
+        (header.magic != CHECKPOINT_MAGIC) || (header.chunkSize != PACKAGE_DECODER_CHUNK_SIZE))
+    {
+        LE_WARN("Invalid checkpoint file '%s'", checkpointPathPtr);
+        close(checkpointFd);
+        return LE_NOT_FOUND;
+    }
+
+    while ((result == LE_OK) && (ReadFull(checkpointFd, &crc, sizeof(crc)) == sizeof(crc)))
+    {
+        uint32_t chunkCrc = crc32(0, Z_NULL, 0);
+        size_t chunkFill = 0;
+
+        while (chunkFill < PACKAGE_DECODER_CHUNK_SIZE)
+        {
+            ssize_t count = pread(fd, buf, sizeof(buf), offset + chunkFill);
+
+            if ((count < 0) && (errno == EINTR))
+            {
+                continue;
+            }
+            if ((count < 0) && (errno == ESPIPE))
+            {
+                result = LE_UNSUPPORTED;
+            }
+            else if (count < 0)
+            {
+                LE_ERROR("Unable to read package: %m");
+                result = LE_FAULT;
+            }
+            if (count <= 0)
+            {
+                break;
+            }
+
+            chunkCrc = crc32(chunkCrc, buf, count);
+            chunkFill += count;
+        }
+
+        // Stop at the first chunk which is incomplete or differs from its checkpoint.
+        if ((chunkFill != PACKAGE_DECODER_CHUNK_SIZE) || (chunkCrc != crc))
+        {
+            break;
+        }
+
+        offset += PACKAGE_DECODER_CHUNK_SIZE;
+    }
+
+    close(checkpointFd);
+
+    LE_DEBUG("Package verified up to offset %jd", (intmax_t)offset);
+    *offsetPtr = offset;
+    return result;
+}
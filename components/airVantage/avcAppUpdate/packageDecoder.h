@@ -0,0 +1,101 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Decoding stage of the packages downloaded by the AirVantage connector.
+ *
+ * Packages may be sent as is, or compressed with zlib/gzip or bzip2. The format is detected from
+ * the first bytes of the package and the decoded stream is handed to the update daemon through a
+ * pipe, so the compressed package never has to be expanded in flash.
+ *
+ * While a package is decoded, the CRC-32 of each chunk of the package is recorded in a checkpoint
+ * file, which is removed once the package has been decoded completely. When the decoding of a
+ * package was interrupted, the package can be checked against these checkpoints to find the
+ * offset a download could resume from.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_AVC_PACKAGE_DECODER_INCLUDE_GUARD
+#define LEGATO_AVC_PACKAGE_DECODER_INCLUDE_GUARD
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the package chunks covered by a checkpoint.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PACKAGE_DECODER_CHUNK_SIZE  (64 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Package formats.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    PACKAGE_FORMAT_RAW,     ///< Package sent as is
+    PACKAGE_FORMAT_ZLIB,    ///< zlib or gzip compressed package
+    PACKAGE_FORMAT_BZIP2    ///< bzip2 compressed package
+}
+packageDecoder_Format_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler reporting the format of a package, once its first bytes have been read.
+ *
+ * @param result    LE_OK if decoding started, LE_FAULT if the package can't be decoded
+ * @param format    Detected package format
+ * @param contextPtr Context given to packageDecoder_Start()
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*packageDecoder_FormatHandlerFunc_t)
+(
+    le_result_t result,
+    packageDecoder_Format_t format,
+    void* contextPtr
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start decoding a package.
+ *
+ * The format of the package is detected from the event loop of the calling thread, as soon as its
+ * first bytes are available, and decoding is then done by a dedicated thread. The decoded package
+ * is read from the returned file descriptor. The input file descriptor is owned by the decoder and
+ * closed once the package has been decoded. If the package can't be read, or is corrupted or
+ * truncated, the output is closed early, so that the reader sees an incomplete package.
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t packageDecoder_Start
+(
+    int inFd,                           ///< [IN] Package, as downloaded
+    const char* checkpointPathPtr,      ///< [IN] Checkpoint file, NULL not to record checkpoints
+    packageDecoder_FormatHandlerFunc_t handlerFunc, ///< [IN] Format detection handler, or NULL
+    void* contextPtr,                   ///< [IN] Context of the format detection handler
+    int* outFdPtr                       ///< [OUT] Decoded package, ready for reading
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check a package against the checkpoints recorded when its decoding was interrupted.
+ *
+ * @return
+ *  - LE_OK on success, offsetPtr is the size of the package which matches the checkpoints
+ *  - LE_NOT_FOUND if there is no valid checkpoint file
+ *  - LE_UNSUPPORTED if the package can't be read at a given offset, e.g. it is a pipe
+ *  - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t packageDecoder_GetResumeOffset
+(
+    int fd,                             ///< [IN] Package, or partially downloaded package
+    const char* checkpointPathPtr,      ///< [IN] Checkpoint file
+    off_t* offsetPtr                    ///< [OUT] Offset the download can resume from
+);
+
+#endif // LEGATO_AVC_PACKAGE_DECODER_INCLUDE_GUARD
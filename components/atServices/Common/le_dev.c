@@ -26,6 +26,14 @@
 //--------------------------------------------------------------------------------------------------
 #define DSIZE_INFO_STR   1600
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum of two sizes
+ */
+//--------------------------------------------------------------------------------------------------
+#define MIN_SIZE(a, b)  (((a) < (b)) ? (a) : (b))
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * struct DevInfo contains useful information about the device in use
@@ -371,6 +379,332 @@ int32_t le_dev_Write
     return currentSize;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to write several buffers on device (or port) with a single system
+ * call.
+ *
+ * @return written byte number
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t le_dev_WriteVec
+(
+    Device_t*           devicePtr,    ///< device pointer
+    const struct iovec* iovPtr,       ///< Buffers to write
+    int                 iovCount      ///< number of buffers
+)
+{
+    struct iovec iov[iovCount];
+    int first = 0;
+    int i;
+    size_t size = 0;
+    size_t currentSize = 0;
+    ssize_t sizeWritten;
+
+    DevInfo.fd = devicePtr->fd;
+    if (!GetDeviceInformation())
+    {
+        LE_DEBUG("%s", DevInfo.devInfoStr);
+    }
+
+    LE_FATAL_IF(devicePtr->fd==-1,"Write Handle error\n");
+
+    // Work on a copy, as the buffers are shifted on partial writes
+    for (i = 0; i < iovCount; i++)
+    {
+        iov[i] = iovPtr[i];
+        size += iovPtr[i].iov_len;
+    }
+
+    while (currentSize < size)
+    {
+        sizeWritten = writev(devicePtr->fd, &iov[first], iovCount - first);
+
+        if (sizeWritten < 0)
+        {
+            if ((errno != EINTR) && (errno != EAGAIN))
+            {
+                LE_ERROR("Cannot write on fd: %s", StrError(errno));
+                break;
+            }
+            continue;
+        }
+
+        currentSize += sizeWritten;
+
+        // Skip the buffers fully written, and move into the one partially written
+        while ((first < iovCount) && ((size_t)sizeWritten >= iov[first].iov_len))
+        {
+            sizeWritten -= iov[first].iov_len;
+            first++;
+        }
+        if (first < iovCount)
+        {
+            iov[first].iov_base = (uint8_t*)iov[first].iov_base + sizeWritten;
+            iov[first].iov_len -= sizeWritten;
+        }
+    }
+
+    if (le_log_GetFilterLevel() == LE_LOG_DEBUG)
+    {
+        size_t printed = 0;
+
+        for (i = 0; (i < iovCount) && (printed < currentSize); i++)
+        {
+            size_t len = MIN_SIZE(iovPtr[i].iov_len, currentSize - printed);
+
+            PrintBuffer(devicePtr->fd, iovPtr[i].iov_base, len);
+            printed += len;
+        }
+    }
+
+    return currentSize;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reverse the bytes of a buffer in place
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReverseBytes
+(
+    uint8_t*  bufferPtr,     ///< the buffer to reverse
+    size_t    size           ///< Number of bytes
+)
+{
+    size_t i;
+    uint8_t byte;
+
+    for (i = 0; i < (size / 2); i++)
+    {
+        byte = bufferPtr[i];
+        bufferPtr[i] = bufferPtr[size - 1 - i];
+        bufferPtr[size - 1 - i] = byte;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move the unread bytes of a ring to the start of its storage, so that they are contiguous.
+ *
+ * This only happens when a line wraps around the end of the ring.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RotateRing
+(
+    le_dev_Ring_t*  ringPtr       ///< ring pointer
+)
+{
+    ReverseBytes(ringPtr->data, ringPtr->head);
+    ReverseBytes(&ringPtr->data[ringPtr->head], LE_DEV_RING_SIZE - ringPtr->head);
+    ReverseBytes(ringPtr->data, LE_DEV_RING_SIZE);
+    ringPtr->head = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to empty a receive ring buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_dev_RingReset
+(
+    le_dev_Ring_t*  ringPtr       ///< ring pointer
+)
+{
+    ringPtr->head = 0;
+    ringPtr->count = 0;
+    ringPtr->scanned = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to read on device (or port) into a receive ring buffer.
+ *
+ * @return byte number read, 0 if the ring is full, -1 on error
+ */
+//--------------------------------------------------------------------------------------------------
+ssize_t le_dev_RingRead
+(
+    Device_t*       devicePtr,    ///< device pointer
+    le_dev_Ring_t*  ringPtr,      ///< ring where to read
+    struct iovec*   rxIovPtr      ///< [OUT] location of the bytes read in the ring (2 buffers), or
+                                  ///<       NULL
+)
+{
+    struct iovec freeIov[2];
+    int freeCount = 1;
+    size_t tail;
+    ssize_t count;
+
+    if ((NULL == devicePtr) || (NULL == ringPtr))
+    {
+        LE_ERROR("Bad parameter!");
+        return -1;
+    }
+
+    if (ringPtr->count >= LE_DEV_RING_SIZE)
+    {
+        return 0;
+    }
+
+    // The free space is at most two segments: after the unread bytes, then before them
+    tail = (ringPtr->head + ringPtr->count) % LE_DEV_RING_SIZE;
+    freeIov[0].iov_base = &ringPtr->data[tail];
+    if (tail >= ringPtr->head)
+    {
+        freeIov[0].iov_len = LE_DEV_RING_SIZE - tail;
+        if (ringPtr->head > 0)
+        {
+            freeIov[1].iov_base = ringPtr->data;
+            freeIov[1].iov_len = ringPtr->head;
+            freeCount = 2;
+        }
+    }
+    else
+    {
+        freeIov[0].iov_len = ringPtr->head - tail;
+    }
+
+    DevInfo.fd = devicePtr->fd;
+    if (!GetDeviceInformation())
+    {
+        LE_INFO("%s", DevInfo.devInfoStr);
+    }
+
+    count = readv(devicePtr->fd, freeIov, freeCount);
+    if (-1 == count)
+    {
+        LE_ERROR("read error: %s", StrError(errno));
+        return -1;
+    }
+
+    ringPtr->count += count;
+
+    if (rxIovPtr)
+    {
+        rxIovPtr[0].iov_base = freeIov[0].iov_base;
+        rxIovPtr[0].iov_len = MIN_SIZE((size_t)count, freeIov[0].iov_len);
+        rxIovPtr[1].iov_base = ringPtr->data;
+        rxIovPtr[1].iov_len = count - rxIovPtr[0].iov_len;
+    }
+
+    if (le_log_GetFilterLevel() == LE_LOG_DEBUG)
+    {
+        size_t firstLen = MIN_SIZE((size_t)count, freeIov[0].iov_len);
+
+        PrintBuffer(devicePtr->fd, freeIov[0].iov_base, firstLen);
+        if ((size_t)count > firstLen)
+        {
+            PrintBuffer(devicePtr->fd, ringPtr->data, count - firstLen);
+        }
+    }
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the unread bytes of a receive ring buffer which are
+ * contiguous in memory, without removing them from the ring.
+ *
+ * @return pointer to the first unread byte
+ */
+//--------------------------------------------------------------------------------------------------
+uint8_t* le_dev_RingPeek
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    size_t*         lenPtr        ///< [OUT] number of contiguous bytes
+)
+{
+    *lenPtr = MIN_SIZE(ringPtr->count, LE_DEV_RING_SIZE - ringPtr->head);
+
+    return &ringPtr->data[ringPtr->head];
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to remove unread bytes from a receive ring buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_dev_RingConsume
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    size_t          size          ///< number of bytes to remove
+)
+{
+    size = MIN_SIZE(size, ringPtr->count);
+
+    ringPtr->count -= size;
+    ringPtr->scanned = (ringPtr->scanned > size) ? (ringPtr->scanned - size) : 0;
+
+    if (0 == ringPtr->count)
+    {
+        // Restart from the beginning to keep the free space contiguous
+        ringPtr->head = 0;
+    }
+    else
+    {
+        ringPtr->head = (ringPtr->head + size) % LE_DEV_RING_SIZE;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the next line of a receive ring buffer.
+ *
+ * The line is removed from the ring and returned in place: the terminator (and a carriage return
+ * preceding it) is replaced by a null character. The line stays valid until the next call on the
+ * ring.
+ *
+ * @return pointer to the line, NULL if no complete line is available
+ */
+//--------------------------------------------------------------------------------------------------
+char* le_dev_RingGetLine
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    char            terminator,   ///< line terminator
+    size_t*         lenPtr        ///< [OUT] line length
+)
+{
+    while (ringPtr->scanned < ringPtr->count)
+    {
+        size_t pos = (ringPtr->head + ringPtr->scanned) % LE_DEV_RING_SIZE;
+        size_t len = MIN_SIZE(ringPtr->count - ringPtr->scanned, LE_DEV_RING_SIZE - pos);
+        uint8_t* termPtr = memchr(&ringPtr->data[pos], terminator, len);
+        size_t lineLen;
+        char* linePtr;
+
+        if (NULL == termPtr)
+        {
+            // Bytes searched once are not searched again on the next call
+            ringPtr->scanned += len;
+            continue;
+        }
+
+        lineLen = ringPtr->scanned + (termPtr - &ringPtr->data[pos]);
+
+        if ((ringPtr->head + lineLen) >= LE_DEV_RING_SIZE)
+        {
+            RotateRing(ringPtr);
+        }
+
+        linePtr = (char*) &ringPtr->data[ringPtr->head];
+        linePtr[lineLen] = '\0';
+        le_dev_RingConsume(ringPtr, lineLen + 1);
+
+        if (('\n' == terminator) && (lineLen > 0) && ('\r' == linePtr[lineLen - 1]))
+        {
+            lineLen--;
+            linePtr[lineLen] = '\0';
+        }
+
+        *lenPtr = lineLen;
+        return linePtr;
+    }
+
+    return NULL;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called to monitor the specified file descriptor
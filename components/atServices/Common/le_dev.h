@@ -8,6 +8,15 @@
 #ifndef LEGATO_LE_DEV_INCLUDE_GUARD
 #define LEGATO_LE_DEV_INCLUDE_GUARD
 
+#include <sys/uio.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the receive ring buffer
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_DEV_RING_SIZE    1024
+
 //--------------------------------------------------------------------------------------------------
 /**
  * device structure
@@ -21,6 +30,24 @@ typedef struct Device
 }
 Device_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receive ring buffer
+ *
+ * Data is read from the device straight into the ring, and lines are framed in place: a line is
+ * returned as a pointer into the ring, so it is never copied to an intermediate buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t data[LE_DEV_RING_SIZE];     ///< Ring storage
+    size_t  head;                       ///< Position of the first unread byte
+    size_t  count;                      ///< Number of unread bytes
+    size_t  scanned;                    ///< Number of unread bytes already searched for a
+                                        ///< line terminator
+}
+le_dev_Ring_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called when we want to read on device (or port)
@@ -49,6 +76,89 @@ int32_t le_dev_Write
     uint32_t    size          ///< size of buffer
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to write several buffers on device (or port) with a single system
+ * call.
+ *
+ * @return written byte number
+ */
+//--------------------------------------------------------------------------------------------------
+int32_t le_dev_WriteVec
+(
+    Device_t*           devicePtr,    ///< device pointer
+    const struct iovec* iovPtr,       ///< Buffers to write
+    int                 iovCount      ///< number of buffers
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to empty a receive ring buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_dev_RingReset
+(
+    le_dev_Ring_t*  ringPtr       ///< ring pointer
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to read on device (or port) into a receive ring buffer.
+ *
+ * @return byte number read, 0 if the ring is full, -1 on error
+ */
+//--------------------------------------------------------------------------------------------------
+ssize_t le_dev_RingRead
+(
+    Device_t*       devicePtr,    ///< device pointer
+    le_dev_Ring_t*  ringPtr,      ///< ring where to read
+    struct iovec*   rxIovPtr      ///< [OUT] location of the bytes read in the ring (2 buffers), or
+                                  ///<       NULL
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the next line of a receive ring buffer.
+ *
+ * The line is removed from the ring and returned in place: the terminator (and a carriage return
+ * preceding it) is replaced by a null character. The line stays valid until the next call on the
+ * ring.
+ *
+ * @return pointer to the line, NULL if no complete line is available
+ */
+//--------------------------------------------------------------------------------------------------
+char* le_dev_RingGetLine
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    char            terminator,   ///< line terminator
+    size_t*         lenPtr        ///< [OUT] line length
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the unread bytes of a receive ring buffer which are
+ * contiguous in memory, without removing them from the ring.
+ *
+ * @return pointer to the first unread byte
+ */
+//--------------------------------------------------------------------------------------------------
+uint8_t* le_dev_RingPeek
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    size_t*         lenPtr        ///< [OUT] number of contiguous bytes
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to remove unread bytes from a receive ring buffer.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_dev_RingConsume
+(
+    le_dev_Ring_t*  ringPtr,      ///< ring pointer
+    size_t          size          ///< number of bytes to remove
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called to monitor the specified file descriptor in the calling thread event
@@ -36,27 +36,23 @@
  *
  * @verbatim
  *
- *    ---------------                                           ---------------------
- *   |               |                 PARSER_CHAR             |                     |
- *   | StartingState |   ---------------------------------->   |  InitializingState  |
- *   |               |                                         |                     |
- *    ---------------                                           ---------------------
- *          |                                                            |
- *          |                                                            |
- *          |                                                            |
- *          |                     -----------------       PARSER_CRLF    |
- *          |                    |                 | <-------------------
- *           ---------------->   | ProcessingState | -----------------------
- *               PARSER_CRLF     |                 | --------------------   |
- *                                -----------------                      |  |
- *                                    /\       /\            PARSER_CRLF |  |
- *                                    |        |                         |  |
- *                                    |         -------------------------   |
- *                                     -------------------------------------
- *                                                 PARSER_PROMPT
+ *    ---------------                                           -----------------
+ *   |               |                 PARSER_CRLF             |                 |
+ *   | StartingState |   ---------------------------------->   | ProcessingState |
+ *   |               |                                         |                 |
+ *    ---------------                                           -----------------
+ *                                                                /\   |   |  /\
+ *                                                                |    |   |   |
+ *                                                                 ----     ----
+ *                                                          PARSER_CRLF     PARSER_PROMPT
  *
  * @verbatim
  *
+ * The received data are framed into lines in place, in the receive ring of the device: a
+ * PARSER_CRLF event is raised for each line ended by CRLF, a PARSER_PROMPT event when the data
+ * following the last line start with a prompt. The data received before the first CRLF are
+ * dropped.
+ *
  */
 
 #include "legato.h"
@@ -108,10 +104,10 @@
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Rx Buffer length
+ * Command response handlers pool size
  */
 //--------------------------------------------------------------------------------------------------
-#define PARSER_BUFFER_MAX_BYTES 1024
+#define RSP_HANDLER_POOL_SIZE DEVICE_POOL_SIZE
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -143,8 +139,7 @@ ClientEvent_t;
 //--------------------------------------------------------------------------------------------------
 typedef enum
 {
-    PARSER_CHAR=0,    ///< Any character except CRLF('\r\n') or PROMPT('>')
-    PARSER_CRLF,      ///< CRLF ('\r\n')
+    PARSER_CRLF=0,    ///< Line ended by CRLF ('\r\n')
     PARSER_PROMPT,    ///< PROMPT ('>')
     PARSER_MAX        ///< unused
 }
@@ -214,10 +209,9 @@ RspString_t;
 //--------------------------------------------------------------------------------------------------
 typedef struct RxData
 {
-    uint8_t  buffer[PARSER_BUFFER_MAX_BYTES];///< buffer read
-    int32_t  idx;                            ///< index of parsing the buffer
-    size_t   endBuffer;                      ///< index where the read was finished (idx<endbuffer)
-    int32_t  idxLastCrLf;                    ///< index where the last CRLF has been found
+    le_dev_Ring_t ring;                      ///< buffer read
+    char*         linePtr;                   ///< line being processed, in the ring
+    size_t        lineSize;                  ///< length of the line being processed
 }
 RxData_t;
 
@@ -265,7 +259,22 @@ typedef struct
 }
 Unsolicited_t;
 
-
+//--------------------------------------------------------------------------------------------------
+/**
+ * Command response handler structure
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_atClient_CommandResponseHandlerFunc_t handlerPtr;        ///< Command response handler
+    void*                                    contextPtr;        ///< User context
+    le_atClient_CommandResponseHandlerRef_t  ref;               ///< Handler reference
+    DeviceContextPtr_t                       interfacePtr;      ///< device context
+    le_dls_Link_t                            link;              ///< link in handlers list
+    le_msg_SessionRef_t                      sessionRef;        ///< client session reference
+}
+RspHandler_t;
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -282,6 +291,7 @@ typedef struct DeviceContext
     le_timer_Ref_t  timerRef;           ///< command timer
     le_dls_List_t   atCommandList;      ///< List of command waiting for execution
     le_dls_List_t   unsolicitedList;    ///< unsolicited command list
+    le_dls_List_t   rspHandlerList;     ///< command response handlers list
     le_sem_Ref_t    waitingSemaphore;   ///< semaphore used for synchronization
     le_atClient_DeviceRef_t ref;        ///< reference of the device context
     le_msg_SessionRef_t sessionRef;     ///< client session reference
@@ -312,6 +322,8 @@ typedef struct AtCmd
     uint32_t               responsesCount;                      ///< responses count in responseList
     le_sem_Ref_t           endSem;                              ///< end treatment semaphore
     le_result_t            result;                              ///< result operation
+    bool                   isAsync;                             ///< responses are reported to
+                                                                ///< the response handlers
     le_dls_Link_t          link;                                ///< link in AT commands list
     le_msg_SessionRef_t    sessionRef;                          ///< client session reference
 }
@@ -367,16 +379,33 @@ static le_ref_MapRef_t DevicesRefMap;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t UnsolRefMap;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for command response handlers
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t  RspHandlerPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Map for command response handlers
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t RspHandlerRefMap;
+
 static void WaitingState(ClientStatePtr_t parserStatePtr,ClientEvent_t input);
 static void SendingState(ClientStatePtr_t  parserStatePtr,ClientEvent_t input);
 
 static void StartingState      (RxParserPtr_t charParserPtr,RxEvent_t input);
-static void InitializingState  (RxParserPtr_t charParserPtr,RxEvent_t input);
 static void ProcessingState    (RxParserPtr_t charParserPtr,RxEvent_t input);
 static void UpdateTransitionManager(ClientStatePtr_t  parserStatePtr,
                                     ClientEvent_t input,
                                     ClientStateFunc_t newState);
 
+static void UpdateTransitionParser(RxParserPtr_t rxParserPtr,
+                                   RxEvent_t input,
+                                   RxParserFunc_t newState);
+
 static void SendLine(RxParserPtr_t charParserPtr);
 static void SendData(RxParserPtr_t charParserPtr);
 
@@ -449,83 +478,7 @@ static void CheckUnsolicited
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function must be called to get the next event to send to the Rx parser
- *
- * @return
- *      - true if a new event is detected and RX parser has to be processed
- *      - false otherwise
- *
- */
-//--------------------------------------------------------------------------------------------------
-static bool GetNextEvent
-(
-    RxParserPtr_t  charParserPtr,
-    RxEvent_t     *evPtr
-)
-{
-    int32_t idx = charParserPtr->rxData.idx++;
-    if (idx < charParserPtr->rxData.endBuffer)
-    {
-        if (charParserPtr->rxData.buffer[idx] == '\r')
-        {
-            idx = charParserPtr->rxData.idx++;
-            if (idx < charParserPtr->rxData.endBuffer)
-            {
-                if ( charParserPtr->rxData.buffer[idx] == '\n')
-                {
-                    *evPtr = PARSER_CRLF;
-                    return true;
-                }
-                else
-                {
-                    return false;
-                }
-            }
-            else
-            {
-                charParserPtr->rxData.idx--;
-                return false;
-            }
-        }
-        else if (charParserPtr->rxData.buffer[idx] == '\n')
-        {
-            if ( idx-1 > 0 )
-            {
-                if (charParserPtr->rxData.buffer[idx-1] == '\r')
-                {
-                    *evPtr = PARSER_CRLF;
-                    return true;
-                }
-                else
-                {
-                    return false;
-                }
-            }
-            else
-            {
-                return false;
-            }
-        }
-        else if (charParserPtr->rxData.buffer[idx] == '>')
-        {
-            *evPtr = PARSER_PROMPT;
-            return true;
-        }
-        else
-        {
-            *evPtr = PARSER_CHAR;
-            return true;
-        }
-    }
-    else
-    {
-        return false;
-    }
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * This function must be called to read and send event to the Rx parser
+ * This function must be called to frame the received data and send events to the Rx parser
  *
  */
 //--------------------------------------------------------------------------------------------------
@@ -534,52 +487,33 @@ static void ParseRxBuffer
     RxParserPtr_t rxParserPtr
 )
 {
-    RxEvent_t event;
+    RxData_t* rxDataPtr = &rxParserPtr->rxData;
+    uint8_t* dataPtr;
+    size_t size;
 
-    for (;rxParserPtr->rxData.idx < rxParserPtr->rxData.endBuffer;)
+    for (;;)
     {
-        if (GetNextEvent(rxParserPtr, &event))
+        rxDataPtr->linePtr = le_dev_RingGetLine(&rxDataPtr->ring, '\n', &rxDataPtr->lineSize);
+        if (rxDataPtr->linePtr)
         {
-            (rxParserPtr->curState)(rxParserPtr,event);
+            (rxParserPtr->curState)(rxParserPtr,PARSER_CRLF);
+            continue;
         }
-    }
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * This function must be called to delete characters that were already read.
- *
- */
-//--------------------------------------------------------------------------------------------------
-static void ResetRxBuffer
-(
-    RxParserPtr_t rxParserPtr
-)
-{
-    if (rxParserPtr->curState == ProcessingState)
-    {
-        size_t idx,sizeToCopy;
-        sizeToCopy = rxParserPtr->rxData.endBuffer-rxParserPtr->rxData.idxLastCrLf+2;
-
-        LE_DEBUG("%d sizeToCopy %zd from %d",
-                            rxParserPtr->rxData.idx,sizeToCopy,rxParserPtr->rxData.idxLastCrLf-2);
 
-        for (idx = 0; idx < sizeToCopy; idx++) {
-            rxParserPtr->rxData.buffer[idx] =
-                                rxParserPtr->rxData.buffer[idx+rxParserPtr->rxData.idxLastCrLf-2];
+        // The prompt is not followed by CRLF, look for it at the start of the pending data
+        dataPtr = le_dev_RingPeek(&rxDataPtr->ring, &size);
+        if ((size > 0) && (dataPtr[0] == '>'))
+        {
+            le_dev_RingConsume(&rxDataPtr->ring, 1);
+            (rxParserPtr->curState)(rxParserPtr,PARSER_PROMPT);
+            continue;
         }
 
-        rxParserPtr->rxData.idxLastCrLf = 2;
-        rxParserPtr->rxData.endBuffer = sizeToCopy;
-        rxParserPtr->rxData.idx = rxParserPtr->rxData.endBuffer;
-        LE_DEBUG("new idx %d, startLine %d",
-                 rxParserPtr->rxData.idx,
-                 rxParserPtr->rxData.idxLastCrLf);
-    }
-    else
-    {
-        LE_DEBUG("Nothing should be copied in RxData\n");
+        break;
     }
+
+    rxDataPtr->linePtr = NULL;
+    rxDataPtr->lineSize = 0;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -599,6 +533,7 @@ static void InitializeState
 
     RxParserPtr_t rxParserPtr = &interfacePtr->rxParser;
     rxParserPtr->curState = StartingState;
+    le_dev_RingReset(&rxParserPtr->rxData.ring);
 
     interfacePtr->timerRef = le_timer_Create("CommandTimer");
     interfacePtr->rxParser.interfacePtr = interfacePtr;
@@ -626,28 +561,23 @@ static void RxNewData
 
     LE_DEBUG("Start read");
 
-    /* Read RX data on uart */
-    // PARSER_BUFFER_MAX_BYTES length is including '\0' character.
-    size = le_dev_Read(&interfacePtr->device,
-                         (uint8_t *)(&interfacePtr->rxParser.rxData.buffer) +
-                         interfacePtr->rxParser.rxData.idx,
-                         (PARSER_BUFFER_MAX_BYTES - interfacePtr->rxParser.rxData.idx - 1));
+    /* Read RX data on uart, straight into the receive ring */
+    size = le_dev_RingRead(&interfacePtr->device, &interfacePtr->rxParser.rxData.ring, NULL);
 
     /* Start the parsing only if we have read some bytes */
     if (size > 0)
     {
-        interfacePtr->rxParser.rxData.buffer[interfacePtr->rxParser.rxData.idx + size] = '\0';
-        interfacePtr->rxParser.rxData.endBuffer += size;
-
         /* Call the parser */
-        LE_DEBUG("Parsing received data: %s", interfacePtr->rxParser.rxData.buffer);
         ParseRxBuffer(&interfacePtr->rxParser);
-        ResetRxBuffer(&interfacePtr->rxParser);
     }
 
-    if (interfacePtr->rxParser.rxData.endBuffer > PARSER_BUFFER_MAX_BYTES)
+    if (interfacePtr->rxParser.rxData.ring.count >= LE_DEV_RING_SIZE)
     {
-        LE_WARN("Rx Buffer Overflow (FillIndex = %d)!!!", interfacePtr->rxParser.rxData.idx);
+        // No line end in a full ring: drop the data and resynchronize on the next CRLF
+        LE_WARN("Rx Buffer Overflow (FillIndex = %zu)!!!",
+                interfacePtr->rxParser.rxData.ring.count);
+        le_dev_RingReset(&interfacePtr->rxParser.rxData.ring);
+        UpdateTransitionParser(&interfacePtr->rxParser, PARSER_MAX, StartingState);
     }
 
     LE_DEBUG("read finished");
@@ -675,6 +605,12 @@ static void DestroyDeviceThread
         le_mem_Release(unsolPtr);
     }
 
+    while ((linkPtr=le_dls_Pop(&interfacePtr->rspHandlerList)) != NULL)
+    {
+        RspHandler_t *rspHandlerPtr = CONTAINER_OF(linkPtr, RspHandler_t, link);
+        le_mem_Release(rspHandlerPtr);
+    }
+
     while ((linkPtr=le_dls_Pop(&interfacePtr->atCommandList)) != NULL)
     {
         AtCmd_t* atCmdPtr = CONTAINER_OF(linkPtr, AtCmd_t, link);
@@ -784,6 +720,74 @@ static void StopTimer
     le_timer_Stop(cmdPtr->interfacePtr->timerRef);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function reports a response of an asynchronous command to the response handlers of the
+ * client which sent the command.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportResponse
+(
+    AtCmd_t*    cmdPtr,
+    le_result_t result,
+    const char* rspPtr
+)
+{
+    le_dls_List_t* listPtr = &cmdPtr->interfacePtr->rspHandlerList;
+    le_dls_Link_t* linkPtr = le_dls_Peek(listPtr);
+
+    while (linkPtr != NULL)
+    {
+        RspHandler_t* rspHandlerPtr = CONTAINER_OF(linkPtr, RspHandler_t, link);
+
+        linkPtr = le_dls_PeekNext(listPtr, linkPtr);
+
+        if (rspHandlerPtr->sessionRef == cmdPtr->sessionRef)
+        {
+            rspHandlerPtr->handlerPtr(cmdPtr->ref, result, rspPtr, rspHandlerPtr->contextPtr);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function ends the command on top of the commands list, and sends the next one.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteCommand
+(
+    ClientStatePtr_t clientStatePtr,
+    ClientEvent_t    input,
+    AtCmd_t*         cmdPtr,
+    le_result_t      result,
+    const char*      finalRspPtr
+)
+{
+    le_dls_Pop(&cmdPtr->interfacePtr->atCommandList);
+
+    cmdPtr->result = result;
+
+    if (cmdPtr->isAsync)
+    {
+        ReportResponse(cmdPtr, result, finalRspPtr);
+
+        // Drop the reference taken by le_atClient_SendAsync()
+        cmdPtr->isAsync = false;
+        le_mem_Release(cmdPtr);
+    }
+    else
+    {
+        le_sem_Post(cmdPtr->endSem);
+    }
+
+    UpdateTransitionManager(clientStatePtr,input,WaitingState);
+
+    // Send the next command
+    (clientStatePtr->curState)(clientStatePtr,EVENT_SENDCMD);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Timer handler (called when the AT command timeout is reached)
@@ -798,15 +802,12 @@ static void TimerHandler
     AtCmd_t* atCmdPtr = le_timer_GetContextPtr(timerRef);
 
     LE_ERROR("Timeout when sending %s, timeout = %d",  atCmdPtr->cmd, atCmdPtr->timeout);
-    atCmdPtr->result = LE_TIMEOUT;
-    le_dls_Pop(&atCmdPtr->interfacePtr->atCommandList);
-    le_sem_Post(atCmdPtr->endSem);
-    ClientStatePtr_t clientStatePtr = &atCmdPtr->interfacePtr->clientState;
-
-    UpdateTransitionManager(clientStatePtr,EVENT_SENDCMD,WaitingState);
 
-    // Send the next command
-    (clientStatePtr->curState)(clientStatePtr,EVENT_SENDCMD);
+    CompleteCommand(&atCmdPtr->interfacePtr->clientState,
+                    EVENT_SENDCMD,
+                    atCmdPtr,
+                    LE_TIMEOUT,
+                    "");
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -835,20 +836,20 @@ static void StartTimer
 
 //--------------------------------------------------------------------------------------------------
 /**
- * This function is used to check if the line matches any of response strings of the command
+ * This function is used to check if the line matches any of response strings of the command,
+ * without storing it.
  *
  * @return
  *      - TRUE if the line matches a response string of the command
  *      - FALSE otherwise
  */
 //--------------------------------------------------------------------------------------------------
-static bool CheckResponse
+static bool MatchResponse
 (
-    char*          receivedRspPtr,   ///< [IN] Received line pointer
+    const char*    receivedRspPtr,   ///< [IN] Received line pointer
     size_t         lineSize,         ///< [IN] Received line size
     le_dls_List_t* responseListPtr,  ///< [IN] List of response strings of the command
-    le_dls_List_t* resultListPtr,    ///< [OUT] List of matched strings after comparison
-    char*          cmdNamePtr        ///< [IN] Command name pointer
+    const char*    cmdNamePtr        ///< [IN] Command name pointer
 )
 {
     LE_DEBUG("Start checking response");
@@ -883,19 +884,11 @@ static bool CheckResponse
         {
             LE_DEBUG("Rsp matched, size: %zu", lineSize);
 
-            RspString_t* newStringPtr = le_mem_ForceAlloc(RspStringPool);
-            memset(newStringPtr, 0, sizeof(RspString_t));
-
-            if(lineSize>LE_ATDEFS_RESPONSE_MAX_BYTES)
+            if (lineSize > LE_ATDEFS_RESPONSE_MAX_LEN)
             {
                 LE_ERROR("String too long");
-                le_mem_Release(newStringPtr);
                 return false;
             }
-
-            strncpy(newStringPtr->line, receivedRspPtr, lineSize);
-            newStringPtr->link = LE_DLS_LINK_INIT;
-            le_dls_Queue(resultListPtr, &(newStringPtr->link));
             return true;
         }
 
@@ -906,6 +899,38 @@ static bool CheckResponse
     return false;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is used to check if the line matches any of response strings of the command
+ *
+ * @return
+ *      - TRUE if the line matches a response string of the command
+ *      - FALSE otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static bool CheckResponse
+(
+    char*          receivedRspPtr,   ///< [IN] Received line pointer
+    size_t         lineSize,         ///< [IN] Received line size
+    le_dls_List_t* responseListPtr,  ///< [IN] List of response strings of the command
+    le_dls_List_t* resultListPtr,    ///< [OUT] List of matched strings after comparison
+    char*          cmdNamePtr        ///< [IN] Command name pointer
+)
+{
+    if (!MatchResponse(receivedRspPtr, lineSize, responseListPtr, cmdNamePtr))
+    {
+        return false;
+    }
+
+    RspString_t* newStringPtr = le_mem_ForceAlloc(RspStringPool);
+    memset(newStringPtr, 0, sizeof(RspString_t));
+
+    strncpy(newStringPtr->line, receivedRspPtr, lineSize);
+    newStringPtr->link = LE_DLS_LINK_INIT;
+    le_dls_Queue(resultListPtr, &(newStringPtr->link));
+    return true;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -937,16 +962,15 @@ static void SendingState
     {
         case EVENT_SENDTEXT:
         {
-            // Send data
-            le_dev_Write(&(interfacePtr->device),
-                           (uint8_t*) cmdPtr->text,
-                           cmdPtr->textSize);
-
-            // Send Ctrl-z
+            // Send data followed by Ctrl-z
             uint8_t ctrlZ = 0x1A;
-            le_dev_Write(&(interfacePtr->device),
-                         &ctrlZ,
-                         1);
+            struct iovec iov[2] =
+            {
+                { .iov_base = cmdPtr->text, .iov_len = cmdPtr->textSize },
+                { .iov_base = &ctrlZ, .iov_len = 1 }
+            };
+
+            le_dev_WriteVec(&(interfacePtr->device), iov, 2);
 
             break;
         }
@@ -957,28 +981,49 @@ static void SendingState
             //~CheckUnsolicited(smRef,
                              //~smRef->curContext.atLine,
                              //~strlen(smRef->curContext.atLine));
-            int32_t newCRLF = parserPtr->idx-2;
-            size_t lineSize = newCRLF - parserPtr->idxLastCrLf;
+            size_t lineSize = parserPtr->lineSize;
+            char* linePtr = parserPtr->linePtr;
 
-            if (CheckResponse((char*)&(parserPtr->buffer[parserPtr->idxLastCrLf]), lineSize,
+            if (cmdPtr->isAsync)
+            {
+                // Pass the line straight to the response handlers, it is not stored.
+                char line[LE_ATDEFS_RESPONSE_MAX_BYTES];
+                bool isFinal = MatchResponse(linePtr, lineSize,
+                                             &(cmdPtr->expectResponseList), cmdPtr->cmd);
+
+                if ((!isFinal) &&
+                    (!MatchResponse(linePtr, lineSize,
+                                    &(cmdPtr->ExpectintermediateResponseList), cmdPtr->cmd)))
+                {
+                    break;
+                }
+
+                memcpy(line, linePtr, lineSize);
+                line[lineSize] = '\0';
+
+                if (isFinal)
+                {
+                    LE_DEBUG("Final command found");
+                    StopTimer(cmdPtr);
+                    CompleteCommand(clientStatePtr, input, cmdPtr, LE_OK, line);
+                    return;
+                }
+
+                ReportResponse(cmdPtr, LE_IN_PROGRESS, line);
+                break;
+            }
+
+            if (CheckResponse(linePtr, lineSize,
                               &(cmdPtr->expectResponseList), &(cmdPtr->responseList),
                               cmdPtr->cmd))
             {
                 LE_DEBUG("Final command found");
-
-                le_dls_Pop(&interfacePtr->atCommandList);
-
-                cmdPtr->result = LE_OK;
                 StopTimer(cmdPtr);
-                le_sem_Post(cmdPtr->endSem);
-
-                UpdateTransitionManager(clientStatePtr,input,WaitingState);
-                // Send the next command
-                (clientStatePtr->curState)(clientStatePtr,EVENT_SENDCMD);
+                CompleteCommand(clientStatePtr, input, cmdPtr, LE_OK, NULL);
                 return;
             }
 
-            CheckResponse((char*)&(parserPtr->buffer[parserPtr->idxLastCrLf]), lineSize,
+            CheckResponse(linePtr, lineSize,
                           &(cmdPtr->ExpectintermediateResponseList), &(cmdPtr->responseList),
                           cmdPtr->cmd);
             break;
@@ -1028,14 +1073,13 @@ static void WaitingState
                 StartTimer(cmdPtr);
             }
 
-            uint32_t len = strlen(cmdPtr->cmd)+2;
-            char atCommand[len];
-            memset(atCommand, 0, len);
-            snprintf(atCommand, len, "%s\r", cmdPtr->cmd);
+            struct iovec iov[2] =
+            {
+                { .iov_base = cmdPtr->cmd, .iov_len = strlen(cmdPtr->cmd) },
+                { .iov_base = "\r", .iov_len = 1 }
+            };
 
-            le_dev_Write(&(interfacePtr->device),
-                           (uint8_t*) atCommand,
-                           len-1);
+            le_dev_WriteVec(&(interfacePtr->device), iov, 2);
 
             UpdateTransitionManager(clientStatePtr,input,SendingState);
 
@@ -1045,12 +1089,9 @@ static void WaitingState
         {
             RxData_t* parserPtr = &interfacePtr->rxParser.rxData;
 
-            int32_t newCRLF = parserPtr->idx-2;
-            size_t lineSize = newCRLF - parserPtr->idxLastCrLf;
-
-            CheckUnsolicited((char*)&(parserPtr->buffer[parserPtr->idxLastCrLf]),
-                              lineSize,
-                              &interfacePtr->unsolicitedList);
+            CheckUnsolicited(parserPtr->linePtr,
+                             parserPtr->lineSize,
+                             &interfacePtr->unsolicitedList);
             break;
         }
         default:
@@ -1078,35 +1119,7 @@ static void StartingState
     switch (input)
     {
         case PARSER_CRLF:
-            rxParserPtr->rxData.idxLastCrLf = rxParserPtr->rxData.idx;
-            UpdateTransitionParser(rxParserPtr,input,ProcessingState);
-            break;
-        case PARSER_CHAR:
-            UpdateTransitionParser(rxParserPtr,input,InitializingState);
-            break;
-        default:
-            break;
-    }
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * This function is a state of the Rx data parser.
- *
- */
-//--------------------------------------------------------------------------------------------------
-static void InitializingState
-(
-    RxParserPtr_t rxParserPtr,
-    RxEvent_t     input
-)
-{
-    LE_DEBUG("%d", input);
-
-    switch (input)
-    {
-        case PARSER_CRLF:
-            rxParserPtr->rxData.idxLastCrLf = rxParserPtr->rxData.idx;
+            // Drop what was received before the first CRLF
             UpdateTransitionParser(rxParserPtr,input,ProcessingState);
             break;
         default:
@@ -1174,8 +1187,6 @@ static void SendLine
     ClientStatePtr_t clientStatePtr = &rxParserPtr->interfacePtr->clientState;
 
     (clientStatePtr->curState)(clientStatePtr,EVENT_PROCESSLINE);
-
-    rxParserPtr->rxData.idxLastCrLf = rxParserPtr->rxData.idx;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1296,6 +1307,31 @@ static void UnsolicitedPoolDestructor
     le_ref_DeleteRef(UnsolRefMap, unsolicitedPtr->ref);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function is the destructor for RspHandler_t struct
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void RspHandlerPoolDestructor
+(
+    void *ptr
+)
+{
+    RspHandler_t* rspHandlerPtr = ptr;
+    le_dls_List_t* listPtr = &rspHandlerPtr->interfacePtr->rspHandlerList;
+
+    if ( le_dls_IsInList(listPtr, &rspHandlerPtr->link) )
+    {
+        le_dls_Remove(listPtr, &rspHandlerPtr->link);
+    }
+
+    if (rspHandlerPtr->ref)
+    {
+        le_ref_DeleteRef(RspHandlerRefMap, rspHandlerPtr->ref);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is used to get the intermediate response at specified index
@@ -1348,6 +1384,22 @@ static void RemoveUnsolicited
     le_mem_Release(unsolicitedPtr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function removes a command response handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RemoveRspHandler
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    RspHandler_t* rspHandlerPtr = param1Ptr;
+
+    le_mem_Release(rspHandlerPtr);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function must be called to create a new AT command.
@@ -1750,6 +1802,77 @@ le_result_t le_atClient_Send
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to send an AT Command without waiting for its responses.
+ *
+ * The responses of the command are reported to the handlers added with
+ * le_atClient_AddCommandResponseHandler() on the command device.
+ *
+ * @return
+ *      - LE_FAULT when function failed
+ *      - LE_BUSY when the command is already being sent
+ *      - LE_OK when function succeed
+ *
+ * @note If the AT Command reference is invalid, a fatal error occurs,
+ *       the function won't return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_atClient_SendAsync
+(
+    le_atClient_CmdRef_t cmdRef
+        ///< [IN] AT Command
+)
+{
+    AtCmd_t* cmdPtr = le_ref_Lookup(CmdRefMap, cmdRef);
+    if (cmdPtr == NULL)
+    {
+        LE_KILL_CLIENT("Invalid reference (%p) provided!", cmdRef);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (cmdPtr->interfacePtr == NULL)
+    {
+        LE_ERROR("no device set");
+        return LE_FAULT;
+    }
+
+    if (le_dls_NumLinks(&cmdPtr->expectResponseList) == 0)
+    {
+        LE_ERROR("no final responses set");
+        return LE_FAULT;
+    }
+
+    if (cmdPtr->isAsync)
+    {
+        LE_ERROR("Command %s already sent", cmdPtr->cmd);
+        return LE_BUSY;
+    }
+
+    if (le_dls_NumLinks(&cmdPtr->ExpectintermediateResponseList) == 0)
+    {
+        if (le_atClient_SetIntermediateResponse(cmdRef,"") != LE_OK)
+        {
+            LE_ERROR("Can't set intermediate rsp");
+            return LE_FAULT;
+        }
+    }
+
+    ReleaseRspStringList(&cmdPtr->responseList);
+
+    // The command is kept until its final response even if the client deletes it meanwhile.
+    cmdPtr->isAsync = true;
+    le_mem_AddRef(cmdPtr);
+    le_dls_Queue(&cmdPtr->interfacePtr->atCommandList, &cmdPtr->link);
+
+    le_event_QueueFunctionToThread(cmdPtr->interfacePtr->threadRef,
+                                   SendCommand,
+                                   (void*) cmdPtr->interfacePtr,
+                                   (void*) NULL);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * This function is used to get the first intermediate response.
@@ -2081,6 +2204,74 @@ void le_atClient_RemoveUnsolicitedResponseHandler
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * This event provides the responses of the commands sent with le_atClient_SendAsync() on a
+ * device. Only the commands created by the same client are reported.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+le_atClient_CommandResponseHandlerRef_t le_atClient_AddCommandResponseHandler
+(
+    le_atClient_DeviceRef_t devRef,
+        ///< [IN] Device to listen
+
+    le_atClient_CommandResponseHandlerFunc_t handlerPtr,
+        ///< [IN]
+
+    void* contextPtr
+        ///< [IN]
+)
+{
+    DeviceContext_t* interfacePtr = le_ref_Lookup(DevicesRefMap, devRef);
+
+    if (interfacePtr == NULL)
+    {
+        LE_ERROR("Invalid device");
+        return NULL;
+    }
+
+    RspHandler_t* rspHandlerPtr = le_mem_ForceAlloc(RspHandlerPool);
+
+    memset(rspHandlerPtr, 0, sizeof(RspHandler_t));
+    rspHandlerPtr->handlerPtr = handlerPtr;
+    rspHandlerPtr->contextPtr = contextPtr;
+    rspHandlerPtr->ref = le_ref_CreateRef(RspHandlerRefMap, rspHandlerPtr);
+    rspHandlerPtr->interfacePtr = interfacePtr;
+    rspHandlerPtr->link = LE_DLS_LINK_INIT;
+    rspHandlerPtr->sessionRef = le_atClient_GetClientSessionRef();
+
+    le_dls_Queue(&interfacePtr->rspHandlerList, &rspHandlerPtr->link);
+
+    return rspHandlerPtr->ref;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove handler function for EVENT 'le_atClient_CommandResponse'
+ */
+//--------------------------------------------------------------------------------------------------
+void le_atClient_RemoveCommandResponseHandler
+(
+    le_atClient_CommandResponseHandlerRef_t handlerRef
+        ///< [IN]
+)
+{
+    RspHandler_t* rspHandlerPtr = le_ref_Lookup(RspHandlerRefMap, handlerRef);
+
+    if (rspHandlerPtr)
+    {
+        le_ref_DeleteRef(RspHandlerRefMap, handlerRef);
+        rspHandlerPtr->ref = NULL;
+
+        // The handlers list belongs to the device thread
+        le_event_QueueFunctionToThread(rspHandlerPtr->interfacePtr->threadRef,
+                                       RemoveRspHandler,
+                                       (void*) rspHandlerPtr,
+                                       (void*) NULL);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Handler function to the close session service
@@ -2097,6 +2288,20 @@ static void CloseSessionEventHandler
     AtCmd_t *cmdPtr = NULL;
     DeviceContext_t *devPtr = NULL;
     Unsolicited_t *unsolPtr  = NULL;
+    RspHandler_t *rspHandlerPtr = NULL;
+
+    iter = le_ref_GetIterator(RspHandlerRefMap);
+    while (LE_OK == le_ref_NextNode(iter))
+    {
+        rspHandlerPtr = (RspHandler_t *) le_ref_GetValue(iter);
+        if (rspHandlerPtr)
+        {
+            if (sessionRef == rspHandlerPtr->sessionRef)
+            {
+                le_mem_Release(rspHandlerPtr);
+            }
+        }
+    }
 
     iter = le_ref_GetIterator(UnsolRefMap);
     while (LE_OK == le_ref_NextNode(iter))
@@ -2249,6 +2454,12 @@ COMPONENT_INIT
     le_mem_SetDestructor(UnsolicitedPool,UnsolicitedPoolDestructor);
     UnsolRefMap = le_ref_CreateMap("UnsolRefMap", UNSOLICITED_POOL_SIZE);
 
+    // Command response handlers pool allocation
+    RspHandlerPool = le_mem_CreatePool("AtRspHandlerPool",sizeof(RspHandler_t));
+    le_mem_ExpandPool(RspHandlerPool,RSP_HANDLER_POOL_SIZE);
+    le_mem_SetDestructor(RspHandlerPool,RspHandlerPoolDestructor);
+    RspHandlerRefMap = le_ref_CreateMap("RspHandlerRefMap", RSP_HANDLER_POOL_SIZE);
+
     // Add a handler to the close session service
     le_msg_AddServiceCloseHandler(
         le_atClient_GetServiceRef(), CloseSessionEventHandler, NULL);
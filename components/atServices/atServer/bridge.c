@@ -59,15 +59,16 @@
 //--------------------------------------------------------------------------------------------------
 typedef struct
 {
-    le_thread_Ref_t                             threadRef;          ///< AT client thread reference
-    le_thread_Ref_t                             mainThreadRef;      ///< main thread reference
     le_atServer_BridgeRef_t                     bridgeRef;          ///< Bridge reference
     le_dls_List_t                               devicesList;        ///< list of devices bridged
                                                                     ///< with the current bridge
+    le_dls_List_t                               pendingCmdList;     ///< commands waiting for the
+                                                                    ///< modem responses
     le_atClient_DeviceRef_t                     atClientRef;        ///< AT client device reference
     le_atClient_UnsolicitedResponseHandlerRef_t unsolHandlerRef;    ///< AT cleint unsolicited
                                                                     ///< handler refenrece
-    le_sem_Ref_t                                semRef;             ///< semaphore reference
+    le_atClient_CommandResponseHandlerRef_t     rspHandlerRef;      ///< AT client command
+                                                                    ///< response handler reference
     le_msg_SessionRef_t                         sessionRef;         ///< session reference
 }
 BridgeCtx_t;
@@ -85,6 +86,9 @@ typedef struct
     char                             cmd[LE_ATDEFS_COMMAND_MAX_BYTES];  ///< cmd to be sent to AT
                                                                     ///< client
     void*                            refPtr;                        ///< self reference
+    le_dls_List_t*                   pendingListPtr;                ///< pending list of the bridge
+                                                                    ///< the command is sent on
+    le_dls_Link_t                    link;                          ///< link in pending list
 }
 ModemCmdDesc_t;
 
@@ -140,14 +144,6 @@ static le_mem_PoolRef_t    ModemCmdPool;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t ModemCmdRefMap;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Bridge mutex
- *
- */
-//--------------------------------------------------------------------------------------------------
-static le_mutex_Ref_t BridgeMutexRef;
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Success responses strings array
@@ -211,6 +207,12 @@ static void ModemCmdPoolDestructor
         }
     }
 
+    // Stop waiting for the modem responses
+    if (modemCmdDescPtr->pendingListPtr)
+    {
+        le_dls_Remove(modemCmdDescPtr->pendingListPtr, &modemCmdDescPtr->link);
+    }
+
     // Clean AT client contexts
     if (modemCmdDescPtr->atClientCmdRef)
     {
@@ -237,13 +239,6 @@ static void BridgePoolDestructor
 {
     BridgeCtx_t* bridgePtr = ptr;
 
-    // Remove the trhread
-    if (bridgePtr->threadRef)
-    {
-        le_thread_Cancel(bridgePtr->threadRef);
-        le_thread_Join(bridgePtr->threadRef, NULL);
-    }
-
     // Remove bridge reference
     if (bridgePtr->bridgeRef)
     {
@@ -256,15 +251,33 @@ static void BridgePoolDestructor
         le_atClient_RemoveUnsolicitedResponseHandler(bridgePtr->unsolHandlerRef);
     }
 
-    // Close AT commands client
-    if (bridgePtr->atClientRef)
+    // Remove AT client command response handler
+    if (bridgePtr->rspHandlerRef)
     {
-        le_atClient_Stop(bridgePtr->atClientRef);
+        le_atClient_RemoveCommandResponseHandler(bridgePtr->rspHandlerRef);
+    }
+
+    // Forget the commands still waiting for the modem, their responses are not expected anymore
+    le_dls_Link_t* cmdLinkPtr = le_dls_Pop(&bridgePtr->pendingCmdList);
+
+    while (NULL != cmdLinkPtr)
+    {
+        ModemCmdDesc_t* modemCmdDescPtr = CONTAINER_OF(cmdLinkPtr, ModemCmdDesc_t, link);
+
+        modemCmdDescPtr->pendingListPtr = NULL;
+
+        if (LE_OK == le_atClient_Delete(modemCmdDescPtr->atClientCmdRef))
+        {
+            modemCmdDescPtr->atClientCmdRef = NULL;
+        }
+
+        cmdLinkPtr = le_dls_Pop(&bridgePtr->pendingCmdList);
     }
 
-    if (bridgePtr->semRef)
+    // Close AT commands client
+    if (bridgePtr->atClientRef)
     {
-        le_sem_Delete(bridgePtr->semRef);
+        le_atClient_Stop(bridgePtr->atClientRef);
     }
 
     // Release devices list
@@ -282,22 +295,6 @@ static void BridgePoolDestructor
     }
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Bridge Thread Destructor
- * This function is called in bridge thread when the thread gets cancelled.
- */
-//--------------------------------------------------------------------------------------------------
-static void BridgeThreadDestructor
-(
-    void* paramPtr
- )
-{
-    // Set thread destructor to disconnect the service to avoid memory leak
-    // when the thread gets cancelled.
-    le_atClient_DisconnectService();
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Treat error
@@ -340,194 +337,185 @@ static void TreatCommandError
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Treat response of the AT command (coming from modem)
- * This function is called in the main thread (mandatory as this function calls le_atServer_xxx
- * functions).
+ * Find the bridged command waiting for the responses of an AT client command
  *
+ * @return
+ *      - Pointer to the modem command description.
+ *      - NULL if the AT client command is not waited by the bridge.
  */
 //--------------------------------------------------------------------------------------------------
-static void TreatResponse
+static ModemCmdDesc_t* FindPendingCmd
 (
-    void* param1Ptr,
-    void* param2Ptr
+    BridgeCtx_t*         bridgePtr,
+    le_atClient_CmdRef_t atClientCmdRef
 )
 {
-    void* modemCmdDescRef = param1Ptr;
+    le_dls_Link_t* linkPtr = le_dls_Peek(&bridgePtr->pendingCmdList);
 
-    ModemCmdDesc_t* modemCmdDescPtr = le_ref_Lookup(ModemCmdRefMap, modemCmdDescRef);
+    while (NULL != linkPtr)
+    {
+        ModemCmdDesc_t* modemCmdDescPtr = CONTAINER_OF(linkPtr, ModemCmdDesc_t, link);
+
+        if (modemCmdDescPtr->atClientCmdRef == atClientCmdRef)
+        {
+            return modemCmdDescPtr;
+        }
+
+        linkPtr = le_dls_PeekNext(&bridgePtr->pendingCmdList, linkPtr);
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Treat a response of the AT command (coming from modem)
+ * This function is called in the main thread by the AT client, as soon as a response line is
+ * received: intermediate responses are forwarded to the host without being stored.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void CommandResponseHandler
+(
+    le_atClient_CmdRef_t cmdRef,
+    le_result_t          result,
+    const char*          rspPtr,
+    void*                contextPtr
+)
+{
+    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, contextPtr);
+    if (NULL == bridgePtr)
+    {
+        LE_ERROR("bridge resources are not found");
+        return;
+    }
+
+    ModemCmdDesc_t* modemCmdDescPtr = FindPendingCmd(bridgePtr, cmdRef);
     if (NULL == modemCmdDescPtr)
     {
         LE_ERROR("modem command is not found");
         return;
     }
 
+    void* modemCmdDescRef = modemCmdDescPtr->refPtr;
     le_atServer_CmdRef_t atServerCmdRef = modemCmdDescPtr->atServerCmdRef;
-    le_atClient_CmdRef_t atClientCmdRef = modemCmdDescPtr->atClientCmdRef;
-    char rsp[LE_ATDEFS_RESPONSE_MAX_BYTES];
-
-    // Get all intermediate responses from the AT client, and send back to the host through the AT
-    // server.
-    if (LE_OK == le_atClient_GetFirstIntermediateResponse(atClientCmdRef,
-                                                          rsp,
-                                                          LE_ATDEFS_RESPONSE_MAX_BYTES))
+
+    // Send the intermediate response back to the host through the AT server.
+    if (LE_IN_PROGRESS == result)
     {
-        do
+        if (LE_OK != le_atServer_SendIntermediateResponse(atServerCmdRef, rspPtr))
         {
-            if (LE_OK != le_atServer_SendIntermediateResponse(atServerCmdRef, rsp))
-            {
-                LE_ERROR("Failed to send intermediate response");
-                TreatCommandError(modemCmdDescRef, NULL);
-                return;
-            }
-            memset(rsp, 0, LE_ATDEFS_RESPONSE_MAX_BYTES);
+            LE_ERROR("Failed to send intermediate response");
+            TreatCommandError(modemCmdDescRef, NULL);
         }
-        while (LE_OK == le_atClient_GetNextIntermediateResponse(atClientCmdRef,
-                                                                rsp,
-                                                                LE_ATDEFS_RESPONSE_MAX_BYTES));
+        return;
     }
 
-    // Get the final response from the AT client, and send back to the host through the AT
-    // server.
-    if (LE_OK == le_atClient_GetFinalResponse(atClientCmdRef,
-                                              rsp,
-                                              LE_ATDEFS_RESPONSE_MAX_BYTES))
-    {
-        int i;
-        le_atServer_FinalRsp_t finalRsp = LE_ATSERVER_ERROR;
-
-        // check if the response code is an error
-        for (i=0; i < NUM_ARRAY_MEMBERS(SuccessRspCode); i++)
-        {
-            if (0 == strncmp(SuccessRspCode[i], rsp, strlen(rsp)))
-            {
-                finalRsp = LE_ATSERVER_OK;
-                break;
-            }
-        }
+    // The command is over on the modem side
+    le_dls_Remove(&bridgePtr->pendingCmdList, &modemCmdDescPtr->link);
+    modemCmdDescPtr->pendingListPtr = NULL;
 
-        // Need free the atClientCmdRef before processing next concatenated AT bridge command
-        // otherwise atClientCmdRef of next command will be cleared and cause atServer crash.
-        if (LE_OK != le_atClient_Delete(modemCmdDescPtr->atClientCmdRef))
-        {
-            LE_ERROR("Error in deleting atClient reference");
-        }
-        else
-        {
-            modemCmdDescPtr->atClientCmdRef = 0;
-        }
+    if (LE_OK != result)
+    {
+        LE_ERROR("Error in sending AT command, %d", result);
+        TreatCommandError(modemCmdDescRef, NULL);
+        return;
+    }
 
-        LE_DEBUG("finalRsp = %s", (finalRsp == LE_ATSERVER_OK) ? "ok": "error");
+    // Send the final response back to the host through the AT server.
+    int i;
+    le_atServer_FinalRsp_t finalRsp = LE_ATSERVER_ERROR;
 
-        if (LE_OK != le_atServer_SendFinalResponse(atServerCmdRef,
-                                                   finalRsp,
-                                                   true,
-                                                   rsp))
+    // check if the response code is an error
+    for (i=0; i < NUM_ARRAY_MEMBERS(SuccessRspCode); i++)
+    {
+        if (0 == strncmp(SuccessRspCode[i], rspPtr, strlen(rspPtr)))
         {
-            LE_ERROR("Failed to send final response");
-            TreatCommandError(modemCmdDescRef, NULL);
-            return;
+            finalRsp = LE_ATSERVER_OK;
+            break;
         }
+    }
 
-        // "ERROR" final response could mean that the AT command doesn't exist => delete it in this
-        // case
-        if (0 == strncmp(rsp, ErrorString, sizeof(ErrorString)))
-        {
-            LE_DEBUG("Remove AT command");
-            le_mem_Release(modemCmdDescPtr);
-        }
+    // Need free the atClientCmdRef before processing next concatenated AT bridge command
+    // otherwise atClientCmdRef of next command will be cleared and cause atServer crash.
+    if (LE_OK != le_atClient_Delete(modemCmdDescPtr->atClientCmdRef))
+    {
+        LE_ERROR("Error in deleting atClient reference");
     }
     else
     {
-        LE_ERROR("Failed to get final response");
+        modemCmdDescPtr->atClientCmdRef = 0;
+    }
+
+    LE_DEBUG("finalRsp = %s", (finalRsp == LE_ATSERVER_OK) ? "ok": "error");
+
+    if (LE_OK != le_atServer_SendFinalResponse(atServerCmdRef,
+                                               finalRsp,
+                                               true,
+                                               rspPtr))
+    {
+        LE_ERROR("Failed to send final response");
         TreatCommandError(modemCmdDescRef, NULL);
+        return;
+    }
+
+    // "ERROR" final response could mean that the AT command doesn't exist => delete it in this
+    // case
+    if (0 == strncmp(rspPtr, ErrorString, sizeof(ErrorString)))
+    {
+        LE_DEBUG("Remove AT command");
+        le_mem_Release(modemCmdDescPtr);
     }
 }
 
 //--------------------------------------------------------------------------------------------------
 /**
  * Send the AT command to the modem through the AT client
- * This function is called in a separate thread: le_atClient_SetCommandAndSend is synchronous, and
- * can be locked many seconds (>30s for some of them).
+ * The command is sent asynchronously: its responses are given to CommandResponseHandler() from
+ * the event loop, so the main thread is never locked by a long AT command.
  *
+ * @return
+ *      - LE_OK            The command is sent.
+ *      - LE_BUSY          The command is already waiting for the modem responses.
+ *      - LE_FAULT         The function failed to send the command.
  */
 //--------------------------------------------------------------------------------------------------
-static void SendAtCommand
+static le_result_t SendAtCommand
 (
-    void* param1Ptr,
-    void* param2Ptr
+    ModemCmdDesc_t* modemCmdDescPtr,
+    BridgeCtx_t*    bridgePtr
 )
 {
-    void* modemCmdDescRef = param1Ptr;
-    BridgeCtx_t* bridgeRef = param2Ptr;
-
-    le_mutex_Lock(BridgeMutexRef);
+    LE_DEBUG("AT command to be sent to the modem: %s", modemCmdDescPtr->cmd);
 
-    ModemCmdDesc_t* modemCmdDescPtr = le_ref_Lookup(ModemCmdRefMap, modemCmdDescRef);
-    BridgeCtx_t* bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
-    if (( NULL == modemCmdDescPtr ) || ( NULL == bridgePtr ))
+    if (modemCmdDescPtr->pendingListPtr)
     {
-        LE_ERROR("bridge resources are not found");
-        le_mutex_Unlock(BridgeMutexRef);
-        return;
+        LE_ERROR("AT command %s already in progress", modemCmdDescPtr->cmd);
+        return LE_BUSY;
     }
 
-    LE_DEBUG("AT command to be sent to the modem: %s", modemCmdDescPtr->cmd);
-
-    // At this point, modemCmdDescPtr and bridgePtr are available , make a local copy for
-    // some parameters passed to le_atClient_SetCommandAndSend().
-    le_atClient_CmdRef_t atClientCmdRef = NULL;
-    le_atClient_DeviceRef_t atClientDevicetRef = bridgePtr->atClientRef;
-    le_thread_Ref_t mainThreadRef = bridgePtr->mainThreadRef;
-    char   atClientCmd[LE_ATDEFS_COMMAND_MAX_BYTES] = {0};
-    snprintf(atClientCmd, LE_ATDEFS_COMMAND_MAX_BYTES, "%s", modemCmdDescPtr->cmd);
-    le_mutex_Unlock(BridgeMutexRef);
-
-    // Send AT command to the modem
-    le_result_t result = le_atClient_SetCommandAndSend(&atClientCmdRef,
-                                                       atClientDevicetRef,
-                                                       atClientCmd,
-                                                       "",
-                                                       AtClientFinalResponse,
-                                                       AT_CLIENT_TIMEOUT);
-
-    // Since le_atClient_SetCommandAndSend() is a blocking API which is executed in
-    // bridge thread, it's possible the brige device is already released in main thread
-    // after the API is returned, thus we need check again if bridge pointers are
-    // still available before using them.
-    le_mutex_Lock(BridgeMutexRef);
-
-    modemCmdDescPtr = le_ref_Lookup(ModemCmdRefMap, modemCmdDescRef);
-    bridgePtr = le_ref_Lookup(BridgesRefMap, bridgeRef);
-    if (( NULL == modemCmdDescPtr ) || ( NULL == bridgePtr ))
+    le_atClient_CmdRef_t atClientCmdRef = le_atClient_Create();
+    if (NULL == atClientCmdRef)
     {
-        LE_ERROR("bridge resources are not found");
-        le_mutex_Unlock(BridgeMutexRef);
-        return;
+        return LE_FAULT;
     }
 
-    if (result != LE_OK)
+    if ((LE_OK != le_atClient_SetCommand(atClientCmdRef, modemCmdDescPtr->cmd)) ||
+        (LE_OK != le_atClient_SetDevice(atClientCmdRef, bridgePtr->atClientRef)) ||
+        (LE_OK != le_atClient_SetIntermediateResponse(atClientCmdRef, "")) ||
+        (LE_OK != le_atClient_SetFinalResponse(atClientCmdRef, AtClientFinalResponse)) ||
+        (LE_OK != le_atClient_SetTimeout(atClientCmdRef, AT_CLIENT_TIMEOUT)) ||
+        (LE_OK != le_atClient_SendAsync(atClientCmdRef)))
     {
-        LE_ERROR("Error in sending AT command");
-        // Treat the error in the main thread
-        le_event_QueueFunctionToThread(mainThreadRef,
-                                       TreatCommandError,
-                                       modemCmdDescRef,
-                                       NULL);
-
-        le_mutex_Unlock(BridgeMutexRef);
-        return;
+        le_atClient_Delete(atClientCmdRef);
+        return LE_FAULT;
     }
 
-    // Copy back atClientCmdRef which will be used in response.
     modemCmdDescPtr->atClientCmdRef = atClientCmdRef;
+    modemCmdDescPtr->pendingListPtr = &bridgePtr->pendingCmdList;
+    le_dls_Queue(&bridgePtr->pendingCmdList, &modemCmdDescPtr->link);
 
-    // Treat the send of responses in the main thread.
-    le_event_QueueFunctionToThread(mainThreadRef,
-                                   TreatResponse,
-                                   modemCmdDescRef,
-                                   NULL);
-
-    le_mutex_Unlock(BridgeMutexRef);
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -832,11 +820,11 @@ static void AtCmdHandler
         return;
     }
 
-    // Treat the AT commands in the Bridge thread in order to not lock the main thread
-    le_event_QueueFunctionToThread(bridgePtr->threadRef,
-                                   SendAtCommand,
-                                   modemCmdDescRef,
-                                   bridgeRef);
+    if (LE_OK != SendAtCommand(modemCmdDescPtr, bridgePtr))
+    {
+        LE_ERROR("Error in sending AT command");
+        TreatCommandError(modemCmdDescRef, NULL);
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -880,30 +868,6 @@ static void UnsolicitedResponseHandler
     }
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Thread used for the bridge
- * This thread is used to send the AT command to the modem (called function is synchronous, and
- * may take a lot of time).
- */
-//--------------------------------------------------------------------------------------------------
-static void *BridgeThread
-(
-    void* context
-)
-{
-    le_atClient_ConnectService();
-
-    le_thread_AddDestructor(BridgeThreadDestructor, (void *)NULL);
-
-    BridgeCtx_t* bridgeCtxPtr = context;
-
-    le_sem_Post(bridgeCtxPtr->semRef);
-
-    le_event_RunLoop();
-    return NULL;
-}
-
 //--------------------------------------------------------------------------------------------------
 //                                       Public declarations
 //--------------------------------------------------------------------------------------------------
@@ -992,9 +956,6 @@ void bridge_Init
     ModemCmdRefMap = le_ref_CreateMap("BridgeModemCmdRefMap", CMD_POOL_SIZE);
     le_mem_SetDestructor(ModemCmdPool, ModemCmdPoolDestructor);
 
-    // Create bridge mutex
-    BridgeMutexRef =  le_mutex_CreateRecursive("BridgeMutex");
-
     // Build string for AT client final response
     int i = 0;
     bool firstLoop = true;
@@ -1031,52 +992,33 @@ le_atServer_BridgeRef_t bridge_Open
     int fd
 )
 {
-    char name[THREAD_NAME_MAX_LENGTH];
-    static uint32_t threadNumber = 0;
-
-    snprintf(name, THREAD_NAME_MAX_LENGTH, "BridgeThread-%d", threadNumber);
-
     BridgeCtx_t* bridgeCtxPtr = le_mem_ForceAlloc(BridgesPool);
     memset(bridgeCtxPtr, 0, sizeof(BridgeCtx_t));
 
-
     bridgeCtxPtr->bridgeRef = le_ref_CreateRef(BridgesRefMap, bridgeCtxPtr);
     bridgeCtxPtr->devicesList = LE_DLS_LIST_INIT;
+    bridgeCtxPtr->pendingCmdList = LE_DLS_LIST_INIT;
 
-    bridgeCtxPtr->threadRef = le_thread_Create(name, BridgeThread, bridgeCtxPtr);
-
-    if (!bridgeCtxPtr->threadRef)
-    {
-        LE_ERROR("Error in thread creation");
-        return NULL;
-    }
-
-    le_thread_SetJoinable(bridgeCtxPtr->threadRef);
-
-    memset(name, 0, THREAD_NAME_MAX_LENGTH);
-    snprintf(name, THREAD_NAME_MAX_LENGTH, "BridgeSem-%d", threadNumber);
-
-    bridgeCtxPtr->semRef = le_sem_Create(name, 0);
-
-    le_thread_Start(bridgeCtxPtr->threadRef);
+    // Create the bridge with the AT client
+    // fd now belongs to AT command client
+    bridgeCtxPtr->atClientRef = le_atClient_Start(fd);
 
-    le_clk_Time_t timeToWait={30,0};
-    if (le_sem_WaitWithTimeOut(bridgeCtxPtr->semRef, timeToWait) != LE_OK)
+    if (NULL == bridgeCtxPtr->atClientRef)
     {
-        LE_ERROR("Semaphore error");
+        LE_ERROR("ATClient error");
         le_mem_Release(bridgeCtxPtr);
         return NULL;
     }
 
-    bridgeCtxPtr->mainThreadRef = le_thread_GetCurrent();
-
-    // Create the bridge with the AT client
-    // fd now belongs to AT command client
-    bridgeCtxPtr->atClientRef = le_atClient_Start(fd);
+    // Subscribe to the responses of the commands sent through the bridge
+    bridgeCtxPtr->rspHandlerRef = le_atClient_AddCommandResponseHandler(
+                                                                bridgeCtxPtr->atClientRef,
+                                                                CommandResponseHandler,
+                                                                bridgeCtxPtr->bridgeRef);
 
-    if (NULL == bridgeCtxPtr->atClientRef)
+    if (NULL == bridgeCtxPtr->rspHandlerRef)
     {
-        LE_ERROR("ATClient error");
+        LE_ERROR("ATClient handler error");
         le_mem_Release(bridgeCtxPtr);
         return NULL;
     }
@@ -1089,7 +1031,6 @@ le_atServer_BridgeRef_t bridge_Open
                                                                         bridgeCtxPtr,
                                                                         1);
 
-    threadNumber++;
     bridgeCtxPtr->sessionRef = le_atServer_GetClientSessionRef();
 
     return bridgeCtxPtr->bridgeRef;
@@ -1270,9 +1211,7 @@ void bridge_CleanContext
 
             LE_DEBUG("deleting bridgeRef %p", bridgePtr->bridgeRef);
 
-            le_mutex_Lock(BridgeMutexRef);
             le_mem_Release(bridgePtr);
-            le_mutex_Unlock(BridgeMutexRef);
         }
     }
 }
@@ -1325,8 +1264,6 @@ le_result_t bridge_ReleaseModemCmd
         return LE_FAULT;
     }
 
-    le_mutex_Lock(BridgeMutexRef);
     le_mem_Release(cmdDescPtr);
-    le_mutex_Unlock(BridgeMutexRef);
     return LE_OK;
 }
@@ -47,6 +47,20 @@
 //--------------------------------------------------------------------------------------------------
 #define RSP_POOL_SIZE       10
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of responses sent with a single write
+ */
+//--------------------------------------------------------------------------------------------------
+#define RSP_BATCH_MAX       8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of buffers to write a response: leading CRLF, response, trailing CRLF
+ */
+//--------------------------------------------------------------------------------------------------
+#define RSP_IOV_MAX         3
+
 //--------------------------------------------------------------------------------------------------
 /**
  * User-defined error strings pool size
@@ -519,20 +533,6 @@ typedef struct
 }
 RspString_t;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * RX parser state.
- *
- */
-//--------------------------------------------------------------------------------------------------
-typedef enum
-{
-    PARSER_SEARCH_A,
-    PARSER_SEARCH_T,
-    PARSER_SEARCH_CR
-}
-RxParserState_t;
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Command parser state.
@@ -622,7 +622,6 @@ ATCmdSubscribed_t;
 typedef struct
 {
     char                    foundCmd[LE_ATDEFS_COMMAND_MAX_LEN];    ///< cmd found in input string
-    RxParserState_t         rxState;                                ///< input string parser state
     CmdParserState_t        cmdParser;                              ///< cmd parser state
     CmdParserState_t        lastCmdParserState;                     ///< previous cmd parser state
     char*                   currentAtCmdPtr;                        ///< current AT cmd position
@@ -680,10 +679,7 @@ typedef struct
 {
     Device_t                device;                               ///< data of the connected device
     le_atServer_DeviceRef_t ref;                                  ///< reference of the device
-    char                    currentCmd[LE_ATDEFS_COMMAND_MAX_LEN];///< input buffer
-    uint32_t                indexRead;                            ///< last read character position
-                                                                  ///< in currentCmd
-    uint32_t                parseIndex;                           ///< current index in currentCmd
+    le_dev_Ring_t           rxRing;                               ///< input buffer
     CmdParser_t             cmdParser;                            ///< parsing context
     FinalRsp_t              finalRsp;                             ///< final response to be sent
     bool                    processing;                           ///< is an AT command in progress
@@ -870,30 +866,103 @@ static void AtCmdPoolDestructor
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Send a response on the opened device.
+ * Describe a response and its framing as buffers to write, without copying the response.
  *
+ * @return number of buffers filled in iovPtr (at most RSP_IOV_MAX)
  */
 //--------------------------------------------------------------------------------------------------
-static void SendRspString
+static int BuildRspIov
 (
     DeviceContext_t* devPtr,
-    const char* rspPtr
+    const char* rspPtr,
+    struct iovec* iovPtr
 )
 {
-    char string[LE_ATDEFS_RESPONSE_MAX_BYTES+4] = {0};
+    static const char crlf[] = "\r\n";
+    int iovCount = 0;
 
     if ((devPtr->rspState == AT_RSP_FINAL) || (devPtr->rspState == AT_RSP_UNSOLICITED) ||
         ((devPtr->rspState == AT_RSP_INTERMEDIATE) && devPtr->isFirstIntermediate))
     {
-        snprintf(string, LE_ATDEFS_RESPONSE_MAX_BYTES+4, "\r\n%s\r\n", rspPtr);
+        iovPtr[iovCount].iov_base = (void*)crlf;
+        iovPtr[iovCount].iov_len = sizeof(crlf) - 1;
+        iovCount++;
         devPtr->isFirstIntermediate = false;
     }
-    else
+
+    iovPtr[iovCount].iov_base = (void*)rspPtr;
+    iovPtr[iovCount].iov_len = strnlen(rspPtr, LE_ATDEFS_RESPONSE_MAX_LEN);
+    iovCount++;
+
+    iovPtr[iovCount].iov_base = (void*)crlf;
+    iovPtr[iovCount].iov_len = sizeof(crlf) - 1;
+    iovCount++;
+
+    return iovCount;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a response on the opened device.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendRspString
+(
+    DeviceContext_t* devPtr,
+    const char* rspPtr
+)
+{
+    struct iovec iov[RSP_IOV_MAX];
+    int iovCount = BuildRspIov(devPtr, rspPtr, iov);
+
+    le_dev_WriteVec(&devPtr->device, iov, iovCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a final response followed by the backup unsolicited responses on the opened device.
+ *
+ * The responses are gathered to be written with as few system calls as possible.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void SendFinalRspBatch
+(
+    DeviceContext_t* devPtr,
+    const char* rspPtr
+)
+{
+    struct iovec iov[RSP_IOV_MAX * (RSP_BATCH_MAX + 1)];
+    RspString_t* unsolPtr[RSP_BATCH_MAX];
+    int iovCount = BuildRspIov(devPtr, rspPtr, iov);
+    int unsolCount = 0;
+    int i;
+    le_dls_Link_t* linkPtr;
+
+    do
     {
-        snprintf(string, LE_ATDEFS_RESPONSE_MAX_BYTES+2, "%s\r\n", rspPtr);
-    }
+        linkPtr = le_dls_Pop(&devPtr->unsolicitedList);
+        if (linkPtr)
+        {
+            unsolPtr[unsolCount] = CONTAINER_OF(linkPtr, RspString_t, link);
+            iovCount += BuildRspIov(devPtr, unsolPtr[unsolCount]->resp, &iov[iovCount]);
+            unsolCount++;
+        }
+
+        if ((iovCount > 0) && ((NULL == linkPtr) || (RSP_BATCH_MAX == unsolCount)))
+        {
+            le_dev_WriteVec(&devPtr->device, iov, iovCount);
 
-    le_dev_Write(&devPtr->device, (uint8_t*)string, strlen(string));
+            for (i = 0; i < unsolCount; i++)
+            {
+                le_mem_Release(unsolPtr[i]);
+            }
+            iovCount = 0;
+            unsolCount = 0;
+        }
+    }
+    while (linkPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -988,6 +1057,7 @@ static void SendFinalRsp
 {
     UserErrorCode_t* errorCodePtr;
     size_t patternLength = 0;
+    const char* rspPtr = devPtr->finalRsp.resp;
 
     devPtr->rspState = AT_RSP_FINAL;
 
@@ -996,7 +1066,6 @@ static void SendFinalRsp
     if (devPtr->finalRsp.customStringAvailable && (MODE_DISABLED != ErrorCodesMode))
     {
         LE_DEBUG("Custom string mode");
-        SendRspString(devPtr, devPtr->finalRsp.resp);
         goto end_processing;
     }
 
@@ -1006,7 +1075,7 @@ static void SendFinalRsp
     // and the final response is not an error, we use it as a custom string
     if ((LE_ATSERVER_ERROR != devPtr->finalRsp.final) && patternLength)
     {
-        SendRspString(devPtr, devPtr->finalRsp.pattern);
+        rspPtr = devPtr->finalRsp.pattern;
         goto end_processing;
     }
 
@@ -1100,26 +1169,15 @@ static void SendFinalRsp
         default:
             break;
     }
-    SendRspString(devPtr, devPtr->finalRsp.resp);
 
 end_processing:
+    // Send the final response with the backup unsolicited responses
+    SendFinalRspBatch(devPtr, rspPtr);
+
     devPtr->processing = false;
 
     memset( &devPtr->cmdParser, 0, sizeof(CmdParser_t) );
     memset( &devPtr->finalRsp, 0, sizeof(FinalRsp_t) );
-
-    // Send backup unsolicited responses
-    le_dls_Link_t* linkPtr;
-
-    while ( (linkPtr = le_dls_Pop(&devPtr->unsolicitedList)) != NULL )
-    {
-        RspString_t* rspStringPtr = CONTAINER_OF(linkPtr,
-                                    RspString_t,
-                                    link);
-
-        SendRspString(devPtr, rspStringPtr->resp);
-        le_mem_Release(rspStringPtr);
-    }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1131,19 +1189,18 @@ end_processing:
 static void SendIntermediateRsp
 (
     DeviceContext_t* devPtr,
-    RspString_t* rspStringPtr
+    const char* rspPtr
 )
 {
-    if (rspStringPtr == NULL)
+    if (rspPtr == NULL)
     {
-        LE_ERROR("Bad rspStringPtr");
+        LE_ERROR("Bad rspPtr");
         return;
     }
 
     if (devPtr == NULL)
     {
         LE_ERROR("Bad devPtr");
-        le_mem_Release(rspStringPtr);
         return;
     }
 
@@ -1154,12 +1211,10 @@ static void SendIntermediateRsp
         (devPtr->cmdParser.currentCmdPtr && !((devPtr->cmdParser.currentCmdPtr)->processing)))
     {
         LE_ERROR("Command not processing anymore");
-        le_mem_Release(rspStringPtr);
         return;
     }
 
-    SendRspString(devPtr, rspStringPtr->resp);
-    le_mem_Release(rspStringPtr);
+    SendRspString(devPtr, rspPtr);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1171,19 +1226,18 @@ static void SendIntermediateRsp
 static void SendUnsolRsp
 (
     DeviceContext_t* devPtr,
-    RspString_t* rspStringPtr
+    const char* rspPtr
 )
 {
-    if (rspStringPtr == NULL)
+    if (rspPtr == NULL)
     {
-        LE_ERROR("Bad rspStringPtr");
+        LE_ERROR("Bad rspPtr");
         return;
     }
 
     if (devPtr == NULL)
     {
         LE_ERROR("Bad devPtr");
-        le_mem_Release(rspStringPtr);
         return;
     }
 
@@ -1191,11 +1245,14 @@ static void SendUnsolRsp
 
     if (!devPtr->processing && !devPtr->suspended)
     {
-        SendRspString(devPtr, rspStringPtr->resp);
-        le_mem_Release(rspStringPtr);
+        SendRspString(devPtr, rspPtr);
     }
     else
     {
+        // Keep a copy until the end of the command
+        RspString_t* rspStringPtr = le_mem_ForceAlloc(RspStringPool);
+        le_utf8_Copy(rspStringPtr->resp, rspPtr, LE_ATDEFS_RESPONSE_MAX_BYTES, NULL);
+        rspStringPtr->link = LE_DLS_LINK_INIT;
         le_dls_Queue(&devPtr->unsolicitedList, &(rspStringPtr->link));
     }
 }
@@ -2222,123 +2279,124 @@ sendErrorRsp:
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Parser incoming characters
+ * Parse a received line, ended by a carriage return
  *
+ * The line is modified in place.
  */
 //--------------------------------------------------------------------------------------------------
-static void ParseBuffer
+static void ParseLine
 (
-    DeviceContext_t* devPtr
+    DeviceContext_t* devPtr,
+    char* linePtr,
+    size_t lineLen
 )
 {
-    uint32_t i;
+    char* cmdPtr = NULL;
+    size_t cmdLen = 0;
+    size_t i;
 
-    for (i = devPtr->parseIndex; i < devPtr->indexRead; i++)
+    // Skip everything before the first "AT"
+    for (i = 0; (i + 1) < lineLen; i++)
     {
-        char input = devPtr->currentCmd[i];
-
-        switch (devPtr->cmdParser.rxState)
+        if ((( linePtr[i] == 'A' ) || ( linePtr[i] == 'a' )) &&
+            (( linePtr[i+1] == 'T' ) || ( linePtr[i+1] == 't' )))
         {
-            case PARSER_SEARCH_A:
-                if (( input == 'A' ) || ( input == 'a' ))
-                {
-                    devPtr->currentCmd[0] = input;
-                    devPtr->cmdParser.rxState = PARSER_SEARCH_T;
-                    devPtr->parseIndex = 1;
-                }
+            cmdPtr = &linePtr[i];
             break;
-            case PARSER_SEARCH_T:
-                switch (input)
-                {
-                    case 'T':
-                    case 't':
-                    {
-                        devPtr->currentCmd[1] = input;
-                        devPtr->cmdParser.rxState = PARSER_SEARCH_CR;
-                        devPtr->parseIndex = 2;
-                    }
-                    break;
-                    case 'A':
-                    case 'a':
-                        // do nothing in this case
-                    break;
-                    default:
-                    {
-                        devPtr->cmdParser.rxState = PARSER_SEARCH_A;
-                        devPtr->parseIndex = 0;
-                    }
-                    break;
-                }
-            break;
-            case PARSER_SEARCH_CR:
-            {
-                if ( input == AT_TOKEN_CR )
-                {
-                    if (!devPtr->processing)
-                    {
-                        devPtr->processing = true;
-
-                        devPtr->currentCmd[devPtr->parseIndex] = '\0';
-                        LE_DEBUG("Command found %s", devPtr->currentCmd);
-                        le_utf8_Copy(devPtr->cmdParser.foundCmd,
-                                     devPtr->currentCmd,
-                                     LE_ATDEFS_COMMAND_MAX_LEN,
-                                     NULL);
-
-                        ssize_t offset = strnlen(devPtr->cmdParser.foundCmd,
-                                                 sizeof(devPtr->cmdParser.foundCmd)) - 1;
-                        if((offset >= 0) && (offset < sizeof(devPtr->cmdParser.foundCmd)))
-                        {
-                            devPtr->cmdParser.lastCharPtr = devPtr->cmdParser.foundCmd + offset;
-
-                            devPtr->cmdParser.currentCharPtr = devPtr->cmdParser.foundCmd;
-                            devPtr->cmdParser.currentAtCmdPtr = devPtr->cmdParser.foundCmd;
+        }
+    }
 
-                            ParseAtCmd(devPtr);
-                        }
-                        // It's possible that non-ASCII char is detected because of line error
-                        // which casues string length to zero. In this case we assume it's an
-                        // illegal command.
-                        else
-                        {
-                            LE_WARN("Illegal command detected!");
-                            SendRspString(devPtr, "ERROR");
-                            devPtr->processing = false;
-                        }
-                    }
-                    else
-                    {
-                        LE_WARN("Command in progress");
-                        SendRspString(devPtr, "ERROR");
-                    }
+    if (NULL == cmdPtr)
+    {
+        return;
+    }
 
-                    devPtr->parseIndex=0;
-                    devPtr->cmdParser.rxState = PARSER_SEARCH_A;
-                }
-                // backspace character
-                else if ( input == 0x7F )
-                {
-                    devPtr->parseIndex--;
-                }
-                else
-                {
-                    devPtr->currentCmd[devPtr->parseIndex] = input;
-                    devPtr->parseIndex++;
-                }
+    // Apply the backspace characters
+    cmdLen = 2;
+    for (i = 2; &cmdPtr[i] < &linePtr[lineLen]; i++)
+    {
+        if ( cmdPtr[i] == 0x7F )
+        {
+            if (cmdLen > 2)
+            {
+                cmdLen--;
             }
-            break;
-            default:
-                LE_ERROR("bad state !!");
-            break;
         }
+        else
+        {
+            cmdPtr[cmdLen] = cmdPtr[i];
+            cmdLen++;
+        }
+    }
+    cmdPtr[cmdLen] = '\0';
+
+    if (cmdLen >= LE_ATDEFS_COMMAND_MAX_LEN)
+    {
+        LE_WARN("Command too long");
+        SendRspString(devPtr, "ERROR");
+        return;
+    }
+
+    if (devPtr->processing)
+    {
+        LE_WARN("Command in progress");
+        SendRspString(devPtr, "ERROR");
+        return;
+    }
+
+    devPtr->processing = true;
+
+    LE_DEBUG("Command found %s", cmdPtr);
+    le_utf8_Copy(devPtr->cmdParser.foundCmd,
+                 cmdPtr,
+                 LE_ATDEFS_COMMAND_MAX_LEN,
+                 NULL);
+
+    ssize_t offset = strnlen(devPtr->cmdParser.foundCmd,
+                             sizeof(devPtr->cmdParser.foundCmd)) - 1;
+    if((offset >= 0) && (offset < sizeof(devPtr->cmdParser.foundCmd)))
+    {
+        devPtr->cmdParser.lastCharPtr = devPtr->cmdParser.foundCmd + offset;
+
+        devPtr->cmdParser.currentCharPtr = devPtr->cmdParser.foundCmd;
+        devPtr->cmdParser.currentAtCmdPtr = devPtr->cmdParser.foundCmd;
+
+        ParseAtCmd(devPtr);
+    }
+    // It's possible that non-ASCII char is detected because of line error
+    // which casues string length to zero. In this case we assume it's an
+    // illegal command.
+    else
+    {
+        LE_WARN("Illegal command detected!");
+        SendRspString(devPtr, "ERROR");
+        devPtr->processing = false;
     }
+}
 
-    devPtr->indexRead = devPtr->parseIndex;
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parser incoming characters
+ *
+ * Lines are framed directly in the receive ring, without being copied.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ParseBuffer
+(
+    DeviceContext_t* devPtr
+)
+{
+    char* linePtr;
+    size_t lineLen;
+
+    while (NULL != (linePtr = le_dev_RingGetLine(&devPtr->rxRing, AT_TOKEN_CR, &lineLen)))
+    {
+        ParseLine(devPtr, linePtr, lineLen);
+    }
 
-    if (devPtr->indexRead >= LE_ATDEFS_COMMAND_MAX_LEN)
+    if (devPtr->rxRing.count >= LE_ATDEFS_COMMAND_MAX_LEN)
     {
-        devPtr->indexRead = devPtr->parseIndex = 0;
-        devPtr->cmdParser.rxState = PARSER_SEARCH_A;
+        le_dev_RingReset(&devPtr->rxRing);
         SendRspString(devPtr, "ERROR");
     }
 }
@@ -2355,15 +2413,15 @@ static void ReceiveCmd
 )
 {
     ssize_t size;
+    struct iovec rxIov[2];
+
     // Read RX data on uart
-    size = le_dev_Read(&devPtr->device,
-                (uint8_t *)(devPtr->currentCmd + devPtr->indexRead),
-                (LE_ATDEFS_COMMAND_MAX_LEN - devPtr->indexRead));
+    size = le_dev_RingRead(&devPtr->device, &devPtr->rxRing, rxIov);
 
     // Value of size is negative.
     if (0 > size)
     {
-        LE_ERROR("le_dev_Read failed!");
+        LE_ERROR("le_dev_RingRead failed!");
         return;
     }
     // Value of size is 0.
@@ -2376,12 +2434,9 @@ static void ReceiveCmd
     // Echo is activated
     if (devPtr->echo)
     {
-        le_dev_Write(&devPtr->device,
-                    (uint8_t *)(devPtr->currentCmd + devPtr->indexRead),
-                    size);
+        le_dev_WriteVec(&devPtr->device, rxIov, 2);
     }
 
-    devPtr->indexRead += size;
     ParseBuffer(devPtr);
 }
 
@@ -2645,10 +2700,7 @@ static le_result_t SendUnsolicitedResponse
         return LE_FAULT;
     }
 
-    RspString_t* rspStringPtr = le_mem_ForceAlloc(RspStringPool);
-    le_utf8_Copy(rspStringPtr->resp, unsolRsp, LE_ATDEFS_RESPONSE_MAX_BYTES, NULL);
-
-    SendUnsolRsp(devPtr, rspStringPtr);
+    SendUnsolRsp(devPtr, unsolRsp);
 
     return LE_OK;
 }
@@ -3002,8 +3054,7 @@ le_atServer_DeviceRef_t le_atServer_Open
         return NULL;
     }
 
-    devPtr->cmdParser.rxState = PARSER_SEARCH_A;
-    devPtr->parseIndex = 0;
+    le_dev_RingReset(&devPtr->rxRing);
     devPtr->unsolicitedList = LE_DLS_LIST_INIT;
     devPtr->isFirstIntermediate = true;
     devPtr->sessionRef = le_atServer_GetClientSessionRef();
@@ -3391,10 +3442,7 @@ le_result_t le_atServer_SendIntermediateResponse
         return LE_FAULT;
     }
 
-    RspString_t* rspStringPtr = le_mem_ForceAlloc(RspStringPool);
-    le_utf8_Copy(rspStringPtr->resp, intermediateRspPtr, LE_ATDEFS_RESPONSE_MAX_BYTES, NULL);
-
-    SendIntermediateRsp(devPtr, rspStringPtr);
+    SendIntermediateRsp(devPtr, intermediateRspPtr);
 
     return LE_OK;
 }
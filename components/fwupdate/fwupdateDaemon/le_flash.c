@@ -18,6 +18,14 @@
 //--------------------------------------------------------------------------------------------------
 #define MAX_PARTITION_REF             18
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of chunk buffers used by the streaming write. While one chunk is compared and programmed
+ * into the flash, the next one is read from the file descriptor.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STREAM_CHUNK_NB               2
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Event ID on bad image notification.
@@ -67,6 +75,36 @@ typedef struct
 }
 Partition_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * A chunk of data read from the file descriptor of a streaming write.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t*    dataPtr;       ///< Buffer of the chunk, allocated from the StreamBufferPool
+    size_t      dataSize;      ///< Number of bytes read from the file descriptor
+}
+StreamChunk_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Context shared between the reader thread and the writer of a streaming write.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int             fd;                       ///< File descriptor to read the image from
+    size_t          chunkSize;                ///< Data size of a logical block
+    bool            isPadded;                 ///< True if the chunk is compared to the whole
+                                              ///< erase block, tail padded with erased bytes
+    StreamChunk_t   chunk[STREAM_CHUNK_NB];   ///< Chunk buffers
+    le_sem_Ref_t    freeSem;                  ///< Posted when a chunk may be filled by the reader
+    le_sem_Ref_t    filledSem;                ///< Posted when a chunk is ready for the writer
+    le_result_t     readResult;               ///< LE_OK, or LE_FAULT if the read failed
+}
+StreamCtx_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool for allocating partitions ref.
@@ -81,6 +119,13 @@ static le_mem_PoolRef_t PartitionPool = NULL;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t PartitionRefMap = NULL;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for the chunk and read back buffers of the streaming write.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t StreamBufferPool = NULL;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool for allocating request count by client.
@@ -677,6 +722,279 @@ static void RequestInit
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Erase and program one logical block of a partition. For UBI, the volume is extended if needed.
+ *
+ * @return
+ *      - LE_OK            On success
+ *      - LE_FAULT         On failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteBlock
+(
+    Partition_t*   partPtr,       ///< [IN] Partition descriptor
+    uint32_t       blockIndex,    ///< [IN] Logical block index to be write.
+    const uint8_t* writeData,     ///< [IN] Data buffer to be written.
+    size_t         writeDataSize  ///< [IN] Data size to be written
+)
+{
+    le_result_t res;
+
+    if (partPtr->isUbi)
+    {
+        LE_INFO("MTD%d BlockIndex %u WriteDataSize %zu", partPtr->mtdNum, blockIndex, writeDataSize);
+        res = pa_flash_WriteUbiAtBlock(partPtr->desc, blockIndex,
+                                       (uint8_t*)writeData, writeDataSize, true);
+        if (LE_OK != res)
+        {
+            LE_ERROR("Ubi Volume %u Partition \"%s\" MTD%d: Write failed at blockIndex %u,"
+                     " dataSize %zu: %d",
+                     partPtr->ubiVolume, partPtr->partitionName, partPtr->mtdNum, blockIndex,
+                     writeDataSize, res);
+            res = LE_FAULT;
+        }
+    }
+    else
+    {
+        res = pa_flash_EraseBlock( partPtr->desc, blockIndex );
+        if (LE_OK != res)
+        {
+            LE_ERROR("Partition \"%s\" MTD%d: Erase failed at blockIndex %u",
+                     partPtr->partitionName, partPtr->mtdNum, blockIndex);
+            return LE_FAULT;
+        }
+        res = pa_flash_WriteAtBlock( partPtr->desc, blockIndex, (uint8_t*)writeData, writeDataSize);
+        if (LE_OK != res)
+        {
+            LE_ERROR("Partition \"%s\" MTD%d: Write failed at blockIndex %u, dataSize %zu: %d",
+                     partPtr->partitionName, partPtr->mtdNum, blockIndex, writeDataSize, res);
+            res = LE_FAULT;
+        }
+    }
+    return res;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a logical block already holds the content of a chunk. The block is read back and
+ * compared byte per byte to the chunk.
+ *
+ * For MTD, the whole erase block is compared: the tail of the chunk is padded with erased bytes, so
+ * a block programmed with a longer content is never taken as identical.
+ *
+ * @return
+ *      - true             If the block content is identical to the chunk
+ *      - false            If it differs or cannot be read
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsBlockIdentical
+(
+    Partition_t*         partPtr,      ///< [IN] Partition descriptor
+    const StreamCtx_t*   ctxPtr,       ///< [IN] Stream context
+    uint32_t             blockIndex,   ///< [IN] Logical block index to compare
+    const StreamChunk_t* chunkPtr,     ///< [IN] Chunk to compare with
+    uint8_t*             readBackPtr   ///< [IN] Buffer to read the block into
+)
+{
+    size_t compareSize;
+    le_result_t res;
+
+    if (ctxPtr->isPadded)
+    {
+        compareSize = partPtr->mtdInfo->eraseSize;
+        res = pa_flash_ReadAtBlock(partPtr->desc, blockIndex, readBackPtr, compareSize);
+    }
+    else
+    {
+        size_t readSize = ctxPtr->chunkSize;
+
+        compareSize = chunkPtr->dataSize;
+        res = pa_flash_ReadUbiAtBlock(partPtr->desc, blockIndex, readBackPtr, &readSize);
+        if ((LE_OK == res) && (readSize != compareSize))
+        {
+            return false;
+        }
+    }
+    if (LE_OK != res)
+    {
+        // The block is not readable or not yet allocated to the volume: it needs to be written.
+        LE_DEBUG("MTD%d: Unable to read back blockIndex %u: %d", partPtr->mtdNum, blockIndex, res);
+        return false;
+    }
+
+    return (0 == memcmp(readBackPtr, chunkPtr->dataPtr, compareSize));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reader thread of the streaming write. It fills the chunks with the data read from the file
+ * descriptor, while the previous chunk is programmed into the flash.
+ * A chunk with a null data size is posted at end of file or on error.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* StreamReaderThread
+(
+    void* contextPtr   ///< [IN] Stream context
+)
+{
+    StreamCtx_t* ctxPtr = contextPtr;
+    int iChunk = 0;
+    StreamChunk_t* chunkPtr;
+
+    do
+    {
+        ssize_t readSize;
+
+        le_sem_Wait(ctxPtr->freeSem);
+        chunkPtr = &ctxPtr->chunk[iChunk];
+        chunkPtr->dataSize = 0;
+
+        // Fill the whole chunk, as a pipe or a socket may return less than requested.
+        while (chunkPtr->dataSize < ctxPtr->chunkSize)
+        {
+            readSize = read(ctxPtr->fd, chunkPtr->dataPtr + chunkPtr->dataSize,
+                            ctxPtr->chunkSize - chunkPtr->dataSize);
+            if ((-1 == readSize) && (EINTR == errno))
+            {
+                continue;
+            }
+            if (-1 == readSize)
+            {
+                LE_ERROR("Read from fd %d failed: %m", ctxPtr->fd);
+                ctxPtr->readResult = LE_FAULT;
+                chunkPtr->dataSize = 0;
+                break;
+            }
+            if (0 == readSize)
+            {
+                break;
+            }
+            chunkPtr->dataSize += readSize;
+        }
+
+        if ((chunkPtr->dataSize) && (ctxPtr->isPadded))
+        {
+            // Pad the tail with erased bytes, as the whole erase block is compared.
+            memset(chunkPtr->dataPtr + chunkPtr->dataSize, 0xFF,
+                   ctxPtr->chunkSize - chunkPtr->dataSize);
+        }
+
+        le_sem_Post(ctxPtr->filledSem);
+        iChunk = (iChunk + 1) % STREAM_CHUNK_NB;
+    }
+    while (chunkPtr->dataSize);
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the content read from a file descriptor into consecutive logical blocks. Reading the next
+ * chunk is pipelined with the compare, erase and program of the current block. A block already
+ * holding the chunk content is not erased nor programmed.
+ *
+ * @return
+ *      - LE_OK            On success
+ *      - LE_NO_MEMORY     If the logical block is too large for the chunk buffers
+ *      - LE_FAULT         On failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t WriteStream
+(
+    Partition_t* partPtr,            ///< [IN] Partition descriptor
+    int          fd,                 ///< [IN] File descriptor to read the image from
+    uint32_t     blockIndex,         ///< [IN] First logical block index to write
+    uint32_t*    skippedBlocksPtr,   ///< [OUT] Blocks left untouched as already identical
+    uint32_t*    writtenBlocksPtr    ///< [OUT] Blocks erased and programmed
+)
+{
+    StreamCtx_t ctx;
+    le_thread_Ref_t readerRef;
+    uint8_t* readBackPtr;
+    le_result_t res = LE_OK;
+    int iChunk = 0;
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.fd = fd;
+    ctx.isPadded = !partPtr->isUbi;
+    ctx.chunkSize = partPtr->mtdInfo->eraseSize;
+    if (partPtr->isUbi)
+    {
+        ctx.chunkSize -= (2 * partPtr->mtdInfo->writeSize);
+    }
+    if (partPtr->mtdInfo->eraseSize > LE_FLASH_MAX_WRITE_SIZE)
+    {
+        LE_ERROR("Partition \"%s\" MTD%d: Erase block size %u too large",
+                 partPtr->partitionName, partPtr->mtdNum, partPtr->mtdInfo->eraseSize);
+        return LE_NO_MEMORY;
+    }
+
+    if (NULL == StreamBufferPool)
+    {
+        StreamBufferPool = le_mem_CreatePool("Flash Stream Buffer Pool", LE_FLASH_MAX_WRITE_SIZE);
+    }
+    for (iChunk = 0; iChunk < STREAM_CHUNK_NB; iChunk++)
+    {
+        ctx.chunk[iChunk].dataPtr = le_mem_ForceAlloc(StreamBufferPool);
+    }
+    readBackPtr = le_mem_ForceAlloc(StreamBufferPool);
+
+    ctx.readResult = LE_OK;
+    ctx.freeSem = le_sem_Create("FlashStreamFree", STREAM_CHUNK_NB);
+    ctx.filledSem = le_sem_Create("FlashStreamFilled", 0);
+
+    readerRef = le_thread_Create("FlashStreamReader", StreamReaderThread, &ctx);
+    le_thread_SetJoinable(readerRef);
+    le_thread_Start(readerRef);
+
+    for (iChunk = 0; ; iChunk = (iChunk + 1) % STREAM_CHUNK_NB, blockIndex++)
+    {
+        StreamChunk_t* chunkPtr = &ctx.chunk[iChunk];
+
+        le_sem_Wait(ctx.filledSem);
+        if (0 == chunkPtr->dataSize)
+        {
+            // End of file, or the reader has failed and stopped.
+            res = ctx.readResult;
+            break;
+        }
+
+        if (IsBlockIdentical(partPtr, &ctx, blockIndex, chunkPtr, readBackPtr))
+        {
+            LE_DEBUG("MTD%d: blockIndex %u is unchanged, skipped", partPtr->mtdNum, blockIndex);
+            (*skippedBlocksPtr)++;
+        }
+        else
+        {
+            res = WriteBlock(partPtr, blockIndex, chunkPtr->dataPtr, chunkPtr->dataSize);
+            if (LE_OK != res)
+            {
+                break;
+            }
+            (*writtenBlocksPtr)++;
+        }
+        le_sem_Post(ctx.freeSem);
+    }
+
+    if (LE_OK != res)
+    {
+        // The reader may be blocked in read() or waiting for a free chunk.
+        le_thread_Cancel(readerRef);
+    }
+    le_thread_Join(readerRef, NULL);
+
+    le_sem_Delete(ctx.freeSem);
+    le_sem_Delete(ctx.filledSem);
+    for (iChunk = 0; iChunk < STREAM_CHUNK_NB; iChunk++)
+    {
+        le_mem_Release(ctx.chunk[iChunk].dataPtr);
+    }
+    le_mem_Release(readBackPtr);
+
+    return res;
+}
+
 //--------------------------------------------------------------------------------------------------
 // APIs
 //--------------------------------------------------------------------------------------------------
@@ -1183,48 +1501,94 @@ le_result_t le_flash_Write
 )
 {
     Partition_t *partPtr = GetPartitionFromRef(partitionRef);
-    le_result_t res;
 
     if ((NULL == partPtr) || !(partPtr->isWrite) || (NULL == writeData))
     {
         return LE_BAD_PARAMETER;
     }
 
-    if (partPtr->isUbi)
+    if ((partPtr->isUbi) && (-1 == partPtr->ubiVolume))
     {
-        if (-1 == partPtr->ubiVolume)
-        {
-            return LE_BAD_PARAMETER;
-        }
-        LE_INFO("MTD%d BlockIndex %u WriteDataSize %zu", partPtr->mtdNum, blockIndex, writeDataSize);
-        res = pa_flash_WriteUbiAtBlock(partPtr->desc, blockIndex,
-                                       (uint8_t*)writeData, writeDataSize, true);
-        if (LE_OK != res)
-        {
-            LE_ERROR("Ubi Volume %u Partition \"%s\" MTD%d: Write failed at blockIndex %u,"
-                     " dataSize %zu: %d",
-                     partPtr->ubiVolume, partPtr->partitionName, partPtr->mtdNum, blockIndex,
-                     writeDataSize, res);
-            res = LE_FAULT;
-        }
+        return LE_BAD_PARAMETER;
     }
-    else
+
+    return WriteBlock(partPtr, blockIndex, writeData, writeDataSize);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the content read from a file descriptor to a flash partition, starting at the logical
+ * block index given by blockIndex and up to the end of file.
+ * - the content is split into chunks of the maximum data length accepted by le_flash_Write().
+ * - each destination block is read back and compared to its chunk. An identical block is neither
+ *   erased nor programmed.
+ * - other blocks are erased and programmed like le_flash_Write() does.
+ * - the next chunk is read from the file descriptor while the current block is programmed.
+ *
+ * @note This call is synchronous: it returns only when the whole content has been written. The
+ *       event loop of the fwupdateDaemon is blocked meanwhile, so other le_flash and le_fwupdate
+ *       requests are not served until the write is over.
+ *
+ * @return
+ *      - LE_OK            On success
+ *      - LE_BAD_PARAMETER If a parameter is invalid
+ *      - LE_NO_MEMORY     If the erase block size exceeds LE_FLASH_MAX_WRITE_SIZE
+ *      - LE_FAULT         On other error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_flash_WriteFromFd
+(
+    le_flash_PartitionRef_t partitionRef,       ///< [IN] Partition reference to be used.
+    int                     fd,                 ///< [IN] File descriptor to read the data from.
+    uint32_t                blockIndex,         ///< [IN] First logical block index to be written.
+    uint32_t*               skippedBlocksPtr,   ///< [OUT] Blocks skipped as already identical.
+    uint32_t*               writtenBlocksPtr,   ///< [OUT] Blocks erased and programmed.
+    uint32_t*               badBlocksPtr        ///< [OUT] Blocks newly marked bad.
+)
+{
+    Partition_t *partPtr = GetPartitionFromRef(partitionRef);
+    pa_flash_EccStats_t eccStats;
+    uint32_t badBlocksAtStart;
+    le_result_t res;
+
+    if (fd < 0)
     {
-        res = pa_flash_EraseBlock( partPtr->desc, blockIndex );
-        if (LE_OK != res)
-        {
-            LE_ERROR("Partition \"%s\" MTD%d: Erase failed at blockIndex %u",
-                     partPtr->partitionName, partPtr->mtdNum, blockIndex);
-            return LE_FAULT;
-        }
-        res = pa_flash_WriteAtBlock( partPtr->desc, blockIndex, (uint8_t*)writeData, writeDataSize);
-        if (LE_OK != res)
-        {
-            LE_ERROR("Partition \"%s\" MTD%d: Write failed at blockIndex %u, dataSize %zu: %d",
-                     partPtr->partitionName, partPtr->mtdNum, blockIndex, writeDataSize, res);
-            res = LE_FAULT;
-        }
+        LE_KILL_CLIENT("'fd' is negative");
+        return LE_BAD_PARAMETER;
     }
+
+    if ((NULL == partPtr) || !(partPtr->isWrite) ||
+        (NULL == skippedBlocksPtr) || (NULL == writtenBlocksPtr) || (NULL == badBlocksPtr) ||
+        ((partPtr->isUbi) && (-1 == partPtr->ubiVolume)))
+    {
+        close(fd);
+        return LE_BAD_PARAMETER;
+    }
+
+    *skippedBlocksPtr = 0;
+    *writtenBlocksPtr = 0;
+    *badBlocksPtr = 0;
+
+    res = pa_flash_GetEccStats(partPtr->desc, &eccStats);
+    if (LE_OK != res)
+    {
+        close(fd);
+        return LE_FAULT;
+    }
+    badBlocksAtStart = eccStats.badBlocks;
+
+    res = WriteStream(partPtr, fd, blockIndex, skippedBlocksPtr, writtenBlocksPtr);
+    close(fd);
+
+    if (LE_OK == pa_flash_GetEccStats(partPtr->desc, &eccStats))
+    {
+        *badBlocksPtr = eccStats.badBlocks - badBlocksAtStart;
+    }
+
+    LE_INFO("Partition \"%s\" MTD%d: %u blocks written, %u skipped, %u new bad blocks: %d",
+            partPtr->partitionName, partPtr->mtdNum,
+            *writtenBlocksPtr, *skippedBlocksPtr, *badBlocksPtr, res);
+
     return res;
 }
 
@@ -151,6 +151,33 @@ static pthread_mutex_t RegisteringNetworkMutex = PTHREAD_MUTEX_INITIALIZER;
 #define UNLOCK()  LE_FATAL_IF((pthread_mutex_unlock(&RegisteringNetworkMutex)!=0), \
                                "Could not unlock the mutex")
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Synchronization of an entry of the network state cache.  The mutex is only held to look up or
+ * publish the entry, never across a platform adaptor query, so a long network scan does not block
+ * the clients of the other entries.  Clients missing the entry while it is being refreshed wait for
+ * the refresh in progress instead of querying the platform adaptor again.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t  refreshedCond;      // Signalled when a refresh ends
+    bool            isRefreshing;       // Is a platform adaptor query in progress?
+}
+CacheSync_t;
+
+#define CACHE_SYNC_INIT { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, false }
+
+static CacheSync_t NgbrCellsCacheSync = CACHE_SYNC_INIT;
+static CacheSync_t ScanCacheSync = CACHE_SYNC_INIT;
+static CacheSync_t NameCacheSync = CACHE_SYNC_INIT;
+
+#define CACHE_LOCK(mutex)    LE_FATAL_IF((pthread_mutex_lock(&(mutex))!=0), \
+                                          "Could not lock the mutex")
+#define CACHE_UNLOCK(mutex)  LE_FATAL_IF((pthread_mutex_unlock(&(mutex))!=0), \
+                                          "Could not unlock the mutex")
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MRC command Type.
@@ -170,6 +197,40 @@ CmdType_t;
 // Data structures.
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Snapshot of a list retrieved from the platform adaptor.  Snapshots are reference counted and
+ * shared between the network state cache and the client lists created from them, so their
+ * content must never be modified.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_clk_Time_t       timestamp;           // Relative time the list was retrieved
+    uint32_t            generation;          // Cache generation the list was retrieved in
+    le_mrc_RatBitMask_t ratMask;             // Scanned RATs (scan information only)
+    int32_t             count;               // Number of entries (neighboring cells only)
+    le_dls_List_t       paList;              // list of pa_mrc_CellInfo_t or
+                                             // pa_mrc_ScanInformation_t
+} NetSnapshot_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Network state cache.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    NetSnapshot_t*      ngbrCellsPtr;        // Last neighboring cells information, or NULL
+    NetSnapshot_t*      scanPtr;             // Last cellular network scan, or NULL
+    bool                isNameValid;         // Is the current network name cached?
+    le_clk_Time_t       nameTimestamp;       // Relative time the network name was retrieved
+    uint32_t            nameGeneration;      // Cache generation the network name was retrieved in
+    char                name[LE_MRC_NETWORK_NAME_MAX_LEN + 1]; // Current network name
+} NetworkCache_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Neighboring Cells Information safe Reference list structure.
@@ -192,7 +253,7 @@ typedef struct
 {
     int32_t             cellsCount;          // number of detected cells
     le_msg_SessionRef_t sessionRef;          // Message session reference
-    le_dls_List_t       paNgbrCellInfoList;  // list of pa_mrc_CellInfo_t
+    NetSnapshot_t*      ngbrCellsPtr;        // snapshot holding the list of pa_mrc_CellInfo_t
     le_dls_List_t       safeRefCellInfoList; // list of CellSafeRef_t
     le_dls_Link_t       *currentLinkPtr;     // link for current CellSafeRef_t reference
 } CellList_t;
@@ -272,7 +333,8 @@ typedef struct
 typedef struct
 {
     le_msg_SessionRef_t sessionRef;          // Message session reference
-    le_dls_List_t       paScanInfoList;      // list of pa_mrc_ScanInformation_t
+    NetSnapshot_t*      scanPtr;             // snapshot holding the list of
+                                             // pa_mrc_ScanInformation_t
     le_dls_List_t       safeRefScanInfoList; // list of ScanInfoSafeRef_t
     le_dls_Link_t       *currentLink;        // link for iterator
 } ScanInfoList_t;
@@ -364,6 +426,36 @@ JammingDetectionRef_t;
 //--------------------------------------------------------------------------------------------------
 // Static declarations.
 //--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for neighboring cells information snapshots.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t CellSnapshotPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool for cellular network scan snapshots.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ScanSnapshotPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Network state cache.  Each entry is protected by its own mutex: see NgbrCellsCacheSync,
+ * ScanCacheSync and NameCacheSync.
+ */
+//--------------------------------------------------------------------------------------------------
+static NetworkCache_t NetworkCache;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Network state cache generation.  It is incremented when the network state changes, which makes
+ * all the cached information stale.
+ */
+//--------------------------------------------------------------------------------------------------
+static volatile uint32_t NetworkCacheGeneration;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Pool for neighboring cells information list.
@@ -657,6 +749,425 @@ static void DeletePreferredOperatorsSafeRefList
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor of neighboring cells information snapshots.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void CellSnapshotDestructor
+(
+    void* objPtr
+)
+{
+    NetSnapshot_t* snapshotPtr = objPtr;
+
+    pa_mrc_DeleteNeighborCellsInfo(&(snapshotPtr->paList));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor of cellular network scan snapshots.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void ScanSnapshotDestructor
+(
+    void* objPtr
+)
+{
+    NetSnapshot_t* snapshotPtr = objPtr;
+
+    pa_mrc_DeleteScanInformation(&(snapshotPtr->paList));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make all the cached network state information stale.
+ *
+ * This only updates the cache generation, so it can be called from any thread without waiting for
+ * a cache refresh in progress.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void InvalidateNetworkCache
+(
+    void
+)
+{
+    __sync_fetch_and_add(&NetworkCacheGeneration, 1);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if cached information is fresh enough.
+ *
+ * @return true if the information was retrieved less than maxAge milliseconds ago, and the network
+ *         state did not change since.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsCacheFresh
+(
+    le_clk_Time_t timestamp,    ///< [IN] Relative time the information was retrieved
+    uint32_t      generation,   ///< [IN] Cache generation the information was retrieved in
+    uint32_t      maxAge        ///< [IN] Maximum age of the information in milliseconds
+)
+{
+    le_clk_Time_t age;
+
+    if ((0 == maxAge) || (generation != NetworkCacheGeneration))
+    {
+        return false;
+    }
+
+    age = le_clk_Sub(le_clk_GetRelativeTime(), timestamp);
+
+    return (((uint64_t)age.sec * 1000 + age.usec / 1000) <= maxAge);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for the end of the refresh of a cache entry, if one is in progress.  Otherwise, the caller
+ * becomes responsible for the refresh, and must end it with EndCacheRefresh().
+ *
+ * Must be called with the mutex of the entry held.
+ *
+ * @return true if a refresh was waited for, in which case the entry must be looked up again, or
+ *         false if the caller must refresh the entry.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static bool WaitCacheRefresh
+(
+    CacheSync_t* syncPtr            ///< [IN] Synchronization of the cache entry
+)
+{
+    if (!syncPtr->isRefreshing)
+    {
+        syncPtr->isRefreshing = true;
+        return false;
+    }
+
+    LE_DEBUG("Waiting for the cache refresh in progress");
+    while (syncPtr->isRefreshing)
+    {
+        LE_ASSERT(0 == pthread_cond_wait(&syncPtr->refreshedCond, &syncPtr->mutex));
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * End the refresh of a cache entry, and wake up the clients waiting for it.
+ *
+ * Must be called with the mutex of the entry held.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndCacheRefresh
+(
+    CacheSync_t* syncPtr            ///< [IN] Synchronization of the cache entry
+)
+{
+    syncPtr->isRefreshing = false;
+    LE_ASSERT(0 == pthread_cond_broadcast(&syncPtr->refreshedCond));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Publish a snapshot retrieved from the platform adaptor in a cache entry and end its refresh.  The
+ * cache takes its own reference on the snapshot; the caller keeps the one it holds.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static void PublishSnapshot
+(
+    CacheSync_t*     syncPtr,       ///< [IN] Synchronization of the cache entry
+    NetSnapshot_t**  entryPtr,      ///< [IN/OUT] Cache entry
+    NetSnapshot_t*   snapshotPtr    ///< [IN] Snapshot to publish, or NULL if the query failed
+)
+{
+    CACHE_LOCK(syncPtr->mutex);
+
+    if (snapshotPtr != NULL)
+    {
+        if (*entryPtr != NULL)
+        {
+            le_mem_Release(*entryPtr);
+        }
+        le_mem_AddRef(snapshotPtr);
+        *entryPtr = snapshotPtr;
+    }
+
+    EndCacheRefresh(syncPtr);
+
+    CACHE_UNLOCK(syncPtr->mutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the neighboring cells information, from the cache if it is fresh enough or from the platform
+ * adaptor otherwise.  In the latter case, the cache is updated.
+ *
+ * @return A new reference to the snapshot, which must be released by the caller, or NULL if no
+ *         cells information is available.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static NetSnapshot_t* GetNeighborCellsSnapshot
+(
+    uint32_t maxAge             ///< [IN] Maximum age of the information in milliseconds
+)
+{
+    NetSnapshot_t* snapshotPtr = NULL;
+
+    CACHE_LOCK(NgbrCellsCacheSync.mutex);
+    do
+    {
+        if ((NetworkCache.ngbrCellsPtr != NULL) &&
+            IsCacheFresh(NetworkCache.ngbrCellsPtr->timestamp,
+                         NetworkCache.ngbrCellsPtr->generation,
+                         maxAge))
+        {
+            LE_DEBUG("Neighboring cells information served from cache");
+            snapshotPtr = NetworkCache.ngbrCellsPtr;
+            le_mem_AddRef(snapshotPtr);
+        }
+    }
+    while ((NULL == snapshotPtr) && WaitCacheRefresh(&NgbrCellsCacheSync));
+    CACHE_UNLOCK(NgbrCellsCacheSync.mutex);
+
+    if (snapshotPtr != NULL)
+    {
+        return snapshotPtr;
+    }
+
+    snapshotPtr = le_mem_ForceAlloc(CellSnapshotPool);
+    snapshotPtr->paList = LE_DLS_LIST_INIT;
+    snapshotPtr->ratMask = 0;
+    snapshotPtr->generation = NetworkCacheGeneration;
+    snapshotPtr->count = pa_mrc_GetNeighborCellsInfo(&(snapshotPtr->paList));
+    snapshotPtr->timestamp = le_clk_GetRelativeTime();
+
+    if (snapshotPtr->count <= 0)
+    {
+        PublishSnapshot(&NgbrCellsCacheSync, &NetworkCache.ngbrCellsPtr, NULL);
+        le_mem_Release(snapshotPtr);
+        return NULL;
+    }
+
+    PublishSnapshot(&NgbrCellsCacheSync, &NetworkCache.ngbrCellsPtr, snapshotPtr);
+
+    return snapshotPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a cellular network scan, from the cache if it is fresh enough and was performed on the same
+ * RATs, or from the platform adaptor otherwise.  In the latter case, the cache is updated.
+ *
+ * @return A new reference to the snapshot, which must be released by the caller, or NULL if the
+ *         scan failed.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static NetSnapshot_t* GetScanSnapshot
+(
+    le_mrc_RatBitMask_t ratMask,    ///< [IN] Radio Access Technology bitmask
+    uint32_t            maxAge      ///< [IN] Maximum age of the information in milliseconds
+)
+{
+    NetSnapshot_t* snapshotPtr = NULL;
+    le_result_t    result;
+
+    CACHE_LOCK(ScanCacheSync.mutex);
+    do
+    {
+        if ((NetworkCache.scanPtr != NULL) &&
+            (NetworkCache.scanPtr->ratMask == ratMask) &&
+            IsCacheFresh(NetworkCache.scanPtr->timestamp, NetworkCache.scanPtr->generation, maxAge))
+        {
+            LE_DEBUG("Cellular network scan served from cache");
+            snapshotPtr = NetworkCache.scanPtr;
+            le_mem_AddRef(snapshotPtr);
+        }
+    }
+    while ((NULL == snapshotPtr) && WaitCacheRefresh(&ScanCacheSync));
+    CACHE_UNLOCK(ScanCacheSync.mutex);
+
+    if (snapshotPtr != NULL)
+    {
+        return snapshotPtr;
+    }
+
+    snapshotPtr = le_mem_ForceAlloc(ScanSnapshotPool);
+    snapshotPtr->paList = LE_DLS_LIST_INIT;
+    snapshotPtr->ratMask = ratMask;
+    snapshotPtr->count = 0;
+    snapshotPtr->generation = NetworkCacheGeneration;
+
+    LOCK();
+    result = pa_mrc_PerformNetworkScan(ratMask, PA_MRC_SCAN_PLMN, &(snapshotPtr->paList));
+    UNLOCK();
+
+    snapshotPtr->timestamp = le_clk_GetRelativeTime();
+
+    if (LE_OK != result)
+    {
+        LE_ERROR("Network scan error");
+        PublishSnapshot(&ScanCacheSync, &NetworkCache.scanPtr, NULL);
+        le_mem_Release(snapshotPtr);
+        return NULL;
+    }
+
+    PublishSnapshot(&ScanCacheSync, &NetworkCache.scanPtr, snapshotPtr);
+
+    return snapshotPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the current network name, from the cache if it is fresh enough or from the platform adaptor
+ * otherwise.  In the latter case, the cache is updated.
+ *
+ * @return
+ *      - LE_OK             on success
+ *      - LE_OVERFLOW       if the name can't fit in nameStr
+ *      - LE_FAULT          on any other failure
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetCurrentNetworkName
+(
+    uint32_t    maxAge,         ///< [IN] Maximum age of the information in milliseconds
+    char*       nameStr,        ///< [OUT] the network name
+    size_t      nameStrSize     ///< [IN] the nameStr size
+)
+{
+    char        name[LE_MRC_NETWORK_NAME_MAX_LEN + 1];
+    uint32_t    generation;
+    le_result_t result;
+
+    CACHE_LOCK(NameCacheSync.mutex);
+    do
+    {
+        if (NetworkCache.isNameValid &&
+            IsCacheFresh(NetworkCache.nameTimestamp, NetworkCache.nameGeneration, maxAge))
+        {
+            LE_DEBUG("Current network name served from cache");
+            result = le_utf8_Copy(nameStr, NetworkCache.name, nameStrSize, NULL);
+            CACHE_UNLOCK(NameCacheSync.mutex);
+            return result;
+        }
+    }
+    while (WaitCacheRefresh(&NameCacheSync));
+    CACHE_UNLOCK(NameCacheSync.mutex);
+
+    generation = NetworkCacheGeneration;
+    result = pa_mrc_GetCurrentNetwork(name, sizeof(name), NULL, 0, NULL, 0);
+
+    CACHE_LOCK(NameCacheSync.mutex);
+    if (LE_OK == result)
+    {
+        memcpy(NetworkCache.name, name, sizeof(NetworkCache.name));
+        NetworkCache.isNameValid = true;
+        NetworkCache.nameTimestamp = le_clk_GetRelativeTime();
+        NetworkCache.nameGeneration = generation;
+    }
+    EndCacheRefresh(&NameCacheSync);
+    CACHE_UNLOCK(NameCacheSync.mutex);
+
+    if (LE_OK != result)
+    {
+        return result;
+    }
+
+    return le_utf8_Copy(nameStr, name, nameStrSize, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a client list of scan information from a snapshot.
+ *
+ * @return Reference to the list object.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mrc_ScanInformationListRef_t CreateScanInformationList
+(
+    NetSnapshot_t*      snapshotPtr,    ///< [IN] The snapshot, whose reference is taken over
+    le_msg_SessionRef_t sessionRef      ///< [IN] Message session reference
+)
+{
+    ScanInfoList_t* newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
+
+    newScanInformationListPtr->scanPtr = snapshotPtr;
+    newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
+    newScanInformationListPtr->currentLink = NULL;
+    newScanInformationListPtr->sessionRef = sessionRef;
+
+    return le_ref_CreateRef(ScanInformationListRefMap, newScanInformationListPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a client list of neighboring cells information from a snapshot.
+ *
+ * @return Reference to the list object.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mrc_NeighborCellsRef_t CreateNeighborCellsList
+(
+    NetSnapshot_t*      snapshotPtr,    ///< [IN] The snapshot, whose reference is taken over
+    le_msg_SessionRef_t sessionRef      ///< [IN] Message session reference
+)
+{
+    CellList_t* ngbrCellsInfoListPtr = le_mem_ForceAlloc(CellListPool);
+
+    ngbrCellsInfoListPtr->ngbrCellsPtr = snapshotPtr;
+    ngbrCellsInfoListPtr->cellsCount = snapshotPtr->count;
+    ngbrCellsInfoListPtr->safeRefCellInfoList = LE_DLS_LIST_INIT;
+    ngbrCellsInfoListPtr->currentLinkPtr = NULL;
+    ngbrCellsInfoListPtr->sessionRef = sessionRef;
+
+    return le_ref_CreateRef(CellListRefMap, ngbrCellsInfoListPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts a state report to a client handler: only the latest state matters, so the messages that
+ * the handler is called with are keyed to it, and a client that does not keep up gets the latest
+ * report of each of its handlers instead of a backlog.  Must be called from a first-layer handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartStateReport
+(
+    void
+)
+{
+#if LE_CONFIG_LINUX
+    le_msg_SetThreadCoalesceKey((uintptr_t)le_event_GetContextPtr());
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ends a state report started by StartStateReport().
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndStateReport
+(
+    void
+)
+{
+#if LE_CONFIG_LINUX
+    le_msg_SetThreadCoalesceKey(0);
+#endif
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The first-layer Network Registration State Change Handler.
@@ -672,7 +1183,9 @@ static void FirstLayerNetRegStateChangeHandler
     le_mrc_NetRegState_t*           statePtr = reportPtr;
     le_mrc_NetRegStateHandlerFunc_t clientHandlerFunc = secondLayerHandlerFunc;
 
+    StartStateReport();
     clientHandlerFunc(*statePtr, le_event_GetContextPtr());
+    EndStateReport();
 
     // The reportPtr is a reference counted object, so need to release it
     le_mem_Release(reportPtr);
@@ -691,6 +1204,8 @@ static void NewRegStateHandler
 {
     LE_DEBUG("Handler Function called with regStat %d", *regStatePtr);
 
+    InvalidateNetworkCache();
+
     // Notify all the registered client's handlers
     le_event_ReportWithRefCounting(NewNetRegStateId, regStatePtr);
 }
@@ -776,7 +1291,9 @@ static void FirstLayerRatChangeHandler
     le_mrc_Rat_t*           ratPtr = reportPtr;
     le_mrc_RatChangeHandlerFunc_t clientHandlerFunc = secondLayerHandlerFunc;
 
+    StartStateReport();
     clientHandlerFunc(*ratPtr, le_event_GetContextPtr());
+    EndStateReport();
 
     // The reportPtr is a reference counted object, so need to release it
     le_mem_Release(reportPtr);
@@ -798,7 +1315,9 @@ static void FirstLayerPSChangeHandler
     le_mrc_PacketSwitchedChangeHandlerFunc_t clientHandlerFunc =
                     (le_mrc_PacketSwitchedChangeHandlerFunc_t) secondLayerHandlerFunc;
 
+    StartStateReport();
     clientHandlerFunc(*serviceStatePtr, le_event_GetContextPtr());
+    EndStateReport();
 
     // The reportPtr is a reference counted object, so need to release it
     le_mem_Release(reportPtr);
@@ -818,6 +1337,8 @@ static void RatChangeHandler
 {
     LE_DEBUG("Handler Function called with RAT %d", *ratPtr);
 
+    InvalidateNetworkCache();
+
     // Notify all the registered client's handlers
     le_event_ReportWithRefCounting(RatChangeId, ratPtr);
 }
@@ -855,7 +1376,9 @@ static void FirstLayerSsChangeHandler
     pa_mrc_SignalStrengthIndication_t*    ssIndPtr = (pa_mrc_SignalStrengthIndication_t*)reportPtr;
     le_mrc_SignalStrengthChangeHandlerFunc_t clientHandlerFunc = secondLayerHandlerFunc;
 
+    StartStateReport();
     clientHandlerFunc(ssIndPtr->ss, le_event_GetContextPtr());
+    EndStateReport();
 
     // The reportPtr is a reference counted object, so need to release it
     le_mem_Release(reportPtr);
@@ -1015,30 +1538,15 @@ static void ProcessMrcCommandEventHandler
         le_mrc_CellularNetworkScanHandlerFunc_t handlerFunc = cmdRequest->callBackPtr;
         le_mrc_RatBitMask_t ratMask = cmdRequest->scan.ratMask;
 
-        ScanInfoList_t* newScanInformationListPtr = NULL;
         le_mrc_ScanInformationListRef_t scanInformationListRef = NULL;
 
-        newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
-        newScanInformationListPtr->paScanInfoList = LE_DLS_LIST_INIT;
-        newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
-        newScanInformationListPtr->currentLink = NULL;
-
-        LOCK();
-        res = pa_mrc_PerformNetworkScan(ratMask, ((CmdRequest_t*) msgCommand)->scan.type,
-                                        &(newScanInformationListPtr->paScanInfoList));
-        UNLOCK();
-
-        if (LE_OK != res)
-        {
-            le_mem_Release(newScanInformationListPtr);
-        }
-        else
+        // An asynchronous scan always queries the modem; its result refreshes the cache used by
+        // le_mrc_PerformCellularNetworkScan().
+        NetSnapshot_t* snapshotPtr = GetScanSnapshot(ratMask, 0);
+        if (NULL != snapshotPtr)
         {
-            // Store message session reference.
-            newScanInformationListPtr->sessionRef = cmdRequest->sessionRef;
-
-            scanInformationListRef =
-                     le_ref_CreateRef(ScanInformationListRefMap, newScanInformationListPtr);
+            scanInformationListRef = CreateScanInformationList(snapshotPtr,
+                                                               cmdRequest->sessionRef);
         }
 
         // Check if a handler function is available.
@@ -1049,7 +1557,7 @@ static void ProcessMrcCommandEventHandler
         }
         else
         {
-            LE_WARN("No handler function, status %d!!", res);
+            LE_WARN("No handler function, scan list %p!!", scanInformationListRef);
         }
     }
     else if (cmdRequest->command == LE_MRC_CMD_TYPE_ASYNC_PCISCAN)
@@ -1802,6 +2310,12 @@ void le_mrc_Init
     ScanInformationListPool = le_mem_CreatePool("ScanInformationListPool",
                                                 sizeof(ScanInfoList_t));
 
+    // Create the pools for the snapshots shared by the network state cache and client lists.
+    ScanSnapshotPool = le_mem_CreatePool("ScanSnapshotPool", sizeof(NetSnapshot_t));
+    le_mem_SetDestructor(ScanSnapshotPool, ScanSnapshotDestructor);
+    CellSnapshotPool = le_mem_CreatePool("CellSnapshotPool", sizeof(NetSnapshot_t));
+    le_mem_SetDestructor(CellSnapshotPool, CellSnapshotDestructor);
+
     ScanInformationSafeRefPool = le_mem_CreatePool("ScanInformationSafeRefPool",
                                                    sizeof(ScanInfoSafeRef_t));
 
@@ -1876,6 +2390,13 @@ void le_mrc_Init
     le_msg_ServiceRef_t msgService = le_mrc_GetServiceRef();
     le_msg_AddServiceCloseHandler(msgService, CloseSessionEventHandler, NULL);
 
+#if LE_CONFIG_LINUX
+    // Coalesce the state reports (see StartStateReport()) of a client that does not keep up.  The
+    // rejection and jamming events are not keyed, so they are never merged.
+    le_msg_SetServiceTxQueueLimit(msgService, LE_CONFIG_MSG_TX_QUEUE_LIMIT,
+                                  LE_MSG_TX_OVERFLOW_COALESCE);
+#endif /* end LE_CONFIG_LINUX */
+
     // Create an event Id for new Network Registration State notification
     NewNetRegStateId = le_event_CreateIdWithRefCounting("NewNetRegState");
 
@@ -3193,6 +3714,31 @@ le_result_t le_mrc_GetCurrentNetworkName
     char       *nameStr,               ///< [OUT] the home network Name
     size_t      nameStrSize            ///< [IN] the nameStr size
 )
+{
+    return le_mrc_GetCachedCurrentNetworkName(0, nameStr, nameStrSize);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get the current network name information, no older than a
+ * maximum age.
+ *
+ * @return
+ *      - LE_OK             on success
+ *      - LE_BAD_PARAMETER  if nameStr is NULL
+ *      - LE_OVERFLOW       if the Home Network Name can't fit in nameStr
+ *      - LE_FAULT          on any other failure
+ *
+ * @note If the caller is passing a bad pointer into this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_mrc_GetCachedCurrentNetworkName
+(
+    uint32_t    maxAge,                ///< [IN] Maximum age of the name in milliseconds
+    char       *nameStr,               ///< [OUT] the home network Name
+    size_t      nameStrSize            ///< [IN] the nameStr size
+)
 {
     if (nameStr == NULL)
     {
@@ -3200,7 +3746,7 @@ le_result_t le_mrc_GetCurrentNetworkName
         return LE_BAD_PARAMETER;
     }
 
-    return pa_mrc_GetCurrentNetwork(nameStr, nameStrSize, NULL, 0, NULL, 0);
+    return GetCurrentNetworkName(maxAge, nameStr, nameStrSize);
 }
 
 
@@ -3333,31 +3879,33 @@ le_mrc_ScanInformationListRef_t le_mrc_PerformCellularNetworkScan
     le_mrc_RatBitMask_t ratMask ///< [IN] Radio Access Technology bitmask
 )
 {
-    le_result_t result;
-    ScanInfoList_t* newScanInformationListPtr = NULL;
-
-    newScanInformationListPtr = le_mem_ForceAlloc(ScanInformationListPool);
-    newScanInformationListPtr->paScanInfoList = LE_DLS_LIST_INIT;
-    newScanInformationListPtr->safeRefScanInfoList = LE_DLS_LIST_INIT;
-    newScanInformationListPtr->currentLink = NULL;
+    return le_mrc_GetCachedCellularNetworkScan(ratMask, 0);
+}
 
-    LOCK();
-    result = pa_mrc_PerformNetworkScan(ratMask,
-                                       PA_MRC_SCAN_PLMN,
-                                       &(newScanInformationListPtr->paScanInfoList));
-    UNLOCK();
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to get a cellular network scan no older than a maximum age.  The
+ * last scan is returned if it was performed on the same RATs less than maxAge milliseconds ago and
+ * the network registration state did not change since; a new scan is performed otherwise.
+ *
+ * @return
+ *      Reference to the List object. Null pointer if the scan failed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_mrc_ScanInformationListRef_t le_mrc_GetCachedCellularNetworkScan
+(
+    le_mrc_RatBitMask_t ratMask,    ///< [IN] Radio Access Technology bitmask
+    uint32_t            maxAge      ///< [IN] Maximum age of the scan in milliseconds
+)
+{
+    NetSnapshot_t* snapshotPtr = GetScanSnapshot(ratMask, maxAge);
 
-    if (result != LE_OK)
+    if (NULL == snapshotPtr)
     {
-        LE_ERROR("Network scan error");
-        le_mem_Release(newScanInformationListPtr);
         return NULL;
     }
 
-    // Store message session reference.
-    newScanInformationListPtr->sessionRef = le_mrc_GetClientSessionRef();
-
-    return le_ref_CreateRef(ScanInformationListRefMap, newScanInformationListPtr);
+    return CreateScanInformationList(snapshotPtr, le_mrc_GetClientSessionRef());
 }
 
 
@@ -3456,7 +4004,7 @@ le_mrc_ScanInformationRef_t le_mrc_GetFirstCellularNetworkScan
         return NULL;
     }
 
-    linkPtr = le_dls_Peek(&(scanInformationListPtr->paScanInfoList));
+    linkPtr = le_dls_Peek(&(scanInformationListPtr->scanPtr->paList));
     if (linkPtr != NULL)
     {
         nodePtr = CONTAINER_OF(linkPtr, pa_mrc_ScanInformation_t, link);
@@ -3505,7 +4053,7 @@ le_mrc_ScanInformationRef_t le_mrc_GetNextCellularNetworkScan
         return NULL;
     }
 
-    linkPtr = le_dls_PeekNext(&(scanInformationListPtr->paScanInfoList),
+    linkPtr = le_dls_PeekNext(&(scanInformationListPtr->scanPtr->paList),
                                 scanInformationListPtr->currentLink);
     if (linkPtr != NULL)
     {
@@ -3551,7 +4099,7 @@ void le_mrc_DeleteCellularNetworkScan
     }
 
     scanInformationListPtr->currentLink = NULL;
-    pa_mrc_DeleteScanInformation(&(scanInformationListPtr->paScanInfoList));
+    le_mem_Release(scanInformationListPtr->scanPtr);
 
     // Delete the safe Reference list.
     DeleteSafeRefList(&(scanInformationListPtr->safeRefScanInfoList));
@@ -3818,27 +4366,34 @@ le_mrc_NeighborCellsRef_t le_mrc_GetNeighborCellsInfo
     void
 )
 {
-    CellList_t* ngbrCellsInfoListPtr = le_mem_ForceAlloc(CellListPool);
+    return le_mrc_GetCachedNeighborCellsInfo(0);
+}
 
-    ngbrCellsInfoListPtr->paNgbrCellInfoList = LE_DLS_LIST_INIT;
-    ngbrCellsInfoListPtr->safeRefCellInfoList = LE_DLS_LIST_INIT;
-    ngbrCellsInfoListPtr->currentLinkPtr = NULL;
-    ngbrCellsInfoListPtr->cellsCount = pa_mrc_GetNeighborCellsInfo(
-                                            &(ngbrCellsInfoListPtr->paNgbrCellInfoList));
-    if (ngbrCellsInfoListPtr->cellsCount > 0)
-    {
-        // Save message session reference.
-        ngbrCellsInfoListPtr->sessionRef = le_mrc_GetClientSessionRef();
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to retrieve the Neighboring Cells information no older than a
+ * maximum age.  The last retrieved information is returned if it is less than maxAge milliseconds
+ * old and the network registration state did not change since; it is retrieved again otherwise.
+ *
+ * @return A reference to the Neighboring Cells information.
+ * @return NULL if no Cells Information are available.
+ */
+//--------------------------------------------------------------------------------------------------
+le_mrc_NeighborCellsRef_t le_mrc_GetCachedNeighborCellsInfo
+(
+    uint32_t maxAge             ///< [IN] Maximum age of the information in milliseconds
+)
+{
+    NetSnapshot_t* snapshotPtr = GetNeighborCellsSnapshot(maxAge);
 
-        // Create and return a Safe Reference for this List object.
-        return le_ref_CreateRef(CellListRefMap, ngbrCellsInfoListPtr);
-    }
-    else
+    if (NULL == snapshotPtr)
     {
-        le_mem_Release(ngbrCellsInfoListPtr);
         LE_WARN("Unable to retrieve the Neighboring Cells information!");
         return NULL;
     }
+
+    // Create and return a Safe Reference for this List object.
+    return CreateNeighborCellsList(snapshotPtr, le_mrc_GetClientSessionRef());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -3863,7 +4418,7 @@ void le_mrc_DeleteNeighborCellsInfo
     }
 
     ngbrCellsInfoListPtr->currentLinkPtr = NULL;
-    pa_mrc_DeleteNeighborCellsInfo(&(ngbrCellsInfoListPtr->paNgbrCellInfoList));
+    le_mem_Release(ngbrCellsInfoListPtr->ngbrCellsPtr);
 
     // Delete the safe Reference list.
     DeleteCellInfoSafeRefList(&(ngbrCellsInfoListPtr->safeRefCellInfoList));
@@ -3899,7 +4454,7 @@ le_mrc_CellInfoRef_t le_mrc_GetFirstNeighborCellInfo
         return NULL;
     }
 
-    linkPtr = le_dls_Peek(&(ngbrCellsInfoListPtr->paNgbrCellInfoList));
+    linkPtr = le_dls_Peek(&(ngbrCellsInfoListPtr->ngbrCellsPtr->paList));
     if (linkPtr != NULL)
     {
         nodePtr = CONTAINER_OF(linkPtr, pa_mrc_CellInfo_t, link);
@@ -3944,7 +4499,7 @@ le_mrc_CellInfoRef_t le_mrc_GetNextNeighborCellInfo
         return NULL;
     }
 
-    linkPtr = le_dls_PeekNext(&(ngbrCellsInfoListPtr->paNgbrCellInfoList),
+    linkPtr = le_dls_PeekNext(&(ngbrCellsInfoListPtr->ngbrCellsPtr->paList),
         ngbrCellsInfoListPtr->currentLinkPtr);
     if (linkPtr != NULL)
     {
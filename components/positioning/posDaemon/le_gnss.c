@@ -12,6 +12,7 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "pa_gnss.h"
+#include "nmeaFanout.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -197,6 +198,22 @@ typedef struct le_gnss_PositionHandler
 }
 le_gnss_PositionHandler_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Position snapshot handler structure.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_gnss_PositionSnapshotHandler
+{
+    le_gnss_PositionSnapshotHandlerFunc_t handlerFuncPtr;    ///< The handler function address.
+    void*                         handlerContextPtr;         ///< The handler function context.
+    le_gnss_SnapshotField_t       requestedFields;           ///< Field groups to fill.
+    le_msg_SessionRef_t           sessionRef;                ///< Store message session reference.
+    le_dls_Link_t                 link;                      ///< Object node link
+}
+le_gnss_PositionSnapshotHandler_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Position sample request objet structure.
@@ -284,6 +301,22 @@ static int32_t NumOfPositionHandlers = 0;
 //--------------------------------------------------------------------------------------------------
 static le_dls_List_t PositionHandlerList = LE_DLS_LIST_INIT;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory Pool for position snapshot handlers.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t   PositionSnapshotHandlerPoolRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Position snapshot handlers list.
+ *
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t PositionSnapshotHandlerList = LE_DLS_LIST_INIT;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory Pool for position samples.
@@ -340,13 +373,6 @@ static le_ref_MapRef_t PositionSampleMap;
 //--------------------------------------------------------------------------------------------------
 static le_ref_MapRef_t ClientRequestRefMap;
 
-//--------------------------------------------------------------------------------------------------
-/**
- * NMEA pipe file descriptor
- */
-//--------------------------------------------------------------------------------------------------
-static int NmeaPipeFd = -1;
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Position Handler destructor.
@@ -447,124 +473,6 @@ static void CreateNmeaPipe
            "Could not create %s. errno.%d (%s)", LE_GNSS_NMEA_NODE_PATH, errno, strerror(errno));
 }
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Open the NMEA pipe
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t OpenNmeaPipe
-(
-    void
-)
-{
-
-    // Check NMEA pipe file descriptor
-    if(NmeaPipeFd != -1)
-    {
-        return LE_DUPLICATE;
-    }
-
-    // Open NMEA pipe
-    do
-    {
-        if (((NmeaPipeFd=open(LE_GNSS_NMEA_NODE_PATH,
-                                O_WRONLY|O_APPEND|O_CLOEXEC|O_NONBLOCK)) == -1)
-            && (errno != EINTR))
-        {
-            LE_WARN_IF(errno != 6, "Open %s failure: errno.%d (%s)",
-                       LE_GNSS_NMEA_NODE_PATH, errno, strerror(errno));
-            return LE_FAULT;
-        }
-    }while (NmeaPipeFd==-1);
-
-    return LE_OK;
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Close the NMEA pipe
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t CloseNmeaPipe
-(
-    void
-)
-{
-    le_result_t retResult = LE_OK;
-    int result;
-
-    // Check NMEA pipe file descriptor
-    if(NmeaPipeFd == -1)
-    {
-        LE_WARN("Invalid file descriptor. File already closed");
-        return LE_DUPLICATE;
-    }
-
-    // Close NMEA pipe
-    do
-    {
-        result = close(NmeaPipeFd);
-    }
-    while ((result != 0) && (errno == EINTR));
-
-    LE_ERROR_IF(result != 0, "Could not close %s. errno.%d (%s)",
-               LE_GNSS_NMEA_NODE_PATH, errno, strerror(errno));
-
-    if(result != 0)
-    {
-        retResult = LE_FAULT;
-    }
-    else
-    {
-        // Release the NMEA pipe file descriptor
-        NmeaPipeFd = -1;
-    }
-
-    return retResult;
-}
-
-//--------------------------------------------------------------------------------------------------
-/**
- * Write the NMEA sentence to NMEA pipe
- */
-//--------------------------------------------------------------------------------------------------
-static le_result_t WriteNmeaPipe
-(
-    const char*  nmeaStringPtr          ///< [IN] Pointer to the NMEA sentence to write.
-)
-{
-    le_result_t resultNmeaPipe = LE_OK;
-    ssize_t resultWrite = 0;
-    ssize_t written = 0;
-    ssize_t stringSize = 0;
-
-    // Open the NMEA FIFO pipe
-    resultNmeaPipe = OpenNmeaPipe();
-
-    if((resultNmeaPipe == LE_OK)||(resultNmeaPipe == LE_DUPLICATE))
-    {
-        written = 0;
-        stringSize = strlen(nmeaStringPtr)+1;
-        // Write to NMEA pipe
-        while (written < stringSize)
-        {
-            resultWrite = write(NmeaPipeFd, nmeaStringPtr + written, stringSize - written);
-
-            if ((resultWrite < 0) && (errno != EINTR))
-            {
-                LE_ERROR("Could not write to %s (write error, errno.%d (%s))",
-                         LE_GNSS_NMEA_NODE_PATH, errno, strerror(errno));
-                CloseNmeaPipe();
-                return LE_FAULT;
-            }
-
-            written += resultWrite;
-        }
-    }
-
-    return LE_OK;
-}
-
 //--------------------------------------------------------------------------------------------------
 /**
  * The PA NMEA Handler.
@@ -578,8 +486,8 @@ static void PaNmeaHandler
 {
     LE_DEBUG("Handler Function called with PA NMEA %p", nmeaPtr);
 
-    // Write the NMEA sentence to the /dev/nmea device folder
-    WriteNmeaPipe(nmeaPtr);
+    // Distribute the NMEA sentence to the NMEA readers
+    nmeaFanout_AddSentence(nmeaPtr);
 
     le_mem_Release(nmeaPtr);
 }
@@ -809,18 +717,18 @@ static le_gnss_Client_t* GetClientSessionReference
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Convert the DOP value in the selected resolution.
+ * Convert the DOP value in the resolution selected by a client session.
  */
 //--------------------------------------------------------------------------------------------------
-static uint32_t ConvertDop
+static uint32_t ConvertDopForSession
 (
-    uint32_t dopValue    ///< [IN] Dilution of Precision value to convert.
+    le_msg_SessionRef_t sessionRef,     ///< [IN] Client session.
+    uint32_t dopValue                   ///< [IN] Dilution of Precision value to convert.
 )
 {
     uint16_t resValue = 0;
 
     le_gnss_Client_t* clientRequestPtr = NULL;
-    le_msg_SessionRef_t sessionRef = le_gnss_GetClientSessionRef();
     le_gnss_Resolution_t resolution = LE_GNSS_RES_UNKNOWN;
 
     clientRequestPtr = FindClientSessionReference(sessionRef);
@@ -853,22 +761,35 @@ static uint32_t ConvertDop
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Convert the position data in the selected resolution.
+ * Convert the DOP value in the selected resolution.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t ConvertDop
+(
+    uint32_t dopValue    ///< [IN] Dilution of Precision value to convert.
+)
+{
+    return ConvertDopForSession(le_gnss_GetClientSessionRef(), dopValue);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the position data in the resolution selected by a client session.
  *
  * @return
  *  - LE_OK     The function succeed.
  *  - LE_FAULT  The function failed.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t ConvertPositionData
+static le_result_t ConvertPositionDataForSession
 (
-    int32_t value,                 ///< [IN] Data value to convert.
-    le_gnss_DataType_t dataType,   ///< [IN] Data type.
-    int32_t* valuePtr              ///< [OUT] The converted data value.
+    le_msg_SessionRef_t sessionRef,     ///< [IN] Client session.
+    int32_t value,                      ///< [IN] Data value to convert.
+    le_gnss_DataType_t dataType,        ///< [IN] Data type.
+    int32_t* valuePtr                   ///< [OUT] The converted data value.
 )
 {
     le_gnss_Client_t* clientRequestPtr = NULL;
-    le_msg_SessionRef_t sessionRef = le_gnss_GetClientSessionRef();
     le_gnss_Resolution_t resolution = LE_GNSS_RES_UNKNOWN;
 
     if (NULL == valuePtr)
@@ -939,6 +860,246 @@ static le_result_t ConvertPositionData
     return LE_OK;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the position data in the selected resolution.
+ *
+ * @return
+ *  - LE_OK     The function succeed.
+ *  - LE_FAULT  The function failed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ConvertPositionData
+(
+    int32_t value,                 ///< [IN] Data value to convert.
+    le_gnss_DataType_t dataType,   ///< [IN] Data type.
+    int32_t* valuePtr              ///< [OUT] The converted data value.
+)
+{
+    return ConvertPositionDataForSession(le_gnss_GetClientSessionRef(), value, dataType, valuePtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a DOP value for a position snapshot.
+ *
+ * @return true if the DOP is valid.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool GetSnapshotDop
+(
+    le_msg_SessionRef_t sessionRef,     ///< [IN] Client session.
+    bool dopValid,                      ///< [IN] Whether the DOP value is valid.
+    uint32_t dopValue,                  ///< [IN] DOP value to convert.
+    uint16_t* dopPtr                    ///< [OUT] Converted DOP, or UINT16_MAX if invalid.
+)
+{
+    uint32_t dop = dopValid ? ConvertDopForSession(sessionRef, dopValue) : UINT32_MAX;
+
+    if (dop >> 16)
+    {
+        *dopPtr = UINT16_MAX;
+        return false;
+    }
+
+    *dopPtr = (uint16_t)dop;
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fill a position snapshot from a position sample, with the same values as the equivalent
+ * le_gnss_GetXXX() functions.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FillPositionSnapshot
+(
+    const le_gnss_PositionSample_t* samplePtr,  ///< [IN] Position sample.
+    le_msg_SessionRef_t sessionRef,             ///< [IN] Client session, for the resolutions.
+    le_gnss_SnapshotField_t requestedFields,    ///< [IN] Field groups to fill.
+    le_gnss_PositionSnapshot_t* snapshotPtr     ///< [OUT] Position snapshot.
+)
+{
+    le_gnss_SnapshotField_t validFields = 0;
+    bool valid;
+
+    memset(snapshotPtr, 0, sizeof(*snapshotPtr));
+    snapshotPtr->version = LE_GNSS_POSITION_SNAPSHOT_VERSION;
+    snapshotPtr->fixState = samplePtr->fixState;
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_LOCATION)
+    {
+        snapshotPtr->latitude = samplePtr->latitudeValid ? samplePtr->latitude : INT32_MAX;
+        snapshotPtr->longitude = samplePtr->longitudeValid ? samplePtr->longitude : INT32_MAX;
+        snapshotPtr->hAccuracy = samplePtr->hAccuracyValid ? samplePtr->hAccuracy : INT32_MAX;
+        if (samplePtr->latitudeValid && samplePtr->longitudeValid && samplePtr->hAccuracyValid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_LOCATION;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_ALTITUDE)
+    {
+        snapshotPtr->altitude = samplePtr->altitudeValid ? samplePtr->altitude : INT32_MAX;
+        valid = samplePtr->vAccuracyValid &&
+                (LE_OK == ConvertPositionDataForSession(sessionRef,
+                                                        samplePtr->vAccuracy,
+                                                        LE_GNSS_DATA_VACCURACY,
+                                                        &snapshotPtr->vAccuracy));
+        if (!valid)
+        {
+            snapshotPtr->vAccuracy = INT32_MAX;
+        }
+        if (samplePtr->altitudeValid && valid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_ALTITUDE;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_ALTITUDE_WGS84)
+    {
+        snapshotPtr->altitudeOnWgs84 = samplePtr->altitudeOnWgs84Valid ?
+                                       samplePtr->altitudeOnWgs84 : INT32_MAX;
+        if (samplePtr->altitudeOnWgs84Valid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_ALTITUDE_WGS84;
+        }
+    }
+
+    if ((requestedFields & LE_GNSS_SNAPSHOT_TIME) && samplePtr->timeValid)
+    {
+        snapshotPtr->hours = samplePtr->hours;
+        snapshotPtr->minutes = samplePtr->minutes;
+        snapshotPtr->seconds = samplePtr->seconds;
+        snapshotPtr->milliseconds = samplePtr->milliseconds;
+        validFields |= LE_GNSS_SNAPSHOT_TIME;
+    }
+
+    if ((requestedFields & LE_GNSS_SNAPSHOT_DATE) && samplePtr->dateValid)
+    {
+        snapshotPtr->year = samplePtr->year;
+        snapshotPtr->month = samplePtr->month;
+        snapshotPtr->day = samplePtr->day;
+        validFields |= LE_GNSS_SNAPSHOT_DATE;
+    }
+
+    if ((requestedFields & LE_GNSS_SNAPSHOT_EPOCH_TIME) && samplePtr->timeValid)
+    {
+        snapshotPtr->epochTime = samplePtr->epochTime;
+        validFields |= LE_GNSS_SNAPSHOT_EPOCH_TIME;
+    }
+
+    if ((requestedFields & LE_GNSS_SNAPSHOT_GPS_TIME) && samplePtr->gpsTimeValid)
+    {
+        snapshotPtr->gpsWeek = samplePtr->gpsWeek;
+        snapshotPtr->gpsTimeOfWeek = samplePtr->gpsTimeOfWeek;
+        validFields |= LE_GNSS_SNAPSHOT_GPS_TIME;
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_TIME_ACCURACY)
+    {
+        snapshotPtr->timeAccuracy = samplePtr->timeAccuracyValid ?
+                                    samplePtr->timeAccuracy : UINT16_MAX;
+        if (samplePtr->timeAccuracyValid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_TIME_ACCURACY;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_HSPEED)
+    {
+        snapshotPtr->hSpeed = samplePtr->hSpeedValid ? samplePtr->hSpeed : UINT32_MAX;
+        valid = samplePtr->hSpeedAccuracyValid &&
+                (LE_OK == ConvertPositionDataForSession(sessionRef,
+                                                 samplePtr->hSpeedAccuracy,
+                                                 LE_GNSS_DATA_HSPEEDACCURACY,
+                                                 (int32_t*)&snapshotPtr->hSpeedAccuracy));
+        if (!valid)
+        {
+            snapshotPtr->hSpeedAccuracy = UINT32_MAX;
+        }
+        if (samplePtr->hSpeedValid && valid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_HSPEED;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_VSPEED)
+    {
+        snapshotPtr->vSpeed = samplePtr->vSpeedValid ? samplePtr->vSpeed : INT32_MAX;
+        valid = samplePtr->vSpeedAccuracyValid &&
+                (LE_OK == ConvertPositionDataForSession(sessionRef,
+                                                        samplePtr->vSpeedAccuracy,
+                                                        LE_GNSS_DATA_VSPEEDACCURACY,
+                                                        &snapshotPtr->vSpeedAccuracy));
+        if (!valid)
+        {
+            snapshotPtr->vSpeedAccuracy = INT32_MAX;
+        }
+        if (samplePtr->vSpeedValid && valid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_VSPEED;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_DIRECTION)
+    {
+        snapshotPtr->direction = samplePtr->directionValid ? samplePtr->direction : UINT32_MAX;
+        snapshotPtr->directionAccuracy = samplePtr->directionAccuracyValid ?
+                                         samplePtr->directionAccuracy : UINT32_MAX;
+        if (samplePtr->directionValid && samplePtr->directionAccuracyValid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_DIRECTION;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_DOP)
+    {
+        // Evaluate all of them, so that each invalid DOP is set to UINT16_MAX.
+        valid = GetSnapshotDop(sessionRef, samplePtr->pdopValid, samplePtr->pdop,
+                               &snapshotPtr->pdop);
+        valid = GetSnapshotDop(sessionRef, samplePtr->hdopValid, samplePtr->hdop,
+                               &snapshotPtr->hdop) && valid;
+        valid = GetSnapshotDop(sessionRef, samplePtr->vdopValid, samplePtr->vdop,
+                               &snapshotPtr->vdop) && valid;
+        valid = GetSnapshotDop(sessionRef, samplePtr->gdopValid, samplePtr->gdop,
+                               &snapshotPtr->gdop) && valid;
+        valid = GetSnapshotDop(sessionRef, samplePtr->tdopValid, samplePtr->tdop,
+                               &snapshotPtr->tdop) && valid;
+        if (valid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_DOP;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_SATS_STATUS)
+    {
+        snapshotPtr->satsInViewCount = samplePtr->satsInViewCountValid ?
+                                       samplePtr->satsInViewCount : UINT8_MAX;
+        snapshotPtr->satsTrackingCount = samplePtr->satsTrackingCountValid ?
+                                         samplePtr->satsTrackingCount : UINT8_MAX;
+        snapshotPtr->satsUsedCount = samplePtr->satsUsedCountValid ?
+                                     samplePtr->satsUsedCount : UINT8_MAX;
+        if (samplePtr->satsInViewCountValid && samplePtr->satsTrackingCountValid &&
+            samplePtr->satsUsedCountValid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_SATS_STATUS;
+        }
+    }
+
+    if (requestedFields & LE_GNSS_SNAPSHOT_MAGNETIC_DEVIATION)
+    {
+        snapshotPtr->magneticDeviation = samplePtr->magneticDeviationValid ?
+                                         samplePtr->magneticDeviation : INT32_MAX;
+        if (samplePtr->magneticDeviationValid)
+        {
+            validFields |= LE_GNSS_SNAPSHOT_MAGNETIC_DEVIATION;
+        }
+    }
+
+    snapshotPtr->validFields = validFields;
+}
+
 //--------------------------------------------------------------------------------------------------
 // APIs.
 //--------------------------------------------------------------------------------------------------
@@ -971,6 +1132,24 @@ static void PaPositionHandler
     // Get the position sample data from the PA position data report
     GetPosSampleData(&LastPositionSample, positionPtr);
 
+    // Snapshot handlers get the position directly, without any position sample to query.
+    linkPtr = le_dls_Peek(&PositionSnapshotHandlerList);
+    while (NULL != linkPtr)
+    {
+        le_gnss_PositionSnapshotHandler_t* snapshotHandlerPtr =
+            CONTAINER_OF(linkPtr, le_gnss_PositionSnapshotHandler_t, link);
+        le_gnss_PositionSnapshot_t snapshot;
+
+        // Move to the next node first, as the handler may remove itself.
+        linkPtr = le_dls_PeekNext(&PositionSnapshotHandlerList, linkPtr);
+
+        FillPositionSnapshot(&LastPositionSample,
+                             snapshotHandlerPtr->sessionRef,
+                             snapshotHandlerPtr->requestedFields,
+                             &snapshot);
+        snapshotHandlerPtr->handlerFuncPtr(&snapshot, snapshotHandlerPtr->handlerContextPtr);
+    }
+
     if(!NumOfPositionHandlers)
     {
         LE_DEBUG("No positioning handlers, exit Handler Function");
@@ -1108,6 +1287,25 @@ static void CloseSessionEventHandler
         result = le_ref_NextNode(iterRef);
     }
 
+    // Remove the position snapshot handlers of the closed session.
+    le_dls_Link_t* linkPtr = le_dls_Peek(&PositionSnapshotHandlerList);
+    while (NULL != linkPtr)
+    {
+        le_gnss_PositionSnapshotHandler_t* snapshotHandlerPtr =
+            CONTAINER_OF(linkPtr, le_gnss_PositionSnapshotHandler_t, link);
+
+        linkPtr = le_dls_PeekNext(&PositionSnapshotHandlerList, linkPtr);
+
+        if (snapshotHandlerPtr->sessionRef == sessionRef)
+        {
+            le_gnss_RemovePositionSnapshotHandler(
+                                (le_gnss_PositionSnapshotHandlerRef_t)snapshotHandlerPtr);
+        }
+    }
+
+    // Close the NMEA streams of the closed session.
+    nmeaFanout_CloseSessionStreams(sessionRef);
+
     iterRef = le_ref_GetIterator(ClientRequestRefMap);
     result = le_ref_NextNode(iterRef);
     while (LE_OK == result)
@@ -1223,6 +1421,10 @@ le_result_t gnss_Init
                                                sizeof(le_gnss_PositionHandler_t));
     le_mem_SetDestructor(PositionHandlerPoolRef, PositionHandlerDestructor);
 
+    // Create a pool for position snapshot handler objects
+    PositionSnapshotHandlerPoolRef = le_mem_CreatePool("PositionSnapshotHandlerPoolRef",
+                                                sizeof(le_gnss_PositionSnapshotHandler_t));
+
     // Create a pool for Position Sample objects
     PositionSamplePoolRef = le_mem_CreatePool("PositionSamplePoolRef",
                                               sizeof(le_gnss_PositionSample_t));
@@ -1274,6 +1476,10 @@ le_result_t gnss_Init
          {
              LE_ERROR("Failed to add PA NMEA handler!");
          }
+         else
+         {
+             nmeaFanout_Init(LE_GNSS_NMEA_NODE_PATH);
+         }
     }
     else if ((resultStat == 0) && (S_ISCHR(nmeaFileStat.st_mode))) // Character device file
     {
@@ -1285,6 +1491,7 @@ le_result_t gnss_Init
         {
             // Create NMEA device folder
             CreateNmeaPipe();
+            nmeaFanout_Init(LE_GNSS_NMEA_NODE_PATH);
         }
         else
         {
@@ -1391,7 +1598,91 @@ void le_gnss_RemovePositionHandler
         } while (linkPtr != NULL);
     }
 
-    if(NumOfPositionHandlers == 0)
+    if ((NumOfPositionHandlers == 0) && le_dls_IsEmpty(&PositionSnapshotHandlerList))
+    {
+        pa_gnss_RemovePositionDataHandler(PaHandlerRef);
+        PaHandlerRef = NULL;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to register an handler for position snapshots.
+ *
+ *  - A handler reference, which is only needed for later removal of the handler.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+le_gnss_PositionSnapshotHandlerRef_t le_gnss_AddPositionSnapshotHandler
+(
+    le_gnss_SnapshotField_t                 requestedFields,    ///< [IN] Field groups to fill.
+    le_gnss_PositionSnapshotHandlerFunc_t   handlerPtr,         ///< [IN] The handler function.
+    void*                                   contextPtr          ///< [IN] The context pointer
+)
+{
+    le_gnss_PositionSnapshotHandler_t* snapshotHandlerPtr;
+
+    LE_FATAL_IF((NULL == handlerPtr), "handlerPtr pointer is NULL !");
+
+    snapshotHandlerPtr = le_mem_ForceAlloc(PositionSnapshotHandlerPoolRef);
+    snapshotHandlerPtr->link = LE_DLS_LINK_INIT;
+    snapshotHandlerPtr->handlerFuncPtr = handlerPtr;
+    snapshotHandlerPtr->handlerContextPtr = contextPtr;
+    snapshotHandlerPtr->requestedFields = requestedFields;
+    snapshotHandlerPtr->sessionRef = le_gnss_GetClientSessionRef();
+
+    // Subscribe to PA position Data handler
+    if (NULL == PaHandlerRef)
+    {
+        if ((PaHandlerRef=pa_gnss_AddPositionDataHandler(PaPositionHandler)) == NULL)
+        {
+            LE_ERROR("Failed to add PA position Data handler!");
+        }
+        else
+        {
+            LE_DEBUG("PaHandlerRef %p subscribed", PaHandlerRef);
+        }
+    }
+
+    le_dls_Queue(&PositionSnapshotHandlerList, &(snapshotHandlerPtr->link));
+
+    LE_DEBUG("Position snapshot handler %p added (fields 0x%X)",
+             handlerPtr, (unsigned int)requestedFields);
+
+    return (le_gnss_PositionSnapshotHandlerRef_t)snapshotHandlerPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function must be called to remove a handler for position snapshots.
+ *
+ * @note Doesn't return on failure, so there's no need to check the return value for errors.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gnss_RemovePositionSnapshotHandler
+(
+    le_gnss_PositionSnapshotHandlerRef_t handlerRef ///< [IN] The handler reference.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&PositionSnapshotHandlerList);
+
+    while (NULL != linkPtr)
+    {
+        le_gnss_PositionSnapshotHandler_t* snapshotHandlerPtr =
+            CONTAINER_OF(linkPtr, le_gnss_PositionSnapshotHandler_t, link);
+
+        if ((le_gnss_PositionSnapshotHandlerRef_t)snapshotHandlerPtr == handlerRef)
+        {
+            le_dls_Remove(&PositionSnapshotHandlerList, linkPtr);
+            le_mem_Release(snapshotHandlerPtr);
+            break;
+        }
+
+        linkPtr = le_dls_PeekNext(&PositionSnapshotHandlerList, linkPtr);
+    }
+
+    if ((NumOfPositionHandlers == 0) && le_dls_IsEmpty(&PositionSnapshotHandlerList))
     {
         pa_gnss_RemovePositionDataHandler(PaHandlerRef);
         PaHandlerRef = NULL;
@@ -2984,6 +3275,58 @@ le_result_t le_gnss_GetMagneticDeviation
     return result;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a snapshot of a position sample, in a single call.
+ *
+ * @return
+ *  - LE_FAULT         Function failed to find the positionSample.
+ *  - LE_OK            Function succeeded. The validFields member of the snapshot tells which
+ *                     requested fields are valid.
+ *
+ * @note If the caller is passing an invalid Position sample reference into this function,
+ *       it is a fatal error, the function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gnss_GetPositionSnapshot
+(
+    le_gnss_SampleRef_t positionSampleRef,
+        ///< [IN]
+        ///< Position sample's reference.
+
+    le_gnss_SnapshotField_t requestedFields,
+        ///< [IN]
+        ///< Field groups to fill.
+
+    le_gnss_PositionSnapshot_t* snapshotPtr
+        ///< [OUT]
+        ///< Snapshot of the position sample.
+)
+{
+    le_gnss_PositionSampleRequest_t* positionSampleRequestNodePtr
+                                            = le_ref_Lookup(PositionSampleMap,positionSampleRef);
+
+    if (NULL == snapshotPtr)
+    {
+        LE_KILL_CLIENT("Invalid pointer provided!");
+        return LE_FAULT;
+    }
+
+    // Check position sample's reference
+    le_result_t result = ValidatePositionSamplePtr(positionSampleRequestNodePtr);
+    if (LE_OK != result)
+    {
+        return result;
+    }
+
+    FillPositionSnapshot(positionSampleRequestNodePtr->positionSampleNodePtr,
+                         le_gnss_GetClientSessionRef(),
+                         requestedFields,
+                         snapshotPtr);
+
+    return LE_OK;
+}
+
 
 //--------------------------------------------------------------------------------------------------
 /**
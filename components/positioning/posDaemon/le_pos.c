@@ -998,9 +998,16 @@ static void PosSampleHandlerfunc
             // Store posSample reference which will be used in close session handler
             posSampleRequestPtr->positionSampleRef = reqRef;
 
-            // Call the client's handler
+            // Call the client's handler.  Only its latest sample matters, so the report is keyed
+            // to the handler for a client that does not keep up.
+#if LE_CONFIG_LINUX
+            le_msg_SetThreadCoalesceKey((uintptr_t)posSampleHandlerNodePtr);
+#endif
             posSampleHandlerNodePtr->handlerFuncPtr(reqRef,
                                             posSampleHandlerNodePtr->handlerContextPtr);
+#if LE_CONFIG_LINUX
+            le_msg_SetThreadCoalesceKey(0);
+#endif
         }
 
         // Move to the next node.
@@ -1172,6 +1179,13 @@ COMPONENT_INIT
     le_msg_ServiceRef_t posMsgService = le_pos_GetServiceRef();
     le_msg_AddServiceCloseHandler(posMsgService, PosCloseSessionEventHandler, NULL);
 
+#if LE_CONFIG_LINUX
+    // A client that does not keep up with the movement reports only needs the latest one of
+    // each handler.
+    le_msg_SetServiceTxQueueLimit(posMsgService, LE_CONFIG_MSG_TX_QUEUE_LIMIT,
+                                  LE_MSG_TX_OVERFLOW_COALESCE);
+#endif
+
     // Initialize the event client close function handler.
     le_msg_ServiceRef_t posCtrlMsgService = le_posCtrl_GetServiceRef();
     le_msg_AddServiceCloseHandler(posCtrlMsgService, PosCtrlCloseSessionEventHandler, NULL);
@@ -0,0 +1,915 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file nmeaFanout.c
+ *
+ * This file contains the distribution of the NMEA flow to the NMEA readers.
+ *
+ * The NMEA sentences received from the PA are gathered in a batch until the fix epoch changes,
+ * the batch is full or a maximum delay expires. The batch is then written to every reader with a
+ * single write. Each reader has its own sentence filter and a bounded queue holding what it could
+ * not accept yet: a slow reader never blocks the daemon nor the other readers, the epochs which
+ * do not fit in its queue are dropped and counted.
+ *
+ * The readers are the "/dev/nmea" FIFO, opened when someone reads it, and the NMEA streams opened
+ * by the clients with le_gnss_OpenNmeaStream(), which are Unix socket pairs.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "interfaces.h"
+#include "nmeaFanout.h"
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of an epoch batch, in bytes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_BATCH_MAX_BYTES        4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of sentences in an epoch batch.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_BATCH_MAX_SENTENCES    64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum delay between the first sentence of a batch and its writing to the readers, in ms.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_BATCH_MAX_DELAY_MS     200
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the queue of a reader, in bytes. It must hold at least one full batch.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_READER_QUEUE_BYTES     (2 * NMEA_BATCH_MAX_BYTES)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of the UTC time field identifying an epoch.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_EPOCH_TIME_MAX_LEN     15
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of the NMEA address field (talker and sentence formatter, e.g. "GPGGA").
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_ADDRESS_LEN            5
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected number of NMEA streams.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NMEA_STREAM_MAX             8
+
+//--------------------------------------------------------------------------------------------------
+// Data structures.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sentence of an epoch batch.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint16_t                offset;     ///< Offset of the sentence in the batch data.
+    uint16_t                size;       ///< Size of the sentence, with its null terminator.
+    le_gnss_NmeaBitMask_t   type;       ///< Sentence type, 0 if not in le_gnss_NmeaBitMask_t.
+}
+Sentence_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Epoch batch.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t      size;                                   ///< Size of the batch data.
+    size_t      sentenceCount;                          ///< Number of sentences.
+    Sentence_t  sentences[NMEA_BATCH_MAX_SENTENCES];    ///< Sentences of the batch.
+    char        epochTime[NMEA_EPOCH_TIME_MAX_LEN + 1]; ///< UTC time of the epoch, empty if
+                                                        ///  no sentence gave it yet.
+    char        data[NMEA_BATCH_MAX_BYTES];             ///< Sentences data.
+}
+Batch_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * NMEA reader.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int                     fd;             ///< File descriptor written to.
+    le_fdMonitor_Ref_t      monitorRef;     ///< Monitor of the file descriptor.
+    le_gnss_NmeaBitMask_t   filter;         ///< Sentence types written, 0 for all.
+    le_gnss_NmeaStreamRef_t streamRef;      ///< Stream reference, NULL for the FIFO.
+    le_msg_SessionRef_t     sessionRef;     ///< Session which opened the stream.
+    uint32_t                dropCount;      ///< Number of dropped sentences.
+    size_t                  queueHead;      ///< Offset of the oldest byte in the queue.
+    size_t                  queueSize;      ///< Number of bytes in the queue.
+    char                    queue[NMEA_READER_QUEUE_BYTES]; ///< Bytes not written yet.
+    le_dls_Link_t           link;           ///< Link in the reader list.
+}
+Reader_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sentence types which can be filtered, from their address field.
+ */
+//--------------------------------------------------------------------------------------------------
+static const struct
+{
+    const char*             addressPtr;     ///< Address field, or its prefix.
+    le_gnss_NmeaBitMask_t   type;           ///< Sentence type.
+}
+SentenceTypes[] =
+{
+    { "GPGGA", LE_GNSS_NMEA_MASK_GPGGA },
+    { "GPGSA", LE_GNSS_NMEA_MASK_GPGSA },
+    { "GPGSV", LE_GNSS_NMEA_MASK_GPGSV },
+    { "GPRMC", LE_GNSS_NMEA_MASK_GPRMC },
+    { "GPVTG", LE_GNSS_NMEA_MASK_GPVTG },
+    { "GLGSV", LE_GNSS_NMEA_MASK_GLGSV },
+    { "GNGNS", LE_GNSS_NMEA_MASK_GNGNS },
+    { "GNGSA", LE_GNSS_NMEA_MASK_GNGSA },
+    { "GAGGA", LE_GNSS_NMEA_MASK_GAGGA },
+    { "GAGSA", LE_GNSS_NMEA_MASK_GAGSA },
+    { "GAGSV", LE_GNSS_NMEA_MASK_GAGSV },
+    { "GARMC", LE_GNSS_NMEA_MASK_GARMC },
+    { "GAVTG", LE_GNSS_NMEA_MASK_GAVTG },
+    { "PSTIS", LE_GNSS_NMEA_MASK_PSTIS },
+    { "GPGRS", LE_GNSS_NMEA_MASK_GPGRS },
+    { "GPGLL", LE_GNSS_NMEA_MASK_GPGLL },
+    { "GPDTM", LE_GNSS_NMEA_MASK_GPDTM },
+    { "GAGNS", LE_GNSS_NMEA_MASK_GAGNS },
+    // Proprietary types: PQXFI, PQGSA and PQGSV
+    { "PQ",    LE_GNSS_NMEA_MASK_PTYPE | LE_GNSS_NMEA_MASK_PQXFI },
+};
+
+//--------------------------------------------------------------------------------------------------
+// Static declarations.
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Current epoch batch.
+ */
+//--------------------------------------------------------------------------------------------------
+static Batch_t Batch;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer writing a batch whose epoch did not end in time.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t BatchTimerRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Path of the NMEA FIFO, NULL if there is none.
+ */
+//--------------------------------------------------------------------------------------------------
+static const char* FifoPathPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * FIFO reader, NULL if the FIFO is not open.
+ */
+//--------------------------------------------------------------------------------------------------
+static Reader_t* FifoReaderPtr;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reader list.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t ReaderList = LE_DLS_LIST_INIT;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reader memory pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ReaderPoolRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Safe reference map of the NMEA streams.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t StreamRefMap;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set once the distribution is initialized.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsInitialized;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the type of a sentence from its address field.
+ *
+ * @return The sentence type, 0 if it is not in le_gnss_NmeaBitMask_t.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_gnss_NmeaBitMask_t GetSentenceType
+(
+    const char* sentencePtr     ///< [IN] NMEA sentence.
+)
+{
+    size_t i;
+
+    if ('$' != sentencePtr[0])
+    {
+        return 0;
+    }
+
+    for (i = 0; i < NUM_ARRAY_MEMBERS(SentenceTypes); i++)
+    {
+        if (0 == strncmp(sentencePtr + 1, SentenceTypes[i].addressPtr,
+                         strlen(SentenceTypes[i].addressPtr)))
+        {
+            return SentenceTypes[i].type;
+        }
+    }
+
+    return 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the UTC time of the fix a sentence belongs to.
+ *
+ * Only the sentences carrying the time of the fix are considered: GGA, RMC, GNS, ZDA and GLL.
+ *
+ * @return true if the sentence gave a time.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool GetEpochTime
+(
+    const char* sentencePtr,    ///< [IN] NMEA sentence.
+    char*       timePtr         ///< [OUT] UTC time field, NMEA_EPOCH_TIME_MAX_LEN + 1 bytes.
+)
+{
+    const char* formatterPtr;
+    int timeField;
+    size_t len;
+
+    if (('$' != sentencePtr[0]) || (strlen(sentencePtr) <= NMEA_ADDRESS_LEN))
+    {
+        return false;
+    }
+
+    // The sentence formatter follows the two characters of the talker.
+    formatterPtr = sentencePtr + 3;
+    if ((0 == strncmp(formatterPtr, "GGA,", 4)) ||
+        (0 == strncmp(formatterPtr, "RMC,", 4)) ||
+        (0 == strncmp(formatterPtr, "GNS,", 4)) ||
+        (0 == strncmp(formatterPtr, "ZDA,", 4)))
+    {
+        timeField = 1;
+    }
+    else if (0 == strncmp(formatterPtr, "GLL,", 4))
+    {
+        timeField = 5;
+    }
+    else
+    {
+        return false;
+    }
+
+    while (timeField--)
+    {
+        sentencePtr = strchr(sentencePtr, ',');
+        if (NULL == sentencePtr)
+        {
+            return false;
+        }
+        sentencePtr++;
+    }
+
+    len = strcspn(sentencePtr, ",*\r\n");
+    if ((0 == len) || (len > NMEA_EPOCH_TIME_MAX_LEN))
+    {
+        return false;
+    }
+
+    memcpy(timePtr, sentencePtr, len);
+    timePtr[len] = '\0';
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Append bytes to the queue of a reader. The caller checked that they fit.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueAppend
+(
+    Reader_t*   readerPtr,      ///< [IN] Reader.
+    const char* dataPtr,        ///< [IN] Bytes to append.
+    size_t      size            ///< [IN] Number of bytes.
+)
+{
+    size_t tail = (readerPtr->queueHead + readerPtr->queueSize) % NMEA_READER_QUEUE_BYTES;
+    size_t firstPart = NMEA_READER_QUEUE_BYTES - tail;
+
+    if (firstPart > size)
+    {
+        firstPart = size;
+    }
+
+    memcpy(readerPtr->queue + tail, dataPtr, firstPart);
+    memcpy(readerPtr->queue, dataPtr + firstPart, size - firstPart);
+    readerPtr->queueSize += size;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write vectors to a reader, retrying if interrupted.
+ *
+ * @return Number of bytes written, 0 if the reader can not accept anything now, -1 if the reader
+ *         must be closed.
+ */
+//--------------------------------------------------------------------------------------------------
+static ssize_t WriteReader
+(
+    Reader_t*           readerPtr,  ///< [IN] Reader.
+    const struct iovec* iovPtr,     ///< [IN] Vectors to write.
+    int                 iovCount    ///< [IN] Number of vectors.
+)
+{
+    ssize_t written;
+
+    do
+    {
+        written = writev(readerPtr->fd, iovPtr, iovCount);
+    }
+    while ((-1 == written) && (EINTR == errno));
+
+    if (-1 == written)
+    {
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+        {
+            return 0;
+        }
+
+        LE_DEBUG("NMEA reader fd %d closed: errno.%d (%s)",
+                 readerPtr->fd, errno, strerror(errno));
+        return -1;
+    }
+
+    return written;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close a reader, and release its stream reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseReader
+(
+    Reader_t* readerPtr     ///< [IN] Reader.
+)
+{
+    le_fdMonitor_Delete(readerPtr->monitorRef);
+    close(readerPtr->fd);
+
+    if (readerPtr == FifoReaderPtr)
+    {
+        FifoReaderPtr = NULL;
+    }
+    if (readerPtr->streamRef)
+    {
+        le_ref_DeleteRef(StreamRefMap, readerPtr->streamRef);
+    }
+
+    le_dls_Remove(&ReaderList, &readerPtr->link);
+    le_mem_Release(readerPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the queue of a reader, as far as it accepts it.
+ *
+ * @return false if the reader was closed.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool DrainQueue
+(
+    Reader_t* readerPtr     ///< [IN] Reader.
+)
+{
+    struct iovec iov[2];
+    int iovCount = 1;
+    size_t firstPart = NMEA_READER_QUEUE_BYTES - readerPtr->queueHead;
+    ssize_t written;
+
+    if (firstPart >= readerPtr->queueSize)
+    {
+        firstPart = readerPtr->queueSize;
+    }
+    else
+    {
+        iov[1].iov_base = readerPtr->queue;
+        iov[1].iov_len = readerPtr->queueSize - firstPart;
+        iovCount = 2;
+    }
+    iov[0].iov_base = readerPtr->queue + readerPtr->queueHead;
+    iov[0].iov_len = firstPart;
+
+    written = WriteReader(readerPtr, iov, iovCount);
+    if (written < 0)
+    {
+        CloseReader(readerPtr);
+        return false;
+    }
+
+    readerPtr->queueHead = (readerPtr->queueHead + written) % NMEA_READER_QUEUE_BYTES;
+    readerPtr->queueSize -= written;
+
+    if (0 == readerPtr->queueSize)
+    {
+        readerPtr->queueHead = 0;
+        le_fdMonitor_Disable(readerPtr->monitorRef, POLLOUT);
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reader file descriptor event handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReaderEventHandler
+(
+    int     fd,         ///< [IN] File descriptor.
+    short   events      ///< [IN] Events.
+)
+{
+    Reader_t* readerPtr = le_fdMonitor_GetContextPtr();
+
+    LE_UNUSED(fd);
+
+    if (events & (POLLERR | POLLHUP))
+    {
+        CloseReader(readerPtr);
+    }
+    else if (events & POLLOUT)
+    {
+        DrainQueue(readerPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a reader.
+ *
+ * @return The reader.
+ */
+//--------------------------------------------------------------------------------------------------
+static Reader_t* CreateReader
+(
+    int                     fd,         ///< [IN] Non-blocking file descriptor written to.
+    le_gnss_NmeaBitMask_t   filter      ///< [IN] Sentence types written, 0 for all.
+)
+{
+    Reader_t* readerPtr = le_mem_ForceAlloc(ReaderPoolRef);
+
+    readerPtr->fd = fd;
+    readerPtr->filter = filter;
+    readerPtr->streamRef = NULL;
+    readerPtr->sessionRef = NULL;
+    readerPtr->dropCount = 0;
+    readerPtr->queueHead = 0;
+    readerPtr->queueSize = 0;
+    readerPtr->link = LE_DLS_LINK_INIT;
+
+    // POLLOUT is only monitored when there are bytes queued.
+    readerPtr->monitorRef = le_fdMonitor_Create("NmeaReader", fd, ReaderEventHandler, 0);
+    le_fdMonitor_SetContextPtr(readerPtr->monitorRef, readerPtr);
+
+    le_dls_Queue(&ReaderList, &readerPtr->link);
+
+    return readerPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Open the NMEA FIFO if someone is reading it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void OpenFifo
+(
+    void
+)
+{
+    int fd;
+
+    if ((NULL == FifoPathPtr) || (NULL != FifoReaderPtr))
+    {
+        return;
+    }
+
+    do
+    {
+        fd = open(FifoPathPtr, O_WRONLY | O_APPEND | O_CLOEXEC | O_NONBLOCK);
+    }
+    while ((-1 == fd) && (EINTR == errno));
+
+    if (-1 == fd)
+    {
+        // ENXIO: nobody is reading the FIFO.
+        LE_WARN_IF(ENXIO != errno, "Open %s failure: errno.%d (%s)",
+                   FifoPathPtr, errno, strerror(errno));
+        return;
+    }
+
+    FifoReaderPtr = CreateReader(fd, 0);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the current batch to a reader, or queue it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteBatchToReader
+(
+    Reader_t* readerPtr     ///< [IN] Reader.
+)
+{
+    struct iovec iov[NMEA_BATCH_MAX_SENTENCES];
+    int iovCount = 0;
+    size_t sentenceCount = 0;
+    size_t size = 0;
+    size_t i;
+    ssize_t written = 0;
+
+    // Gather the selected sentences, merging the adjacent ones.
+    for (i = 0; i < Batch.sentenceCount; i++)
+    {
+        const Sentence_t* sentencePtr = &Batch.sentences[i];
+
+        if (readerPtr->filter && !(readerPtr->filter & sentencePtr->type))
+        {
+            continue;
+        }
+
+        if ((iovCount > 0) &&
+            ((char*)iov[iovCount - 1].iov_base + iov[iovCount - 1].iov_len ==
+             Batch.data + sentencePtr->offset))
+        {
+            iov[iovCount - 1].iov_len += sentencePtr->size;
+        }
+        else
+        {
+            iov[iovCount].iov_base = Batch.data + sentencePtr->offset;
+            iov[iovCount].iov_len = sentencePtr->size;
+            iovCount++;
+        }
+        sentenceCount++;
+        size += sentencePtr->size;
+    }
+
+    if (0 == size)
+    {
+        return;
+    }
+
+    if (0 == readerPtr->queueSize)
+    {
+        written = WriteReader(readerPtr, iov, iovCount);
+        if (written < 0)
+        {
+            CloseReader(readerPtr);
+            return;
+        }
+        if ((size_t)written == size)
+        {
+            return;
+        }
+        // The remainder always fits in an empty queue.
+    }
+    else if (size > NMEA_READER_QUEUE_BYTES - readerPtr->queueSize)
+    {
+        readerPtr->dropCount += sentenceCount;
+        LE_DEBUG("NMEA reader fd %d too slow, %zu sentences dropped", readerPtr->fd, sentenceCount);
+        return;
+    }
+
+    // Queue what was not written.
+    for (i = 0; i < (size_t)iovCount; i++)
+    {
+        if ((size_t)written >= iov[i].iov_len)
+        {
+            written -= iov[i].iov_len;
+            continue;
+        }
+
+        QueueAppend(readerPtr, (char*)iov[i].iov_base + written, iov[i].iov_len - written);
+        written = 0;
+    }
+
+    le_fdMonitor_Enable(readerPtr->monitorRef, POLLOUT);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the current batch to all the readers, and start a new one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FlushBatch
+(
+    void
+)
+{
+    le_dls_Link_t* linkPtr;
+
+    if (le_timer_IsRunning(BatchTimerRef))
+    {
+        le_timer_Stop(BatchTimerRef);
+    }
+
+    if (0 == Batch.sentenceCount)
+    {
+        return;
+    }
+
+    OpenFifo();
+
+    linkPtr = le_dls_Peek(&ReaderList);
+    while (NULL != linkPtr)
+    {
+        Reader_t* readerPtr = CONTAINER_OF(linkPtr, Reader_t, link);
+
+        // The reader may be closed while written to.
+        linkPtr = le_dls_PeekNext(&ReaderList, linkPtr);
+
+        WriteBatchToReader(readerPtr);
+    }
+
+    Batch.size = 0;
+    Batch.sentenceCount = 0;
+    Batch.epochTime[0] = '\0';
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch timer handler: the epoch did not end in time.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BatchTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Timer reference.
+)
+{
+    LE_UNUSED(timerRef);
+
+    FlushBatch();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the NMEA flow distribution.
+ *
+ * Must be called once the PA NMEA handler is registered, before nmeaFanout_AddSentence().
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_Init
+(
+    const char* fifoPathPtr     ///< [IN] Path of the NMEA FIFO, NULL if there is none.
+)
+{
+    FifoPathPtr = fifoPathPtr;
+
+    ReaderPoolRef = le_mem_CreatePool("NmeaReaderPool", sizeof(Reader_t));
+    StreamRefMap = le_ref_CreateMap("NmeaStreamMap", NMEA_STREAM_MAX);
+
+    BatchTimerRef = le_timer_Create("NmeaBatchTimer");
+    le_timer_SetMsInterval(BatchTimerRef, NMEA_BATCH_MAX_DELAY_MS);
+    le_timer_SetHandler(BatchTimerRef, BatchTimerHandler);
+
+    IsInitialized = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add an NMEA sentence received from the PA.
+ *
+ * The sentences are gathered and written to the readers once per fix epoch.
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_AddSentence
+(
+    const char* sentencePtr     ///< [IN] NMEA sentence, null-terminated.
+)
+{
+    char epochTime[NMEA_EPOCH_TIME_MAX_LEN + 1];
+    size_t size = strlen(sentencePtr) + 1;
+    bool hasEpochTime = GetEpochTime(sentencePtr, epochTime);
+    Sentence_t* newSentencePtr;
+
+    if (size > NMEA_BATCH_MAX_BYTES)
+    {
+        LE_WARN("NMEA sentence too long (%zu bytes)", size);
+        return;
+    }
+
+    // A sentence of another fix starts a new epoch.
+    if ((hasEpochTime && ('\0' != Batch.epochTime[0]) && (0 != strcmp(epochTime, Batch.epochTime)))
+        || (Batch.size + size > NMEA_BATCH_MAX_BYTES)
+        || (NMEA_BATCH_MAX_SENTENCES == Batch.sentenceCount))
+    {
+        FlushBatch();
+    }
+
+    if (hasEpochTime && ('\0' == Batch.epochTime[0]))
+    {
+        le_utf8_Copy(Batch.epochTime, epochTime, sizeof(Batch.epochTime), NULL);
+    }
+
+    newSentencePtr = &Batch.sentences[Batch.sentenceCount++];
+    newSentencePtr->offset = Batch.size;
+    newSentencePtr->size = size;
+    newSentencePtr->type = GetSentenceType(sentencePtr);
+
+    memcpy(Batch.data + Batch.size, sentencePtr, size);
+    Batch.size += size;
+
+    if (1 == Batch.sentenceCount)
+    {
+        le_timer_Start(BatchTimerRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the NMEA streams opened by a client session.
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_CloseSessionStreams
+(
+    le_msg_SessionRef_t sessionRef      ///< [IN] Closed client session.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&ReaderList);
+
+    while (NULL != linkPtr)
+    {
+        Reader_t* readerPtr = CONTAINER_OF(linkPtr, Reader_t, link);
+
+        linkPtr = le_dls_PeekNext(&ReaderList, linkPtr);
+
+        if ((NULL != readerPtr->streamRef) && (readerPtr->sessionRef == sessionRef))
+        {
+            CloseReader(readerPtr);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function opens an NMEA stream, receiving the NMEA sentences of each fix epoch.
+ *
+ * The sentences are written to the returned file descriptor in the same format as in
+ * "/dev/nmea". Only the sentence types selected by the filter are written; a filter of zero
+ * selects all the sentences, including the ones which are not listed in le_gnss_NmeaBitMask_t.
+ *
+ * @return
+ *  - Reference to the NMEA stream.
+ *  - NULL if the stream could not be opened.
+ */
+//--------------------------------------------------------------------------------------------------
+le_gnss_NmeaStreamRef_t le_gnss_OpenNmeaStream
+(
+    le_gnss_NmeaBitMask_t sentenceFilter,   ///< [IN] Sentence types to write, 0 for all sentences.
+    int* streamFdPtr                        ///< [OUT] File descriptor to read the NMEA sentences
+                                            ///<       from.
+)
+{
+    int fds[2];
+    Reader_t* readerPtr;
+
+    if (NULL == streamFdPtr)
+    {
+        LE_KILL_CLIENT("streamFdPtr is NULL !");
+        return NULL;
+    }
+
+    *streamFdPtr = -1;
+
+    if (!IsInitialized)
+    {
+        LE_ERROR("The NMEA flow is not provided by the positioning service");
+        return NULL;
+    }
+
+    if (sentenceFilter & ~LE_GNSS_NMEA_SENTENCES_MAX)
+    {
+        LE_ERROR("Wrong NMEA sentence filter 0x%08X", (uint32_t)sentenceFilter);
+        return NULL;
+    }
+
+    if (-1 == socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds))
+    {
+        LE_ERROR("Failed to create NMEA stream: errno.%d (%s)", errno, strerror(errno));
+        return NULL;
+    }
+
+    // Only the service side is non-blocking.
+    if (-1 == fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK))
+    {
+        LE_ERROR("Failed to set NMEA stream non-blocking: errno.%d (%s)", errno, strerror(errno));
+        close(fds[0]);
+        close(fds[1]);
+        return NULL;
+    }
+
+    readerPtr = CreateReader(fds[0], sentenceFilter);
+    readerPtr->sessionRef = le_gnss_GetClientSessionRef();
+    readerPtr->streamRef = le_ref_CreateRef(StreamRefMap, readerPtr);
+
+    *streamFdPtr = fds[1];
+
+    return readerPtr->streamRef;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function gets the number of NMEA sentences dropped because the reader of an NMEA stream
+ * was too slow.
+ *
+ * @return
+ *  - LE_OK             Success
+ *  - LE_BAD_PARAMETER  Invalid stream reference
+ *
+ * @note If the caller is passing a null pointer to this function, it is a fatal error, the
+ *       function will not return.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_gnss_GetNmeaStreamDropCount
+(
+    le_gnss_NmeaStreamRef_t streamRef,  ///< [IN] NMEA stream reference.
+    uint32_t* dropCountPtr              ///< [OUT] Number of dropped sentences.
+)
+{
+    Reader_t* readerPtr;
+
+    if (NULL == dropCountPtr)
+    {
+        LE_KILL_CLIENT("dropCountPtr is NULL !");
+        return LE_BAD_PARAMETER;
+    }
+
+    readerPtr = IsInitialized ? le_ref_Lookup(StreamRefMap, streamRef) : NULL;
+    if ((NULL == readerPtr) || (readerPtr->sessionRef != le_gnss_GetClientSessionRef()))
+    {
+        LE_ERROR("Invalid NMEA stream reference %p", streamRef);
+        return LE_BAD_PARAMETER;
+    }
+
+    *dropCountPtr = readerPtr->dropCount;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * This function closes an NMEA stream.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_gnss_CloseNmeaStream
+(
+    le_gnss_NmeaStreamRef_t streamRef   ///< [IN] NMEA stream reference.
+)
+{
+    Reader_t* readerPtr = IsInitialized ? le_ref_Lookup(StreamRefMap, streamRef) : NULL;
+
+    if ((NULL == readerPtr) || (readerPtr->sessionRef != le_gnss_GetClientSessionRef()))
+    {
+        LE_ERROR("Invalid NMEA stream reference %p", streamRef);
+        return;
+    }
+
+    CloseReader(readerPtr);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file nmeaFanout.h
+ *
+ * NMEA flow distribution to the NMEA readers: the "/dev/nmea" FIFO and the NMEA streams opened by
+ * the clients with le_gnss_OpenNmeaStream().
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_NMEA_FANOUT_INCLUDE_GUARD
+#define LEGATO_NMEA_FANOUT_INCLUDE_GUARD
+
+#include "legato.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the NMEA flow distribution.
+ *
+ * Must be called once the PA NMEA handler is registered, before nmeaFanout_AddSentence().
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_Init
+(
+    const char* fifoPathPtr     ///< [IN] Path of the NMEA FIFO, NULL if there is none.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add an NMEA sentence received from the PA.
+ *
+ * The sentences are gathered and written to the readers once per fix epoch.
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_AddSentence
+(
+    const char* sentencePtr     ///< [IN] NMEA sentence, null-terminated.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close the NMEA streams opened by a client session.
+ */
+//--------------------------------------------------------------------------------------------------
+void nmeaFanout_CloseSessionStreams
+(
+    le_msg_SessionRef_t sessionRef      ///< [IN] Closed client session.
+);
+
+#endif // LEGATO_NMEA_FANOUT_INCLUDE_GUARD
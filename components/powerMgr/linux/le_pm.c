@@ -34,6 +34,13 @@
 //--------------------------------------------------------------------------------------------------
 #define LEGATO_TAG_PREFIX   "legato"
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Name of the kernel wakeup source held while any Legato wakeup source is acquired
+ */
+//--------------------------------------------------------------------------------------------------
+#define PM_WAKE_LOCK_NAME   LEGATO_TAG_PREFIX "_powerMgr"
+
 ///@{
 //--------------------------------------------------------------------------------------------------
 /**
@@ -52,6 +59,8 @@
 #define LEGATO_WS_NAME_LEN (sizeof(LEGATO_TAG_PREFIX) + LE_PM_TAG_LEN + LEGATO_WS_PROCNAME_LEN + 3)
 ///@}
 
+static_assert(LEGATO_WS_NAME_LEN <= LE_PM_NAME_LEN_BYTES, "Wakeup source name too long for API");
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The timer interval to kick the watchdog chain.
@@ -84,6 +93,11 @@ typedef struct
     pid_t         pid;      // client pid of wakeup source owner
     void          *wsref;   // back-pointer to safe reference
     bool          isRef;     // true if reference counted, false if not
+    uint32_t      acquireCount;     // number of times the wakeup source was acquired
+    uint64_t      totalHoldMs;      // total hold time of the past holds, in ms
+    uint32_t      maxHoldMs;        // longest hold time of the past holds, in ms
+    le_clk_Time_t holdStart;        // time of the current acquisition
+    bool          isWarned;         // true if the current hold exceeded the warning threshold
 }
 WakeupSource_t;
 #define PM_WAKEUP_SOURCE_COOKIE 0xa1f6337b
@@ -118,8 +132,14 @@ static struct
     le_mem_PoolRef_t    cpool;   // memory pool for client records
     le_hashmap_Ref_t    clients; // table of client records
     bool                isFull;  // le_pm_StayAwke() fails with LE_NO_MEMORY
+    uint32_t            heldCount;      // number of wakeup sources acquired
+    uint32_t            acquireCount;   // number of times the kernel wakeup source was acquired
+    uint64_t            totalHoldMs;    // total hold time of the kernel wakeup source, in ms
+    le_clk_Time_t       holdStart;      // time the kernel wakeup source was acquired
+    uint32_t            warnMs;         // hold time warning threshold in ms, 0 if disabled
+    le_timer_Ref_t      warnTimer;      // timer checking the hold times
 }
-PowerManager = {-1, -1, NULL, NULL, NULL, NULL, NULL, false};
+PowerManager = {-1, -1, NULL, NULL, NULL, NULL, NULL, false, 0, 0, 0, {0, 0}, 0, NULL};
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -217,6 +237,158 @@ static inline Client_t *to_Client_t
 #endif
 #undef DEBUG
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the time elapsed since a given relative time, in ms
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t GetElapsedMs
+(
+    le_clk_Time_t start
+)
+{
+    le_clk_Time_t elapsed = le_clk_Sub(le_clk_GetRelativeTime(), start);
+
+    return ((uint64_t)elapsed.sec * 1000) + (elapsed.usec / 1000);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hold time warning timer handler: log the wakeup sources held for too long
+ */
+//--------------------------------------------------------------------------------------------------
+static void HoldTimeWarningHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    WakeupSource_t *ws;
+    le_hashmap_It_Ref_t iter;
+    uint64_t holdMs;
+
+    iter = le_hashmap_GetIterator(PowerManager.locks);
+    while (LE_OK == le_hashmap_NextNode(iter))
+    {
+        ws = (WakeupSource_t*)le_hashmap_GetValue(iter);
+        if (!ws->taken || ws->isWarned)
+        {
+            continue;
+        }
+
+        holdMs = GetElapsedMs(ws->holdStart);
+        if (holdMs >= PowerManager.warnMs)
+        {
+            LE_WARN("Wakeup source '%s' held for %" PRIu64 " ms by pid %d.",
+                    ws->name, holdMs, ws->pid);
+            ws->isWarned = true;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Acquire the kernel wakeup source when the first Legato wakeup source is acquired
+ *
+ * @return
+ *     - LE_OK          if the kernel wakeup source is acquired
+ *     - LE_NO_MEMORY   if the wakeup sources limit is reached
+ *     - LE_FAULT       for other errors
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t AcquireKernelWakeLock
+(
+    const char *name    // name of the Legato wakeup source, for the logs
+)
+{
+    if (PowerManager.heldCount++)
+    {
+        return LE_OK;
+    }
+
+    // Write to /sys/power/wake_lock
+    if (0 > write(PowerManager.wl, PM_WAKE_LOCK_NAME, sizeof(PM_WAKE_LOCK_NAME) - 1))
+    {
+        PowerManager.heldCount--;
+
+        if (ENOSPC == errno)
+        {
+            LE_ERROR("Too many wakeup source: Cannot acquire '%s'.", name);
+            PowerManager.isFull = true;
+            return LE_NO_MEMORY;
+        }
+        else if (EBADF == errno)
+        {
+            LE_FATAL("Error acquiring wakeup source '%s'. Invalid file descriptor %d.",
+                     name, PowerManager.wl);
+        }
+        else
+        {
+            LE_CRIT("Error acquiring wakeup source '%s': %m", name);
+            return LE_FAULT;
+        }
+    }
+
+    PowerManager.acquireCount++;
+    PowerManager.holdStart = le_clk_GetRelativeTime();
+
+    if (PowerManager.warnMs)
+    {
+        le_timer_Start(PowerManager.warnTimer);
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the kernel wakeup source when the last Legato wakeup source is released
+ *
+ * @return
+ *     - LE_OK          if the kernel wakeup source is released
+ *     - LE_NOT_FOUND   if the kernel wakeup source was not currently acquired
+ *     - LE_FAULT       for other errors
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReleaseKernelWakeLock
+(
+    const char *name    // name of the Legato wakeup source, for the logs
+)
+{
+    if (--PowerManager.heldCount)
+    {
+        return LE_OK;
+    }
+
+    PowerManager.totalHoldMs += GetElapsedMs(PowerManager.holdStart);
+
+    if (le_timer_IsRunning(PowerManager.warnTimer))
+    {
+        le_timer_Stop(PowerManager.warnTimer);
+    }
+
+    // write to /sys/power/wake_unlock
+    if (0 > write(PowerManager.wu, PM_WAKE_LOCK_NAME, sizeof(PM_WAKE_LOCK_NAME) - 1))
+    {
+        if (EINVAL == errno)
+        {
+            LE_ERROR("Wakeup source '%s' is not locked.", name);
+            return LE_NOT_FOUND;
+        }
+        else if (EBADF == errno)
+        {
+            LE_FATAL("Error releasing wakeup source '%s'. Invalid file descriptor %d.",
+                     name, PowerManager.wu);
+        }
+        else
+        {
+            LE_CRIT("Error releasing wakeup source '%s': %m", name);
+            return LE_FAULT;
+        }
+    }
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Client connect callback
@@ -398,6 +570,13 @@ COMPONENT_INIT
         LE_FATAL("Failed to create client hashmap");
     }
 
+    // Create the hold time warning timer. It must not wake the system up: it is only useful while
+    // a wakeup source is held.
+    PowerManager.warnTimer = le_timer_Create("PmHoldTimeWarning");
+    le_timer_SetRepeat(PowerManager.warnTimer, 0);
+    le_timer_SetWakeup(PowerManager.warnTimer, false);
+    le_timer_SetHandler(PowerManager.warnTimer, HoldTimeWarningHandler);
+
     // Register client connect/disconnect handlers
     le_msg_AddServiceOpenHandler(le_pm_GetServiceRef(), OnClientConnect, NULL);
     le_msg_AddServiceCloseHandler(le_pm_GetServiceRef(), OnClientDisconnect, NULL);
@@ -497,6 +676,10 @@ le_pm_WakeupSourceRef_t le_pm_NewWakeupSource
     ws->taken = 0;
     ws->pid = cl->pid;
     ws->isRef = (opts & LE_PM_REF_COUNT ? true : false);
+    ws->acquireCount = 0;
+    ws->totalHoldMs = 0;
+    ws->maxHoldMs = 0;
+    ws->isWarned = false;
 
     ws->wsref = le_ref_CreateRef(PowerManager.refs, ws);
 
@@ -561,27 +744,18 @@ le_result_t le_pm_StayAwake
         return LE_OK;
     }
 
-    // Write to /sys/power/wake_lock
-    if (0 > write(PowerManager.wl, entry->name, strlen(entry->name)))
+    // Only the first Legato wakeup source acquires the kernel wakeup source
+    le_result_t result = AcquireKernelWakeLock(entry->name);
+    if (LE_OK != result)
     {
-        if (ENOSPC == errno)
-        {
-            LE_ERROR("Too many wakeup source: Cannot acquire '%s'.", entry->name);
-            PowerManager.isFull = true;
-            return LE_NO_MEMORY;
-        }
-        else if (EBADF == errno)
-        {
-            LE_FATAL("Error acquiring wakeup source '%s'. Invalid file descriptor %d.",
-                     entry->name, PowerManager.wl);
-        }
-        else
-        {
-            LE_CRIT("Error acquiring wakeup source '%s': %m", entry->name);
-            return LE_FAULT;
-        }
+        entry->taken = 0;
+        return result;
     }
 
+    entry->acquireCount++;
+    entry->holdStart = le_clk_GetRelativeTime();
+    entry->isWarned = false;
+
     return LE_OK;
 }
 
@@ -643,27 +817,16 @@ le_result_t le_pm_Relax
         entry->taken = 0;
     }
 
-    // write to /sys/power/wake_unlock
-    if (0 > write(PowerManager.wu, entry->name, strlen(entry->name)))
+    // Account the hold time
+    uint64_t holdMs = GetElapsedMs(entry->holdStart);
+    entry->totalHoldMs += holdMs;
+    if (holdMs > entry->maxHoldMs)
     {
-        if (EINVAL == errno)
-        {
-            LE_ERROR("Wakeup source '%s' is not locked.", entry->name);
-            return LE_NOT_FOUND;
-        }
-        else if (EBADF == errno)
-        {
-            LE_FATAL("Error releasing wakeup source '%s'. Invalid file descriptor %d.",
-                     entry->name, PowerManager.wu);
-        }
-        else
-        {
-            LE_CRIT("Error releasing wakeup source '%s': %m", entry->name);
-            return LE_FAULT;
-        }
+        entry->maxHoldMs = (holdMs > UINT32_MAX) ? UINT32_MAX : (uint32_t)holdMs;
     }
 
-    return LE_OK;
+    // Only the last Legato wakeup source releases the kernel wakeup source
+    return ReleaseKernelWakeLock(entry->name);
 }
 
 
@@ -745,3 +908,129 @@ le_result_t le_pm_ForceRelaxAndDestroyAllWakeupSource
 
     return LE_OK;
 }
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of the Power Manager kernel wakeup source
+ *
+ * @return
+ *     - LE_OK          on success
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pm_GetStats
+(
+    uint32_t *heldCountPtr,
+    uint32_t *acquireCountPtr,
+    uint64_t *totalHoldTimeMsPtr
+)
+{
+    *heldCountPtr = PowerManager.heldCount;
+    *acquireCountPtr = PowerManager.acquireCount;
+    *totalHoldTimeMsPtr = PowerManager.totalHoldMs;
+    if (PowerManager.heldCount)
+    {
+        *totalHoldTimeMsPtr += GetElapsedMs(PowerManager.holdStart);
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a client wakeup source
+ *
+ * The wakeup sources are enumerated by calling this function with an index starting at 0, until
+ * it returns LE_NOT_FOUND.
+ *
+ * @return
+ *     - LE_OK          on success
+ *     - LE_NOT_FOUND   if there is no wakeup source at this index
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pm_GetWakeupSourceStats
+(
+    uint32_t index,
+    char *name,
+    size_t nameSize,
+    uint32_t *holdersPtr,
+    uint32_t *acquireCountPtr,
+    uint64_t *totalHoldTimeMsPtr,
+    uint32_t *maxHoldTimeMsPtr,
+    uint32_t *currentHoldTimeMsPtr
+)
+{
+    WakeupSource_t *ws = NULL;
+    le_hashmap_It_Ref_t iter;
+    uint64_t holdMs = 0;
+
+    iter = le_hashmap_GetIterator(PowerManager.locks);
+    while (LE_OK == le_hashmap_NextNode(iter))
+    {
+        if (0 == index--)
+        {
+            ws = (WakeupSource_t*)le_hashmap_GetValue(iter);
+            break;
+        }
+    }
+
+    if (NULL == ws)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    if (ws->taken)
+    {
+        holdMs = GetElapsedMs(ws->holdStart);
+    }
+
+    le_utf8_Copy(name, ws->name, nameSize, NULL);
+    *holdersPtr = ws->taken;
+    *acquireCountPtr = ws->acquireCount;
+    *totalHoldTimeMsPtr = ws->totalHoldMs + holdMs;
+    *maxHoldTimeMsPtr = (holdMs > ws->maxHoldMs) ?
+                        ((holdMs > UINT32_MAX) ? UINT32_MAX : (uint32_t)holdMs) : ws->maxHoldMs;
+    *currentHoldTimeMsPtr = (holdMs > UINT32_MAX) ? UINT32_MAX : (uint32_t)holdMs;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the hold time above which a warning is logged for a held wakeup source
+ *
+ * A single warning is logged for each hold exceeding the threshold.
+ *
+ * @return
+ *     - LE_OK          on success
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_pm_SetHoldTimeWarning
+(
+    uint32_t thresholdMs
+)
+{
+    PowerManager.warnMs = thresholdMs;
+
+    if (le_timer_IsRunning(PowerManager.warnTimer))
+    {
+        le_timer_Stop(PowerManager.warnTimer);
+    }
+
+    if (thresholdMs)
+    {
+        // Check twice per threshold period, so that a warning is at most half a period late.
+        le_timer_SetMsInterval(PowerManager.warnTimer, (thresholdMs > 1) ? (thresholdMs / 2) : 1);
+        if (PowerManager.heldCount)
+        {
+            le_timer_Start(PowerManager.warnTimer);
+        }
+    }
+
+    LE_INFO("Wakeup source hold time warning %s (%" PRIu32 " ms).",
+            thresholdMs ? "enabled" : "disabled", thresholdMs);
+
+    return LE_OK;
+}
@@ -0,0 +1,557 @@
+/**
+ * @file dnsResolver.c
+ *
+ * This file implements the host name resolution of the socket library.
+ *
+ * getaddrinfo() may block for seconds on cellular networks, so asynchronous lookups are handed
+ * to a resolver thread and the result is queued back to the event loop of the requesting thread.
+ * Positive and negative results are cached and shared by all the sockets of the process.
+ * getaddrinfo() does not report the record TTL, hence fixed cache lifetimes are used.
+ *
+ * <hr>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "dnsResolver.h"
+#include "le_socketLib.h"
+
+#include <sys/types.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <pthread.h>
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of hosts kept in the resolution cache
+ */
+//--------------------------------------------------------------------------------------------------
+#define DNS_CACHE_SIZE              8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lifetime of a successful resolution in the cache, in seconds
+ */
+//--------------------------------------------------------------------------------------------------
+#define DNS_POSITIVE_TTL_SEC        300
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lifetime of a failed resolution in the cache, in seconds
+ */
+//--------------------------------------------------------------------------------------------------
+#define DNS_NEGATIVE_TTL_SEC        30
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of pending asynchronous resolutions
+ */
+//--------------------------------------------------------------------------------------------------
+#define DNS_MAX_PENDING_REQUESTS    MAX_SOCKET_NB
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolution cache entry
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool                    inUse;                  ///< True if the entry holds a resolution
+    char                    host[HOST_ADDR_LEN];    ///< Resolved host
+    SocketType_t            type;                   ///< Socket type of the resolution
+    le_result_t             result;                 ///< Resolution result
+    le_clk_Time_t           expiry;                 ///< Relative time at which the entry expires
+    dnsResolver_AddrList_t  list;                   ///< Resolved addresses
+}
+CacheEntry_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Asynchronous resolution request
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct dnsResolver_Request
+{
+    char                    host[HOST_ADDR_LEN];    ///< Host to resolve
+    SocketType_t            type;                   ///< Socket type (TCP, UDP)
+    dnsResolver_Handler_t   handlerPtr;             ///< Completion handler
+    void*                   contextPtr;             ///< Context pointer passed to the handler
+    le_thread_Ref_t         requesterThread;        ///< Thread to report the result to
+    bool                    isCanceled;             ///< True if the result must not be reported
+    le_result_t             result;                 ///< Resolution result
+    dnsResolver_AddrList_t  list;                   ///< Resolved addresses
+}
+Request_t;
+
+//--------------------------------------------------------------------------------------------------
+// Internal variables
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolution cache, protected by CacheMutex
+ */
+//--------------------------------------------------------------------------------------------------
+static CacheEntry_t Cache[DNS_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the resolution cache
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t CacheMutex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for the asynchronous resolution requests
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(DnsRequestPool, DNS_MAX_PENDING_REQUESTS, sizeof(Request_t));
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool reference for the asynchronous resolution requests
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t RequestPoolRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread running the asynchronous resolutions
+ */
+//--------------------------------------------------------------------------------------------------
+static le_thread_Ref_t ResolverThread;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make sure that the resolver is initialized only once whatever the calling thread
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_once_t InitOnce = PTHREAD_ONCE_INIT;
+
+//--------------------------------------------------------------------------------------------------
+// Internal functions
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolver thread main function: only serves the queued resolutions.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ResolverThreadMain
+(
+    void* contextPtr    ///< [IN] Unused
+)
+{
+    le_event_RunLoop();
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the cache, the request pool and the resolver thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Init
+(
+    void
+)
+{
+    CacheMutex = le_mutex_CreateNonRecursive("DnsCache");
+    RequestPoolRef = le_mem_InitStaticPool(DnsRequestPool, DNS_MAX_PENDING_REQUESTS,
+                                           sizeof(Request_t));
+
+    ResolverThread = le_thread_Create("DnsResolver", ResolverThreadMain, NULL);
+    le_thread_Start(ResolverThread);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for a valid entry in the cache. Expired entries are released on the way.
+ *
+ * @note CacheMutex must be held.
+ *
+ * @return Cache entry, NULL if the host is not cached.
+ */
+//--------------------------------------------------------------------------------------------------
+static CacheEntry_t* FindCacheEntry
+(
+    const char*     hostPtr,    ///< [IN] Host name
+    SocketType_t    type        ///< [IN] Socket type (TCP, UDP)
+)
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+    int i;
+
+    for (i = 0; i < DNS_CACHE_SIZE; i++)
+    {
+        CacheEntry_t* entryPtr = &Cache[i];
+
+        if (!entryPtr->inUse)
+        {
+            continue;
+        }
+
+        if (le_clk_GreaterThan(now, entryPtr->expiry))
+        {
+            entryPtr->inUse = false;
+            continue;
+        }
+
+        if ((entryPtr->type == type) && (0 == strcmp(entryPtr->host, hostPtr)))
+        {
+            return entryPtr;
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a resolution from the cache.
+ *
+ * @return
+ *  - true if the host is cached, its result and addresses are then returned
+ *  - false otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ReadCache
+(
+    const char*             hostPtr,    ///< [IN] Host name
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    le_result_t*            resultPtr,  ///< [OUT] Cached resolution result
+    dnsResolver_AddrList_t* listPtr     ///< [OUT] Cached addresses
+)
+{
+    bool isFound = false;
+
+    le_mutex_Lock(CacheMutex);
+
+    CacheEntry_t* entryPtr = FindCacheEntry(hostPtr, type);
+    if (entryPtr)
+    {
+        *resultPtr = entryPtr->result;
+        memcpy(listPtr, &entryPtr->list, sizeof(*listPtr));
+        isFound = true;
+    }
+
+    le_mutex_Unlock(CacheMutex);
+
+    return isFound;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store a resolution in the cache, replacing the entry closest to expiry if the cache is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteCache
+(
+    const char*                     hostPtr,    ///< [IN] Host name
+    SocketType_t                    type,       ///< [IN] Socket type (TCP, UDP)
+    le_result_t                     result,     ///< [IN] Resolution result
+    const dnsResolver_AddrList_t*   listPtr     ///< [IN] Resolved addresses
+)
+{
+    le_clk_Time_t ttl = { .sec = (LE_OK == result) ? DNS_POSITIVE_TTL_SEC : DNS_NEGATIVE_TTL_SEC,
+                          .usec = 0 };
+    CacheEntry_t* entryPtr;
+    int i;
+
+    le_mutex_Lock(CacheMutex);
+
+    entryPtr = FindCacheEntry(hostPtr, type);
+    for (i = 0; (!entryPtr) && (i < DNS_CACHE_SIZE); i++)
+    {
+        if (!Cache[i].inUse)
+        {
+            entryPtr = &Cache[i];
+        }
+    }
+
+    if (!entryPtr)
+    {
+        entryPtr = &Cache[0];
+        for (i = 1; i < DNS_CACHE_SIZE; i++)
+        {
+            if (le_clk_GreaterThan(entryPtr->expiry, Cache[i].expiry))
+            {
+                entryPtr = &Cache[i];
+            }
+        }
+    }
+
+    LE_ASSERT(LE_OK == le_utf8_Copy(entryPtr->host, hostPtr, sizeof(entryPtr->host), NULL));
+    entryPtr->type = type;
+    entryPtr->result = result;
+    entryPtr->expiry = le_clk_Add(le_clk_GetRelativeTime(), ttl);
+    memcpy(&entryPtr->list, listPtr, sizeof(entryPtr->list));
+    entryPtr->inUse = true;
+
+    le_mutex_Unlock(CacheMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolve a host with getaddrinfo() and store the result in the cache.
+ *
+ * @return
+ *  - LE_OK            Host resolved
+ *  - LE_UNAVAILABLE   Unknown host or DNS issue
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ResolveHost
+(
+    const char*             hostPtr,    ///< [IN] Host name or numeric address
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    dnsResolver_AddrList_t* listPtr     ///< [OUT] Resolved addresses
+)
+{
+    struct addrinfo hints, *addrList, *cur;
+    le_result_t result = LE_UNAVAILABLE;
+    int ret;
+
+    memset(listPtr, 0, sizeof(*listPtr));
+
+    // Do name resolution with both IPv6 and IPv4
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = (type == UDP_TYPE) ? SOCK_DGRAM : SOCK_STREAM;
+    hints.ai_protocol = (type == UDP_TYPE) ? IPPROTO_UDP : IPPROTO_TCP;
+
+    ret = getaddrinfo(hostPtr, NULL, &hints, &addrList);
+    if (0 == ret)
+    {
+        for (cur = addrList;
+             (cur != NULL) && (listPtr->count < DNS_RESOLVER_MAX_ADDR);
+             cur = cur->ai_next)
+        {
+            if (cur->ai_addrlen > sizeof(listPtr->addr[0]))
+            {
+                continue;
+            }
+
+            memcpy(&listPtr->addr[listPtr->count], cur->ai_addr, cur->ai_addrlen);
+            listPtr->addrLen[listPtr->count] = cur->ai_addrlen;
+            listPtr->count++;
+        }
+        freeaddrinfo(addrList);
+
+        if (listPtr->count)
+        {
+            result = LE_OK;
+        }
+    }
+    else
+    {
+        LE_ERROR("Unable to resolve %s: %s", hostPtr, gai_strerror(ret));
+    }
+
+    // Temporary failures (e.g. no network yet) are not cached: the next attempt may succeed.
+    if ((LE_OK == result) || (EAI_NONAME == ret))
+    {
+        WriteCache(hostPtr, type, result, listPtr);
+    }
+
+    return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the result of an asynchronous resolution. Runs in the requester thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportResult
+(
+    void* param1Ptr,    ///< [IN] Request pointer
+    void* param2Ptr     ///< [IN] Unused
+)
+{
+    Request_t* requestPtr = (Request_t*)param1Ptr;
+
+    if (!requestPtr->isCanceled)
+    {
+        requestPtr->handlerPtr(requestPtr->result, &requestPtr->list, requestPtr->contextPtr);
+    }
+    le_mem_Release(requestPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run an asynchronous resolution. Runs in the resolver thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ProcessRequest
+(
+    void* param1Ptr,    ///< [IN] Request pointer
+    void* param2Ptr     ///< [IN] Unused
+)
+{
+    Request_t* requestPtr = (Request_t*)param1Ptr;
+
+    // Another request may have resolved the same host in the meantime
+    if (!ReadCache(requestPtr->host, requestPtr->type, &requestPtr->result, &requestPtr->list))
+    {
+        requestPtr->result = ResolveHost(requestPtr->host, requestPtr->type, &requestPtr->list);
+    }
+
+    le_event_QueueFunctionToThread(requestPtr->requesterThread, ReportResult, requestPtr, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Public functions
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolve a host name in a blocking way. The cache is used when it holds a valid entry.
+ *
+ * @return
+ *  - LE_OK            Host resolved
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_UNAVAILABLE   Unknown host or DNS issue
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dnsResolver_Lookup
+(
+    const char*             hostPtr,    ///< [IN] Host name or numeric address
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    dnsResolver_AddrList_t* listPtr     ///< [OUT] Resolved addresses
+)
+{
+    le_result_t result;
+
+    if ((!hostPtr) || (!listPtr))
+    {
+        LE_ERROR("Wrong parameter provided: %p, %p", hostPtr, listPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    pthread_once(&InitOnce, Init);
+
+    if (ReadCache(hostPtr, type, &result, listPtr))
+    {
+        LE_DEBUG("%s resolved from cache: %d", hostPtr, result);
+        return result;
+    }
+
+    return ResolveHost(hostPtr, type, listPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolve a host name without blocking the caller.
+ *
+ * The handler is always called later from the event loop of the calling thread, even when the
+ * result is already in the cache, unless the resolution is canceled first.
+ *
+ * @return
+ *  - LE_OK            Resolution started
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_NO_MEMORY     Too many pending resolutions
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dnsResolver_Resolve
+(
+    const char*                 hostPtr,        ///< [IN] Host name or numeric address
+    SocketType_t                type,           ///< [IN] Socket type (TCP, UDP)
+    dnsResolver_Handler_t       handlerPtr,     ///< [IN] Completion handler
+    void*                       contextPtr,     ///< [IN] Context pointer passed to the handler
+    dnsResolver_RequestRef_t*   requestRefPtr   ///< [OUT] Reference to the pending resolution,
+                                                ///<       valid until the handler is called
+)
+{
+    Request_t* requestPtr;
+
+    if ((!hostPtr) || (!handlerPtr) || (!requestRefPtr))
+    {
+        LE_ERROR("Wrong parameter provided: %p, %p, %p", hostPtr, handlerPtr, requestRefPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    pthread_once(&InitOnce, Init);
+
+    requestPtr = le_mem_TryAlloc(RequestPoolRef);
+    if (!requestPtr)
+    {
+        LE_ERROR("Too many pending resolutions");
+        return LE_NO_MEMORY;
+    }
+
+    memset(requestPtr, 0, sizeof(*requestPtr));
+    if (LE_OK != le_utf8_Copy(requestPtr->host, hostPtr, sizeof(requestPtr->host), NULL))
+    {
+        LE_ERROR("Host name too long");
+        le_mem_Release(requestPtr);
+        return LE_BAD_PARAMETER;
+    }
+    requestPtr->type = type;
+    requestPtr->handlerPtr = handlerPtr;
+    requestPtr->contextPtr = contextPtr;
+    requestPtr->requesterThread = le_thread_GetCurrent();
+
+    // Cache hits are answered without a round trip to the resolver thread
+    if (ReadCache(requestPtr->host, type, &requestPtr->result, &requestPtr->list))
+    {
+        le_event_QueueFunction(ReportResult, requestPtr, NULL);
+    }
+    else
+    {
+        le_event_QueueFunctionToThread(ResolverThread, ProcessRequest, requestPtr, NULL);
+    }
+
+    *requestRefPtr = requestPtr;
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cancel a pending asynchronous resolution: its handler is not called. The lookup itself is left
+ * to complete, and its result still feeds the cache.
+ *
+ * @note Must be called by the thread which requested the resolution, before its handler is called.
+ */
+//--------------------------------------------------------------------------------------------------
+void dnsResolver_Cancel
+(
+    dnsResolver_RequestRef_t    requestRef      ///< [IN] Reference to the pending resolution
+)
+{
+    if (!requestRef)
+    {
+        LE_ERROR("Wrong parameter provided: %p", requestRef);
+        return;
+    }
+
+    LE_ASSERT(requestRef->requesterThread == le_thread_GetCurrent());
+
+    // The request is released once its result reaches the requester thread
+    requestRef->isCanceled = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the port of a resolved address.
+ */
+//--------------------------------------------------------------------------------------------------
+void dnsResolver_SetPort
+(
+    struct sockaddr_storage*    addrPtr,    ///< [INOUT] Resolved address
+    uint16_t                    port        ///< [IN] Port number
+)
+{
+    if (AF_INET6 == addrPtr->ss_family)
+    {
+        ((struct sockaddr_in6*)addrPtr)->sin6_port = htons(port);
+    }
+    else
+    {
+        ((struct sockaddr_in*)addrPtr)->sin_port = htons(port);
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file dnsResolver.h
+ *
+ * Host name resolution for the socket library. Lookups are run by a dedicated resolver thread so
+ * that event-driven callers are not blocked, and their results are kept in a process-wide cache
+ * shared by all the sockets.
+ *
+ * <hr>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LE_DNS_RESOLVER_H
+#define LE_DNS_RESOLVER_H
+
+#include "legato.h"
+#include "common.h"
+
+#include <sys/socket.h>
+
+//--------------------------------------------------------------------------------------------------
+// Symbol and Enum definitions
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of addresses kept for a host
+ */
+//--------------------------------------------------------------------------------------------------
+#define DNS_RESOLVER_MAX_ADDR       4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Addresses of a resolved host. The port of the addresses is not set.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    size_t                  count;                          ///< Number of valid addresses
+    struct sockaddr_storage addr[DNS_RESOLVER_MAX_ADDR];    ///< Host addresses
+    socklen_t               addrLen[DNS_RESOLVER_MAX_ADDR]; ///< Length of each address
+}
+dnsResolver_AddrList_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a pending asynchronous resolution
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct dnsResolver_Request* dnsResolver_RequestRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype of the handler called when an asynchronous resolution completes.
+ *
+ * The handler is called by the thread which requested the resolution, from its event loop.
+ * The result is one of:
+ *  - LE_OK            Host resolved, listPtr holds at least one address
+ *  - LE_UNAVAILABLE   Unknown host or DNS issue
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*dnsResolver_Handler_t)
+(
+    le_result_t                     result,     ///< [IN] Resolution result
+    const dnsResolver_AddrList_t*   listPtr,    ///< [IN] Resolved addresses
+    void*                           contextPtr  ///< [IN] Context pointer given by the requester
+);
+
+//--------------------------------------------------------------------------------------------------
+// Public functions
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolve a host name in a blocking way. The cache is used when it holds a valid entry.
+ *
+ * @return
+ *  - LE_OK            Host resolved
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_UNAVAILABLE   Unknown host or DNS issue
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dnsResolver_Lookup
+(
+    const char*             hostPtr,    ///< [IN] Host name or numeric address
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    dnsResolver_AddrList_t* listPtr     ///< [OUT] Resolved addresses
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resolve a host name without blocking the caller.
+ *
+ * The handler is always called later from the event loop of the calling thread, even when the
+ * result is already in the cache, unless the resolution is canceled first.
+ *
+ * @return
+ *  - LE_OK            Resolution started
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_NO_MEMORY     Too many pending resolutions
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t dnsResolver_Resolve
+(
+    const char*                 hostPtr,        ///< [IN] Host name or numeric address
+    SocketType_t                type,           ///< [IN] Socket type (TCP, UDP)
+    dnsResolver_Handler_t       handlerPtr,     ///< [IN] Completion handler
+    void*                       contextPtr,     ///< [IN] Context pointer passed to the handler
+    dnsResolver_RequestRef_t*   requestRefPtr   ///< [OUT] Reference to the pending resolution,
+                                                ///<       valid until the handler is called
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Cancel a pending asynchronous resolution: its handler is not called. The lookup itself is left
+ * to complete, and its result still feeds the cache.
+ *
+ * @note Must be called by the thread which requested the resolution, before its handler is called.
+ */
+//--------------------------------------------------------------------------------------------------
+void dnsResolver_Cancel
+(
+    dnsResolver_RequestRef_t    requestRef      ///< [IN] Reference to the pending resolution
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the port of a resolved address.
+ */
+//--------------------------------------------------------------------------------------------------
+void dnsResolver_SetPort
+(
+    struct sockaddr_storage*    addrPtr,    ///< [INOUT] Resolved address
+    uint16_t                    port        ///< [IN] Port number
+);
+
+#endif /* LE_DNS_RESOLVER_H */
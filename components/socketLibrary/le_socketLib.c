@@ -14,11 +14,20 @@
 #include "le_socketLib.h"
 #include "netSocket.h"
 #include "secSocket.h"
+#include "dnsResolver.h"
 
 //--------------------------------------------------------------------------------------------------
 // Symbol and Enum definitions
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Secure handshake timeout, in milliseconds. Handshakes may take much longer than TCP connections
+ * on cellular networks.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SECURE_HANDSHAKE_TIMEOUT_MS     30000
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Socket context
@@ -39,6 +48,16 @@ typedef struct
     short              events;                 ///< Bitmap of events that occurred
     void*              userPtr;                ///< User-defined pointer for socket event handler
     le_socket_EventHandler_t eventHandler;     ///< User-defined callback for ocket event handler
+    bool               isConnecting;           ///< True if an asynchronous connection is ongoing
+    dnsResolver_RequestRef_t resolutionRef;    ///< Pending host name resolution, or NULL
+    bool               isHandshaking;          ///< True if the secure handshake is ongoing
+    le_result_t        connectStatus;          ///< Status of the last connection attempt
+    dnsResolver_AddrList_t addrList;           ///< Resolved host addresses
+    size_t             addrIndex;              ///< Index of the next address to try
+    le_fdMonitor_Ref_t connectMonitorRef;      ///< Monitor of the pending connection
+    le_timer_Ref_t     connectTimerRef;        ///< Timer of the pending connection
+    void*              connectUserPtr;         ///< User-defined pointer for connection handler
+    le_socket_ConnectHandler_t connectHandler; ///< User-defined callback for connection result
 }
 SocketCtx_t;
 
@@ -78,6 +97,17 @@ static void ReadMoreAsyncData
     void*                   param2Ptr   ///< [IN] Unused parameter
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pending connection events handler
+ */
+//--------------------------------------------------------------------------------------------------
+static void ConnectEventsHandler
+(
+    int fd,           ///< [IN] Socket file descriptor
+    short events      ///< [IN] Bitmap of events that occurred
+);
+
 //--------------------------------------------------------------------------------------------------
 // Internal functions
 //--------------------------------------------------------------------------------------------------
@@ -271,6 +301,407 @@ static void ReadMoreAsyncData
     SocketEventsHandler(contextPtr->fd, contextPtr->events);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Stop monitoring the pending connection attempt
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopConnectAttempt
+(
+    SocketCtx_t*    contextPtr    ///< [IN] Socket context pointer
+)
+{
+    if (contextPtr->connectMonitorRef)
+    {
+        le_fdMonitor_Delete(contextPtr->connectMonitorRef);
+        contextPtr->connectMonitorRef = NULL;
+    }
+
+    if (contextPtr->connectTimerRef)
+    {
+        le_timer_Stop(contextPtr->connectTimerRef);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Abort an ongoing asynchronous connection. The connection handler is not called.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CancelConnect
+(
+    SocketCtx_t*    contextPtr    ///< [IN] Socket context pointer
+)
+{
+    if (!contextPtr->isConnecting)
+    {
+        return;
+    }
+
+    StopConnectAttempt(contextPtr);
+
+    if (contextPtr->resolutionRef)
+    {
+        dnsResolver_Cancel(contextPtr->resolutionRef);
+        contextPtr->resolutionRef = NULL;
+    }
+
+    if (contextPtr->isHandshaking)
+    {
+        secSocket_AbortHandshake(contextPtr->secureCtxPtr);
+        contextPtr->isHandshaking = false;
+    }
+
+    if (contextPtr->fd != -1)
+    {
+        close(contextPtr->fd);
+        contextPtr->fd = -1;
+    }
+
+    contextPtr->isConnecting = false;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * End an asynchronous connection and report its result to the user
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompleteConnect
+(
+    SocketCtx_t*    contextPtr,   ///< [IN] Socket context pointer
+    le_result_t     status        ///< [IN] Connection result
+)
+{
+    contextPtr->isConnecting = false;
+
+    if ((LE_OK == status) && (contextPtr->isMonitoring) && (!contextPtr->monitorRef))
+    {
+        contextPtr->monitorRef = le_fdMonitor_Create("SocketLibrary", contextPtr->fd,
+                                                     SocketEventsHandler,
+                                                     POLLIN | POLLRDHUP | POLLOUT);
+        if (!contextPtr->monitorRef)
+        {
+            LE_ERROR("Unable to create an FD monitor object");
+            status = LE_FAULT;
+        }
+    }
+
+    if (status != LE_OK)
+    {
+        LE_ERROR("Unable to connect to %s:%hu. Status: %d",
+                 contextPtr->host, contextPtr->port, status);
+    }
+
+    if (contextPtr->connectHandler)
+    {
+        contextPtr->connectHandler(contextPtr->reference, status, contextPtr->connectUserPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Progress the secure handshake, then wait for the socket events it needs or report the result
+ */
+//--------------------------------------------------------------------------------------------------
+static void ContinueSecureHandshake
+(
+    SocketCtx_t*    contextPtr    ///< [IN] Socket context pointer
+)
+{
+    short events = 0;
+    le_result_t status = secSocket_ContinueHandshake(contextPtr->secureCtxPtr, &events);
+
+    if (LE_IN_PROGRESS == status)
+    {
+        if (!contextPtr->connectMonitorRef)
+        {
+            contextPtr->connectMonitorRef = le_fdMonitor_Create("SocketConnect", contextPtr->fd,
+                                                                ConnectEventsHandler, events);
+            if (contextPtr->connectMonitorRef)
+            {
+                le_fdMonitor_SetContextPtr(contextPtr->connectMonitorRef, contextPtr->reference);
+                return;
+            }
+
+            LE_ERROR("Unable to create an FD monitor object");
+            secSocket_AbortHandshake(contextPtr->secureCtxPtr);
+            status = LE_FAULT;
+        }
+        else
+        {
+            le_fdMonitor_Disable(contextPtr->connectMonitorRef, POLLIN | POLLOUT);
+            le_fdMonitor_Enable(contextPtr->connectMonitorRef, events);
+            return;
+        }
+    }
+
+    StopConnectAttempt(contextPtr);
+    contextPtr->isHandshaking = false;
+
+    if (status != LE_OK)
+    {
+        close(contextPtr->fd);
+        contextPtr->fd = -1;
+    }
+
+    CompleteConnect(contextPtr, status);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called once the socket is connected: start the secure handshake if needed
+ */
+//--------------------------------------------------------------------------------------------------
+static void ConnectionEstablished
+(
+    SocketCtx_t*    contextPtr    ///< [IN] Socket context pointer
+)
+{
+    le_result_t status;
+
+    if (!contextPtr->isSecure)
+    {
+        CompleteConnect(contextPtr, LE_OK);
+        return;
+    }
+
+    status = secSocket_StartHandshake(contextPtr->secureCtxPtr, contextPtr->host,
+                                      contextPtr->port, contextPtr->fd);
+    if (status != LE_OK)
+    {
+        close(contextPtr->fd);
+        contextPtr->fd = -1;
+        CompleteConnect(contextPtr, status);
+        return;
+    }
+
+    contextPtr->isHandshaking = true;
+    le_timer_Stop(contextPtr->connectTimerRef);
+    le_timer_SetMsInterval(contextPtr->connectTimerRef, SECURE_HANDSHAKE_TIMEOUT_MS);
+    le_timer_Start(contextPtr->connectTimerRef);
+
+    ContinueSecureHandshake(contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a connection attempt to the next resolved address, or report the failure when all
+ * addresses have been tried
+ */
+//--------------------------------------------------------------------------------------------------
+static void TryNextAddress
+(
+    SocketCtx_t*    contextPtr    ///< [IN] Socket context pointer
+)
+{
+    while (contextPtr->addrIndex < contextPtr->addrList.count)
+    {
+        size_t index = contextPtr->addrIndex++;
+        le_result_t status;
+
+        dnsResolver_SetPort(&contextPtr->addrList.addr[index], contextPtr->port);
+        status = netSocket_StartConnect((struct sockaddr*)&contextPtr->addrList.addr[index],
+                                        contextPtr->addrList.addrLen[index],
+                                        contextPtr->type, &(contextPtr->fd));
+        if (LE_OK == status)
+        {
+            ConnectionEstablished(contextPtr);
+            return;
+        }
+
+        if (LE_IN_PROGRESS == status)
+        {
+            // The socket becomes writable when the connection attempt is over
+            contextPtr->connectMonitorRef = le_fdMonitor_Create("SocketConnect", contextPtr->fd,
+                                                                ConnectEventsHandler, POLLOUT);
+            if (!contextPtr->connectMonitorRef)
+            {
+                LE_ERROR("Unable to create an FD monitor object");
+                close(contextPtr->fd);
+                contextPtr->fd = -1;
+                CompleteConnect(contextPtr, LE_FAULT);
+                return;
+            }
+            le_fdMonitor_SetContextPtr(contextPtr->connectMonitorRef, contextPtr->reference);
+
+            le_timer_SetMsInterval(contextPtr->connectTimerRef,
+                                   contextPtr->timeout ? contextPtr->timeout :
+                                                         COMM_TIMEOUT_DEFAULT_MS);
+            le_timer_Start(contextPtr->connectTimerRef);
+            return;
+        }
+
+        contextPtr->connectStatus = status;
+    }
+
+    CompleteConnect(contextPtr, contextPtr->connectStatus);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pending connection events handler
+ */
+//--------------------------------------------------------------------------------------------------
+static void ConnectEventsHandler
+(
+    int fd,           ///< [IN] Socket file descriptor
+    short events      ///< [IN] Bitmap of events that occurred
+)
+{
+    SocketCtx_t* contextPtr = le_ref_Lookup(SocketRefMap, le_fdMonitor_GetContextPtr());
+    if ((!contextPtr) || (!contextPtr->isConnecting))
+    {
+        return;
+    }
+
+    if (contextPtr->isHandshaking)
+    {
+        ContinueSecureHandshake(contextPtr);
+        return;
+    }
+
+    StopConnectAttempt(contextPtr);
+
+    if (LE_OK == netSocket_FinishConnect(fd))
+    {
+        ConnectionEstablished(contextPtr);
+        return;
+    }
+
+    close(contextPtr->fd);
+    contextPtr->fd = -1;
+    contextPtr->connectStatus = LE_COMM_ERROR;
+    TryNextAddress(contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pending connection timeout handler
+ */
+//--------------------------------------------------------------------------------------------------
+static void ConnectTimeoutHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Connection timer
+)
+{
+    SocketCtx_t* contextPtr = le_ref_Lookup(SocketRefMap, le_timer_GetContextPtr(timerRef));
+    if ((!contextPtr) || (!contextPtr->isConnecting))
+    {
+        return;
+    }
+
+    LE_WARN("Connection to %s:%hu timed out", contextPtr->host, contextPtr->port);
+
+    StopConnectAttempt(contextPtr);
+
+    if (contextPtr->isHandshaking)
+    {
+        secSocket_AbortHandshake(contextPtr->secureCtxPtr);
+        contextPtr->isHandshaking = false;
+        close(contextPtr->fd);
+        contextPtr->fd = -1;
+        CompleteConnect(contextPtr, LE_TIMEOUT);
+        return;
+    }
+
+    close(contextPtr->fd);
+    contextPtr->fd = -1;
+    contextPtr->connectStatus = LE_TIMEOUT;
+    TryNextAddress(contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Host name resolution handler of an asynchronous connection
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResolutionHandler
+(
+    le_result_t                     result,     ///< [IN] Resolution result
+    const dnsResolver_AddrList_t*   listPtr,    ///< [IN] Resolved addresses
+    void*                           refPtr      ///< [IN] Socket context reference
+)
+{
+    SocketCtx_t* contextPtr = le_ref_Lookup(SocketRefMap, refPtr);
+    if (!contextPtr)
+    {
+        return;
+    }
+
+    // A canceled connection cancels its resolution, so the connection is still ongoing
+    contextPtr->resolutionRef = NULL;
+
+    if (result != LE_OK)
+    {
+        CompleteConnect(contextPtr, LE_UNAVAILABLE);
+        return;
+    }
+
+    memcpy(&contextPtr->addrList, listPtr, sizeof(contextPtr->addrList));
+    contextPtr->addrIndex = 0;
+    contextPtr->connectStatus = LE_COMM_ERROR;
+    TryNextAddress(contextPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run the secure handshake of a synchronous connection on a connected socket. On failure, the
+ * socket is closed.
+ *
+ * @return
+ *  - LE_OK            Handshake completed
+ *  - LE_TIMEOUT       Handshake not completed in SECURE_HANDSHAKE_TIMEOUT_MS
+ *  - Other            Failure reported by the secure socket layer
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RunSecureHandshake
+(
+    SocketCtx_t*    contextPtr,   ///< [IN] Socket context pointer
+    int             fd            ///< [IN] Connected socket file descriptor
+)
+{
+    le_clk_Time_t timeout = { SECURE_HANDSHAKE_TIMEOUT_MS / 1000,
+                              (SECURE_HANDSHAKE_TIMEOUT_MS % 1000) * 1000 };
+    le_clk_Time_t deadline = le_clk_Add(le_clk_GetRelativeTime(), timeout);
+    struct pollfd pollFd = { .fd = fd };
+    le_result_t status;
+
+    status = secSocket_StartHandshake(contextPtr->secureCtxPtr, contextPtr->host,
+                                      contextPtr->port, fd);
+
+    while ((LE_OK == status) &&
+           (LE_IN_PROGRESS == (status = secSocket_ContinueHandshake(contextPtr->secureCtxPtr,
+                                                                    &pollFd.events))))
+    {
+        le_clk_Time_t remaining = le_clk_Sub(deadline, le_clk_GetRelativeTime());
+        int ret = (remaining.sec < 0) ? 0 :
+                  poll(&pollFd, 1, remaining.sec * 1000 + remaining.usec / 1000);
+
+        if ((ret < 0) && (EINTR == errno))
+        {
+            status = LE_OK;
+            continue;
+        }
+
+        if (ret <= 0)
+        {
+            LE_ERROR("Secure handshake %s", (ret == 0) ? "timed out" : strerror(errno));
+            secSocket_AbortHandshake(contextPtr->secureCtxPtr);
+            status = (ret == 0) ? LE_TIMEOUT : LE_FAULT;
+            break;
+        }
+
+        status = LE_OK;
+    }
+
+    if (status != LE_OK)
+    {
+        close(fd);
+    }
+
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -340,6 +771,14 @@ le_result_t le_socket_Delete
         return LE_BAD_PARAMETER;
     }
 
+    CancelConnect(contextPtr);
+
+    if (contextPtr->connectTimerRef)
+    {
+        le_timer_Delete(contextPtr->connectTimerRef);
+        contextPtr->connectTimerRef = NULL;
+    }
+
     if (contextPtr->monitorRef)
     {
         le_fdMonitor_Delete(contextPtr->monitorRef);
@@ -443,15 +882,17 @@ le_result_t le_socket_Connect
         return LE_BAD_PARAMETER;
     }
 
-    if (contextPtr->isSecure)
-    {
-        status = secSocket_Connect(contextPtr->secureCtxPtr, contextPtr->host,
-                                   contextPtr->port, contextPtr->type, &(contextPtr->fd));
-    }
-    else
+    // Secure connections also resolve the host through the socket library resolver and its cache,
+    // then run the secure handshake on the connected socket.
+    status = netSocket_Connect(contextPtr->host, contextPtr->port,
+                               contextPtr->type, &(contextPtr->fd));
+    if ((LE_OK == status) && (contextPtr->isSecure))
     {
-        status = netSocket_Connect(contextPtr->host, contextPtr->port,
-                                   contextPtr->type, &(contextPtr->fd));
+        status = RunSecureHandshake(contextPtr, contextPtr->fd);
+        if (status != LE_OK)
+        {
+            contextPtr->fd = -1;
+        }
     }
 
     if ((contextPtr->isMonitoring) && (!contextPtr->monitorRef))
@@ -474,6 +915,80 @@ le_result_t le_socket_Connect
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initiate a connection with the server without blocking the caller. The host name is resolved
+ * by the socket library resolver, then the connection and the optional secure handshake are
+ * driven by the event loop of the calling thread. The result is reported through the handler.
+ *
+ * @note The calling thread must run an event loop.
+ *
+ * @return
+ *  - LE_OK            Connection started
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_BUSY          A connection is already ongoing
+ *  - LE_DUPLICATE     Socket already connected
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_socket_ConnectAsync
+(
+    le_socket_Ref_t             ref,            ///< [IN] Socket context reference
+    le_socket_ConnectHandler_t  handlerFunc,    ///< [IN] Connection result handler
+    void*                       userPtr         ///< [IN] User-defined data pointer
+)
+{
+    le_result_t status;
+    SocketCtx_t *contextPtr = (SocketCtx_t *)le_ref_Lookup(SocketRefMap, ref);
+    if (contextPtr == NULL)
+    {
+        LE_ERROR("Reference not found: %p", ref);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (!handlerFunc)
+    {
+        LE_ERROR("Wrong parameter: %p", handlerFunc);
+        return LE_BAD_PARAMETER;
+    }
+
+    if (contextPtr->isConnecting)
+    {
+        LE_ERROR("Connection already ongoing");
+        return LE_BUSY;
+    }
+
+    if (contextPtr->fd != -1)
+    {
+        LE_ERROR("Socket already connected");
+        return LE_DUPLICATE;
+    }
+
+    if (!contextPtr->connectTimerRef)
+    {
+        contextPtr->connectTimerRef = le_timer_Create("SocketConnect");
+        if ((LE_OK != le_timer_SetHandler(contextPtr->connectTimerRef, ConnectTimeoutHandler)) ||
+            (LE_OK != le_timer_SetContextPtr(contextPtr->connectTimerRef, contextPtr->reference)))
+        {
+            LE_ERROR("Unable to set up the connection timer");
+            return LE_FAULT;
+        }
+    }
+
+    status = dnsResolver_Resolve(contextPtr->host, contextPtr->type, ResolutionHandler,
+                                 contextPtr->reference, &contextPtr->resolutionRef);
+    if (status != LE_OK)
+    {
+        return status;
+    }
+
+    contextPtr->connectHandler = handlerFunc;
+    contextPtr->connectUserPtr = userPtr;
+    contextPtr->isConnecting = true;
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Close the socket connection.
@@ -497,6 +1012,8 @@ le_result_t le_socket_Disconnect
         return LE_BAD_PARAMETER;
     }
 
+    CancelConnect(contextPtr);
+
     if (contextPtr->isSecure)
     {
         status = secSocket_Disconnect(contextPtr->secureCtxPtr);
@@ -512,6 +1029,7 @@ le_result_t le_socket_Disconnect
         contextPtr->monitorRef = NULL;
     }
 
+    contextPtr->fd = -1;
     return status;
 }
 
@@ -47,6 +47,8 @@
  * In order to enable SSL encryption on top of the socket, a valid DER encoded certificate must be
  * passed through @ref le_socket_AddCertificate. This API decodes the certificate and enables
  * secure exchanges. It is possible to pass several DER certificates for the same socket reference.
+ * Parsed certificates are cached by the library, so adding the same certificates to several
+ * sockets does not parse them again.
  *
  * Example code:
  * @snippet "apps/test/httpServices/socketIntegrationTest/socketTestComponent/socketTest.c"
@@ -62,6 +64,16 @@
  * @snippet "apps/test/httpServices/socketIntegrationTest/socketTestComponent/socketTest.c"
  * SocketConnect
  *
+ * @ref le_socket_Connect blocks the caller during host name resolution, connection and secure
+ * handshake. Event-driven applications should call @ref le_socket_ConnectAsync instead: the host
+ * name is resolved by a resolver thread and the connection progress is driven by the event loop of
+ * the calling thread. The result is reported through a @c le_socket_ConnectHandler_t handler.
+ * Host name resolutions are cached and shared by all the sockets of the process: successful
+ * resolutions are kept 5 minutes and unknown hosts 30 seconds.
+ * For secure sockets, the handshake is also driven by the event loop. Secure sessions are cached
+ * per host and port, so that reconnections use an abbreviated handshake when the server accepts
+ * to resume the session.
+ *
  * Data transmission can be achieved through @ref le_socket_Read and @ref le_socket_Send APIs.
  * These APIs are blocking until there is something to read from the socket or send is finished.
  * A default timeout of 10 sec is implemented to prevent infinite wait. This duration can be
@@ -164,6 +176,26 @@ typedef void (*le_socket_EventHandler_t)
     void*            userPtr    ///< [IN] User-defined pointer
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ *  Handler definition to report the result of an asynchronous connection. The result is one of:
+ *
+ *  - LE_OK            Socket connected
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_UNAVAILABLE   Unable to reach the server or DNS issue
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_CLOSED        In case of end of file error
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_socket_ConnectHandler_t)
+(
+    le_socket_Ref_t  ref,       ///< [IN] Socket context reference
+    le_result_t      result,    ///< [IN] Connection result
+    void*            userPtr    ///< [IN] User-defined pointer
+);
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -236,6 +268,30 @@ LE_SHARED le_result_t le_socket_Connect
     le_socket_Ref_t    ref   ///< [IN] Socket context reference
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initiate a connection with the server without blocking the caller. The host name is resolved
+ * by the socket library resolver, then the connection and the optional secure handshake are
+ * driven by the event loop of the calling thread. The result is reported through the handler.
+ *
+ * @note The calling thread must run an event loop.
+ *
+ * @return
+ *  - LE_OK            Connection started
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_BUSY          A connection is already ongoing
+ *  - LE_DUPLICATE     Socket already connected
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_FAULT         Internal error
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_socket_ConnectAsync
+(
+    le_socket_Ref_t             ref,            ///< [IN] Socket context reference
+    le_socket_ConnectHandler_t  handlerFunc,    ///< [IN] Connection result handler
+    void*                       userPtr         ///< [IN] User-defined data pointer
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Close the socket connection.
@@ -12,6 +12,7 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "netSocket.h"
+#include "dnsResolver.h"
 
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -24,13 +25,6 @@
 // Symbol and Enum definitions
 //--------------------------------------------------------------------------------------------------
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Port maximum length
- */
-//--------------------------------------------------------------------------------------------------
-#define PORT_STR_LEN      6
-
 
 //--------------------------------------------------------------------------------------------------
 // Public functions
@@ -56,8 +50,8 @@ le_result_t netSocket_Connect
     int*          fdPtr       ///< [OUT] Socket file descriptor
 )
 {
-    char portStr[PORT_STR_LEN] = {0};
-    struct addrinfo hints, *addrList, *cur;
+    dnsResolver_AddrList_t addrList;
+    size_t i;
     int fd = -1;
 
     if ((!hostPtr) || (!fdPtr))
@@ -66,56 +60,137 @@ le_result_t netSocket_Connect
         return LE_BAD_PARAMETER;
     }
 
-    // Convert port to string
-    snprintf(portStr, PORT_STR_LEN, "%hu", port);
-
     // Do name resolution with both IPv6 and IPv4
-    memset(&hints, 0, sizeof(hints));
-    hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = (type == UDP_TYPE) ? SOCK_DGRAM : SOCK_STREAM;
-    hints.ai_protocol = (type == UDP_TYPE) ? IPPROTO_UDP : IPPROTO_TCP;
-
-    if(getaddrinfo(hostPtr, portStr, &hints, &addrList) != 0)
+    if (dnsResolver_Lookup(hostPtr, type, &addrList) != LE_OK)
     {
-        LE_ERROR("Error on function: getaddrinfo");
+        LE_ERROR("Unable to resolve %s", hostPtr);
         return LE_UNAVAILABLE;
     }
 
     // Try the sockaddrs until a connection succeeds
-    for(cur = addrList; cur != NULL; cur = cur->ai_next)
+    for (i = 0; i < addrList.count; i++)
     {
-        fd = socket(cur->ai_family, cur->ai_socktype, cur->ai_protocol);
+        dnsResolver_SetPort(&addrList.addr[i], port);
 
-        if( fd < 0 )
+        fd = socket(addrList.addr[i].ss_family,
+                    (type == UDP_TYPE) ? SOCK_DGRAM : SOCK_STREAM,
+                    (type == UDP_TYPE) ? IPPROTO_UDP : IPPROTO_TCP);
+        if (fd < 0)
         {
             continue;
         }
 
-        if( connect(fd, cur->ai_addr, cur->ai_addrlen) == 0 )
+        if (connect(fd, (struct sockaddr*)&addrList.addr[i], addrList.addrLen[i]) == 0)
         {
-            break;
+            *fdPtr = fd;
+            return LE_OK;
         }
 
-        LE_ERROR("Error on function: connect");
+        LE_ERROR("Error on function: connect: %d, %s", errno, strerror(errno));
         close(fd);
-        freeaddrinfo(addrList);
         return LE_COMM_ERROR;
     }
 
-    freeaddrinfo( addrList );
+    LE_ERROR("Unable to create a socket");
+    return LE_FAULT;
+}
 
-    // Check file descriptor
-    if (fd == -1)
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a non-blocking connection to a resolved address. When LE_IN_PROGRESS is returned, the
+ * socket becomes writable once the connection attempt is over and netSocket_FinishConnect() must
+ * be called to get its result.
+ *
+ * @return
+ *  - LE_OK            Connection established
+ *  - LE_IN_PROGRESS   Connection pending
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Unable to create the socket
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_StartConnect
+(
+    const struct sockaddr*  addrPtr,    ///< [IN] Address to connect to, port included
+    socklen_t               addrLen,    ///< [IN] Address length
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    int*                    fdPtr       ///< [OUT] Socket file descriptor
+)
+{
+    int fd;
+
+    if ((!addrPtr) || (!fdPtr))
+    {
+        LE_ERROR("Wrong parameter provided: %p, %p", addrPtr, fdPtr);
+        return LE_BAD_PARAMETER;
+    }
+
+    fd = socket(addrPtr->sa_family,
+                ((type == UDP_TYPE) ? SOCK_DGRAM : SOCK_STREAM) | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                (type == UDP_TYPE) ? IPPROTO_UDP : IPPROTO_TCP);
+    if (fd < 0)
     {
-        LE_ERROR("Unable to create a socket");
+        LE_ERROR("Unable to create a socket: %d, %s", errno, strerror(errno));
         return LE_FAULT;
     }
-    else
+
+    *fdPtr = fd;
+
+    if (connect(fd, addrPtr, addrLen) == 0)
+    {
+        le_result_t result = netSocket_FinishConnect(fd);
+
+        if (LE_OK != result)
+        {
+            close(fd);
+            *fdPtr = -1;
+        }
+        return result;
+    }
+
+    if (errno == EINPROGRESS)
     {
-        *fdPtr = fd;
-        return LE_OK;
+        return LE_IN_PROGRESS;
+    }
 
+    LE_ERROR("Error on function: connect: %d, %s", errno, strerror(errno));
+    close(fd);
+    *fdPtr = -1;
+    return LE_COMM_ERROR;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the result of a connection started by netSocket_StartConnect(). On success, the socket is
+ * switched back to blocking mode, as expected by the read and write functions.
+ *
+ * @return
+ *  - LE_OK            Connection established
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_FinishConnect
+(
+    int fd    ///< [IN] Socket file descriptor
+)
+{
+    int error = 0;
+    socklen_t len = sizeof(error);
+
+    if ((getsockopt(fd, SOL_SOCKET, SO_ERROR, &error, &len) != 0) || (error != 0))
+    {
+        LE_ERROR("Connection failed: %d, %s", error, strerror(error));
+        return LE_COMM_ERROR;
     }
+
+    int flags = fcntl(fd, F_GETFL);
+    if ((flags == -1) || (fcntl(fd, F_SETFL, flags & ~O_NONBLOCK) == -1))
+    {
+        LE_ERROR("Unable to set the socket in blocking mode: %d, %s", errno, strerror(errno));
+        return LE_COMM_ERROR;
+    }
+
+    return LE_OK;
 }
 
 //--------------------------------------------------------------------------------------------------
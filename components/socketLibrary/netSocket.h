@@ -15,6 +15,8 @@
 #include "interfaces.h"
 #include "common.h"
 
+#include <sys/socket.h>
+
 
 //--------------------------------------------------------------------------------------------------
 // Symbol and Enum definitions
@@ -44,6 +46,43 @@ le_result_t netSocket_Connect
     int*          fdPtr       ///< [OUT] Socket file descriptor
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start a non-blocking connection to a resolved address. When LE_IN_PROGRESS is returned, the
+ * socket becomes writable once the connection attempt is over and netSocket_FinishConnect() must
+ * be called to get its result.
+ *
+ * @return
+ *  - LE_OK            Connection established
+ *  - LE_IN_PROGRESS   Connection pending
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Unable to create the socket
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_StartConnect
+(
+    const struct sockaddr*  addrPtr,    ///< [IN] Address to connect to, port included
+    socklen_t               addrLen,    ///< [IN] Address length
+    SocketType_t            type,       ///< [IN] Socket type (TCP, UDP)
+    int*                    fdPtr       ///< [OUT] Socket file descriptor
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the result of a connection started by netSocket_StartConnect(). On success, the socket is
+ * switched back to blocking mode, as expected by the read and write functions.
+ *
+ * @return
+ *  - LE_OK            Connection established
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t netSocket_FinishConnect
+(
+    int fd    ///< [IN] Socket file descriptor
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection
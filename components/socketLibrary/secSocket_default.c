@@ -59,30 +59,68 @@ le_result_t secSocket_AddCertificate
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Initiate a connection with host:port and the given protocol
+ * Prepare a non-blocking SSL/TLS handshake on a socket which is already connected to the host.
+ * A session previously established with the same host and port is offered for resumption.
+ * The handshake is then run by secSocket_ContinueHandshake().
  *
  * @return
  *  - LE_OK            The function succeeded
  *  - LE_BAD_PARAMETER Invalid parameter
- *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secSocket_StartHandshake
+(
+    secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
+    char*            hostPtr,    ///< [IN] Host name, used for server verification
+    uint16_t         port,       ///< [IN] Host port, used to look for a session to resume
+    int              fd          ///< [IN] Connected socket file descriptor
+)
+{
+    return LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Progress the SSL/TLS handshake as far as possible without blocking. When LE_IN_PROGRESS is
+ * returned, this function must be called again once one of the returned events occurs on the
+ * socket.
+ *
+ * On success, the secure socket context owns the file descriptor and closes it on disconnection.
+ * On failure, the file descriptor is left to the caller.
+ *
+ * @return
+ *  - LE_OK            Handshake completed
+ *  - LE_IN_PROGRESS   Handshake pending, wait for eventsPtr on the socket
+ *  - LE_BAD_PARAMETER Invalid parameter
  *  - LE_FAULT         Internal error
  *  - LE_NO_MEMORY     Memory allocation issue
  *  - LE_CLOSED        In case of end of file error
  *  - LE_COMM_ERROR    Connection failure
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t secSocket_Connect
+le_result_t secSocket_ContinueHandshake
 (
     secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
-    char*            hostPtr,    ///< [IN] Host to connect on
-    uint16_t         port,       ///< [IN] Port to connect on
-    SocketType_t     type,       ///< [IN] Socket type (TCP, UDP)
-    int*             fdPtr       ///< [OUT] Socket file descriptor
+    short*           eventsPtr   ///< [OUT] Socket events (POLLIN, POLLOUT) to wait for
 )
 {
     return LE_FAULT;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Abort a pending SSL/TLS handshake. The file descriptor is left to the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+void secSocket_AbortHandshake
+(
+    secSocket_Ctx_t* ctxPtr      ///< [INOUT] Secure socket context pointer
+)
+{
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection while keeping the SSL configuration.
@@ -19,6 +19,7 @@
 #include <sys/socket.h>
 #include <netdb.h>
 #include <unistd.h>
+#include <pthread.h>
 #include "secSocket.h"
 #include "mbedtls/debug.h"
 #include "le_socketLib.h"
@@ -28,6 +29,7 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/entropy.h"
 #include "mbedtls/platform.h"
+#include "mbedtls/sha256.h"
 #include "mbedtls/ssl_internal.h"
 
 //--------------------------------------------------------------------------------------------------
@@ -65,6 +67,76 @@
 //--------------------------------------------------------------------------------------------------
 #define MBEDTLS_MAGIC_NUMBER        0x6D626564
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Port maximum length
+ */
+//--------------------------------------------------------------------------------------------------
+#define PORT_STR_LEN                6
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a session cache key: "host:port"
+ */
+//--------------------------------------------------------------------------------------------------
+#define SESSION_KEY_LEN             (HOST_ADDR_LEN + PORT_STR_LEN + 1)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of TLS sessions kept for resumption
+ */
+//--------------------------------------------------------------------------------------------------
+#define SESSION_CACHE_SIZE          MAX_SOCKET_NB
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of parsed CA chains kept in cache
+ */
+//--------------------------------------------------------------------------------------------------
+#define CA_CACHE_SIZE               4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Length of a SHA-256 digest
+ */
+//--------------------------------------------------------------------------------------------------
+#define DIGEST_LEN                  32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsed CA chain, shared by the contexts which added the same certificates. A chain is private to
+ * its context while certificates are added to it, and becomes shared and immutable once the
+ * context connects.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t            link;      ///< Link in the CA chain cache
+    uint8_t                  digest[DIGEST_LEN]; ///< SHA-256 of the certificates digests, in the
+                                                 ///< order they were added
+    bool                     isShared;  ///< True once the chain was published in the cache
+    mbedtls_x509_crt         chain;     ///< Parsed certificates
+}
+CaChain_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session kept for resumption. A session is only offered again by a context trusting the same
+ * certificates, so that a context never resumes a session it would not have authenticated. The
+ * secure sockets have no client certificate: the trust store is the whole identity of a context.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    bool                     inUse;                 ///< True if the entry holds a session
+    char                     key[SESSION_KEY_LEN];  ///< Host and port of the session
+    uint8_t                  trustDigest[DIGEST_LEN]; ///< Trusted CA chain of the context which
+                                                      ///< negotiated the session
+    le_clk_Time_t            lastUse;               ///< Time of the last use, for eviction
+    mbedtls_ssl_session      session;               ///< Session data
+}
+SessionEntry_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * MbedTLS global context
@@ -78,7 +150,8 @@ typedef struct
     mbedtls_ssl_context      sslCtx;    ///< SSL/TLS context
     mbedtls_ssl_config       sslConf;   ///< SSL/TLS configuration
     mbedtls_entropy_context  entropy;   ///< Entropy context structure
-    mbedtls_x509_crt         caCert;    ///< X.509 certificate
+    CaChain_t*               caChainPtr;///< Trusted CA chain, NULL if no certificate was added
+    char                     sessionKey[SESSION_KEY_LEN]; ///< Session cache key of the connection
     bool                     isInit;    ///< TRUE if the secure socket context is initialized
 }
 MbedtlsCtx_t;
@@ -98,6 +171,13 @@ LE_MEM_DEFINE_STATIC_POOL(MbedTLS, MBEDTLS_LARGE_BUFFER_COUNT, MBEDTLS_SSL_BUFFE
 //--------------------------------------------------------------------------------------------------
 LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(MbedtlsCtx_t));
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool for the parsed CA chains: one per socket plus the cached ones.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(CaChainPool, MAX_SOCKET_NB + CA_CACHE_SIZE, sizeof(CaChain_t));
+
 //--------------------------------------------------------------------------------------------------
 // Internal variables
 //--------------------------------------------------------------------------------------------------
@@ -116,6 +196,42 @@ le_mem_PoolRef_t MbedTLSPoolRef = NULL;
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Memory pool reference for the parsed CA chains
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t CaChainPoolRef = NULL;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsed CA chains cache, most recently used first, protected by CacheMutex
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_List_t CaChainCache = LE_DLS_LIST_INIT;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions cache, protected by CacheMutex
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionEntry_t SessionCache[SESSION_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the CA chains and sessions caches, shared by the secure sockets of all the
+ * threads
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t CacheMutex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make sure that the caches are initialized only once whatever the calling thread
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_once_t InitOnce = PTHREAD_ONCE_INIT;
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
@@ -336,6 +452,423 @@ static le_result_t ReadFromStream
     return r;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Destructor of the parsed CA chains
+ */
+//--------------------------------------------------------------------------------------------------
+static void CaChainDestructor
+(
+    void* objPtr    ///< [IN] CA chain pointer
+)
+{
+    CaChain_t* caChainPtr = (CaChain_t*)objPtr;
+
+    mbedtls_x509_crt_free(&(caChainPtr->chain));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the caches
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitCaches
+(
+    void
+)
+{
+    CacheMutex = le_mutex_CreateNonRecursive("SecSocketCache");
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the digest of the certificates trusted by a context
+ */
+//--------------------------------------------------------------------------------------------------
+static void GetTrustDigest
+(
+    const MbedtlsCtx_t* contextPtr,         ///< [IN] MbedTLS socket context pointer
+    uint8_t             digest[DIGEST_LEN]  ///< [OUT] Digest of the trusted certificates
+)
+{
+    if (contextPtr->caChainPtr)
+    {
+        memcpy(digest, contextPtr->caChainPtr->digest, DIGEST_LEN);
+    }
+    else
+    {
+        memset(digest, 0, DIGEST_LEN);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the digest of a CA chain extended with a certificate
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT if the digest can't be computed
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ComputeChainDigest
+(
+    const MbedtlsCtx_t* contextPtr,         ///< [IN] MbedTLS socket context pointer
+    const uint8_t*      certificatePtr,     ///< [IN] Certificate Pointer
+    size_t              certificateLen,     ///< [IN] Certificate Length
+    uint8_t             digest[DIGEST_LEN]  ///< [OUT] Digest of the extended chain
+)
+{
+    uint8_t digests[2][DIGEST_LEN];
+
+    GetTrustDigest(contextPtr, digests[0]);
+
+    if ((0 != mbedtls_sha256_ret(certificatePtr, certificateLen, digests[1], 0)) ||
+        (0 != mbedtls_sha256_ret((const uint8_t*)digests, sizeof(digests), digest, 0)))
+    {
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for a parsed CA chain in the cache. The returned chain is referenced for the caller.
+ *
+ * @note CacheMutex must be held.
+ *
+ * @return
+ *  - CA chain pointer, NULL if not found
+ */
+//--------------------------------------------------------------------------------------------------
+static CaChain_t* FindCaChain
+(
+    const uint8_t digest[DIGEST_LEN]    ///< [IN] Digest of the certificates
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&CaChainCache);
+
+    while (linkPtr)
+    {
+        CaChain_t* caChainPtr = CONTAINER_OF(linkPtr, CaChain_t, link);
+
+        if (0 == memcmp(caChainPtr->digest, digest, DIGEST_LEN))
+        {
+            // Most recently used first
+            le_dls_Remove(&CaChainCache, linkPtr);
+            le_dls_Stack(&CaChainCache, linkPtr);
+
+            le_mem_AddRef(caChainPtr);
+            return caChainPtr;
+        }
+
+        linkPtr = le_dls_PeekNext(&CaChainCache, linkPtr);
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Share the CA chain of a context through the cache, evicting the least recently used one if the
+ * cache is full. If the same chain was meanwhile published by another context, that one is used
+ * instead. Only complete chains, i.e. the ones used to connect, are published.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PublishCaChain
+(
+    MbedtlsCtx_t*    contextPtr  ///< [INOUT] MbedTLS socket context pointer
+)
+{
+    CaChain_t* caChainPtr = contextPtr->caChainPtr;
+
+    if ((!caChainPtr) || (caChainPtr->isShared))
+    {
+        return;
+    }
+
+    le_mutex_Lock(CacheMutex);
+
+    CaChain_t* cachedChainPtr = FindCaChain(caChainPtr->digest);
+    if (cachedChainPtr)
+    {
+        le_mem_Release(caChainPtr);
+        contextPtr->caChainPtr = cachedChainPtr;
+    }
+    else
+    {
+        caChainPtr->isShared = true;
+        le_mem_AddRef(caChainPtr);
+        le_dls_Stack(&CaChainCache, &(caChainPtr->link));
+
+        if (le_dls_NumLinks(&CaChainCache) > CA_CACHE_SIZE)
+        {
+            le_mem_Release(CONTAINER_OF(le_dls_PopTail(&CaChainCache), CaChain_t, link));
+        }
+    }
+
+    le_mutex_Unlock(CacheMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the session cache key of a host
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetSessionKey
+(
+    MbedtlsCtx_t*    contextPtr, ///< [INOUT] MbedTLS socket context pointer
+    char*            hostPtr,    ///< [IN] Host name
+    uint16_t         port        ///< [IN] Host port
+)
+{
+    snprintf(contextPtr->sessionKey, sizeof(contextPtr->sessionKey), "%s:%hu", hostPtr, port);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached TLS session of a context
+ *
+ * @note CacheMutex must be held.
+ *
+ * @return
+ *  - Session cache entry, NULL if not found
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionEntry_t* FindSession
+(
+    const MbedtlsCtx_t* contextPtr  ///< [IN] MbedTLS socket context pointer
+)
+{
+    uint8_t trustDigest[DIGEST_LEN];
+    int i;
+
+    GetTrustDigest(contextPtr, trustDigest);
+
+    for (i = 0; i < SESSION_CACHE_SIZE; i++)
+    {
+        if ((SessionCache[i].inUse) &&
+            (0 == strcmp(SessionCache[i].key, contextPtr->sessionKey)) &&
+            (0 == memcmp(SessionCache[i].trustDigest, trustDigest, DIGEST_LEN)))
+        {
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store the session of an established connection, replacing the least recently used session if
+ * the cache is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SaveSession
+(
+    MbedtlsCtx_t*    contextPtr  ///< [IN] MbedTLS socket context pointer
+)
+{
+    le_mutex_Lock(CacheMutex);
+
+    SessionEntry_t* entryPtr = FindSession(contextPtr);
+    int i;
+
+    for (i = 0; (!entryPtr) && (i < SESSION_CACHE_SIZE); i++)
+    {
+        if (!SessionCache[i].inUse)
+        {
+            entryPtr = &SessionCache[i];
+        }
+    }
+
+    if (!entryPtr)
+    {
+        entryPtr = &SessionCache[0];
+        for (i = 1; i < SESSION_CACHE_SIZE; i++)
+        {
+            if (le_clk_GreaterThan(entryPtr->lastUse, SessionCache[i].lastUse))
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+    }
+
+    if (entryPtr->inUse)
+    {
+        mbedtls_ssl_session_free(&(entryPtr->session));
+    }
+    mbedtls_ssl_session_init(&(entryPtr->session));
+    entryPtr->inUse = false;
+
+    if (0 != mbedtls_ssl_get_session(&(contextPtr->sslCtx), &(entryPtr->session)))
+    {
+        LE_WARN("Unable to save the session of %s", contextPtr->sessionKey);
+        mbedtls_ssl_session_free(&(entryPtr->session));
+        le_mutex_Unlock(CacheMutex);
+        return;
+    }
+
+    LE_ASSERT(LE_OK == le_utf8_Copy(entryPtr->key, contextPtr->sessionKey,
+                                    sizeof(entryPtr->key), NULL));
+    GetTrustDigest(contextPtr, entryPtr->trustDigest);
+    entryPtr->lastUse = le_clk_GetRelativeTime();
+    entryPtr->inUse = true;
+
+    le_mutex_Unlock(CacheMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forget the cached session of a host, e.g. when the server refused to resume it
+ */
+//--------------------------------------------------------------------------------------------------
+static void DropSession
+(
+    MbedtlsCtx_t*    contextPtr  ///< [IN] MbedTLS socket context pointer
+)
+{
+    le_mutex_Lock(CacheMutex);
+
+    SessionEntry_t* entryPtr = FindSession(contextPtr);
+    if (entryPtr)
+    {
+        mbedtls_ssl_session_free(&(entryPtr->session));
+        entryPtr->inUse = false;
+    }
+
+    le_mutex_Unlock(CacheMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert an MbedTLS handshake error into a Legato result code
+ *
+ * @return
+ *  - LE_TIMEOUT       Timeout during execution
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_CLOSED        In case of end of file error
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetHandshakeError
+(
+    int ret     ///< [IN] MbedTLS error code
+)
+{
+    LE_ERROR("Failed! mbedtls_ssl_handshake returned -0x%x", -ret);
+
+    if (ret == MBEDTLS_ERR_NET_RECV_FAILED)
+    {
+        return LE_TIMEOUT;
+    }
+    else if (ret == MBEDTLS_ERR_NET_SEND_FAILED)
+    {
+        return LE_FAULT;
+    }
+    else if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED)
+    {
+        return LE_NO_MEMORY;
+    }
+    else if (ret == MBEDTLS_ERR_SSL_CONN_EOF)
+    {
+        return LE_CLOSED;
+    }
+
+    return LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set up the SSL/TLS session on the connected socket. A cached session of the same host and port
+ * is offered to the server for resumption.
+ *
+ * @return
+ *  - LE_OK            The function succeeded
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SetupSession
+(
+    MbedtlsCtx_t*    contextPtr, ///< [INOUT] MbedTLS socket context pointer
+    char*            hostPtr,    ///< [IN] Host name
+    uint16_t         port        ///< [IN] Host port
+)
+{
+    SessionEntry_t* entryPtr;
+    int ret;
+
+    // Setup
+    LE_INFO("Setting up the SSL/TLS structure...");
+
+    if ((ret = mbedtls_ssl_config_defaults(&(contextPtr->sslConf),
+                                           MBEDTLS_SSL_IS_CLIENT,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0)
+    {
+        LE_ERROR("Failed! mbedtls_ssl_config_defaults returned %d", ret);
+        // Only possible error is linked to memory allocation issue
+        return LE_NO_MEMORY;
+    }
+
+    mbedtls_ssl_conf_authmode(&(contextPtr->sslConf), MBEDTLS_SSL_VERIFY_REQUIRED);
+    PublishCaChain(contextPtr);
+    mbedtls_ssl_conf_ca_chain(&(contextPtr->sslConf),
+                              contextPtr->caChainPtr ? &(contextPtr->caChainPtr->chain) : NULL,
+                              NULL);
+    mbedtls_ssl_conf_rng(&(contextPtr->sslConf), mbedtls_ctr_drbg_random, &(contextPtr->ctrDrbg));
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&(contextPtr->sslConf), MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    // Release the SSL context of a previous connection before setting it up again
+    mbedtls_ssl_free(&(contextPtr->sslCtx));
+    mbedtls_ssl_init(&(contextPtr->sslCtx));
+
+    if ((ret = mbedtls_ssl_setup(&(contextPtr->sslCtx), &(contextPtr->sslConf))) != 0)
+    {
+        LE_ERROR("Failed! mbedtls_ssl_setup returned %d", ret);
+        if (MBEDTLS_ERR_SSL_ALLOC_FAILED == ret)
+        {
+            return LE_NO_MEMORY;
+        }
+        return LE_FAULT;
+    }
+
+    if ((ret = mbedtls_ssl_set_hostname(&(contextPtr->sslCtx), hostPtr)) != 0)
+    {
+        LE_ERROR("Failed! mbedtls_ssl_set_hostname returned %d", ret);
+        if (MBEDTLS_ERR_SSL_ALLOC_FAILED == ret)
+        {
+            return LE_NO_MEMORY;
+        }
+        return LE_FAULT;
+    }
+
+    // Offer the previous session with this server for an abbreviated handshake
+    SetSessionKey(contextPtr, hostPtr, port);
+    le_mutex_Lock(CacheMutex);
+    entryPtr = FindSession(contextPtr);
+    if (entryPtr)
+    {
+        if (0 == mbedtls_ssl_set_session(&(contextPtr->sslCtx), &(entryPtr->session)))
+        {
+            LE_DEBUG("Resuming session with %s", contextPtr->sessionKey);
+            entryPtr->lastUse = le_clk_GetRelativeTime();
+        }
+    }
+    le_mutex_Unlock(CacheMutex);
+
+    mbedtls_ssl_set_bio(&(contextPtr->sslCtx), &(contextPtr->serverFd),
+                        mbedtls_net_send, NULL, mbedtls_net_recv_timeout);
+
+    // Set the timeout for the initial handshake.
+    mbedtls_ssl_conf_read_timeout(&(contextPtr->sslConf), MBEDTLS_SSL_CONNECT_TIMEOUT);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -364,6 +897,8 @@ le_result_t secSocket_Init
         return LE_BAD_PARAMETER;
     }
 
+    pthread_once(&InitOnce, InitCaches);
+
     // Initialize MbedTLS internal pool and attach callbacks
     if (!MbedTLSPoolRef)
     {
@@ -382,6 +917,15 @@ le_result_t secSocket_Init
                                                  sizeof(MbedtlsCtx_t));
     }
 
+    // Initialize the CA chain pool
+    if (!CaChainPoolRef)
+    {
+        CaChainPoolRef = le_mem_InitStaticPool(CaChainPool,
+                                               MAX_SOCKET_NB + CA_CACHE_SIZE,
+                                               sizeof(CaChain_t));
+        le_mem_SetDestructor(CaChainPoolRef, CaChainDestructor);
+    }
+
     // Check if the socket is already initialized
     MbedtlsCtx_t* contextPtr = GetContext(*ctxPtr);
     if ((contextPtr) && (contextPtr->isInit))
@@ -400,6 +944,7 @@ le_result_t secSocket_Init
 
     // Set the magic number
     contextPtr->magicNb = MBEDTLS_MAGIC_NUMBER;
+    contextPtr->caChainPtr = NULL;
 
     // Initialize the RNG and the session data
     mbedtls_net_init(&(contextPtr->serverFd));
@@ -457,16 +1002,94 @@ le_result_t secSocket_AddCertificate
     }
 
     LE_DEBUG("Certificate: %p Len:%zu", certificatePtr, certificateLen);
-    int ret = mbedtls_x509_crt_parse(&(contextPtr->caCert), certificatePtr, certificateLen);
-    if (ret < 0)
+
+    // Certificates already parsed for another context are shared instead of being parsed again.
+    // A chain is identified by the certificates it was built from, in the order they were added.
+    CaChain_t* oldChainPtr = contextPtr->caChainPtr;
+    uint8_t digest[DIGEST_LEN];
+
+    if (LE_OK != ComputeChainDigest(contextPtr, certificatePtr, certificateLen, digest))
     {
-        LE_ERROR("Failed!  mbedtls_x509_crt_parse returned -0x%x", -ret);
+        LE_ERROR("Unable to compute the certificate digest");
         return LE_FAULT;
     }
 
+    le_mutex_Lock(CacheMutex);
+    CaChain_t* caChainPtr = FindCaChain(digest);
+    le_mutex_Unlock(CacheMutex);
+
+    if (caChainPtr)
+    {
+        if (oldChainPtr)
+        {
+            le_mem_Release(oldChainPtr);
+        }
+        contextPtr->caChainPtr = caChainPtr;
+    }
+    else
+    {
+        int ret;
+
+        if ((oldChainPtr) && (!oldChainPtr->isShared))
+        {
+            // The chain is private to this context: only the new certificate needs to be parsed
+            caChainPtr = oldChainPtr;
+        }
+        else
+        {
+            const mbedtls_x509_crt* crtPtr;
+
+            caChainPtr = le_mem_TryAlloc(CaChainPoolRef);
+            if (!caChainPtr)
+            {
+                LE_ERROR("Unable to allocate a CA chain from pool");
+                return LE_FAULT;
+            }
+
+            caChainPtr->link = LE_DLS_LINK_INIT;
+            caChainPtr->isShared = false;
+            mbedtls_x509_crt_init(&(caChainPtr->chain));
+
+            // A shared chain is immutable: start from a copy of its certificates
+            for (crtPtr = oldChainPtr ? &(oldChainPtr->chain) : NULL;
+                 (crtPtr) && (crtPtr->raw.p);
+                 crtPtr = crtPtr->next)
+            {
+                ret = mbedtls_x509_crt_parse_der(&(caChainPtr->chain),
+                                                 crtPtr->raw.p, crtPtr->raw.len);
+                if (ret < 0)
+                {
+                    LE_ERROR("Failed!  mbedtls_x509_crt_parse_der returned -0x%x", -ret);
+                    le_mem_Release(caChainPtr);
+                    return LE_FAULT;
+                }
+            }
+        }
+
+        // On failure, a private chain is left as it was before this certificate
+        ret = mbedtls_x509_crt_parse(&(caChainPtr->chain), certificatePtr, certificateLen);
+        if (ret < 0)
+        {
+            LE_ERROR("Failed!  mbedtls_x509_crt_parse returned -0x%x", -ret);
+            if (caChainPtr != oldChainPtr)
+            {
+                le_mem_Release(caChainPtr);
+            }
+            return LE_FAULT;
+        }
+
+        memcpy(caChainPtr->digest, digest, DIGEST_LEN);
+
+        if ((oldChainPtr) && (caChainPtr != oldChainPtr))
+        {
+            le_mem_Release(oldChainPtr);
+        }
+        contextPtr->caChainPtr = caChainPtr;
+    }
+
     // Check certificate validity
-    if ((mbedtls_x509_time_is_past(&contextPtr->caCert.valid_to)) ||
-        (mbedtls_x509_time_is_future(&contextPtr->caCert.valid_from)))
+    if ((mbedtls_x509_time_is_past(&caChainPtr->chain.valid_to)) ||
+        (mbedtls_x509_time_is_future(&caChainPtr->chain.valid_from)))
     {
         LE_ERROR("Current certificate expired, please add a valid certificate");
         return LE_FORMAT_ERROR;
@@ -477,34 +1100,28 @@ le_result_t secSocket_AddCertificate
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Initiate a connection with host:port and the given protocol
+ * Prepare a non-blocking SSL/TLS handshake on a socket which is already connected to the host.
+ * A session previously established with the same host and port is offered for resumption.
+ * The handshake is then run by secSocket_ContinueHandshake().
  *
  * @return
  *  - LE_OK            The function succeeded
  *  - LE_BAD_PARAMETER Invalid parameter
- *  - LE_TIMEOUT       Timeout during execution
- *  - LE_UNAVAILABLE   Unable to reach the server or DNS issue
  *  - LE_FAULT         Internal error
  *  - LE_NO_MEMORY     Memory allocation issue
- *  - LE_CLOSED        In case of end of file error
- *  - LE_COMM_ERROR    Connection failure
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t secSocket_Connect
+le_result_t secSocket_StartHandshake
 (
     secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
-    char*            hostPtr,    ///< [IN] Host to connect on
-    uint16_t         port,       ///< [IN] Port to connect on
-    SocketType_t     type,       ///< [IN] Socket type (TCP, UDP)
-    int*             fdPtr       ///< [OUT] Socket file descriptor
+    char*            hostPtr,    ///< [IN] Host name, used for server verification
+    uint16_t         port,       ///< [IN] Host port, used to look for a session to resume
+    int              fd          ///< [IN] Connected socket file descriptor
 )
 {
-    int ret;
-    char portBuffer[6] = {0};
-
-    if ((!ctxPtr) || (!hostPtr) || (!fdPtr))
+    if ((!ctxPtr) || (!hostPtr) || (fd < 0))
     {
-        LE_ERROR("Invalid argument: ctxPtr %p, hostPtr %p fdPtr %p", ctxPtr, hostPtr, fdPtr);
+        LE_ERROR("Invalid argument: ctxPtr %p, hostPtr %p fd %d", ctxPtr, hostPtr, fd);
         return LE_BAD_PARAMETER;
     }
 
@@ -514,106 +1131,107 @@ le_result_t secSocket_Connect
         return LE_BAD_PARAMETER;
     }
 
-    // Start the connection
-    snprintf(portBuffer, sizeof(portBuffer), "%d", port);
-    LE_INFO("Connecting to %d/%s:%d - %s:%s...", type, hostPtr, port, hostPtr, portBuffer);
+    mbedtls_net_init(&(contextPtr->serverFd));
+    contextPtr->serverFd.fd = fd;
 
-    if ((ret = mbedtls_net_connect(&(contextPtr->serverFd),
-                                   hostPtr,
-                                   portBuffer,
-                                   (type == TCP_TYPE) ?
-                                   MBEDTLS_NET_PROTO_TCP : MBEDTLS_NET_PROTO_UDP)) != 0)
+    le_result_t status = SetupSession(contextPtr, hostPtr, port);
+    if ((LE_OK != status) || (0 != mbedtls_net_set_nonblock(&(contextPtr->serverFd))))
     {
-        LE_INFO("Failed! mbedtls_net_connect returned %d", ret);
-        if (ret == MBEDTLS_ERR_NET_UNKNOWN_HOST)
-        {
-            return LE_UNAVAILABLE;
-        }
-        else if (ret == MBEDTLS_ERR_NET_CONNECT_FAILED)
-        {
-            return LE_COMM_ERROR;
-        }
-        return LE_FAULT;
+        mbedtls_net_init(&(contextPtr->serverFd));
+        return (LE_OK != status) ? status : LE_FAULT;
     }
 
-    //Get the file descriptor
-    *fdPtr = contextPtr->serverFd.fd;
-    LE_DEBUG("File descriptor: %d", *fdPtr);
+    // The handshake must return instead of waiting for the socket
+    mbedtls_ssl_set_bio(&(contextPtr->sslCtx), &(contextPtr->serverFd),
+                        mbedtls_net_send, mbedtls_net_recv, NULL);
 
-    // Setup
-    LE_INFO("Setting up the SSL/TLS structure...");
+    return LE_OK;
+}
 
-    if ((ret = mbedtls_ssl_config_defaults(&(contextPtr->sslConf),
-                                           MBEDTLS_SSL_IS_CLIENT,
-                                           MBEDTLS_SSL_TRANSPORT_STREAM,
-                                           MBEDTLS_SSL_PRESET_DEFAULT)) != 0)
+//--------------------------------------------------------------------------------------------------
+/**
+ * Progress the SSL/TLS handshake as far as possible without blocking. When LE_IN_PROGRESS is
+ * returned, this function must be called again once one of the returned events occurs on the
+ * socket.
+ *
+ * On success, the secure socket context owns the file descriptor and closes it on disconnection.
+ * On failure, the file descriptor is left to the caller.
+ *
+ * @return
+ *  - LE_OK            Handshake completed
+ *  - LE_IN_PROGRESS   Handshake pending, wait for eventsPtr on the socket
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_CLOSED        In case of end of file error
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secSocket_ContinueHandshake
+(
+    secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
+    short*           eventsPtr   ///< [OUT] Socket events (POLLIN, POLLOUT) to wait for
+)
+{
+    int ret;
+
+    if ((!ctxPtr) || (!eventsPtr))
     {
-        LE_ERROR("Failed! mbedtls_ssl_config_defaults returned %d", ret);
-        // Only possible error is linked to memory allocation issue
-        return LE_NO_MEMORY;
+        return LE_BAD_PARAMETER;
     }
 
-    mbedtls_ssl_conf_authmode(&(contextPtr->sslConf), MBEDTLS_SSL_VERIFY_REQUIRED);
-    mbedtls_ssl_conf_ca_chain(&(contextPtr->sslConf), &(contextPtr->caCert), NULL);
-    mbedtls_ssl_conf_rng(&(contextPtr->sslConf), mbedtls_ctr_drbg_random, &(contextPtr->ctrDrbg));
-
-    if ((ret = mbedtls_ssl_setup(&(contextPtr->sslCtx), &(contextPtr->sslConf))) != 0)
+    MbedtlsCtx_t* contextPtr = GetContext(ctxPtr);
+    if (!contextPtr)
     {
-        LE_ERROR("Failed! mbedtls_ssl_setup returned %d", ret);
-        if (MBEDTLS_ERR_SSL_ALLOC_FAILED == ret)
-        {
-            return LE_NO_MEMORY;
-        }
-        return LE_FAULT;
+        return LE_BAD_PARAMETER;
     }
 
-    if ((ret = mbedtls_ssl_set_hostname(&(contextPtr->sslCtx), hostPtr)) != 0)
+    ret = mbedtls_ssl_handshake(&(contextPtr->sslCtx));
+    if (MBEDTLS_ERR_SSL_WANT_READ == ret)
     {
-        LE_ERROR("Failed! mbedtls_ssl_set_hostname returned %d", ret);
-        if (MBEDTLS_ERR_SSL_ALLOC_FAILED == ret)
-        {
-            return LE_NO_MEMORY;
-        }
-        return LE_FAULT;
+        *eventsPtr = POLLIN;
+        return LE_IN_PROGRESS;
+    }
+    else if (MBEDTLS_ERR_SSL_WANT_WRITE == ret)
+    {
+        *eventsPtr = POLLOUT;
+        return LE_IN_PROGRESS;
+    }
+    else if (0 != ret)
+    {
+        DropSession(contextPtr);
+        mbedtls_net_init(&(contextPtr->serverFd));
+        return GetHandshakeError(ret);
     }
 
+    LE_INFO("SSL/TLS handshake with %s done", contextPtr->sessionKey);
+    SaveSession(contextPtr);
+
+    // Switch back to the blocking behaviour expected by read and write functions
+    mbedtls_net_set_block(&(contextPtr->serverFd));
     mbedtls_ssl_set_bio(&(contextPtr->sslCtx), &(contextPtr->serverFd),
                         mbedtls_net_send, NULL, mbedtls_net_recv_timeout);
 
-    // Set the timeout for the initial handshake.
-    mbedtls_ssl_conf_read_timeout(&(contextPtr->sslConf), MBEDTLS_SSL_CONNECT_TIMEOUT);
+    return LE_OK;
+}
 
-    // Handshake
-    LE_INFO("Performing the SSL/TLS handshake...");
-    while ((ret = mbedtls_ssl_handshake(&(contextPtr->sslCtx))) != 0)
+//--------------------------------------------------------------------------------------------------
+/**
+ * Abort a pending SSL/TLS handshake. The file descriptor is left to the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+void secSocket_AbortHandshake
+(
+    secSocket_Ctx_t* ctxPtr      ///< [INOUT] Secure socket context pointer
+)
+{
+    MbedtlsCtx_t* contextPtr = GetContext(ctxPtr);
+    if (!contextPtr)
     {
-        LE_ERROR("Failed! mbedtls_ssl_handshake returned -0x%x", -ret);
-        if ((ret != MBEDTLS_ERR_SSL_WANT_READ) && (ret != MBEDTLS_ERR_SSL_WANT_WRITE))
-        {
-            if (ret == MBEDTLS_ERR_NET_RECV_FAILED)
-            {
-                return LE_TIMEOUT;
-            }
-            else if (ret == MBEDTLS_ERR_NET_SEND_FAILED)
-            {
-                return LE_FAULT;
-            }
-            else if (ret == MBEDTLS_ERR_SSL_ALLOC_FAILED)
-            {
-                return LE_NO_MEMORY;
-            }
-            else if (ret == MBEDTLS_ERR_SSL_CONN_EOF)
-            {
-                return LE_CLOSED;
-            }
-            else
-            {
-                return LE_FAULT;
-            }
-        }
+        return;
     }
 
-    return LE_OK;
+    mbedtls_net_init(&(contextPtr->serverFd));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -671,7 +1289,11 @@ le_result_t secSocket_Delete
     }
 
     mbedtls_net_free(&(contextPtr->serverFd));
-    mbedtls_x509_crt_free(&(contextPtr->caCert));
+    if (contextPtr->caChainPtr)
+    {
+        le_mem_Release(contextPtr->caChainPtr);
+        contextPtr->caChainPtr = NULL;
+    }
     mbedtls_ssl_free(&(contextPtr->sslCtx));
     mbedtls_ssl_config_free(&(contextPtr->sslConf));
     mbedtls_ctr_drbg_free(&(contextPtr->ctrDrbg));
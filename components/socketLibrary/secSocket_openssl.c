@@ -19,12 +19,14 @@
 #include <sys/socket.h>
 #include <netdb.h>
 #include <unistd.h>
+#include <pthread.h>
 #include "secSocket.h"
 #include "le_socketLib.h"
 
 #include <openssl/bio.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
+#include <openssl/sha.h>
 #include <openssl/ssl.h>
 
 //--------------------------------------------------------------------------------------------------
@@ -45,6 +47,27 @@
 //--------------------------------------------------------------------------------------------------
 #define PORT_STR_LEN                6
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum length of a session cache key: "host:port"
+ */
+//--------------------------------------------------------------------------------------------------
+#define SESSION_KEY_LEN             (HOST_ADDR_LEN + PORT_STR_LEN + 1)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of TLS sessions kept for resumption
+ */
+//--------------------------------------------------------------------------------------------------
+#define SESSION_CACHE_SIZE          MAX_SOCKET_NB
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of parsed certificates kept in cache
+ */
+//--------------------------------------------------------------------------------------------------
+#define CERT_CACHE_SIZE             4
+
 //--------------------------------------------------------------------------------------------------
 /**
  * OpenSSL global context
@@ -55,10 +78,45 @@ typedef struct
     uint32_t                 magicNb;   ///< Magic number to check structure validity
     BIO*                     bioPtr;    ///< I/O stream abstraction pointer
     SSL_CTX*                 sslCtxPtr; ///< SSL internal context pointer
+    char                     sessionKey[SESSION_KEY_LEN]; ///< Session cache key of the connection
+    uint8_t                  trustDigest[SHA256_DIGEST_LENGTH]; ///< SHA-256 of the trusted
+                                                                ///< certificates, in the order
+                                                                ///< they were added
     bool                     isInit;    ///< TRUE if the secure socket context is initialized
 }
 OpensslCtx_t;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsed certificate, shared by the contexts which added the same certificate
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint8_t                  digest[SHA256_DIGEST_LENGTH]; ///< SHA-256 of the DER encoded
+                                                           ///< certificate
+    le_clk_Time_t            lastUse;   ///< Time of the last use, for eviction
+    X509*                    certPtr;   ///< Parsed certificate, NULL if the entry is free
+}
+CertEntry_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS session kept for resumption. A session is only offered again by a context trusting the same
+ * certificates, so that a context never resumes a session it would not have authenticated. The
+ * secure sockets have no client certificate: the trust store is the whole identity of a context.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char                     key[SESSION_KEY_LEN];  ///< Host and port of the session
+    uint8_t                  trustDigest[SHA256_DIGEST_LENGTH]; ///< Trust store of the context
+                                                                ///< which negotiated the session
+    le_clk_Time_t            lastUse;               ///< Time of the last use, for eviction
+    SSL_SESSION*             sessionPtr;            ///< Session data, NULL if the entry is free
+}
+SessionEntry_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool for OpenSSL sockets context.
@@ -77,10 +135,70 @@ LE_MEM_DEFINE_STATIC_POOL(SocketCtxPool, MAX_SOCKET_NB, sizeof(OpensslCtx_t));
 //--------------------------------------------------------------------------------------------------
 static le_mem_PoolRef_t SocketCtxPoolRef = NULL;
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsed certificates cache, protected by CacheMutex
+ */
+//--------------------------------------------------------------------------------------------------
+static CertEntry_t CertCache[CERT_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * TLS sessions cache, protected by CacheMutex
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionEntry_t SessionCache[SESSION_CACHE_SIZE];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the certificates and sessions caches, shared by the secure sockets of all the
+ * threads
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mutex_Ref_t CacheMutex;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Make sure that the caches are initialized only once whatever the calling thread
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_once_t InitOnce = PTHREAD_ONCE_INIT;
+
 //--------------------------------------------------------------------------------------------------
 // Static functions
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the caches
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitCaches
+(
+    void
+)
+{
+    CacheMutex = le_mutex_CreateNonRecursive("SecSocketCache");
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compute the SHA-256 digest of a buffer
+ *
+ * @return
+ *  - true on success
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ComputeDigest
+(
+    const void*       dataPtr,                      ///< [IN] Data
+    size_t            dataLen,                      ///< [IN] Data length
+    uint8_t           digest[SHA256_DIGEST_LENGTH]  ///< [OUT] SHA-256 digest
+)
+{
+    return (1 == EVP_Digest(dataPtr, dataLen, digest, NULL, EVP_sha256(), NULL));
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Cast secure socket context into OpenSSL socket context and check its validity
@@ -112,6 +230,303 @@ static OpensslCtx_t* GetContext
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert the last OpenSSL error of a connection attempt into a Legato result code
+ *
+ * @return
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_UNAVAILABLE   Unable to reach the server or DNS issue
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_CLOSED        In case of end of file error
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t GetConnectError
+(
+    void
+)
+{
+    le_result_t status = LE_FAULT;
+    unsigned long code = ERR_peek_last_error();
+
+    if ((ERR_GET_LIB(code) == ERR_LIB_BIO) || (ERR_GET_LIB(code) == ERR_LIB_SSL))
+    {
+        switch (ERR_GET_REASON(code))
+        {
+            case ERR_R_MALLOC_FAILURE:
+                status = LE_NO_MEMORY;
+                break;
+
+            case BIO_R_NULL_PARAMETER:
+                status = LE_BAD_PARAMETER;
+                break;
+
+#if defined(BIO_R_BAD_HOSTNAME_LOOKUP)
+            case BIO_R_BAD_HOSTNAME_LOOKUP:
+                status = LE_UNAVAILABLE;
+                break;
+#endif
+
+            case BIO_R_CONNECT_ERROR:
+                status = LE_COMM_ERROR;
+                break;
+
+#if defined(BIO_R_EOF_ON_MEMORY_BIO)
+            case BIO_R_EOF_ON_MEMORY_BIO:
+                status = LE_CLOSED;
+                break;
+#endif
+
+            default:
+                status = LE_FAULT;
+                break;
+        }
+    }
+
+    return status;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Take a reference on an X509 certificate
+ */
+//--------------------------------------------------------------------------------------------------
+static void CertificateAddRef
+(
+    X509* certPtr   ///< [IN] Certificate
+)
+{
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    CRYPTO_add(&certPtr->references, 1, CRYPTO_LOCK_X509);
+#else
+    X509_up_ref(certPtr);
+#endif
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the parsed form of a DER encoded certificate. Certificates already parsed for another
+ * context are taken from the cache, others are parsed and added to the cache in place of the
+ * least recently used one. Certificates are identified by the SHA-256 digest of their encoding.
+ *
+ * @return
+ *  - Certificate, referenced for the caller
+ *  - NULL if the certificate can't be parsed
+ */
+//--------------------------------------------------------------------------------------------------
+static X509* GetCertificate
+(
+    const uint8_t*    certificatePtr,   ///< [IN] Certificate Pointer
+    size_t            certificateLen,   ///< [IN] Certificate Length
+    uint8_t           digest[SHA256_DIGEST_LENGTH]  ///< [OUT] SHA-256 of the certificate
+)
+{
+    CertEntry_t* entryPtr = &CertCache[0];
+    X509* certPtr = NULL;
+    int i;
+
+    if (!ComputeDigest(certificatePtr, certificateLen, digest))
+    {
+        LE_ERROR("Unable to compute the certificate digest");
+        return NULL;
+    }
+
+    le_mutex_Lock(CacheMutex);
+
+    for (i = 0; i < CERT_CACHE_SIZE; i++)
+    {
+        if ((CertCache[i].certPtr) &&
+            (0 == memcmp(CertCache[i].digest, digest, SHA256_DIGEST_LENGTH)))
+        {
+            CertCache[i].lastUse = le_clk_GetRelativeTime();
+            certPtr = CertCache[i].certPtr;
+            CertificateAddRef(certPtr);
+            goto end;
+        }
+
+        // Keep track of the entry to replace: a free one or the least recently used one
+        if ((entryPtr->certPtr) &&
+            ((!CertCache[i].certPtr) || (le_clk_GreaterThan(entryPtr->lastUse,
+                                                            CertCache[i].lastUse))))
+        {
+            entryPtr = &CertCache[i];
+        }
+    }
+
+    // Read the DER formatted certificate from memory into an X509 structure
+    certPtr = d2i_X509(NULL, &certificatePtr, certificateLen);
+    if (!certPtr)
+    {
+        goto end;
+    }
+
+    if (entryPtr->certPtr)
+    {
+        X509_free(entryPtr->certPtr);
+    }
+
+    CertificateAddRef(certPtr);
+    entryPtr->certPtr = certPtr;
+    memcpy(entryPtr->digest, digest, SHA256_DIGEST_LENGTH);
+    entryPtr->lastUse = le_clk_GetRelativeTime();
+
+end:
+    le_mutex_Unlock(CacheMutex);
+
+    return certPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look for the cached TLS session of a context
+ *
+ * @note CacheMutex must be held.
+ *
+ * @return
+ *  - Session cache entry, NULL if not found
+ */
+//--------------------------------------------------------------------------------------------------
+static SessionEntry_t* FindSession
+(
+    const OpensslCtx_t* contextPtr  ///< [IN] OpenSSL socket context pointer
+)
+{
+    int i;
+
+    for (i = 0; i < SESSION_CACHE_SIZE; i++)
+    {
+        if ((SessionCache[i].sessionPtr) &&
+            (0 == strcmp(SessionCache[i].key, contextPtr->sessionKey)) &&
+            (0 == memcmp(SessionCache[i].trustDigest, contextPtr->trustDigest,
+                         SHA256_DIGEST_LENGTH)))
+        {
+            return &SessionCache[i];
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Offer the cached session of a host to the server, for an abbreviated handshake
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResumeSession
+(
+    OpensslCtx_t*    contextPtr, ///< [INOUT] OpenSSL socket context pointer
+    SSL*             sslPtr,     ///< [IN] SSL connection
+    char*            hostPtr,    ///< [IN] Host name
+    uint16_t         port        ///< [IN] Host port
+)
+{
+    snprintf(contextPtr->sessionKey, sizeof(contextPtr->sessionKey), "%s:%hu", hostPtr, port);
+
+    // Retrieved by NewSessionHandler() to store the sessions of this connection
+    SSL_set_app_data(sslPtr, contextPtr);
+
+    le_mutex_Lock(CacheMutex);
+
+    // The SSL connection takes its own reference on the session
+    SessionEntry_t* entryPtr = FindSession(contextPtr);
+    if ((entryPtr) && (SSL_set_session(sslPtr, entryPtr->sessionPtr)))
+    {
+        LE_DEBUG("Resuming session with %s", contextPtr->sessionKey);
+        entryPtr->lastUse = le_clk_GetRelativeTime();
+    }
+
+    le_mutex_Unlock(CacheMutex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Store a new session negotiated with a server, replacing the least recently used session if the
+ * cache is full. With TLS 1.3, sessions are received after the handshake, hence the callback.
+ *
+ * @return
+ *  - 1 if the session reference is kept by the cache
+ *  - 0 otherwise
+ */
+//--------------------------------------------------------------------------------------------------
+static int NewSessionHandler
+(
+    SSL*             sslPtr,     ///< [IN] SSL connection
+    SSL_SESSION*     sessionPtr  ///< [IN] New session
+)
+{
+    OpensslCtx_t* contextPtr = SSL_get_app_data(sslPtr);
+    int i;
+
+    if (!contextPtr)
+    {
+        return 0;
+    }
+
+    le_mutex_Lock(CacheMutex);
+
+    SessionEntry_t* entryPtr = FindSession(contextPtr);
+
+    for (i = 0; (!entryPtr) && (i < SESSION_CACHE_SIZE); i++)
+    {
+        if (!SessionCache[i].sessionPtr)
+        {
+            entryPtr = &SessionCache[i];
+        }
+    }
+
+    if (!entryPtr)
+    {
+        entryPtr = &SessionCache[0];
+        for (i = 1; i < SESSION_CACHE_SIZE; i++)
+        {
+            if (le_clk_GreaterThan(entryPtr->lastUse, SessionCache[i].lastUse))
+            {
+                entryPtr = &SessionCache[i];
+            }
+        }
+    }
+
+    if (entryPtr->sessionPtr)
+    {
+        SSL_SESSION_free(entryPtr->sessionPtr);
+    }
+
+    LE_DEBUG("New session with %s", contextPtr->sessionKey);
+    entryPtr->sessionPtr = sessionPtr;
+    LE_ASSERT(LE_OK == le_utf8_Copy(entryPtr->key, contextPtr->sessionKey,
+                                    sizeof(entryPtr->key), NULL));
+    memcpy(entryPtr->trustDigest, contextPtr->trustDigest, SHA256_DIGEST_LENGTH);
+    entryPtr->lastUse = le_clk_GetRelativeTime();
+
+    le_mutex_Unlock(CacheMutex);
+
+    return 1;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Forget the cached session of a host, e.g. when the server refused to resume it
+ */
+//--------------------------------------------------------------------------------------------------
+static void DropSession
+(
+    OpensslCtx_t*    contextPtr  ///< [IN] OpenSSL socket context pointer
+)
+{
+    le_mutex_Lock(CacheMutex);
+
+    SessionEntry_t* entryPtr = FindSession(contextPtr);
+    if (entryPtr)
+    {
+        SSL_SESSION_free(entryPtr->sessionPtr);
+        entryPtr->sessionPtr = NULL;
+    }
+
+    le_mutex_Unlock(CacheMutex);
+}
+
 //--------------------------------------------------------------------------------------------------
 // Public functions
 //--------------------------------------------------------------------------------------------------
@@ -138,6 +553,8 @@ le_result_t secSocket_Init
         return LE_BAD_PARAMETER;
     }
 
+    pthread_once(&InitOnce, InitCaches);
+
     // Initialize the socket context pool
     if (!SocketCtxPoolRef)
     {
@@ -164,6 +581,7 @@ le_result_t secSocket_Init
 
     // Set the magic number
     contextPtr->magicNb = OPENSSL_MAGIC_NUMBER;
+    memset(contextPtr->trustDigest, 0, sizeof(contextPtr->trustDigest));
 
     // Initialize OpenSSL library and setup SSL pointers
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -174,6 +592,14 @@ le_result_t secSocket_Init
     contextPtr->sslCtxPtr = SSL_CTX_new(TLS_client_method());
 #endif
 
+    if (contextPtr->sslCtxPtr)
+    {
+        // Sessions are kept in the process-wide cache, shared by all the secure sockets
+        SSL_CTX_set_session_cache_mode(contextPtr->sslCtxPtr,
+                                       SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(contextPtr->sslCtxPtr, NewSessionHandler);
+    }
+
     contextPtr->isInit = true;
     *ctxPtr = (secSocket_Ctx_t*)contextPtr;
 
@@ -203,6 +629,7 @@ le_result_t secSocket_AddCertificate
     BIO *bio = NULL;
     le_result_t status = LE_FAULT;
     le_clk_Time_t currentTime;
+    uint8_t digests[2][SHA256_DIGEST_LENGTH];
 
     // Check input parameters
     if ((!ctxPtr) || (!certificatePtr) || (!certificateLen))
@@ -226,8 +653,8 @@ le_result_t secSocket_AddCertificate
         goto end;
     }
 
-    // Read the DER formatted certificate from memory into an X509 structure
-    cert = d2i_X509(NULL, &certificatePtr, certificateLen);
+    // Get the certificate as an X509 structure
+    cert = GetCertificate(certificatePtr, certificateLen, digests[1]);
     if (!cert)
     {
         LE_ERROR("Unable to read certificate");
@@ -260,6 +687,14 @@ le_result_t secSocket_AddCertificate
         goto end;
     }
 
+    // Chain the certificate digest into the trust store digest, which scopes the cached sessions
+    memcpy(digests[0], contextPtr->trustDigest, SHA256_DIGEST_LENGTH);
+    if (!ComputeDigest(digests, sizeof(digests), contextPtr->trustDigest))
+    {
+        LE_ERROR("Unable to compute the trust store digest");
+        goto end;
+    }
+
     status = LE_OK;
 
 end:
@@ -278,37 +713,32 @@ end:
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Initiate a connection with host:port and the given protocol
+ * Prepare a non-blocking SSL/TLS handshake on a socket which is already connected to the host.
+ * A session previously established with the same host and port is offered for resumption.
+ * The handshake is then run by secSocket_ContinueHandshake().
  *
  * @return
  *  - LE_OK            The function succeeded
  *  - LE_BAD_PARAMETER Invalid parameter
- *  - LE_TIMEOUT       Timeout during execution
- *  - LE_UNAVAILABLE   Unable to reach the server or DNS issue
  *  - LE_FAULT         Internal error
  *  - LE_NO_MEMORY     Memory allocation issue
- *  - LE_CLOSED        In case of end of file error
- *  - LE_COMM_ERROR    Connection failure
  */
 //--------------------------------------------------------------------------------------------------
-le_result_t secSocket_Connect
+le_result_t secSocket_StartHandshake
 (
     secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
-    char*            hostPtr,    ///< [IN] Host to connect on
-    uint16_t         port,       ///< [IN] Port to connect on
-    SocketType_t     type,       ///< [IN] Socket type (TCP, UDP)
-    int*             fdPtr       ///< [OUT] Socket file descriptor
+    char*            hostPtr,    ///< [IN] Host name, used for server verification
+    uint16_t         port,       ///< [IN] Host port, used to look for a session to resume
+    int              fd          ///< [IN] Connected socket file descriptor
 )
 {
     SSL* sslPtr = NULL;
     BIO* bioPtr = NULL;
-    char hostAndPort[HOST_ADDR_LEN + PORT_STR_LEN + 1];
-    le_result_t status = LE_FAULT;
-    unsigned long code;
+    BIO* socketBioPtr = NULL;
 
-    if ((!ctxPtr) || (!hostPtr) || (!fdPtr))
+    if ((!ctxPtr) || (!hostPtr) || (fd < 0))
     {
-        LE_ERROR("Invalid argument: ctxPtr %p, hostPtr %p fdPtr %p", ctxPtr, hostPtr, fdPtr);
+        LE_ERROR("Invalid argument: ctxPtr %p, hostPtr %p fd %d", ctxPtr, hostPtr, fd);
         return LE_BAD_PARAMETER;
     }
 
@@ -318,20 +748,20 @@ le_result_t secSocket_Connect
         return LE_BAD_PARAMETER;
     }
 
-    // Start the connection
-    snprintf(hostAndPort, sizeof(hostAndPort), "%s:%d", hostPtr, port);
-    LE_INFO("Connecting to %d/%s:%d - %s...", type, hostPtr, port, hostAndPort);
-
     // Clear the current thread's OpenSSL error queue
     ERR_clear_error();
 
-    // Setting up the BIO abstraction layer
-    bioPtr = BIO_new_ssl_connect(contextPtr->sslCtxPtr);
-    if (!bioPtr)
+    // Setting up the BIO abstraction layer on top of the connected socket. The socket is closed
+    // by the BIO chain only once the handshake succeeded.
+    bioPtr = BIO_new_ssl(contextPtr->sslCtxPtr, 1);
+    socketBioPtr = BIO_new_socket(fd, BIO_NOCLOSE);
+    if ((!bioPtr) || (!socketBioPtr))
     {
-        LE_ERROR("Unable to allocate and connect BIO");
+        LE_ERROR("Unable to allocate BIO");
         goto err;
     }
+    BIO_push(bioPtr, socketBioPtr);
+    socketBioPtr = NULL;
 
     BIO_get_ssl(bioPtr, &sslPtr);
     if (!sslPtr)
@@ -340,68 +770,117 @@ le_result_t secSocket_Connect
         goto err;
     }
 
-    // Set the SSL_MODE_AUTO_RETRY flag: it will cause read/write operations to only return after
-    // the handshake and successful completion
     SSL_set_mode(sslPtr, SSL_MODE_AUTO_RETRY);
 
-    BIO_set_conn_hostname(bioPtr, hostAndPort);
+    ResumeSession(contextPtr, sslPtr, hostPtr, port);
 
-    // Attempt to connect the supplied BIO and perform the handshake.
-    // This function returns 1 if the connection was successfully established and 0 or -1 if the
-    // connection failed.
-    if (BIO_do_connect(bioPtr) != 1)
-    {
-        LE_ERROR("Unable to connect BIO to %s", hostAndPort);
-        goto err;
-    }
-
-    // Get the FD linked to the BIO
-    BIO_get_fd(bioPtr, fdPtr);
-    BIO_socket_nbio(*fdPtr, 1);
+    // The handshake must return instead of waiting for the socket
+    BIO_socket_nbio(fd, 1);
 
     contextPtr->bioPtr = bioPtr;
     return LE_OK;
 
 err:
-    code = ERR_peek_last_error();
+    if (bioPtr)
+    {
+        BIO_free_all(bioPtr);
+    }
+    if (socketBioPtr)
+    {
+        BIO_free(socketBioPtr);
+    }
+    return (ERR_GET_REASON(ERR_peek_last_error()) == ERR_R_MALLOC_FAILURE) ? LE_NO_MEMORY :
+                                                                             LE_FAULT;
+}
 
-    if ((ERR_GET_LIB(code) == ERR_LIB_BIO) || (ERR_GET_LIB(code) == ERR_LIB_SSL))
+//--------------------------------------------------------------------------------------------------
+/**
+ * Progress the SSL/TLS handshake as far as possible without blocking. When LE_IN_PROGRESS is
+ * returned, this function must be called again once one of the returned events occurs on the
+ * socket.
+ *
+ * On success, the secure socket context owns the file descriptor and closes it on disconnection.
+ * On failure, the file descriptor is left to the caller.
+ *
+ * @return
+ *  - LE_OK            Handshake completed
+ *  - LE_IN_PROGRESS   Handshake pending, wait for eventsPtr on the socket
+ *  - LE_BAD_PARAMETER Invalid parameter
+ *  - LE_FAULT         Internal error
+ *  - LE_NO_MEMORY     Memory allocation issue
+ *  - LE_CLOSED        In case of end of file error
+ *  - LE_COMM_ERROR    Connection failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t secSocket_ContinueHandshake
+(
+    secSocket_Ctx_t* ctxPtr,     ///< [INOUT] Secure socket context pointer
+    short*           eventsPtr   ///< [OUT] Socket events (POLLIN, POLLOUT) to wait for
+)
+{
+    SSL* sslPtr = NULL;
+    le_result_t status;
+
+    if ((!ctxPtr) || (!eventsPtr))
     {
-        switch (ERR_GET_REASON(code))
-        {
-            case ERR_R_MALLOC_FAILURE:
-                status = LE_NO_MEMORY;
-                break;
+        return LE_BAD_PARAMETER;
+    }
 
-            case BIO_R_NULL_PARAMETER:
-                status = LE_BAD_PARAMETER;
-                break;
+    OpensslCtx_t* contextPtr = GetContext(ctxPtr);
+    if ((!contextPtr) || (!contextPtr->bioPtr))
+    {
+        return LE_BAD_PARAMETER;
+    }
 
-#if defined(BIO_R_BAD_HOSTNAME_LOOKUP)
-            case BIO_R_BAD_HOSTNAME_LOOKUP:
-                status = LE_UNAVAILABLE;
-                break;
-#endif
+    ERR_clear_error();
 
-            case BIO_R_CONNECT_ERROR:
-                status = LE_COMM_ERROR;
-                break;
+    if (BIO_do_handshake(contextPtr->bioPtr) == 1)
+    {
+        BIO_get_ssl(contextPtr->bioPtr, &sslPtr);
+        LE_DEBUG("Session with %s %s", contextPtr->sessionKey,
+                 SSL_session_reused(sslPtr) ? "resumed" : "established");
 
-#if defined(BIO_R_EOF_ON_MEMORY_BIO)
-            case BIO_R_EOF_ON_MEMORY_BIO:
-                status = LE_CLOSED;
-                break;
-#endif
+        // The connection is established: the BIO chain now closes the socket when freed
+        BIO_set_close(BIO_next(contextPtr->bioPtr), BIO_CLOSE);
+        return LE_OK;
+    }
 
-            default:
-                status = LE_FAULT;
-                break;
-        }
-     }
+    if (BIO_should_retry(contextPtr->bioPtr))
+    {
+        *eventsPtr = BIO_should_write(contextPtr->bioPtr) ? POLLOUT : POLLIN;
+        return LE_IN_PROGRESS;
+    }
+
+    LE_ERROR("SSL/TLS handshake with %s failed", contextPtr->sessionKey);
+    status = GetConnectError();
+
+    DropSession(contextPtr);
+    BIO_free_all(contextPtr->bioPtr);
+    contextPtr->bioPtr = NULL;
 
     return status;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Abort a pending SSL/TLS handshake. The file descriptor is left to the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+void secSocket_AbortHandshake
+(
+    secSocket_Ctx_t* ctxPtr      ///< [INOUT] Secure socket context pointer
+)
+{
+    OpensslCtx_t* contextPtr = GetContext(ctxPtr);
+    if ((!contextPtr) || (!contextPtr->bioPtr))
+    {
+        return;
+    }
+
+    BIO_free_all(contextPtr->bioPtr);
+    contextPtr->bioPtr = NULL;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gracefully close the socket connection while keeping the SSL configuration.
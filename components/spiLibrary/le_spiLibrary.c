@@ -331,6 +331,61 @@ le_result_t le_spiLib_ReadHD
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a SPI transaction made of several segments with a single system call. The device stays
+ * selected between the segments unless csChange is set.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if there is no segment or too many segments
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spiLib_Transfer
+(
+    int fd,                                 ///< [in] open file descriptor of SPI port
+    const le_spiLib_Segment_t* segments,    ///< [in] segments of the transaction
+    size_t segmentCount                     ///< [in] number of segments
+)
+{
+    int transferResult;
+
+    if ((segmentCount == 0) || (segmentCount > LE_SPILIB_MAX_SEGMENTS))
+    {
+        LE_ERROR("Invalid number of segments: %zu", segmentCount);
+        return LE_BAD_PARAMETER;
+    }
+
+    struct spi_ioc_transfer tr[segmentCount];
+    memset(tr, 0, sizeof(tr));
+
+    for (size_t i = 0; i < segmentCount; i++)
+    {
+        tr[i].tx_buf = (unsigned long)segments[i].txPtr;
+        tr[i].rx_buf = (unsigned long)segments[i].rxPtr;
+        tr[i].len = segments[i].length;
+        tr[i].delay_usecs = segments[i].delayUsecs;
+        tr[i].speed_hz = segments[i].speedHz;
+        tr[i].cs_change = segments[i].csChange;
+    }
+
+    LE_DEBUG("Transferring %zu segments", segmentCount);
+
+    transferResult = ioctl(fd, SPI_IOC_MESSAGE(segmentCount), tr);
+    if (transferResult < 0)
+    {
+        LE_ERROR("Transfer failed with error %d : %d (%m)", transferResult, errno);
+        LE_ERROR("can't send spi message");
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("Successful transaction of %d bytes", transferResult);
+
+    return LE_OK;
+}
+
+
 COMPONENT_INIT
 {
     LE_DEBUG("spiLibrary initializing");
@@ -8,6 +8,29 @@
 #ifndef LE_SPI_LIBRARY_H
 #define LE_SPI_LIBRARY_H
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of segments in a transaction
+ */
+//--------------------------------------------------------------------------------------------------
+#define LE_SPILIB_MAX_SEGMENTS  64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Segment of a SPI transaction
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const uint8_t* txPtr;   ///< data sent to slave, NULL to send zeros
+    uint8_t* rxPtr;         ///< buffer for the data received from slave, NULL to discard them
+    size_t length;          ///< number of bytes of the segment
+    bool csChange;          ///< deselect the device after the segment
+    uint16_t delayUsecs;    ///< delay after the segment, before deselecting the device
+    uint32_t speedHz;       ///< speed (Hz) of the segment, 0 for the configured speed
+}
+le_spiLib_Segment_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Configures the SPI bus for use with a specific device.
@@ -100,4 +123,22 @@ LE_SHARED le_result_t le_spiLib_ReadHD
     size_t* readDataLength    ///< [in/out] number of bytes in rx message
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a SPI transaction made of several segments with a single system call. The device stays
+ * selected between the segments unless csChange is set.
+ *
+ * @return
+ *      - LE_OK
+ *      - LE_BAD_PARAMETER if there is no segment or too many segments
+ *      - LE_FAULT
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED le_result_t le_spiLib_Transfer
+(
+    int fd,                                 ///< [in] open file descriptor of SPI port
+    const le_spiLib_Segment_t* segments,    ///< [in] segments of the transaction
+    size_t segmentCount                     ///< [in] number of segments
+);
+
 #endif  // LE_SPI_LIBRARY_H
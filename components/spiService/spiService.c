@@ -12,6 +12,7 @@
 #include "interfaces.h"
 #include "le_spiLibrary.h"
 #include "watchdogChain.h"
+#include <sys/mman.h>
 
 #define MAX_EXPECTED_DEVICES (8)
 
@@ -27,6 +28,8 @@ typedef struct
     int fd;
     ino_t inode;
     le_msg_SessionRef_t owningSession;
+    uint8_t* sharedBufferPtr;   // Buffer registered with le_spi_RegisterBuffer, or NULL
+    size_t sharedBufferSize;
 } Device_t;
 
 
@@ -35,6 +38,16 @@ static Device_t const* FindDeviceWithInode(ino_t inode);
 static void CloseDevice(le_spi_DeviceHandleRef_t handle, Device_t* device);
 static void CloseAllHandlesOwnedByClient(le_msg_SessionRef_t owner);
 static void ClientSessionClosedHandler(le_msg_SessionRef_t clientSession, void* context);
+static void UnmapSharedBuffer(Device_t* device);
+static le_result_t BuildSegments(
+    const le_spi_Segment_t* segments,
+    size_t segmentCount,
+    const uint8_t* txBuffer,
+    size_t txBufferSize,
+    uint8_t* rxBuffer,
+    size_t rxBufferSize,
+    le_spiLib_Segment_t* libSegments,
+    size_t* rxEnd);
 
 // Memory pool for allocating devices
 static le_mem_PoolRef_t DevicePool;
@@ -131,6 +144,8 @@ le_result_t le_spi_Open
     newDevice->fd = openResult;
     newDevice->inode = deviceFileStat.st_ino;
     newDevice->owningSession = le_spi_GetClientSessionRef();
+    newDevice->sharedBufferPtr = NULL;
+    newDevice->sharedBufferSize = 0;
     *handle = le_ref_CreateRef(DeviceHandleRefMap, newDevice);
 
     return LE_OK;
@@ -363,6 +378,276 @@ le_result_t le_spi_ReadHD
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a SPI transaction made of several segments, in a single bus transaction.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BAD_PARAMETER if a segment is out of the buffers
+ *      - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spi_Transfer
+(
+    le_spi_DeviceHandleRef_t handle,    ///< [in] Handle for the SPI master to perform the
+                                        ///  transaction on
+    const le_spi_Segment_t* segments,   ///< [in] Segments of the transaction
+    size_t segmentCount,                ///< [in] Number of segments
+    const uint8_t* writeData,           ///< [in] Data sent by the segments
+    size_t writeDataLength,             ///< [in] Number of bytes in writeData
+    uint8_t* readData,                  ///< [out] Data received by the segments
+    size_t* readDataLength              ///< [in/out] Number of bytes in readData
+)
+{
+    if ((readData == NULL) || (readDataLength == NULL))
+    {
+        LE_KILL_CLIENT("readData is NULL.");
+        return LE_FAULT;
+    }
+
+    Device_t* device = le_ref_Lookup(DeviceHandleRefMap, handle);
+    if (device == NULL)
+    {
+        LE_KILL_CLIENT("Failed to lookup device from handle!");
+        return LE_FAULT;
+    }
+
+    if (!IsDeviceOwnedByCaller(device))
+    {
+        LE_KILL_CLIENT("Cannot assign handle to transfer as it is not owned by the caller");
+        return LE_FAULT;
+    }
+
+    le_spiLib_Segment_t libSegments[LE_SPI_MAX_SEGMENTS];
+    size_t rxEnd;
+    le_result_t result = BuildSegments(
+        segments,
+        segmentCount,
+        writeData,
+        writeDataLength,
+        readData,
+        *readDataLength,
+        libSegments,
+        &rxEnd);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    *readDataLength = rxEnd;
+
+    return le_spiLib_Transfer(device->fd, libSegments, segmentCount) == LE_OK ? LE_OK : LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Registers a buffer shared between the client and the SPI service, to be used by
+ * le_spi_TransferShared(). A buffer already registered for the device is replaced.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BAD_PARAMETER if the size is 0 or greater than LE_SPI_MAX_SHARED_BUFFER_SIZE
+ *      - LE_FAULT if the buffer can't be mapped
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spi_RegisterBuffer
+(
+    le_spi_DeviceHandleRef_t handle,    ///< [in] Handle for the SPI master using the buffer
+    int bufferFd,                       ///< [in] File holding the buffer
+    uint32_t size                       ///< [in] Size of the buffer
+)
+{
+    Device_t* device = le_ref_Lookup(DeviceHandleRefMap, handle);
+    if (device == NULL)
+    {
+        LE_KILL_CLIENT("Failed to lookup device from handle!");
+        close(bufferFd);
+        return LE_FAULT;
+    }
+
+    if (!IsDeviceOwnedByCaller(device))
+    {
+        LE_KILL_CLIENT("Cannot register a buffer on a handle not owned by the caller");
+        close(bufferFd);
+        return LE_FAULT;
+    }
+
+    if ((size == 0) || (size > LE_SPI_MAX_SHARED_BUFFER_SIZE))
+    {
+        LE_ERROR("Invalid shared buffer size %" PRIu32, size);
+        close(bufferFd);
+        return LE_BAD_PARAMETER;
+    }
+
+    void* bufferPtr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, bufferFd, 0);
+
+    // The mapping stays valid once the file is closed
+    close(bufferFd);
+
+    if (bufferPtr == MAP_FAILED)
+    {
+        LE_ERROR("Couldn't map the shared buffer: (%m)");
+        return LE_FAULT;
+    }
+
+    UnmapSharedBuffer(device);
+    device->sharedBufferPtr = bufferPtr;
+    device->sharedBufferSize = size;
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Performs a SPI transaction made of several segments on the buffer registered by
+ * le_spi_RegisterBuffer().
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BAD_PARAMETER if a segment is out of the buffer
+ *      - LE_UNAVAILABLE if no buffer is registered
+ *      - LE_FAULT on failure
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_spi_TransferShared
+(
+    le_spi_DeviceHandleRef_t handle,    ///< [in] Handle for the SPI master to perform the
+                                        ///  transaction on
+    const le_spi_Segment_t* segments,   ///< [in] Segments of the transaction
+    size_t segmentCount                 ///< [in] Number of segments
+)
+{
+    Device_t* device = le_ref_Lookup(DeviceHandleRefMap, handle);
+    if (device == NULL)
+    {
+        LE_KILL_CLIENT("Failed to lookup device from handle!");
+        return LE_FAULT;
+    }
+
+    if (!IsDeviceOwnedByCaller(device))
+    {
+        LE_KILL_CLIENT("Cannot assign handle to transfer as it is not owned by the caller");
+        return LE_FAULT;
+    }
+
+    if (device->sharedBufferPtr == NULL)
+    {
+        LE_ERROR("No shared buffer registered");
+        return LE_UNAVAILABLE;
+    }
+
+    le_spiLib_Segment_t libSegments[LE_SPI_MAX_SEGMENTS];
+    size_t rxEnd;
+    le_result_t result = BuildSegments(
+        segments,
+        segmentCount,
+        device->sharedBufferPtr,
+        device->sharedBufferSize,
+        device->sharedBufferPtr,
+        device->sharedBufferSize,
+        libSegments,
+        &rxEnd);
+    if (result != LE_OK)
+    {
+        return result;
+    }
+
+    return le_spiLib_Transfer(device->fd, libSegments, segmentCount) == LE_OK ? LE_OK : LE_FAULT;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Converts the segments of a transaction into library segments pointing into the given buffers.
+ *
+ * @return
+ *      - LE_OK on success
+ *      - LE_BAD_PARAMETER if there is no segment, too many segments, or a segment out of the
+ *        buffers
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t BuildSegments
+(
+    const le_spi_Segment_t* segments,   ///< [in] Segments of the transaction
+    size_t segmentCount,                ///< [in] Number of segments
+    const uint8_t* txBuffer,            ///< [in] Buffer holding the data to send
+    size_t txBufferSize,                ///< [in] Size of txBuffer
+    uint8_t* rxBuffer,                  ///< [in] Buffer for the data received
+    size_t rxBufferSize,                ///< [in] Size of rxBuffer
+    le_spiLib_Segment_t* libSegments,   ///< [out] Library segments, segmentCount entries
+    size_t* rxEnd                       ///< [out] End of the last byte received in rxBuffer
+)
+{
+    if ((segmentCount == 0) || (segmentCount > LE_SPI_MAX_SEGMENTS))
+    {
+        LE_ERROR("Invalid number of segments: %zu", segmentCount);
+        return LE_BAD_PARAMETER;
+    }
+
+    *rxEnd = 0;
+
+    for (size_t i = 0; i < segmentCount; i++)
+    {
+        const le_spi_Segment_t* segment = &segments[i];
+        le_spiLib_Segment_t* libSegment = &libSegments[i];
+
+        memset(libSegment, 0, sizeof(*libSegment));
+
+        if (segment->flags & LE_SPI_SEGMENT_TX)
+        {
+            if (((uint64_t)segment->txOffset + segment->length) > txBufferSize)
+            {
+                LE_ERROR("Segment %zu is out of the write buffer", i);
+                return LE_BAD_PARAMETER;
+            }
+            libSegment->txPtr = txBuffer + segment->txOffset;
+        }
+
+        if (segment->flags & LE_SPI_SEGMENT_RX)
+        {
+            if (((uint64_t)segment->rxOffset + segment->length) > rxBufferSize)
+            {
+                LE_ERROR("Segment %zu is out of the read buffer", i);
+                return LE_BAD_PARAMETER;
+            }
+            libSegment->rxPtr = rxBuffer + segment->rxOffset;
+
+            if ((segment->rxOffset + segment->length) > *rxEnd)
+            {
+                *rxEnd = segment->rxOffset + segment->length;
+            }
+        }
+
+        libSegment->length = segment->length;
+        libSegment->csChange = (segment->flags & LE_SPI_SEGMENT_CS_CHANGE) != 0;
+        libSegment->delayUsecs = segment->delayUsecs;
+        libSegment->speedHz = segment->speedHz;
+    }
+
+    return LE_OK;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Unmaps the buffer registered for a device, if any.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnmapSharedBuffer
+(
+    Device_t* device
+)
+{
+    if (device->sharedBufferPtr != NULL)
+    {
+        if (munmap(device->sharedBufferPtr, device->sharedBufferSize) != 0)
+        {
+            LE_WARN("Couldn't unmap the shared buffer: (%m)");
+        }
+        device->sharedBufferPtr = NULL;
+        device->sharedBufferSize = 0;
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks if the given handle is owned by the current client.
@@ -425,6 +710,7 @@ static void CloseDevice(le_spi_DeviceHandleRef_t handle, Device_t* device)
     {
         LE_WARN("Couldn't close the fd cleanly: (%m)");
     }
+    UnmapSharedBuffer(device);
     le_mem_Release(device);
 }
 
@@ -29,7 +29,10 @@
 //--------------------------------------------------------------------------------------------------
 #define MS_WDOG_INTERVAL 8
 
-static struct gpioSysfs_Gpio SysfsGpioPin1 = {1,"gpio1",false,NULL,NULL,NULL,NULL};
+static_assert(LE_GPIOPIN1_MAX_EDGE_BATCH == GPIOSYSFS_MAX_EDGE_BATCH,
+              "Edge batch size mismatch between le_gpio.api and gpioSysfs.h");
+
+static struct gpioSysfs_Gpio SysfsGpioPin1 = {1,"gpio1",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin1 = &SysfsGpioPin1;
 
 void gpioPin1_InputMonitorHandlerFunc (int fd, short events)
@@ -140,6 +143,29 @@ void le_gpioPin1_RemoveChangeEventHandler(le_gpioPin1_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin1, addHandlerRef);
 }
 
+le_gpioPin1_EdgeBatchEventHandlerRef_t le_gpioPin1_AddEdgeBatchEventHandler
+(
+    le_gpioPin1_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin1_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin1_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin1, gpioPin1_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin1_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin1_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin1, addHandlerRef);
+}
+
 le_result_t le_gpioPin1_SetEdgeSense (le_gpioPin1_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin1, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -163,7 +189,7 @@ le_result_t le_gpioPin1_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin2 = {2,"gpio2",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin2 = {2,"gpio2",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin2 = &SysfsGpioPin2;
 
 void gpioPin2_InputMonitorHandlerFunc (int fd, short events)
@@ -274,6 +300,29 @@ void le_gpioPin2_RemoveChangeEventHandler(le_gpioPin2_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin2, addHandlerRef);
 }
 
+le_gpioPin2_EdgeBatchEventHandlerRef_t le_gpioPin2_AddEdgeBatchEventHandler
+(
+    le_gpioPin2_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin2_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin2_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin2, gpioPin2_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin2_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin2_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin2, addHandlerRef);
+}
+
 le_result_t le_gpioPin2_SetEdgeSense (le_gpioPin2_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin2, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -297,7 +346,7 @@ le_result_t le_gpioPin2_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin3 = {3,"gpio3",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin3 = {3,"gpio3",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin3 = &SysfsGpioPin3;
 
 void gpioPin3_InputMonitorHandlerFunc (int fd, short events)
@@ -408,6 +457,29 @@ void le_gpioPin3_RemoveChangeEventHandler(le_gpioPin3_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin3, addHandlerRef);
 }
 
+le_gpioPin3_EdgeBatchEventHandlerRef_t le_gpioPin3_AddEdgeBatchEventHandler
+(
+    le_gpioPin3_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin3_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin3_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin3, gpioPin3_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin3_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin3_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin3, addHandlerRef);
+}
+
 le_result_t le_gpioPin3_SetEdgeSense (le_gpioPin3_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin3, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -431,7 +503,7 @@ le_result_t le_gpioPin3_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin4 = {4,"gpio4",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin4 = {4,"gpio4",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin4 = &SysfsGpioPin4;
 
 void gpioPin4_InputMonitorHandlerFunc (int fd, short events)
@@ -542,6 +614,29 @@ void le_gpioPin4_RemoveChangeEventHandler(le_gpioPin4_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin4, addHandlerRef);
 }
 
+le_gpioPin4_EdgeBatchEventHandlerRef_t le_gpioPin4_AddEdgeBatchEventHandler
+(
+    le_gpioPin4_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin4_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin4_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin4, gpioPin4_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin4_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin4_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin4, addHandlerRef);
+}
+
 le_result_t le_gpioPin4_SetEdgeSense (le_gpioPin4_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin4, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -565,7 +660,7 @@ le_result_t le_gpioPin4_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin5 = {5,"gpio5",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin5 = {5,"gpio5",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin5 = &SysfsGpioPin5;
 
 void gpioPin5_InputMonitorHandlerFunc (int fd, short events)
@@ -676,6 +771,29 @@ void le_gpioPin5_RemoveChangeEventHandler(le_gpioPin5_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin5, addHandlerRef);
 }
 
+le_gpioPin5_EdgeBatchEventHandlerRef_t le_gpioPin5_AddEdgeBatchEventHandler
+(
+    le_gpioPin5_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin5_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin5_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin5, gpioPin5_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin5_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin5_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin5, addHandlerRef);
+}
+
 le_result_t le_gpioPin5_SetEdgeSense (le_gpioPin5_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin5, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -699,7 +817,7 @@ le_result_t le_gpioPin5_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin6 = {6,"gpio6",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin6 = {6,"gpio6",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin6 = &SysfsGpioPin6;
 
 void gpioPin6_InputMonitorHandlerFunc (int fd, short events)
@@ -810,6 +928,29 @@ void le_gpioPin6_RemoveChangeEventHandler(le_gpioPin6_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin6, addHandlerRef);
 }
 
+le_gpioPin6_EdgeBatchEventHandlerRef_t le_gpioPin6_AddEdgeBatchEventHandler
+(
+    le_gpioPin6_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin6_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin6_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin6, gpioPin6_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin6_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin6_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin6, addHandlerRef);
+}
+
 le_result_t le_gpioPin6_SetEdgeSense (le_gpioPin6_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin6, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -833,7 +974,7 @@ le_result_t le_gpioPin6_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin7 = {7,"gpio7",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin7 = {7,"gpio7",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin7 = &SysfsGpioPin7;
 
 void gpioPin7_InputMonitorHandlerFunc (int fd, short events)
@@ -944,6 +1085,29 @@ void le_gpioPin7_RemoveChangeEventHandler(le_gpioPin7_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin7, addHandlerRef);
 }
 
+le_gpioPin7_EdgeBatchEventHandlerRef_t le_gpioPin7_AddEdgeBatchEventHandler
+(
+    le_gpioPin7_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin7_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin7_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin7, gpioPin7_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin7_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin7_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin7, addHandlerRef);
+}
+
 le_result_t le_gpioPin7_SetEdgeSense (le_gpioPin7_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin7, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -967,7 +1131,7 @@ le_result_t le_gpioPin7_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin8 = {8,"gpio8",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin8 = {8,"gpio8",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin8 = &SysfsGpioPin8;
 
 void gpioPin8_InputMonitorHandlerFunc (int fd, short events)
@@ -1078,6 +1242,29 @@ void le_gpioPin8_RemoveChangeEventHandler(le_gpioPin8_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin8, addHandlerRef);
 }
 
+le_gpioPin8_EdgeBatchEventHandlerRef_t le_gpioPin8_AddEdgeBatchEventHandler
+(
+    le_gpioPin8_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin8_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin8_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin8, gpioPin8_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin8_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin8_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin8, addHandlerRef);
+}
+
 le_result_t le_gpioPin8_SetEdgeSense (le_gpioPin8_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin8, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1101,7 +1288,7 @@ le_result_t le_gpioPin8_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin9 = {9,"gpio9",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin9 = {9,"gpio9",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin9 = &SysfsGpioPin9;
 
 void gpioPin9_InputMonitorHandlerFunc (int fd, short events)
@@ -1212,6 +1399,29 @@ void le_gpioPin9_RemoveChangeEventHandler(le_gpioPin9_ChangeEventHandlerRef_t ad
     gpioSysfs_RemoveChangeCallback(gpioRefPin9, addHandlerRef);
 }
 
+le_gpioPin9_EdgeBatchEventHandlerRef_t le_gpioPin9_AddEdgeBatchEventHandler
+(
+    le_gpioPin9_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin9_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin9_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin9, gpioPin9_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin9_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin9_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin9, addHandlerRef);
+}
+
 le_result_t le_gpioPin9_SetEdgeSense (le_gpioPin9_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin9, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1235,7 +1445,7 @@ le_result_t le_gpioPin9_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin10 = {10,"gpio10",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin10 = {10,"gpio10",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin10 = &SysfsGpioPin10;
 
 void gpioPin10_InputMonitorHandlerFunc (int fd, short events)
@@ -1346,6 +1556,29 @@ void le_gpioPin10_RemoveChangeEventHandler(le_gpioPin10_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin10, addHandlerRef);
 }
 
+le_gpioPin10_EdgeBatchEventHandlerRef_t le_gpioPin10_AddEdgeBatchEventHandler
+(
+    le_gpioPin10_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin10_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin10_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin10, gpioPin10_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin10_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin10_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin10, addHandlerRef);
+}
+
 le_result_t le_gpioPin10_SetEdgeSense (le_gpioPin10_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin10, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1369,7 +1602,7 @@ le_result_t le_gpioPin10_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin11 = {11,"gpio11",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin11 = {11,"gpio11",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin11 = &SysfsGpioPin11;
 
 void gpioPin11_InputMonitorHandlerFunc (int fd, short events)
@@ -1480,6 +1713,29 @@ void le_gpioPin11_RemoveChangeEventHandler(le_gpioPin11_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin11, addHandlerRef);
 }
 
+le_gpioPin11_EdgeBatchEventHandlerRef_t le_gpioPin11_AddEdgeBatchEventHandler
+(
+    le_gpioPin11_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin11_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin11_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin11, gpioPin11_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin11_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin11_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin11, addHandlerRef);
+}
+
 le_result_t le_gpioPin11_SetEdgeSense (le_gpioPin11_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin11, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1503,7 +1759,7 @@ le_result_t le_gpioPin11_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin12 = {12,"gpio12",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin12 = {12,"gpio12",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin12 = &SysfsGpioPin12;
 
 void gpioPin12_InputMonitorHandlerFunc (int fd, short events)
@@ -1614,6 +1870,29 @@ void le_gpioPin12_RemoveChangeEventHandler(le_gpioPin12_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin12, addHandlerRef);
 }
 
+le_gpioPin12_EdgeBatchEventHandlerRef_t le_gpioPin12_AddEdgeBatchEventHandler
+(
+    le_gpioPin12_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin12_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin12_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin12, gpioPin12_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin12_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin12_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin12, addHandlerRef);
+}
+
 le_result_t le_gpioPin12_SetEdgeSense (le_gpioPin12_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin12, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1637,7 +1916,7 @@ le_result_t le_gpioPin12_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin13 = {13,"gpio13",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin13 = {13,"gpio13",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin13 = &SysfsGpioPin13;
 
 void gpioPin13_InputMonitorHandlerFunc (int fd, short events)
@@ -1748,6 +2027,29 @@ void le_gpioPin13_RemoveChangeEventHandler(le_gpioPin13_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin13, addHandlerRef);
 }
 
+le_gpioPin13_EdgeBatchEventHandlerRef_t le_gpioPin13_AddEdgeBatchEventHandler
+(
+    le_gpioPin13_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin13_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin13_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin13, gpioPin13_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin13_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin13_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin13, addHandlerRef);
+}
+
 le_result_t le_gpioPin13_SetEdgeSense (le_gpioPin13_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin13, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1771,7 +2073,7 @@ le_result_t le_gpioPin13_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin14 = {14,"gpio14",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin14 = {14,"gpio14",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin14 = &SysfsGpioPin14;
 
 void gpioPin14_InputMonitorHandlerFunc (int fd, short events)
@@ -1882,6 +2184,29 @@ void le_gpioPin14_RemoveChangeEventHandler(le_gpioPin14_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin14, addHandlerRef);
 }
 
+le_gpioPin14_EdgeBatchEventHandlerRef_t le_gpioPin14_AddEdgeBatchEventHandler
+(
+    le_gpioPin14_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin14_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin14_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin14, gpioPin14_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin14_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin14_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin14, addHandlerRef);
+}
+
 le_result_t le_gpioPin14_SetEdgeSense (le_gpioPin14_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin14, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -1905,7 +2230,7 @@ le_result_t le_gpioPin14_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin15 = {15,"gpio15",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin15 = {15,"gpio15",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin15 = &SysfsGpioPin15;
 
 void gpioPin15_InputMonitorHandlerFunc (int fd, short events)
@@ -2016,6 +2341,29 @@ void le_gpioPin15_RemoveChangeEventHandler(le_gpioPin15_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin15, addHandlerRef);
 }
 
+le_gpioPin15_EdgeBatchEventHandlerRef_t le_gpioPin15_AddEdgeBatchEventHandler
+(
+    le_gpioPin15_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin15_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin15_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin15, gpioPin15_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin15_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin15_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin15, addHandlerRef);
+}
+
 le_result_t le_gpioPin15_SetEdgeSense (le_gpioPin15_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin15, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2039,7 +2387,7 @@ le_result_t le_gpioPin15_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin16 = {16,"gpio16",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin16 = {16,"gpio16",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin16 = &SysfsGpioPin16;
 
 void gpioPin16_InputMonitorHandlerFunc (int fd, short events)
@@ -2150,6 +2498,29 @@ void le_gpioPin16_RemoveChangeEventHandler(le_gpioPin16_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin16, addHandlerRef);
 }
 
+le_gpioPin16_EdgeBatchEventHandlerRef_t le_gpioPin16_AddEdgeBatchEventHandler
+(
+    le_gpioPin16_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin16_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin16_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin16, gpioPin16_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin16_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin16_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin16, addHandlerRef);
+}
+
 le_result_t le_gpioPin16_SetEdgeSense (le_gpioPin16_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin16, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2173,7 +2544,7 @@ le_result_t le_gpioPin16_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin17 = {17,"gpio17",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin17 = {17,"gpio17",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin17 = &SysfsGpioPin17;
 
 void gpioPin17_InputMonitorHandlerFunc (int fd, short events)
@@ -2284,6 +2655,29 @@ void le_gpioPin17_RemoveChangeEventHandler(le_gpioPin17_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin17, addHandlerRef);
 }
 
+le_gpioPin17_EdgeBatchEventHandlerRef_t le_gpioPin17_AddEdgeBatchEventHandler
+(
+    le_gpioPin17_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin17_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin17_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin17, gpioPin17_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin17_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin17_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin17, addHandlerRef);
+}
+
 le_result_t le_gpioPin17_SetEdgeSense (le_gpioPin17_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin17, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2307,7 +2701,7 @@ le_result_t le_gpioPin17_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin18 = {18,"gpio18",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin18 = {18,"gpio18",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin18 = &SysfsGpioPin18;
 
 void gpioPin18_InputMonitorHandlerFunc (int fd, short events)
@@ -2418,6 +2812,29 @@ void le_gpioPin18_RemoveChangeEventHandler(le_gpioPin18_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin18, addHandlerRef);
 }
 
+le_gpioPin18_EdgeBatchEventHandlerRef_t le_gpioPin18_AddEdgeBatchEventHandler
+(
+    le_gpioPin18_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin18_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin18_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin18, gpioPin18_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin18_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin18_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin18, addHandlerRef);
+}
+
 le_result_t le_gpioPin18_SetEdgeSense (le_gpioPin18_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin18, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2441,7 +2858,7 @@ le_result_t le_gpioPin18_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin19 = {19,"gpio19",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin19 = {19,"gpio19",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin19 = &SysfsGpioPin19;
 
 void gpioPin19_InputMonitorHandlerFunc (int fd, short events)
@@ -2552,6 +2969,29 @@ void le_gpioPin19_RemoveChangeEventHandler(le_gpioPin19_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin19, addHandlerRef);
 }
 
+le_gpioPin19_EdgeBatchEventHandlerRef_t le_gpioPin19_AddEdgeBatchEventHandler
+(
+    le_gpioPin19_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin19_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin19_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin19, gpioPin19_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin19_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin19_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin19, addHandlerRef);
+}
+
 le_result_t le_gpioPin19_SetEdgeSense (le_gpioPin19_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin19, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2575,7 +3015,7 @@ le_result_t le_gpioPin19_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin20 = {20,"gpio20",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin20 = {20,"gpio20",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin20 = &SysfsGpioPin20;
 
 void gpioPin20_InputMonitorHandlerFunc (int fd, short events)
@@ -2686,13 +3126,36 @@ void le_gpioPin20_RemoveChangeEventHandler(le_gpioPin20_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin20, addHandlerRef);
 }
 
-le_result_t le_gpioPin20_SetEdgeSense (le_gpioPin20_Edge_t trigger)
+le_gpioPin20_EdgeBatchEventHandlerRef_t le_gpioPin20_AddEdgeBatchEventHandler
+(
+    le_gpioPin20_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin20_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
 {
-    return gpioSysfs_SetEdgeSense(gpioRefPin20, (gpioSysfs_EdgeSensivityMode_t)trigger);
+    return (le_gpioPin20_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin20, gpioPin20_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
 }
 
-le_result_t le_gpioPin20_DisableEdgeSense (void)
-{
+void le_gpioPin20_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin20_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin20, addHandlerRef);
+}
+
+le_result_t le_gpioPin20_SetEdgeSense (le_gpioPin20_Edge_t trigger)
+{
+    return gpioSysfs_SetEdgeSense(gpioRefPin20, (gpioSysfs_EdgeSensivityMode_t)trigger);
+}
+
+le_result_t le_gpioPin20_DisableEdgeSense (void)
+{
     return gpioSysfs_DisableEdgeSense(gpioRefPin20);
 }
 
@@ -2709,7 +3172,7 @@ le_result_t le_gpioPin20_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin21 = {21,"gpio21",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin21 = {21,"gpio21",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin21 = &SysfsGpioPin21;
 
 void gpioPin21_InputMonitorHandlerFunc (int fd, short events)
@@ -2820,6 +3283,29 @@ void le_gpioPin21_RemoveChangeEventHandler(le_gpioPin21_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin21, addHandlerRef);
 }
 
+le_gpioPin21_EdgeBatchEventHandlerRef_t le_gpioPin21_AddEdgeBatchEventHandler
+(
+    le_gpioPin21_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin21_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin21_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin21, gpioPin21_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin21_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin21_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin21, addHandlerRef);
+}
+
 le_result_t le_gpioPin21_SetEdgeSense (le_gpioPin21_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin21, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2843,7 +3329,7 @@ le_result_t le_gpioPin21_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin22 = {22,"gpio22",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin22 = {22,"gpio22",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin22 = &SysfsGpioPin22;
 
 void gpioPin22_InputMonitorHandlerFunc (int fd, short events)
@@ -2954,6 +3440,29 @@ void le_gpioPin22_RemoveChangeEventHandler(le_gpioPin22_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin22, addHandlerRef);
 }
 
+le_gpioPin22_EdgeBatchEventHandlerRef_t le_gpioPin22_AddEdgeBatchEventHandler
+(
+    le_gpioPin22_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin22_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin22_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin22, gpioPin22_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin22_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin22_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin22, addHandlerRef);
+}
+
 le_result_t le_gpioPin22_SetEdgeSense (le_gpioPin22_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin22, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -2977,7 +3486,7 @@ le_result_t le_gpioPin22_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin23 = {23,"gpio23",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin23 = {23,"gpio23",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin23 = &SysfsGpioPin23;
 
 void gpioPin23_InputMonitorHandlerFunc (int fd, short events)
@@ -3088,6 +3597,29 @@ void le_gpioPin23_RemoveChangeEventHandler(le_gpioPin23_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin23, addHandlerRef);
 }
 
+le_gpioPin23_EdgeBatchEventHandlerRef_t le_gpioPin23_AddEdgeBatchEventHandler
+(
+    le_gpioPin23_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin23_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin23_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin23, gpioPin23_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin23_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin23_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin23, addHandlerRef);
+}
+
 le_result_t le_gpioPin23_SetEdgeSense (le_gpioPin23_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin23, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3111,7 +3643,7 @@ le_result_t le_gpioPin23_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin24 = {24,"gpio24",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin24 = {24,"gpio24",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin24 = &SysfsGpioPin24;
 
 void gpioPin24_InputMonitorHandlerFunc (int fd, short events)
@@ -3222,6 +3754,29 @@ void le_gpioPin24_RemoveChangeEventHandler(le_gpioPin24_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin24, addHandlerRef);
 }
 
+le_gpioPin24_EdgeBatchEventHandlerRef_t le_gpioPin24_AddEdgeBatchEventHandler
+(
+    le_gpioPin24_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin24_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin24_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin24, gpioPin24_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin24_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin24_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin24, addHandlerRef);
+}
+
 le_result_t le_gpioPin24_SetEdgeSense (le_gpioPin24_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin24, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3245,7 +3800,7 @@ le_result_t le_gpioPin24_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin25 = {25,"gpio25",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin25 = {25,"gpio25",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin25 = &SysfsGpioPin25;
 
 void gpioPin25_InputMonitorHandlerFunc (int fd, short events)
@@ -3356,6 +3911,29 @@ void le_gpioPin25_RemoveChangeEventHandler(le_gpioPin25_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin25, addHandlerRef);
 }
 
+le_gpioPin25_EdgeBatchEventHandlerRef_t le_gpioPin25_AddEdgeBatchEventHandler
+(
+    le_gpioPin25_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin25_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin25_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin25, gpioPin25_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin25_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin25_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin25, addHandlerRef);
+}
+
 le_result_t le_gpioPin25_SetEdgeSense (le_gpioPin25_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin25, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3379,7 +3957,7 @@ le_result_t le_gpioPin25_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin26 = {26,"gpio26",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin26 = {26,"gpio26",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin26 = &SysfsGpioPin26;
 
 void gpioPin26_InputMonitorHandlerFunc (int fd, short events)
@@ -3490,6 +4068,29 @@ void le_gpioPin26_RemoveChangeEventHandler(le_gpioPin26_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin26, addHandlerRef);
 }
 
+le_gpioPin26_EdgeBatchEventHandlerRef_t le_gpioPin26_AddEdgeBatchEventHandler
+(
+    le_gpioPin26_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin26_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin26_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin26, gpioPin26_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin26_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin26_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin26, addHandlerRef);
+}
+
 le_result_t le_gpioPin26_SetEdgeSense (le_gpioPin26_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin26, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3513,7 +4114,7 @@ le_result_t le_gpioPin26_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin27 = {27,"gpio27",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin27 = {27,"gpio27",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin27 = &SysfsGpioPin27;
 
 void gpioPin27_InputMonitorHandlerFunc (int fd, short events)
@@ -3624,6 +4225,29 @@ void le_gpioPin27_RemoveChangeEventHandler(le_gpioPin27_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin27, addHandlerRef);
 }
 
+le_gpioPin27_EdgeBatchEventHandlerRef_t le_gpioPin27_AddEdgeBatchEventHandler
+(
+    le_gpioPin27_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin27_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin27_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin27, gpioPin27_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin27_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin27_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin27, addHandlerRef);
+}
+
 le_result_t le_gpioPin27_SetEdgeSense (le_gpioPin27_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin27, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3647,7 +4271,7 @@ le_result_t le_gpioPin27_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin28 = {28,"gpio28",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin28 = {28,"gpio28",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin28 = &SysfsGpioPin28;
 
 void gpioPin28_InputMonitorHandlerFunc (int fd, short events)
@@ -3758,6 +4382,29 @@ void le_gpioPin28_RemoveChangeEventHandler(le_gpioPin28_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin28, addHandlerRef);
 }
 
+le_gpioPin28_EdgeBatchEventHandlerRef_t le_gpioPin28_AddEdgeBatchEventHandler
+(
+    le_gpioPin28_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin28_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin28_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin28, gpioPin28_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin28_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin28_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin28, addHandlerRef);
+}
+
 le_result_t le_gpioPin28_SetEdgeSense (le_gpioPin28_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin28, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3781,7 +4428,7 @@ le_result_t le_gpioPin28_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin29 = {29,"gpio29",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin29 = {29,"gpio29",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin29 = &SysfsGpioPin29;
 
 void gpioPin29_InputMonitorHandlerFunc (int fd, short events)
@@ -3892,6 +4539,29 @@ void le_gpioPin29_RemoveChangeEventHandler(le_gpioPin29_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin29, addHandlerRef);
 }
 
+le_gpioPin29_EdgeBatchEventHandlerRef_t le_gpioPin29_AddEdgeBatchEventHandler
+(
+    le_gpioPin29_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin29_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin29_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin29, gpioPin29_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin29_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin29_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin29, addHandlerRef);
+}
+
 le_result_t le_gpioPin29_SetEdgeSense (le_gpioPin29_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin29, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -3915,7 +4585,7 @@ le_result_t le_gpioPin29_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin30 = {30,"gpio30",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin30 = {30,"gpio30",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin30 = &SysfsGpioPin30;
 
 void gpioPin30_InputMonitorHandlerFunc (int fd, short events)
@@ -4026,6 +4696,29 @@ void le_gpioPin30_RemoveChangeEventHandler(le_gpioPin30_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin30, addHandlerRef);
 }
 
+le_gpioPin30_EdgeBatchEventHandlerRef_t le_gpioPin30_AddEdgeBatchEventHandler
+(
+    le_gpioPin30_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin30_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin30_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin30, gpioPin30_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin30_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin30_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin30, addHandlerRef);
+}
+
 le_result_t le_gpioPin30_SetEdgeSense (le_gpioPin30_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin30, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4049,7 +4742,7 @@ le_result_t le_gpioPin30_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin31 = {31,"gpio31",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin31 = {31,"gpio31",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin31 = &SysfsGpioPin31;
 
 void gpioPin31_InputMonitorHandlerFunc (int fd, short events)
@@ -4160,6 +4853,29 @@ void le_gpioPin31_RemoveChangeEventHandler(le_gpioPin31_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin31, addHandlerRef);
 }
 
+le_gpioPin31_EdgeBatchEventHandlerRef_t le_gpioPin31_AddEdgeBatchEventHandler
+(
+    le_gpioPin31_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin31_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin31_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin31, gpioPin31_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin31_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin31_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin31, addHandlerRef);
+}
+
 le_result_t le_gpioPin31_SetEdgeSense (le_gpioPin31_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin31, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4183,7 +4899,7 @@ le_result_t le_gpioPin31_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin32 = {32,"gpio32",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin32 = {32,"gpio32",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin32 = &SysfsGpioPin32;
 
 void gpioPin32_InputMonitorHandlerFunc (int fd, short events)
@@ -4294,6 +5010,29 @@ void le_gpioPin32_RemoveChangeEventHandler(le_gpioPin32_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin32, addHandlerRef);
 }
 
+le_gpioPin32_EdgeBatchEventHandlerRef_t le_gpioPin32_AddEdgeBatchEventHandler
+(
+    le_gpioPin32_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin32_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin32_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin32, gpioPin32_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin32_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin32_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin32, addHandlerRef);
+}
+
 le_result_t le_gpioPin32_SetEdgeSense (le_gpioPin32_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin32, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4317,7 +5056,7 @@ le_result_t le_gpioPin32_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin33 = {33,"gpio33",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin33 = {33,"gpio33",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin33 = &SysfsGpioPin33;
 
 void gpioPin33_InputMonitorHandlerFunc (int fd, short events)
@@ -4428,6 +5167,29 @@ void le_gpioPin33_RemoveChangeEventHandler(le_gpioPin33_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin33, addHandlerRef);
 }
 
+le_gpioPin33_EdgeBatchEventHandlerRef_t le_gpioPin33_AddEdgeBatchEventHandler
+(
+    le_gpioPin33_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin33_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin33_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin33, gpioPin33_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin33_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin33_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin33, addHandlerRef);
+}
+
 le_result_t le_gpioPin33_SetEdgeSense (le_gpioPin33_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin33, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4451,7 +5213,7 @@ le_result_t le_gpioPin33_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin34 = {34,"gpio34",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin34 = {34,"gpio34",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin34 = &SysfsGpioPin34;
 
 void gpioPin34_InputMonitorHandlerFunc (int fd, short events)
@@ -4562,6 +5324,29 @@ void le_gpioPin34_RemoveChangeEventHandler(le_gpioPin34_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin34, addHandlerRef);
 }
 
+le_gpioPin34_EdgeBatchEventHandlerRef_t le_gpioPin34_AddEdgeBatchEventHandler
+(
+    le_gpioPin34_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin34_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin34_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin34, gpioPin34_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin34_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin34_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin34, addHandlerRef);
+}
+
 le_result_t le_gpioPin34_SetEdgeSense (le_gpioPin34_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin34, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4585,7 +5370,7 @@ le_result_t le_gpioPin34_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin35 = {35,"gpio35",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin35 = {35,"gpio35",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin35 = &SysfsGpioPin35;
 
 void gpioPin35_InputMonitorHandlerFunc (int fd, short events)
@@ -4696,6 +5481,29 @@ void le_gpioPin35_RemoveChangeEventHandler(le_gpioPin35_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin35, addHandlerRef);
 }
 
+le_gpioPin35_EdgeBatchEventHandlerRef_t le_gpioPin35_AddEdgeBatchEventHandler
+(
+    le_gpioPin35_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin35_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin35_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin35, gpioPin35_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin35_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin35_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin35, addHandlerRef);
+}
+
 le_result_t le_gpioPin35_SetEdgeSense (le_gpioPin35_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin35, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4719,7 +5527,7 @@ le_result_t le_gpioPin35_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin36 = {36,"gpio36",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin36 = {36,"gpio36",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin36 = &SysfsGpioPin36;
 
 void gpioPin36_InputMonitorHandlerFunc (int fd, short events)
@@ -4830,6 +5638,29 @@ void le_gpioPin36_RemoveChangeEventHandler(le_gpioPin36_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin36, addHandlerRef);
 }
 
+le_gpioPin36_EdgeBatchEventHandlerRef_t le_gpioPin36_AddEdgeBatchEventHandler
+(
+    le_gpioPin36_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin36_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin36_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin36, gpioPin36_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin36_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin36_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin36, addHandlerRef);
+}
+
 le_result_t le_gpioPin36_SetEdgeSense (le_gpioPin36_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin36, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4853,7 +5684,7 @@ le_result_t le_gpioPin36_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin37 = {37,"gpio37",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin37 = {37,"gpio37",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin37 = &SysfsGpioPin37;
 
 void gpioPin37_InputMonitorHandlerFunc (int fd, short events)
@@ -4964,6 +5795,29 @@ void le_gpioPin37_RemoveChangeEventHandler(le_gpioPin37_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin37, addHandlerRef);
 }
 
+le_gpioPin37_EdgeBatchEventHandlerRef_t le_gpioPin37_AddEdgeBatchEventHandler
+(
+    le_gpioPin37_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin37_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin37_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin37, gpioPin37_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin37_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin37_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin37, addHandlerRef);
+}
+
 le_result_t le_gpioPin37_SetEdgeSense (le_gpioPin37_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin37, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -4987,7 +5841,7 @@ le_result_t le_gpioPin37_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin38 = {38,"gpio38",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin38 = {38,"gpio38",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin38 = &SysfsGpioPin38;
 
 void gpioPin38_InputMonitorHandlerFunc (int fd, short events)
@@ -5098,6 +5952,29 @@ void le_gpioPin38_RemoveChangeEventHandler(le_gpioPin38_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin38, addHandlerRef);
 }
 
+le_gpioPin38_EdgeBatchEventHandlerRef_t le_gpioPin38_AddEdgeBatchEventHandler
+(
+    le_gpioPin38_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin38_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin38_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin38, gpioPin38_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin38_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin38_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin38, addHandlerRef);
+}
+
 le_result_t le_gpioPin38_SetEdgeSense (le_gpioPin38_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin38, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5121,7 +5998,7 @@ le_result_t le_gpioPin38_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin39 = {39,"gpio39",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin39 = {39,"gpio39",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin39 = &SysfsGpioPin39;
 
 void gpioPin39_InputMonitorHandlerFunc (int fd, short events)
@@ -5232,6 +6109,29 @@ void le_gpioPin39_RemoveChangeEventHandler(le_gpioPin39_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin39, addHandlerRef);
 }
 
+le_gpioPin39_EdgeBatchEventHandlerRef_t le_gpioPin39_AddEdgeBatchEventHandler
+(
+    le_gpioPin39_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin39_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin39_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin39, gpioPin39_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin39_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin39_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin39, addHandlerRef);
+}
+
 le_result_t le_gpioPin39_SetEdgeSense (le_gpioPin39_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin39, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5255,7 +6155,7 @@ le_result_t le_gpioPin39_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin40 = {40,"gpio40",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin40 = {40,"gpio40",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin40 = &SysfsGpioPin40;
 
 void gpioPin40_InputMonitorHandlerFunc (int fd, short events)
@@ -5366,6 +6266,29 @@ void le_gpioPin40_RemoveChangeEventHandler(le_gpioPin40_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin40, addHandlerRef);
 }
 
+le_gpioPin40_EdgeBatchEventHandlerRef_t le_gpioPin40_AddEdgeBatchEventHandler
+(
+    le_gpioPin40_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin40_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin40_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin40, gpioPin40_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin40_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin40_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin40, addHandlerRef);
+}
+
 le_result_t le_gpioPin40_SetEdgeSense (le_gpioPin40_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin40, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5389,7 +6312,7 @@ le_result_t le_gpioPin40_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin41 = {41,"gpio41",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin41 = {41,"gpio41",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin41 = &SysfsGpioPin41;
 
 void gpioPin41_InputMonitorHandlerFunc (int fd, short events)
@@ -5500,6 +6423,29 @@ void le_gpioPin41_RemoveChangeEventHandler(le_gpioPin41_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin41, addHandlerRef);
 }
 
+le_gpioPin41_EdgeBatchEventHandlerRef_t le_gpioPin41_AddEdgeBatchEventHandler
+(
+    le_gpioPin41_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin41_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin41_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin41, gpioPin41_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin41_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin41_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin41, addHandlerRef);
+}
+
 le_result_t le_gpioPin41_SetEdgeSense (le_gpioPin41_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin41, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5523,7 +6469,7 @@ le_result_t le_gpioPin41_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin42 = {42,"gpio42",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin42 = {42,"gpio42",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin42 = &SysfsGpioPin42;
 
 void gpioPin42_InputMonitorHandlerFunc (int fd, short events)
@@ -5634,6 +6580,29 @@ void le_gpioPin42_RemoveChangeEventHandler(le_gpioPin42_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin42, addHandlerRef);
 }
 
+le_gpioPin42_EdgeBatchEventHandlerRef_t le_gpioPin42_AddEdgeBatchEventHandler
+(
+    le_gpioPin42_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin42_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin42_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin42, gpioPin42_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin42_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin42_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin42, addHandlerRef);
+}
+
 le_result_t le_gpioPin42_SetEdgeSense (le_gpioPin42_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin42, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5657,7 +6626,7 @@ le_result_t le_gpioPin42_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin43 = {43,"gpio43",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin43 = {43,"gpio43",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin43 = &SysfsGpioPin43;
 
 void gpioPin43_InputMonitorHandlerFunc (int fd, short events)
@@ -5768,6 +6737,29 @@ void le_gpioPin43_RemoveChangeEventHandler(le_gpioPin43_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin43, addHandlerRef);
 }
 
+le_gpioPin43_EdgeBatchEventHandlerRef_t le_gpioPin43_AddEdgeBatchEventHandler
+(
+    le_gpioPin43_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin43_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin43_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin43, gpioPin43_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin43_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin43_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin43, addHandlerRef);
+}
+
 le_result_t le_gpioPin43_SetEdgeSense (le_gpioPin43_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin43, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5791,7 +6783,7 @@ le_result_t le_gpioPin43_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin44 = {44,"gpio44",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin44 = {44,"gpio44",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin44 = &SysfsGpioPin44;
 
 void gpioPin44_InputMonitorHandlerFunc (int fd, short events)
@@ -5902,6 +6894,29 @@ void le_gpioPin44_RemoveChangeEventHandler(le_gpioPin44_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin44, addHandlerRef);
 }
 
+le_gpioPin44_EdgeBatchEventHandlerRef_t le_gpioPin44_AddEdgeBatchEventHandler
+(
+    le_gpioPin44_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin44_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin44_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin44, gpioPin44_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin44_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin44_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin44, addHandlerRef);
+}
+
 le_result_t le_gpioPin44_SetEdgeSense (le_gpioPin44_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin44, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -5925,7 +6940,7 @@ le_result_t le_gpioPin44_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin45 = {45,"gpio45",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin45 = {45,"gpio45",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin45 = &SysfsGpioPin45;
 
 void gpioPin45_InputMonitorHandlerFunc (int fd, short events)
@@ -6018,20 +7033,43 @@ le_gpioPin45_PullUpDown_t le_gpioPin45_GetPullUpDown (void)
     return (le_gpioPin45_PullUpDown_t)gpioSysfs_GetPullUpDown(gpioRefPin45);
 }
 
-le_gpioPin45_ChangeEventHandlerRef_t le_gpioPin45_AddChangeEventHandler
+le_gpioPin45_ChangeEventHandlerRef_t le_gpioPin45_AddChangeEventHandler
+(
+    le_gpioPin45_Edge_t trigger,
+    le_gpioPin45_ChangeCallbackFunc_t handlerPtr,
+    void* contextPtr,
+    int32_t sampleMs
+)
+{
+    return (le_gpioPin45_ChangeEventHandlerRef_t)gpioSysfs_SetChangeCallback(
+                gpioRefPin45, gpioPin45_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, handlerPtr, contextPtr, sampleMs);
+}
+
+void le_gpioPin45_RemoveChangeEventHandler(le_gpioPin45_ChangeEventHandlerRef_t addHandlerRef)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin45, addHandlerRef);
+}
+
+le_gpioPin45_EdgeBatchEventHandlerRef_t le_gpioPin45_AddEdgeBatchEventHandler
 (
     le_gpioPin45_Edge_t trigger,
-    le_gpioPin45_ChangeCallbackFunc_t handlerPtr,
-    void* contextPtr,
-    int32_t sampleMs
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin45_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
 )
 {
-    return (le_gpioPin45_ChangeEventHandlerRef_t)gpioSysfs_SetChangeCallback(
+    return (le_gpioPin45_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
                 gpioRefPin45, gpioPin45_InputMonitorHandlerFunc,
-                (gpioSysfs_EdgeSensivityMode_t)trigger, handlerPtr, contextPtr, sampleMs);
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
 }
 
-void le_gpioPin45_RemoveChangeEventHandler(le_gpioPin45_ChangeEventHandlerRef_t addHandlerRef)
+void le_gpioPin45_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin45_EdgeBatchEventHandlerRef_t addHandlerRef
+)
 {
     gpioSysfs_RemoveChangeCallback(gpioRefPin45, addHandlerRef);
 }
@@ -6059,7 +7097,7 @@ le_result_t le_gpioPin45_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin46 = {46,"gpio46",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin46 = {46,"gpio46",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin46 = &SysfsGpioPin46;
 
 void gpioPin46_InputMonitorHandlerFunc (int fd, short events)
@@ -6170,6 +7208,29 @@ void le_gpioPin46_RemoveChangeEventHandler(le_gpioPin46_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin46, addHandlerRef);
 }
 
+le_gpioPin46_EdgeBatchEventHandlerRef_t le_gpioPin46_AddEdgeBatchEventHandler
+(
+    le_gpioPin46_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin46_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin46_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin46, gpioPin46_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin46_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin46_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin46, addHandlerRef);
+}
+
 le_result_t le_gpioPin46_SetEdgeSense (le_gpioPin46_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin46, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6193,7 +7254,7 @@ le_result_t le_gpioPin46_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin47 = {47,"gpio47",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin47 = {47,"gpio47",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin47 = &SysfsGpioPin47;
 
 void gpioPin47_InputMonitorHandlerFunc (int fd, short events)
@@ -6304,6 +7365,29 @@ void le_gpioPin47_RemoveChangeEventHandler(le_gpioPin47_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin47, addHandlerRef);
 }
 
+le_gpioPin47_EdgeBatchEventHandlerRef_t le_gpioPin47_AddEdgeBatchEventHandler
+(
+    le_gpioPin47_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin47_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin47_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin47, gpioPin47_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin47_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin47_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin47, addHandlerRef);
+}
+
 le_result_t le_gpioPin47_SetEdgeSense (le_gpioPin47_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin47, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6327,7 +7411,7 @@ le_result_t le_gpioPin47_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin48 = {48,"gpio48",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin48 = {48,"gpio48",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin48 = &SysfsGpioPin48;
 
 void gpioPin48_InputMonitorHandlerFunc (int fd, short events)
@@ -6438,6 +7522,29 @@ void le_gpioPin48_RemoveChangeEventHandler(le_gpioPin48_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin48, addHandlerRef);
 }
 
+le_gpioPin48_EdgeBatchEventHandlerRef_t le_gpioPin48_AddEdgeBatchEventHandler
+(
+    le_gpioPin48_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin48_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin48_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin48, gpioPin48_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin48_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin48_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin48, addHandlerRef);
+}
+
 le_result_t le_gpioPin48_SetEdgeSense (le_gpioPin48_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin48, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6461,7 +7568,7 @@ le_result_t le_gpioPin48_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin49 = {49,"gpio49",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin49 = {49,"gpio49",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin49 = &SysfsGpioPin49;
 
 void gpioPin49_InputMonitorHandlerFunc (int fd, short events)
@@ -6572,6 +7679,29 @@ void le_gpioPin49_RemoveChangeEventHandler(le_gpioPin49_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin49, addHandlerRef);
 }
 
+le_gpioPin49_EdgeBatchEventHandlerRef_t le_gpioPin49_AddEdgeBatchEventHandler
+(
+    le_gpioPin49_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin49_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin49_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin49, gpioPin49_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin49_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin49_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin49, addHandlerRef);
+}
+
 le_result_t le_gpioPin49_SetEdgeSense (le_gpioPin49_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin49, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6595,7 +7725,7 @@ le_result_t le_gpioPin49_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin50 = {50,"gpio50",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin50 = {50,"gpio50",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin50 = &SysfsGpioPin50;
 
 void gpioPin50_InputMonitorHandlerFunc (int fd, short events)
@@ -6706,6 +7836,29 @@ void le_gpioPin50_RemoveChangeEventHandler(le_gpioPin50_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin50, addHandlerRef);
 }
 
+le_gpioPin50_EdgeBatchEventHandlerRef_t le_gpioPin50_AddEdgeBatchEventHandler
+(
+    le_gpioPin50_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin50_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin50_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin50, gpioPin50_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin50_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin50_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin50, addHandlerRef);
+}
+
 le_result_t le_gpioPin50_SetEdgeSense (le_gpioPin50_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin50, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6729,7 +7882,7 @@ le_result_t le_gpioPin50_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin51 = {51,"gpio51",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin51 = {51,"gpio51",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin51 = &SysfsGpioPin51;
 
 void gpioPin51_InputMonitorHandlerFunc (int fd, short events)
@@ -6840,6 +7993,29 @@ void le_gpioPin51_RemoveChangeEventHandler(le_gpioPin51_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin51, addHandlerRef);
 }
 
+le_gpioPin51_EdgeBatchEventHandlerRef_t le_gpioPin51_AddEdgeBatchEventHandler
+(
+    le_gpioPin51_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin51_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin51_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin51, gpioPin51_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin51_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin51_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin51, addHandlerRef);
+}
+
 le_result_t le_gpioPin51_SetEdgeSense (le_gpioPin51_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin51, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6863,7 +8039,7 @@ le_result_t le_gpioPin51_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin52 = {52,"gpio52",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin52 = {52,"gpio52",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin52 = &SysfsGpioPin52;
 
 void gpioPin52_InputMonitorHandlerFunc (int fd, short events)
@@ -6974,6 +8150,29 @@ void le_gpioPin52_RemoveChangeEventHandler(le_gpioPin52_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin52, addHandlerRef);
 }
 
+le_gpioPin52_EdgeBatchEventHandlerRef_t le_gpioPin52_AddEdgeBatchEventHandler
+(
+    le_gpioPin52_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin52_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin52_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin52, gpioPin52_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin52_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin52_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin52, addHandlerRef);
+}
+
 le_result_t le_gpioPin52_SetEdgeSense (le_gpioPin52_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin52, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -6997,7 +8196,7 @@ le_result_t le_gpioPin52_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin53 = {53,"gpio53",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin53 = {53,"gpio53",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin53 = &SysfsGpioPin53;
 
 void gpioPin53_InputMonitorHandlerFunc (int fd, short events)
@@ -7108,6 +8307,29 @@ void le_gpioPin53_RemoveChangeEventHandler(le_gpioPin53_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin53, addHandlerRef);
 }
 
+le_gpioPin53_EdgeBatchEventHandlerRef_t le_gpioPin53_AddEdgeBatchEventHandler
+(
+    le_gpioPin53_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin53_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin53_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin53, gpioPin53_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin53_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin53_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin53, addHandlerRef);
+}
+
 le_result_t le_gpioPin53_SetEdgeSense (le_gpioPin53_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin53, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7131,7 +8353,7 @@ le_result_t le_gpioPin53_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin54 = {54,"gpio54",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin54 = {54,"gpio54",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin54 = &SysfsGpioPin54;
 
 void gpioPin54_InputMonitorHandlerFunc (int fd, short events)
@@ -7242,6 +8464,29 @@ void le_gpioPin54_RemoveChangeEventHandler(le_gpioPin54_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin54, addHandlerRef);
 }
 
+le_gpioPin54_EdgeBatchEventHandlerRef_t le_gpioPin54_AddEdgeBatchEventHandler
+(
+    le_gpioPin54_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin54_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin54_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin54, gpioPin54_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin54_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin54_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin54, addHandlerRef);
+}
+
 le_result_t le_gpioPin54_SetEdgeSense (le_gpioPin54_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin54, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7265,7 +8510,7 @@ le_result_t le_gpioPin54_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin55 = {55,"gpio55",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin55 = {55,"gpio55",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin55 = &SysfsGpioPin55;
 
 void gpioPin55_InputMonitorHandlerFunc (int fd, short events)
@@ -7376,6 +8621,29 @@ void le_gpioPin55_RemoveChangeEventHandler(le_gpioPin55_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin55, addHandlerRef);
 }
 
+le_gpioPin55_EdgeBatchEventHandlerRef_t le_gpioPin55_AddEdgeBatchEventHandler
+(
+    le_gpioPin55_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin55_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin55_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin55, gpioPin55_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin55_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin55_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin55, addHandlerRef);
+}
+
 le_result_t le_gpioPin55_SetEdgeSense (le_gpioPin55_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin55, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7399,7 +8667,7 @@ le_result_t le_gpioPin55_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin56 = {56,"gpio56",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin56 = {56,"gpio56",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin56 = &SysfsGpioPin56;
 
 void gpioPin56_InputMonitorHandlerFunc (int fd, short events)
@@ -7510,6 +8778,29 @@ void le_gpioPin56_RemoveChangeEventHandler(le_gpioPin56_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin56, addHandlerRef);
 }
 
+le_gpioPin56_EdgeBatchEventHandlerRef_t le_gpioPin56_AddEdgeBatchEventHandler
+(
+    le_gpioPin56_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin56_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin56_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin56, gpioPin56_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin56_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin56_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin56, addHandlerRef);
+}
+
 le_result_t le_gpioPin56_SetEdgeSense (le_gpioPin56_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin56, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7533,7 +8824,7 @@ le_result_t le_gpioPin56_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin57 = {57,"gpio57",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin57 = {57,"gpio57",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin57 = &SysfsGpioPin57;
 
 void gpioPin57_InputMonitorHandlerFunc (int fd, short events)
@@ -7644,6 +8935,29 @@ void le_gpioPin57_RemoveChangeEventHandler(le_gpioPin57_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin57, addHandlerRef);
 }
 
+le_gpioPin57_EdgeBatchEventHandlerRef_t le_gpioPin57_AddEdgeBatchEventHandler
+(
+    le_gpioPin57_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin57_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin57_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin57, gpioPin57_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin57_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin57_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin57, addHandlerRef);
+}
+
 le_result_t le_gpioPin57_SetEdgeSense (le_gpioPin57_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin57, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7667,7 +8981,7 @@ le_result_t le_gpioPin57_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin58 = {58,"gpio58",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin58 = {58,"gpio58",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin58 = &SysfsGpioPin58;
 
 void gpioPin58_InputMonitorHandlerFunc (int fd, short events)
@@ -7778,6 +9092,29 @@ void le_gpioPin58_RemoveChangeEventHandler(le_gpioPin58_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin58, addHandlerRef);
 }
 
+le_gpioPin58_EdgeBatchEventHandlerRef_t le_gpioPin58_AddEdgeBatchEventHandler
+(
+    le_gpioPin58_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin58_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin58_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin58, gpioPin58_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin58_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin58_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin58, addHandlerRef);
+}
+
 le_result_t le_gpioPin58_SetEdgeSense (le_gpioPin58_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin58, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7801,7 +9138,7 @@ le_result_t le_gpioPin58_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin59 = {59,"gpio59",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin59 = {59,"gpio59",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin59 = &SysfsGpioPin59;
 
 void gpioPin59_InputMonitorHandlerFunc (int fd, short events)
@@ -7912,6 +9249,29 @@ void le_gpioPin59_RemoveChangeEventHandler(le_gpioPin59_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin59, addHandlerRef);
 }
 
+le_gpioPin59_EdgeBatchEventHandlerRef_t le_gpioPin59_AddEdgeBatchEventHandler
+(
+    le_gpioPin59_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin59_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin59_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin59, gpioPin59_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin59_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin59_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin59, addHandlerRef);
+}
+
 le_result_t le_gpioPin59_SetEdgeSense (le_gpioPin59_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin59, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -7935,7 +9295,7 @@ le_result_t le_gpioPin59_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin60 = {60,"gpio60",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin60 = {60,"gpio60",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin60 = &SysfsGpioPin60;
 
 void gpioPin60_InputMonitorHandlerFunc (int fd, short events)
@@ -8046,6 +9406,29 @@ void le_gpioPin60_RemoveChangeEventHandler(le_gpioPin60_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin60, addHandlerRef);
 }
 
+le_gpioPin60_EdgeBatchEventHandlerRef_t le_gpioPin60_AddEdgeBatchEventHandler
+(
+    le_gpioPin60_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin60_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin60_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin60, gpioPin60_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin60_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin60_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin60, addHandlerRef);
+}
+
 le_result_t le_gpioPin60_SetEdgeSense (le_gpioPin60_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin60, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -8069,7 +9452,7 @@ le_result_t le_gpioPin60_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin61 = {61,"gpio61",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin61 = {61,"gpio61",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin61 = &SysfsGpioPin61;
 
 void gpioPin61_InputMonitorHandlerFunc (int fd, short events)
@@ -8180,6 +9563,29 @@ void le_gpioPin61_RemoveChangeEventHandler(le_gpioPin61_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin61, addHandlerRef);
 }
 
+le_gpioPin61_EdgeBatchEventHandlerRef_t le_gpioPin61_AddEdgeBatchEventHandler
+(
+    le_gpioPin61_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin61_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin61_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin61, gpioPin61_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin61_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin61_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin61, addHandlerRef);
+}
+
 le_result_t le_gpioPin61_SetEdgeSense (le_gpioPin61_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin61, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -8203,7 +9609,7 @@ le_result_t le_gpioPin61_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin62 = {62,"gpio62",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin62 = {62,"gpio62",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin62 = &SysfsGpioPin62;
 
 void gpioPin62_InputMonitorHandlerFunc (int fd, short events)
@@ -8314,6 +9720,29 @@ void le_gpioPin62_RemoveChangeEventHandler(le_gpioPin62_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin62, addHandlerRef);
 }
 
+le_gpioPin62_EdgeBatchEventHandlerRef_t le_gpioPin62_AddEdgeBatchEventHandler
+(
+    le_gpioPin62_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin62_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin62_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin62, gpioPin62_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin62_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin62_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin62, addHandlerRef);
+}
+
 le_result_t le_gpioPin62_SetEdgeSense (le_gpioPin62_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin62, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -8337,7 +9766,7 @@ le_result_t le_gpioPin62_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin63 = {63,"gpio63",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin63 = {63,"gpio63",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin63 = &SysfsGpioPin63;
 
 void gpioPin63_InputMonitorHandlerFunc (int fd, short events)
@@ -8448,6 +9877,29 @@ void le_gpioPin63_RemoveChangeEventHandler(le_gpioPin63_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin63, addHandlerRef);
 }
 
+le_gpioPin63_EdgeBatchEventHandlerRef_t le_gpioPin63_AddEdgeBatchEventHandler
+(
+    le_gpioPin63_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin63_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin63_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin63, gpioPin63_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin63_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin63_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin63, addHandlerRef);
+}
+
 le_result_t le_gpioPin63_SetEdgeSense (le_gpioPin63_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin63, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -8471,7 +9923,7 @@ le_result_t le_gpioPin63_DisableEdgeSense (void)
  */
 //--------------------------------------------------------------------------------------------------
 
-static struct gpioSysfs_Gpio SysfsGpioPin64 = {64,"gpio64",false,NULL,NULL,NULL,NULL};
+static struct gpioSysfs_Gpio SysfsGpioPin64 = {64,"gpio64",false,NULL,NULL,NULL,NULL,NULL};
 static gpioSysfs_GpioRef_t gpioRefPin64 = &SysfsGpioPin64;
 
 void gpioPin64_InputMonitorHandlerFunc (int fd, short events)
@@ -8582,6 +10034,29 @@ void le_gpioPin64_RemoveChangeEventHandler(le_gpioPin64_ChangeEventHandlerRef_t
     gpioSysfs_RemoveChangeCallback(gpioRefPin64, addHandlerRef);
 }
 
+le_gpioPin64_EdgeBatchEventHandlerRef_t le_gpioPin64_AddEdgeBatchEventHandler
+(
+    le_gpioPin64_Edge_t trigger,
+    uint32_t debounceUs,
+    uint32_t batchPeriodMs,
+    le_gpioPin64_EdgeBatchCallbackFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    return (le_gpioPin64_EdgeBatchEventHandlerRef_t)gpioSysfs_SetEdgeBatchCallback(
+                gpioRefPin64, gpioPin64_InputMonitorHandlerFunc,
+                (gpioSysfs_EdgeSensivityMode_t)trigger, debounceUs, batchPeriodMs,
+                (gpioSysfs_EdgeBatchCallbackFunc_t)handlerPtr, contextPtr);
+}
+
+void le_gpioPin64_RemoveEdgeBatchEventHandler
+(
+    le_gpioPin64_EdgeBatchEventHandlerRef_t addHandlerRef
+)
+{
+    gpioSysfs_RemoveChangeCallback(gpioRefPin64, addHandlerRef);
+}
+
 le_result_t le_gpioPin64_SetEdgeSense (le_gpioPin64_Edge_t trigger)
 {
     return gpioSysfs_SetEdgeSense(gpioRefPin64, (gpioSysfs_EdgeSensivityMode_t)trigger);
@@ -110,6 +110,49 @@ typedef enum
 gpioSysfs_EdgeSensivityMode_t;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of edges delivered in a single batch. Must match MAX_EDGE_BATCH in le_gpio.api.
+ */
+//--------------------------------------------------------------------------------------------------
+#define GPIOSYSFS_MAX_EDGE_BATCH    32
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timestamped edge. Same layout as the EdgeEvent structure of le_gpio.api.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t timestampNs;                   ///< Monotonic time of the edge (ns)
+    gpioSysfs_EdgeSensivityMode_t edge;     ///< SYSFS_EDGE_SENSE_RISING or SYSFS_EDGE_SENSE_FALLING
+}
+gpioSysfs_EdgeEvent_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Edge batch handler (callback).
+ *
+ * @param eventsPtr
+ *        Edges, oldest first.
+ * @param eventsCount
+ *        Number of edges.
+ * @param droppedCount
+ *        Edges lost since the previous batch.
+ * @param contextPtr
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*gpioSysfs_EdgeBatchCallbackFunc_t)
+(
+    const gpioSysfs_EdgeEvent_t* eventsPtr,
+    size_t eventsCount,
+    uint32_t droppedCount,
+    void* contextPtr
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The operation of GPIO open drain
@@ -290,6 +333,25 @@ void* gpioSysfs_SetChangeCallback
     int32_t sampleMs                              ///< [IN] If not interrupt capable, sample this often (ms).
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set an edge batch callback on a particular pin. The edge batch callback and the change callback
+ * share the pin interrupt, so only one of them can be set at a time.
+ *
+ * @return This will return a reference.
+ */
+//--------------------------------------------------------------------------------------------------
+void* gpioSysfs_SetEdgeBatchCallback
+(
+    gpioSysfs_GpioRef_t gpioRef,                    ///< [IN] GPIO object reference
+    le_fdMonitor_HandlerFunc_t fdMonFunc,           ///< [IN] The fd monitor function
+    gpioSysfs_EdgeSensivityMode_t edge,             ///< [IN] Edge(s) that should be reported
+    uint32_t debounceUs,                            ///< [IN] Time the input must be stable (us)
+    uint32_t batchPeriodMs,                         ///< [IN] Longest time an edge is held (ms)
+    gpioSysfs_EdgeBatchCallbackFunc_t handlerPtr,   ///< [IN] The edge batch callback
+    void* contextPtr                                ///< [IN] A context pointer
+);
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Remove a change callback on a particular pin
@@ -473,6 +535,7 @@ struct gpioSysfs_Gpio {
     void *callbackContextPtr;                     ///< Client context to be passed back
     le_fdMonitor_Ref_t fdMonitor;                 ///< fdMonitor Object associated to this GPIO
     le_msg_SessionRef_t currentSession;           ///< Current valid IPC session for this pin
+    struct gpioSysfsEdge_Filter* edgeFilterPtr;   ///< Edge batching, if an edge handler is set
 };
 
 
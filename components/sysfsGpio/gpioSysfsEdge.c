@@ -0,0 +1,306 @@
+/**
+ * @file gpioSysfsEdge.c
+ *
+ * Edge filter of the sysfs GPIO service.
+ *
+ * The kernel only tells that the value of a pin changed: the edge detection is therefore set to
+ * both edges and the state read after each interrupt is compared with the last reported state.
+ * Reading twice the same state means that the pin toggled back before it could be read, those two
+ * edges are accounted as dropped.
+ *
+ * When debouncing is requested, a change of state is only reported once no other interrupt was
+ * seen for the debounce time, with the timestamp of the first edge of the burst. Reported edges
+ * matching the requested trigger are queued and the queue is delivered to the client in a single
+ * call, when it is full or when the batch period expires.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "gpioSysfsEdge.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Expected number of edge filters, one per GPIO at most.
+ */
+//--------------------------------------------------------------------------------------------------
+#define EDGE_FILTER_POOL_SIZE   4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the timer names, including the null-terminator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define TIMER_NAME_BYTES        32
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Edge filter.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct gpioSysfsEdge_Filter
+{
+    gpioSysfs_EdgeSensivityMode_t trigger;          ///< Edge(s) to report
+    uint32_t batchPeriodMs;                         ///< Longest time an edge is held (ms)
+    gpioSysfs_EdgeBatchCallbackFunc_t handlerPtr;   ///< Batch handler
+    void* contextPtr;                               ///< Context pointer for the handler
+    bool state;                                     ///< Last reported state
+    bool pendingState;                              ///< State waiting for the debounce time
+    uint64_t pendingTimestampNs;                    ///< Time of the first edge of the burst (ns)
+    le_timer_Ref_t debounceTimer;                   ///< Debounce timer, NULL without debouncing
+    le_timer_Ref_t batchTimer;                      ///< Batch period timer
+    uint32_t droppedCount;                          ///< Edges lost since the last batch
+    size_t eventCount;                              ///< Number of queued edges
+    gpioSysfs_EdgeEvent_t events[GPIOSYSFS_MAX_EDGE_BATCH];    ///< Queued edges
+}
+EdgeFilter_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of edge filters.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t EdgeFilterPool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deliver the queued edges to the client.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FlushBatch
+(
+    EdgeFilter_t* filterPtr     ///< [IN] Edge filter
+)
+{
+    le_timer_Stop(filterPtr->batchTimer);
+
+    if ((filterPtr->eventCount == 0) && (filterPtr->droppedCount == 0))
+    {
+        return;
+    }
+
+    LE_DEBUG("Delivering %zu edges, %" PRIu32 " dropped",
+             filterPtr->eventCount, filterPtr->droppedCount);
+
+    filterPtr->handlerPtr(filterPtr->events, filterPtr->eventCount, filterPtr->droppedCount,
+                          filterPtr->contextPtr);
+
+    filterPtr->eventCount = 0;
+    filterPtr->droppedCount = 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Batch period expiry handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void BatchTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Batch timer
+)
+{
+    FlushBatch(le_timer_GetContextPtr(timerRef));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Schedule the delivery of the queued edges according to the batch period.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ScheduleBatch
+(
+    EdgeFilter_t* filterPtr     ///< [IN] Edge filter
+)
+{
+    if ((filterPtr->eventCount == GPIOSYSFS_MAX_EDGE_BATCH) || (filterPtr->batchPeriodMs == 0))
+    {
+        FlushBatch(filterPtr);
+    }
+    else if (!le_timer_IsRunning(filterPtr->batchTimer))
+    {
+        le_timer_Start(filterPtr->batchTimer);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report a change of state of the pin, queuing the edge if it matches the trigger.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportEdge
+(
+    EdgeFilter_t* filterPtr,    ///< [IN] Edge filter
+    bool state,                 ///< [IN] New state
+    uint64_t timestampNs        ///< [IN] Time of the edge (ns)
+)
+{
+    gpioSysfs_EdgeSensivityMode_t edge = state ? SYSFS_EDGE_SENSE_RISING : SYSFS_EDGE_SENSE_FALLING;
+
+    filterPtr->state = state;
+
+    if ((filterPtr->trigger != SYSFS_EDGE_SENSE_BOTH) && (filterPtr->trigger != edge))
+    {
+        return;
+    }
+
+    // The queue is flushed as soon as it is full, so there is always room here.
+    filterPtr->events[filterPtr->eventCount].timestampNs = timestampNs;
+    filterPtr->events[filterPtr->eventCount].edge = edge;
+    filterPtr->eventCount++;
+
+    ScheduleBatch(filterPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Account for a pulse which was too short to be seen by the service.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportLostPulse
+(
+    EdgeFilter_t* filterPtr     ///< [IN] Edge filter
+)
+{
+    // A pulse is made of a rising and a falling edge.
+    filterPtr->droppedCount += (filterPtr->trigger == SYSFS_EDGE_SENSE_BOTH) ? 2 : 1;
+
+    ScheduleBatch(filterPtr);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Debounce time expiry handler: the pin has been stable for the debounce time.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DebounceTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Debounce timer
+)
+{
+    EdgeFilter_t* filterPtr = le_timer_GetContextPtr(timerRef);
+
+    // A burst ending on the reported state is a glitch and is filtered out.
+    if (filterPtr->pendingState != filterPtr->state)
+    {
+        ReportEdge(filterPtr, filterPtr->pendingState, filterPtr->pendingTimestampNs);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the edge filter module. Must be called once before any filter is created.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Init
+(
+    void
+)
+{
+    EdgeFilterPool = le_mem_CreatePool("GpioEdgeFilterPool", sizeof(EdgeFilter_t));
+    le_mem_ExpandPool(EdgeFilterPool, EDGE_FILTER_POOL_SIZE);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an edge filter.
+ *
+ * @return The edge filter reference.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioSysfsEdge_FilterRef_t gpioSysfsEdge_Create
+(
+    const char* gpioName,                           ///< [IN] GPIO name, used to name the timers
+    bool initialState,                              ///< [IN] Current state of the pin
+    gpioSysfs_EdgeSensivityMode_t trigger,          ///< [IN] Edge(s) to report
+    uint32_t debounceUs,                            ///< [IN] Time the input must be stable (us)
+    uint32_t batchPeriodMs,                         ///< [IN] Longest time an edge is held (ms)
+    gpioSysfs_EdgeBatchCallbackFunc_t handlerPtr,   ///< [IN] Batch handler
+    void* contextPtr                                ///< [IN] Context pointer for the handler
+)
+{
+    EdgeFilter_t* filterPtr = le_mem_ForceAlloc(EdgeFilterPool);
+    char timerName[TIMER_NAME_BYTES];
+
+    memset(filterPtr, 0, sizeof(EdgeFilter_t));
+    filterPtr->trigger = trigger;
+    filterPtr->batchPeriodMs = batchPeriodMs;
+    filterPtr->handlerPtr = handlerPtr;
+    filterPtr->contextPtr = contextPtr;
+    filterPtr->state = initialState;
+    filterPtr->pendingState = initialState;
+
+    if (debounceUs != 0)
+    {
+        le_clk_Time_t debounce = { .sec = debounceUs / 1000000, .usec = debounceUs % 1000000 };
+
+        snprintf(timerName, sizeof(timerName), "%sDebounce", gpioName);
+        filterPtr->debounceTimer = le_timer_Create(timerName);
+        le_timer_SetInterval(filterPtr->debounceTimer, debounce);
+        le_timer_SetHandler(filterPtr->debounceTimer, DebounceTimerHandler);
+        le_timer_SetContextPtr(filterPtr->debounceTimer, filterPtr);
+    }
+
+    snprintf(timerName, sizeof(timerName), "%sBatch", gpioName);
+    filterPtr->batchTimer = le_timer_Create(timerName);
+    le_timer_SetMsInterval(filterPtr->batchTimer, batchPeriodMs);
+    le_timer_SetHandler(filterPtr->batchTimer, BatchTimerHandler);
+    le_timer_SetContextPtr(filterPtr->batchTimer, filterPtr);
+
+    return filterPtr;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete an edge filter. The edges not delivered yet are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Delete
+(
+    gpioSysfsEdge_FilterRef_t filterRef             ///< [IN] Edge filter reference
+)
+{
+    if (filterRef->debounceTimer != NULL)
+    {
+        le_timer_Delete(filterRef->debounceTimer);
+    }
+    le_timer_Delete(filterRef->batchTimer);
+
+    le_mem_Release(filterRef);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the state read after an edge interrupt.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Report
+(
+    gpioSysfsEdge_FilterRef_t filterRef,            ///< [IN] Edge filter reference
+    bool state,                                     ///< [IN] State read from the pin
+    uint64_t timestampNs                            ///< [IN] Monotonic time of the interrupt (ns)
+)
+{
+    if (filterRef->debounceTimer == NULL)
+    {
+        if (state != filterRef->state)
+        {
+            ReportEdge(filterRef, state, timestampNs);
+        }
+        else
+        {
+            ReportLostPulse(filterRef);
+        }
+        return;
+    }
+
+    // Any edge during the debounce time restarts it, the burst keeps the time of its first edge.
+    if (!le_timer_IsRunning(filterRef->debounceTimer))
+    {
+        filterRef->pendingTimestampNs = timestampNs;
+    }
+    filterRef->pendingState = state;
+    le_timer_Restart(filterRef->debounceTimer);
+}
@@ -0,0 +1,74 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Edge filter of the sysfs GPIO service: debounces the edges seen on an input pin, filters them
+ * according to the requested trigger, and groups them in batches before they are delivered to the
+ * client.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef GPIOSYSFSEDGE_INCLUDE_GUARD
+#define GPIOSYSFSEDGE_INCLUDE_GUARD
+
+#include "legato.h"
+#include "gpioSysfs.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to an edge filter.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct gpioSysfsEdge_Filter* gpioSysfsEdge_FilterRef_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the edge filter module. Must be called once before any filter is created.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an edge filter.
+ *
+ * @return The edge filter reference.
+ */
+//--------------------------------------------------------------------------------------------------
+gpioSysfsEdge_FilterRef_t gpioSysfsEdge_Create
+(
+    const char* gpioName,                           ///< [IN] GPIO name, used to name the timers
+    bool initialState,                              ///< [IN] Current state of the pin
+    gpioSysfs_EdgeSensivityMode_t trigger,          ///< [IN] Edge(s) to report
+    uint32_t debounceUs,                            ///< [IN] Time the input must be stable (us)
+    uint32_t batchPeriodMs,                         ///< [IN] Longest time an edge is held (ms)
+    gpioSysfs_EdgeBatchCallbackFunc_t handlerPtr,   ///< [IN] Batch handler
+    void* contextPtr                                ///< [IN] Context pointer for the handler
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete an edge filter. The edges not delivered yet are discarded.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Delete
+(
+    gpioSysfsEdge_FilterRef_t filterRef             ///< [IN] Edge filter reference
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report the state read after an edge interrupt.
+ */
+//--------------------------------------------------------------------------------------------------
+void gpioSysfsEdge_Report
+(
+    gpioSysfsEdge_FilterRef_t filterRef,            ///< [IN] Edge filter reference
+    bool state,                                     ///< [IN] State read from the pin
+    uint64_t timestampNs                            ///< [IN] Monotonic time of the interrupt (ns)
+);
+
+#endif // GPIOSYSFSEDGE_INCLUDE_GUARD
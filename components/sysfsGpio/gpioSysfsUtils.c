@@ -12,6 +12,7 @@
 #include "legato.h"
 #include "interfaces.h"
 #include "gpioSysfs.h"
+#include "gpioSysfsEdge.h"
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -67,6 +68,13 @@ static void RemoveChangeCallback
         LE_WARN_IF(ret == -1, "Failed to close file descriptor for gpio %d: %m", gpioRef->pinNum);
     }
 
+    // If there is an edge filter then discard it along with the edges not delivered yet
+    if (gpioRef->edgeFilterPtr != NULL)
+    {
+        gpioSysfsEdge_Delete(gpioRef->edgeFilterPtr);
+        gpioRef->edgeFilterPtr = NULL;
+    }
+
     LE_DEBUG("Removing callback references");
     // If there is a callback registered then forget it
     gpioRef->callbackContextPtr = NULL;
@@ -586,6 +594,63 @@ le_result_t gpioSysfs_SetPolarity
     return WriteSysGpioSignalAttr(path, attr);
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start monitoring the value of a pin for interrupts
+ *
+ * @return
+ *  - LE_OK on success
+ *  - LE_FAULT if the value file cannot be opened
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t StartMonitor
+(
+    gpioSysfs_GpioRef_t gpioRef,                  ///< [IN] GPIO object reference
+    le_fdMonitor_HandlerFunc_t fdMonFunc,         ///< [IN] The fd monitor function
+    bool* statePtr                                ///< [OUT] Current state of the pin
+)
+{
+    char monFile[128];
+    int monFd = -1;
+
+    // Start monitoring the fd for the correct GPIO
+    snprintf(monFile, sizeof(monFile), "%s/%s%s/%s", SYSFS_GPIO_PATH, GpioAliasesPath,
+             gpioRef->gpioName, "value");
+
+    do
+    {
+        monFd = open(monFile, O_RDONLY);
+    }
+    while ((monFd < 0) && (errno == EINTR));
+
+    if (monFd < 0)
+    {
+        LE_ERROR("Unable to open GPIO file for monitoring");
+        return LE_FAULT;
+    }
+
+    // Seek to the start of the file and read from it - this is required to prevent
+    // false triggers- see https://www.kernel.org/doc/Documentation/gpio/sysfs.txt
+    LE_DEBUG("Seek to start of file %d", monFd);
+
+    LE_ERROR_IF(lseek(monFd, 0, SEEK_SET) == (off_t)(-1),
+                "Failed to SEEK_SET for GPIO '%s'. %m.", gpioRef->gpioName );
+
+    //We will read a single character
+    char buf[1] = { '0' };
+
+    if (read(monFd, buf, 1) != 1)
+    {
+        LE_ERROR("Unable to read value for GPIO %s. %m", gpioRef->gpioName);
+    }
+    *statePtr = (buf[0] == '1');
+
+    LE_DEBUG("Setting up file monitor for fd %d and pin %s", monFd, gpioRef->gpioName);
+    gpioRef->fdMonitor = le_fdMonitor_Create (gpioRef->gpioName, monFd, fdMonFunc, POLLPRI);
+
+    return LE_OK;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Set a change callback on a particular pin
@@ -603,9 +668,8 @@ void* gpioSysfs_SetChangeCallback
     int32_t sampleMs                              ///< [IN] If not interrupt capable, sample this often.
 )
 {
-    char monFile[128];
-    int monFd = -1;
     le_result_t leResult;
+    bool state;
 
     if ((!gpioRef) || (gpioRef->pinNum == 0))
     {
@@ -639,39 +703,69 @@ void* gpioSysfs_SetChangeCallback
     gpioRef->handlerPtr = handlerPtr;
     gpioRef->callbackContextPtr = contextPtr;
 
-    // Start monitoring the fd for the correct GPIO
-    snprintf(monFile, sizeof(monFile), "%s/%s%s/%s", SYSFS_GPIO_PATH, GpioAliasesPath,
-             gpioRef->gpioName, "value");
-
-    do
+    if (StartMonitor(gpioRef, fdMonFunc, &state) != LE_OK)
     {
-        monFd = open(monFile, O_RDONLY);
+        return NULL;
     }
-    while ((monFd < 0) && (errno == EINTR));
 
-    if (monFd < 0)
+    return gpioRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set an edge batch callback on a particular pin
+ *
+ * @return This will return a reference
+ */
+//--------------------------------------------------------------------------------------------------
+void* gpioSysfs_SetEdgeBatchCallback
+(
+    gpioSysfs_GpioRef_t gpioRef,                    ///< [IN] GPIO object reference
+    le_fdMonitor_HandlerFunc_t fdMonFunc,           ///< [IN] The fd monitor function
+    gpioSysfs_EdgeSensivityMode_t edge,             ///< [IN] Edge(s) that should be reported
+    uint32_t debounceUs,                            ///< [IN] Time the input must be stable (us)
+    uint32_t batchPeriodMs,                         ///< [IN] Longest time an edge is held (ms)
+    gpioSysfs_EdgeBatchCallbackFunc_t handlerPtr,   ///< [IN] The edge batch callback
+    void* contextPtr                                ///< [IN] A context pointer
+)
+{
+    bool state;
+
+    if ((!gpioRef) || (gpioRef->pinNum == 0))
     {
-        LE_ERROR("Unable to open GPIO file for monitoring");
+        LE_KILL_CLIENT("gpioRef is NULL or object not initialized");
         return NULL;
     }
 
-    // Seek to the start of the file and read from it - this is required to prevent
-    // false triggers- see https://www.kernel.org/doc/Documentation/gpio/sysfs.txt
-    LE_DEBUG("Seek to start of file %d", monFd);
+    // Only one handler is allowed here, whatever its kind
+    if (gpioRef->fdMonitor != NULL)
+    {
+        LE_KILL_CLIENT("Only one change handler can be registered");
+        return NULL;
+    }
 
-    LE_ERROR_IF(lseek(monFd, 0, SEEK_SET) == (off_t)(-1),
-                "Failed to SEEK_SET for GPIO '%s'. %m.", gpioRef->gpioName );
+    if ((edge != SYSFS_EDGE_SENSE_RISING) && (edge != SYSFS_EDGE_SENSE_FALLING) &&
+        (edge != SYSFS_EDGE_SENSE_BOTH))
+    {
+        LE_KILL_CLIENT("Invalid edge %d", edge);
+        return NULL;
+    }
 
-    //We will read a single character
-    char buf[1];
+    // Both edges are needed to follow the state of the pin, the trigger is applied by the filter
+    if (SetEdgeSense(gpioRef, SYSFS_EDGE_SENSE_BOTH) != LE_OK)
+    {
+        LE_KILL_CLIENT("Unable to set edge detection correctly");
+        return NULL;
+    }
 
-    if (read(monFd, buf, 1) != 1)
+    if (StartMonitor(gpioRef, fdMonFunc, &state) != LE_OK)
     {
-        LE_ERROR("Unable to read value for GPIO %s. %m", gpioRef->gpioName);
+        return NULL;
     }
 
-    LE_DEBUG("Setting up file monitor for fd %d and pin %s", monFd, gpioRef->gpioName);
-    gpioRef->fdMonitor = le_fdMonitor_Create (gpioRef->gpioName, monFd, fdMonFunc, POLLPRI);
+    gpioRef->edgeFilterPtr = gpioSysfsEdge_Create(gpioRef->gpioName, state, edge, debounceUs,
+                                                  batchPeriodMs, handlerPtr, contextPtr);
 
     return gpioRef;
 }
@@ -1071,6 +1165,10 @@ void gpioSysfs_InputMonitorHandlerFunc
 {
     //We're reading a single character
     char buf[1];
+    struct timespec now;
+
+    // Timestamp the edge before anything else, the read below can take a while
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
     LE_DEBUG("Input handler called for %s", gpioRef->gpioName);
 
@@ -1094,6 +1192,13 @@ void gpioSysfs_InputMonitorHandlerFunc
 
     LE_DEBUG("Read value %c from value file for callback", buf[0]);
 
+    if (gpioRef->edgeFilterPtr != NULL)
+    {
+        gpioSysfsEdge_Report(gpioRef->edgeFilterPtr, buf[0] == '1',
+                             (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+        return;
+    }
+
     // Look up the callback function
     gpioSysfs_ChangeCallbackFunc_t handlerPtr = (gpioSysfs_ChangeCallbackFunc_t)gpioRef->handlerPtr;
 
@@ -1292,6 +1397,8 @@ void gpioSysfs_Initialize
 {
     char path[128];
 
+    gpioSysfsEdge_Init();
+
     *gpioDesignPtr = GpioDesign;
     snprintf(path, sizeof(path), "%s/%s%s", SYSFS_GPIO_PATH, SYSFS_GPIO_ALIAS_PREFIX, "export");
     if (access(path, W_OK) == 0)
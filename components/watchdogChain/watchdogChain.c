@@ -5,6 +5,10 @@
  * watchdog.  The watchdog will be kicked when all non-stopped tasks on the chain have requested
  * a kick.
  *
+ * Kicks sent to the watchdog daemon are rate limited: a completed chain is only forwarded if the
+ * previous kick was sent more than 1/8 of the watchdog timeout ago.  Otherwise the chain is left
+ * in the kicked state and a one-shot timer of the main thread forwards it when the hold-off ends.
+ *
  * Copyright (C) Sierra Wireless Inc.
  */
 //--------------------------------------------------------------------------------------------------
@@ -36,6 +40,13 @@
 //--------------------------------------------------------------------------------------------------
 #define MAX_EVENT_LOOPS                  8
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Fraction of the watchdog timeout during which kicks to the watchdog daemon are held off.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KICK_HOLD_OFF_DIVISOR            8
+
 #if MAX_WATCHDOG_CHAINS > 16
 typedef uint64_t watchdog_t;
 #   define WATCHDOG_C(x) UINT64_C(x)
@@ -115,6 +126,43 @@ WatchdogObj_t* WatchdogList[MAX_WATCHDOG_CHAINS];
  */
 //--------------------------------------------------------------------------------------------------
 le_log_TraceRef_t TraceRef;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Time the last kick was sent to the watchdog daemon.
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t LastKickTime;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Minimum time between two kicks sent to the watchdog daemon.  Zero until the watchdog timeout
+ * is known.
+ */
+//--------------------------------------------------------------------------------------------------
+le_clk_Time_t KickHoldOff;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread owning the held kick timer: the thread which initialized the component.
+ */
+//--------------------------------------------------------------------------------------------------
+le_thread_Ref_t MainThread;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * One-shot timer sending a held kick when the hold-off ends.  Created on first use.
+ */
+//--------------------------------------------------------------------------------------------------
+le_timer_Ref_t HeldKickTimer;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set while a held kick is waiting for the hold-off to end, i.e. while the held kick timer is
+ * started or about to be.
+ */
+//--------------------------------------------------------------------------------------------------
+volatile bool IsKickHeld;
 });
 
 /// Macro used to generate trace output in this module.
@@ -276,6 +324,114 @@ static void CheckEventLoopHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the kick hold-off from the watchdog timeout.  A timeout which is not a positive number of
+ * milliseconds (never or now) disables the hold-off.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetKickHoldOff
+(
+    int64_t timeoutMs   ///< Watchdog timeout, in milliseconds
+)
+{
+    uint64_t holdOffMs = 0;
+
+    if (timeoutMs > 0)
+    {
+        holdOffMs = (uint64_t)timeoutMs / KICK_HOLD_OFF_DIVISOR;
+    }
+
+    LE_CDATA_THIS->KickHoldOff.sec = holdOffMs / 1000;
+    LE_CDATA_THIS->KickHoldOff.usec = (holdOffMs % 1000) * 1000;
+    TRACE("Watchdog kick hold-off set to %" PRIu64 " ms", holdOffMs);
+}
+
+static void CheckChain(watchdog_t watchdogChain);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Held kick timer handler: the hold-off is over, so forward the chain if it is still kicked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HeldKickTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    LE_UNUSED(timerRef);
+
+    __sync_lock_release(&LE_CDATA_THIS->IsKickHeld);
+
+    watchdog_t watchdogChain = __sync_fetch_and_or(&LE_CDATA_THIS->WatchdogChain, 0);
+
+    // Don't restart a watchdog which has been stopped during the hold-off.
+    if (!AllAreStopped(watchdogChain))
+    {
+        CheckChain(watchdogChain);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start the held kick timer for the remaining hold-off time.  Runs on the main thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartHeldKickTimer
+(
+    void* param1Ptr,    ///< Unused
+    void* param2Ptr     ///< Unused
+)
+{
+    LE_UNUSED(param1Ptr);
+    LE_UNUSED(param2Ptr);
+
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+    le_clk_Time_t end = le_clk_Add(LE_CDATA_THIS->LastKickTime, LE_CDATA_THIS->KickHoldOff);
+
+    if (!le_clk_GreaterThan(end, now))
+    {
+        HeldKickTimerHandler(LE_CDATA_THIS->HeldKickTimer);
+        return;
+    }
+
+    if (NULL == LE_CDATA_THIS->HeldKickTimer)
+    {
+        LE_CDATA_THIS->HeldKickTimer = le_timer_Create("HeldKick");
+        le_timer_SetHandler(LE_CDATA_THIS->HeldKickTimer, HeldKickTimerHandler);
+        le_timer_SetWakeup(LE_CDATA_THIS->HeldKickTimer, false);
+    }
+    le_timer_SetInterval(LE_CDATA_THIS->HeldKickTimer, le_clk_Sub(end, now));
+    le_timer_Start(LE_CDATA_THIS->HeldKickTimer);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Arrange for a held kick to be sent when the hold-off ends, unless this is already done.  Timers
+ * belong to a thread, so the timer is always started by the main thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HoldKick
+(
+    void
+)
+{
+    if (__sync_lock_test_and_set(&LE_CDATA_THIS->IsKickHeld, true))
+    {
+        return;
+    }
+
+    if ((NULL == LE_CDATA_THIS->MainThread) ||
+        (le_thread_GetCurrent() == LE_CDATA_THIS->MainThread))
+    {
+        StartHeldKickTimer(NULL, NULL);
+    }
+    else
+    {
+        le_event_QueueFunctionToThread(LE_CDATA_THIS->MainThread, StartHeldKickTimer, NULL, NULL);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Check if the watchdog chain is all kicked, and if so kick the process watchdog.
@@ -291,6 +447,18 @@ static void CheckChain
     // Calculate if all watchdogs are either kicked or stopped
     if (AllHaveBeenKicked(watchdogChain))
     {
+        le_clk_Time_t now = le_clk_GetRelativeTime();
+
+        // Don't flood the watchdog daemon with kicks.  The chain stays kicked, and the kick is
+        // sent when the hold-off ends.
+        if (le_clk_GreaterThan(le_clk_Add(LE_CDATA_THIS->LastKickTime,
+                                          LE_CDATA_THIS->KickHoldOff), now))
+        {
+            TRACE("Complete watchdog chain kicked, holding off kick.");
+            HoldKick();
+            return;
+        }
+
         // Yes; kick watchdog and reset kick list.  Could potentially be double kicked if
         // another thread calls le_wdogChain_Kick in here somewhere, but a double kick is not
         // a problem.
@@ -298,6 +466,18 @@ static void CheckChain
 
         le_wdog_Kick();
         MarkAllUnkicked();
+        LE_CDATA_THIS->LastKickTime = now;
+
+        if ((0 == LE_CDATA_THIS->KickHoldOff.sec) && (0 == LE_CDATA_THIS->KickHoldOff.usec))
+        {
+            uint64_t timeoutMs;
+
+            // The watchdog exists once kicked, so its timeout can now be retrieved.
+            if ((LE_OK == le_wdog_GetWatchdogTimeout(&timeoutMs)) && (timeoutMs <= INT64_MAX))
+            {
+                SetKickHoldOff((int64_t)timeoutMs);
+            }
+        }
     }
 }
 
@@ -534,6 +714,12 @@ void le_wdogChain_Stop
         // All watchdogs are stopped -- stop process watchdog (if allowed).  If not allowed,
         // process should not have stopped all watchdogs on the chain.
         le_wdog_Timeout(LE_WDOG_TIMEOUT_NEVER);
+
+        // Don't hold off the kick which will restart the watchdog, and retrieve the timeout
+        // again once it is restarted.
+        SetKickHoldOff(LE_WDOG_TIMEOUT_NEVER);
+        LE_CDATA_THIS->LastKickTime.sec = 0;
+        LE_CDATA_THIS->LastKickTime.usec = 0;
     }
     else
     {
@@ -550,6 +736,23 @@ void le_wdogChain_Stop
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the timeout of the process watchdog.
+ *
+ * Processes using the watchdog chain should call this instead of le_wdog_Timeout(), so the hold-off
+ * applied to the chain kicks follows the new timeout.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_wdogChain_Timeout
+(
+    int32_t milliseconds
+)
+{
+    le_wdog_Timeout(milliseconds);
+    SetKickHoldOff(milliseconds);
+}
+
 COMPONENT_INIT_ONCE
 {
     WatchdogPool = le_mem_InitStaticPool(WatchdogChain, MAX_WATCHDOG_CHAINS, sizeof(WatchdogObj_t));
@@ -559,4 +762,6 @@ COMPONENT_INIT
 {
     // Get a reference to the trace keyword that is used to control tracing in this module.
     LE_CDATA_THIS->TraceRef = le_log_GetTraceRef("wdog");
+
+    LE_CDATA_THIS->MainThread = le_thread_GetCurrent();
 }
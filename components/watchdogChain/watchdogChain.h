@@ -70,4 +70,17 @@ LE_SHARED void le_wdogChain_Stop
     uint32_t watchdog
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the timeout of the process watchdog.
+ *
+ * Use this instead of le_wdog_Timeout(), so the hold-off applied to the chain kicks follows the
+ * new timeout.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_SHARED void le_wdogChain_Timeout
+(
+    int32_t milliseconds    ///< Timeout in milliseconds, or LE_WDOG_TIMEOUT_NEVER/NOW
+);
+
 #endif /* LEGATO_WATCHDOG_CHAIN_INCLUDE_GUARD */
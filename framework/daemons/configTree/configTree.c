@@ -109,6 +109,11 @@ COMPONENT_INIT
     le_msg_AddServiceCloseHandler(le_cfg_GetServiceRef(), OnConfigSessionClosed, NULL);
     le_msg_AddServiceCloseHandler(le_cfgAdmin_GetServiceRef(), OnConfigAdminSessionClosed, NULL);
 
+    // A change notification carries no data, so a client that does not keep up only needs one
+    // pending notification per change handler, to which treeDb keys the notifications.
+    le_msg_SetServiceTxQueueLimit(le_cfg_GetServiceRef(), LE_CONFIG_MSG_TX_QUEUE_LIMIT,
+                                  LE_MSG_TX_OVERFLOW_COALESCE);
+
     // Because this is a system process, we need to close our standard in.  This way the supervisor
     // is properly informed we have completed our startup sequence.  Standard in is reopened on
     // /dev/null so that the file descriptor isn't accidently reused for some other file.
@@ -1817,3 +1817,32 @@ void le_cfg_QuickSetBool
                               value);
     }
 }
+
+
+
+
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the generation of the tree holding a node.
+ */
+// -------------------------------------------------------------------------------------------------
+void le_cfg_GetTreeGeneration
+(
+    le_cfg_ServerCmdRef_t commandRef,  ///< [IN] Reference used to generate a reply for this
+                                       ///<      request.
+    const char* pathPtr                ///< [IN] Path to a node of the tree.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_DEBUG("** Get tree generation at \"%p\".", pathPtr);
+
+    tu_UserRef_t userRef = tu_GetCurrentConfigUserInfo();
+    tdb_TreeRef_t treeRef = QuickGetTree(userRef, TU_TREE_READ, pathPtr);
+
+    if (treeRef != NULL)
+    {
+        // Changes are merged as soon as they are committed, so there is no need to wait for the
+        // pending requests on the tree.
+        le_cfg_GetTreeGenerationRespond(commandRef, tdb_GetGeneration(treeRef));
+    }
+}
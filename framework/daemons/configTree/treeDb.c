@@ -297,6 +297,9 @@ typedef struct Tree
                                           ///<   0 - Unknonwn.
                                           ///<   1, 2, 3 is one of the rock, paper, scissors revs.
 
+    uint32_t generation;                  ///< Changed each time the tree is loaded or changes
+                                          ///<   are merged into it.
+
     Node_t* rootNodeRef;                  ///< The root node of this tree.
 
     ssize_t activeReadCount;              ///< Count of reads that are currently active on
@@ -350,6 +353,10 @@ LE_MEM_DEFINE_STATIC_POOL(treePool, LE_CONFIG_CFGTREE_MAX_TREE_POOL_SIZE, sizeof
 /// Pool from which Tree objects are allocated.
 static le_mem_PoolRef_t TreePoolRef = NULL;
 
+/// Last generation given to a tree.  Shared by all the trees, so that a tree deleted and created
+/// again never gets a generation it already had.
+static uint32_t LastGeneration = 0;
+
 
 /// Define static pool for handlers
 LE_MEM_DEFINE_STATIC_POOL(HandlerPool, LE_CONFIG_CFGTREE_MAX_HANDLER_POOL_SIZE,
@@ -1205,7 +1212,15 @@ static void FireTriggeredCallbacks
             {
                 Handler_t* handlerObjectPtr = CONTAINER_OF(linkPtr, Handler_t, link);
 
+                // A notification carries no data, so the pending ones of a handler can be
+                // coalesced for a client that does not keep up.
+#if LE_CONFIG_LINUX
+                le_msg_SetThreadCoalesceKey((uintptr_t)handlerObjectPtr);
+#endif
                 handlerObjectPtr->handlerPtr(handlerObjectPtr->contextPtr);
+#if LE_CONFIG_LINUX
+                le_msg_SetThreadCoalesceKey(0);
+#endif
                 linkPtr = le_dls_PeekNext(&registrationPtr->handlerList, linkPtr);
             }
 
@@ -1594,6 +1609,7 @@ tdb_TreeRef_t NewTree
     treeRef->isDeletePending = false;
     treeRef->originalTreeRef = NULL;
     treeRef->revisionId = 0;
+    treeRef->generation = ++LastGeneration;
     treeRef->rootNodeRef = (rootNodeRef != NULL) ? rootNodeRef : NewNode();
     treeRef->activeReadCount = 0;
     treeRef->activeWriteIterRef = NULL;
@@ -3104,6 +3120,33 @@ le_sls_List_t* tdb_GetRequestQueue
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the generation of a tree.  It changes each time changes are merged into the tree, so that
+ *  users of the tree can check if values they read from it before may have changed.
+ *
+ *  @return The generation of the tree.
+ */
+// -------------------------------------------------------------------------------------------------
+uint32_t tdb_GetGeneration
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree object to read.
+)
+// -------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(treeRef != NULL);
+
+    if (treeRef->originalTreeRef != NULL)
+    {
+        return treeRef->originalTreeRef->generation;
+    }
+
+    return treeRef->generation;
+}
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Merge a shadow tree into the original tree it was created from.  Once the change is merged the
@@ -3124,6 +3167,10 @@ void tdb_MergeTree
     InternalMergeTree(shadowTreeRef->originalTreeRef->name, pathRef, nodeRef, false);
     le_pathIter_Delete(pathRef);
 
+    // Bump the generation before any callback, so that a client reacting to a change notification
+    // sees the new generation.
+    shadowTreeRef->originalTreeRef->generation = ++LastGeneration;
+
     // Now, go through and call the triggered callbacks.
     FireTriggeredCallbacks();
 
@@ -231,6 +231,22 @@ le_sls_List_t* tdb_GetRequestQueue
 
 
 
+// -------------------------------------------------------------------------------------------------
+/**
+ *  Get the generation of a tree.  It changes each time changes are merged into the tree, so that
+ *  users of the tree can check if values they read from it before may have changed.
+ *
+ *  @return The generation of the tree.
+ */
+// -------------------------------------------------------------------------------------------------
+uint32_t tdb_GetGeneration
+(
+    tdb_TreeRef_t treeRef  ///< [IN] The tree object to read.
+);
+
+
+
+
 // -------------------------------------------------------------------------------------------------
 /**
  *  Merge a shadow tree into the original tree it was created from.  Once the change is merged the
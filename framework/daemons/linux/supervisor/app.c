@@ -331,6 +331,31 @@ static const le_clk_Time_t KillTimeout =
 };
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timeout value for the processes of an app to be frozen when it is paused.  A process can only be
+ * frozen once it gets out of an uninterruptible sleep, which normally takes much less than this.
+ */
+//--------------------------------------------------------------------------------------------------
+static const le_clk_Time_t FreezeTimeout =
+{
+    .sec = 1,
+    .usec = 0
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Interval between two checks of the freeze state of an app being paused.
+ */
+//--------------------------------------------------------------------------------------------------
+static const le_clk_Time_t FreezePollInterval =
+{
+    .sec = 0,
+    .usec = 1000
+};
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The application object.
@@ -349,6 +374,12 @@ typedef struct app_Ref
                                                                          // group IDs.
     size_t          numSupplementGids;  // Number of supplementary groups for this app.
     app_State_t     state;              // Applications current state.
+    bool            isPaused;           // true if the app's processes are frozen by app_Pause().
+    app_PauseHandlerFunc_t pauseHandler; // Handler to call when the app is paused, or NULL if the
+                                        // app is not being paused.
+    void*           pauseContextPtr;    // Context pointer of the pause handler.
+    le_clk_Time_t   freezeExpiryTime;   // Time by which the processes must be frozen.
+    le_timer_Ref_t  freezeTimer;        // Timer polling the freeze state of the app being paused.
     le_dls_List_t   procs;              // List of processes in this application.
     le_dls_List_t   auxProcs;           // List of auxiliary processes in this application.
     le_timer_Ref_t  killTimer;          // Timeout timer for killing processes.
@@ -1586,6 +1617,74 @@ static void HardKillApp
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Completes the pausing of an application, if it is being paused: stops polling its freeze state
+ * and calls the pause handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CompletePause
+(
+    app_Ref_t appRef,                   ///< [IN] The application.
+    le_result_t result                  ///< [IN] Result passed to the pause handler.
+)
+{
+    app_PauseHandlerFunc_t handlerFunc = appRef->pauseHandler;
+
+    if (handlerFunc == NULL)
+    {
+        return;
+    }
+
+    le_timer_Stop(appRef->freezeTimer);
+    appRef->pauseHandler = NULL;
+
+    handlerFunc(appRef, result, appRef->pauseContextPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the processes of an application being paused are frozen.  Called periodically
+ * until they are, or until the freeze timeout expires, in which case they are thawed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void FreezePollHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    app_Ref_t appRef = (app_Ref_t)le_timer_GetContextPtr(timerRef);
+    cgrp_FreezeState_t freezeState = cgrp_frz_GetState(appRef->name);
+
+    if (freezeState == CGRP_FROZEN)
+    {
+        appRef->isPaused = true;
+        CompletePause(appRef, LE_OK);
+        return;
+    }
+
+    if ((le_result_t)freezeState == LE_FAULT)
+    {
+        LE_ERROR("Could not get freeze state of application '%s'.", appRef->name);
+    }
+    else if (le_clk_GreaterThan(le_clk_GetRelativeTime(), appRef->freezeExpiryTime))
+    {
+        LE_ERROR("Processes of application '%s' could not be frozen in time.", appRef->name);
+    }
+    else
+    {
+        return;
+    }
+
+    if (cgrp_frz_Thaw(appRef->name) != LE_OK)
+    {
+        LE_ERROR("Could not thaw processes for application '%s'.", appRef->name);
+    }
+    CompletePause(appRef, LE_FAULT);
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Finds a process container with this pid in the specified list.
@@ -3251,6 +3350,9 @@ app_Ref_t app_Create
     appPtr->auxProcs = LE_DLS_LIST_INIT;
     appPtr->additionalLinks = LE_SLS_LIST_INIT;
     appPtr->state = APP_STATE_STOPPED;
+    appPtr->isPaused = false;
+    appPtr->pauseHandler = NULL;
+    appPtr->freezeTimer = NULL;
     appPtr->killTimer = NULL;
 
     LE_INFO("Creating app '%s'", appPtr->name);
@@ -3441,11 +3543,15 @@ void app_Delete
     DeleteProcContainersList(appRef->procs);
     DeleteProcContainersList(appRef->auxProcs);
 
-    // Release the app timer.
+    // Release the app timers.
     if (appRef->killTimer != NULL)
     {
         le_timer_Delete(appRef->killTimer);
     }
+    if (appRef->freezeTimer != NULL)
+    {
+        le_timer_Delete(appRef->freezeTimer);
+    }
 
     // Release app.
     le_mem_Release(appRef);
@@ -3609,7 +3715,10 @@ void app_Stop
         }
     }
 
-    // Soft kill all the processes in the app.
+    // Soft kill all the processes in the app.  This thaws them if the app is paused.
+    appRef->isPaused = false;
+    CompletePause(appRef, LE_NOT_FOUND);
+
     if (KillAppProcs(appRef, KILL_SOFT) == LE_OK)
     {
         // Start the kill timeout timer for this app.
@@ -3641,6 +3750,129 @@ void app_Stop
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pauses an application by freezing all of its processes.  This is an asynchronous function call
+ * that returns immediately: the handler is called once the processes are all frozen, or they could
+ * not be and were left running, or the application was stopped.
+ *
+ * @return
+ *      LE_OK if the processes are being frozen.
+ *      LE_NOT_FOUND if the application is not running.
+ *      LE_DUPLICATE if the application is already paused or being paused.
+ *      LE_FAULT if the processes could not be frozen.  They are left running.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_Pause
+(
+    app_Ref_t appRef,                   ///< [IN] Reference to the application to pause.
+    app_PauseHandlerFunc_t handlerFunc, ///< [IN] Handler called when the pausing has completed.
+    void* contextPtr                    ///< [IN] Context pointer passed to the handler.
+)
+{
+    LE_ASSERT(handlerFunc != NULL);
+
+    if (appRef->state != APP_STATE_RUNNING)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    if (appRef->isPaused || (appRef->pauseHandler != NULL))
+    {
+        return LE_DUPLICATE;
+    }
+
+    LE_INFO("Pausing app '%s'", appRef->name);
+
+    if (cgrp_frz_Freeze(appRef->name) != LE_OK)
+    {
+        LE_ERROR("Could not freeze processes for application '%s'.", appRef->name);
+        return LE_FAULT;
+    }
+
+    // The processes are not frozen at once, so poll their state rather than block the supervisor.
+    if (appRef->freezeTimer == NULL)
+    {
+        char timerName[LIMIT_MAX_PATH_BYTES];
+
+        snprintf(timerName, sizeof(timerName), "%s_Freezer", appRef->name);
+        appRef->freezeTimer = le_timer_Create(timerName);
+
+        LE_ASSERT(le_timer_SetInterval(appRef->freezeTimer, FreezePollInterval) == LE_OK);
+        LE_ASSERT(le_timer_SetRepeat(appRef->freezeTimer, 0) == LE_OK);
+
+        LE_ASSERT(le_timer_SetContextPtr(appRef->freezeTimer, (void*)appRef) == LE_OK);
+        LE_ASSERT(le_timer_SetHandler(appRef->freezeTimer, FreezePollHandler) == LE_OK);
+    }
+
+    appRef->pauseHandler = handlerFunc;
+    appRef->pauseContextPtr = contextPtr;
+    appRef->freezeExpiryTime = le_clk_Add(le_clk_GetRelativeTime(), FreezeTimeout);
+
+    le_timer_Start(appRef->freezeTimer);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resumes a paused application by thawing all of its processes.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the application is not running.
+ *      LE_DUPLICATE if the application is not paused.
+ *      LE_FAULT if the processes could not be thawed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_Resume
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application to resume.
+)
+{
+    if (appRef->state != APP_STATE_RUNNING)
+    {
+        return LE_NOT_FOUND;
+    }
+
+    if (!appRef->isPaused)
+    {
+        return LE_DUPLICATE;
+    }
+
+    LE_INFO("Resuming app '%s'", appRef->name);
+
+    if (cgrp_frz_Thaw(appRef->name) != LE_OK)
+    {
+        LE_ERROR("Could not thaw processes for application '%s'.", appRef->name);
+        return LE_FAULT;
+    }
+
+    appRef->isPaused = false;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if an application is paused.
+ *
+ * @return
+ *      true if the application is paused.
+ *      false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool app_IsPaused
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application.
+)
+{
+    return appRef->isPaused;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets an application's state.
@@ -3926,6 +4158,16 @@ le_result_t app_WatchdogTimeoutHandler
 
     proc_Ref_t procRef = procContainerPtr->procRef;
 
+    // The watchdogs of a paused app are suspended, but a timeout may have been reported just
+    // before.  A frozen process can't kick its watchdog, so this is not a fault.
+    if (appRef->isPaused)
+    {
+        LE_INFO("Ignoring watchdog timeout of process '%s' in paused app '%s'.",
+                proc_GetName(procRef), appRef->name);
+        *watchdogActionPtr = WATCHDOG_ACTION_HANDLED;
+        return LE_OK;
+    }
+
     // Get the current process fault action.
     wdog_action_WatchdogAction_t watchdogAction = proc_GetWatchdogAction(procRef);
 
@@ -4751,4 +4993,6 @@ void app_StopComplete
     LE_INFO("app '%s' has stopped.", appRef->name);
 
     appRef->state = APP_STATE_STOPPED;
+    appRef->isPaused = false;
+    CompletePause(appRef, LE_NOT_FOUND);
 }
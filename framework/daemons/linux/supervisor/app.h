@@ -39,6 +39,21 @@ typedef void (*app_Proc_StopHandlerFunc_t)
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for a handler that is called when the pausing of an application has completed.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*app_PauseHandlerFunc_t)
+(
+    app_Ref_t appRef,               ///< [IN] The application.
+    le_result_t result,             ///< [IN] LE_OK if its processes are frozen, LE_NOT_FOUND if
+                                    ///       it was stopped, or LE_FAULT if they could not be
+                                    ///       frozen.
+    void* contextPtr                ///< [IN] Context pointer.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Prototype for a handler that is called when an application's process is blocked just before it
@@ -184,6 +199,59 @@ void app_Stop
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pauses an application by freezing all of its processes.  This is an asynchronous function call
+ * that returns immediately: the handler is called once the processes are all frozen, or they could
+ * not be and were left running, or the application was stopped.
+ *
+ * @return
+ *      LE_OK if the processes are being frozen.
+ *      LE_NOT_FOUND if the application is not running.
+ *      LE_DUPLICATE if the application is already paused or being paused.
+ *      LE_FAULT if the processes could not be frozen.  They are left running.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_Pause
+(
+    app_Ref_t appRef,                   ///< [IN] Reference to the application to pause.
+    app_PauseHandlerFunc_t handlerFunc, ///< [IN] Handler called when the pausing has completed.
+    void* contextPtr                    ///< [IN] Context pointer passed to the handler.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resumes a paused application by thawing all of its processes.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the application is not running.
+ *      LE_DUPLICATE if the application is not paused.
+ *      LE_FAULT if the processes could not be thawed.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t app_Resume
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application to resume.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if an application is paused.
+ *
+ * @return
+ *      true if the application is paused.
+ *      false otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+bool app_IsPaused
+(
+    app_Ref_t appRef                    ///< [IN] Reference to the application.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets an application's state.
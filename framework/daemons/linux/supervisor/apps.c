@@ -34,6 +34,11 @@
  * be checked within the SIGCHILD handler.  The SIGCHILD handler will then call the app stop handler
  * when the app has actually stopped.
  *
+ * A running app can be paused with le_appCtrl_Pause(), which freezes all of its processes, and
+ * resumed with le_appCtrl_Resume().  The Watchdog daemon is told about it through the
+ * wdog_AppPause event, so that the watchdogs of the processes of the app are suspended while it is
+ * paused.
+ *
  * When an app has stopped it is popped off the active list and placed onto the inactive list of
  * apps.  When an app is restarted it is moved from the inactive list to the active list.  This
  * means we do not have to recreate app containers each time.  App containers are only cleaned when
@@ -204,6 +209,25 @@ static le_ref_MapRef_t AppMap;
 static le_ref_MapRef_t AppAttachHandlerMap;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Safe reference map for app pause handlers.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t AppPauseHandlerMap;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler of the Watchdog daemon for app pause and resume, its context and its safe reference.
+ * NULL if not registered.
+ */
+//--------------------------------------------------------------------------------------------------
+static wdog_AppPauseHandlerFunc_t AppPauseHandler = NULL;
+static void* AppPauseContextPtr = NULL;
+static wdog_AppPauseHandlerRef_t AppPauseHandlerRef = NULL;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * List of all active app containers.
@@ -1281,6 +1305,7 @@ void apps_Init
     AppProcMap = le_ref_CreateMap("AppProcs", 5);
     AppMap = le_ref_CreateMap("App", 5);
     AppAttachHandlerMap = le_ref_CreateMap("AppAttachHandlers", 5);
+    AppPauseHandlerMap = le_ref_CreateMap("AppPauseHandlers", 1);
 
     le_instStat_AddAppUninstallEventHandler(DeletesInactiveApp, NULL);
     le_instStat_AddAppInstallEventHandler(DeletesInactiveApp, NULL);
@@ -1668,6 +1693,24 @@ static void appCtrl_SetDebug
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Tells the Watchdog daemon that an app has been paused or resumed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReportAppPause
+(
+    app_Ref_t appRef,                   ///< [IN] The app.
+    bool isPaused                       ///< [IN] true if the app has been paused.
+)
+{
+    if (AppPauseHandler != NULL)
+    {
+        AppPauseHandler(app_GetName(appRef), isPaused, AppPauseContextPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Starts an app.  This function is called by the event loop when a separate process requests to
@@ -1737,6 +1780,12 @@ static le_result_t appCtrl_Stop
         return LE_NOT_FOUND;
     }
 
+    // A paused app is thawed to be stopped, so the watchdogs of its processes must be re-armed.
+    if (app_IsPaused(appContainerPtr->appRef))
+    {
+        ReportAppPause(appContainerPtr->appRef, false);
+    }
+
     // Save this commands reference in this app.
     appContainerPtr->stopCmdRef = cmdRef;
 
@@ -1758,6 +1807,127 @@ static le_result_t appCtrl_Stop
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Responds to the pause app command once the processes of the app are frozen, or could not be.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RespondToPauseAppCmd
+(
+    app_Ref_t appRef,                   ///< [IN] The app.
+    le_result_t result,                 ///< [IN] Result of the pausing.
+    void* contextPtr                    ///< [IN] Command reference of the pause app command.
+)
+{
+    // The app is left running, so the watchdogs of its processes must be re-armed.
+    if (result != LE_OK)
+    {
+        ReportAppPause(appRef, false);
+    }
+
+    le_appCtrl_PauseRespond((le_appCtrl_ServerCmdRef_t)contextPtr, result);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pauses an app.  The watchdogs of its processes are suspended before they are frozen.
+ *
+ * @note If this function returns LE_OK the processes of the app are not necessarily frozen yet,
+ *       because freezing them is asynchronous.  The command is responded to once they are.
+ *
+ * @return
+ *      LE_OK if the processes of the app are being frozen.
+ *      LE_NOT_FOUND if the app is not running.
+ *      LE_DUPLICATE if the app is already paused.
+ *      LE_FAULT if the processes of the app could not be frozen.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t appCtrl_Pause
+(
+    le_appCtrl_ServerCmdRef_t cmdRef,   ///< [IN] Command reference that must be passed to this
+                                        ///       command's response function.
+    const char* appName                 ///< [IN] Name of the application to pause.
+)
+{
+    if (!IsAppNameValid(appName))
+    {
+        LE_KILL_CLIENT("Invalid app name.");
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("Received request to pause application '%s'.", appName);
+
+    AppContainer_t* appContainerPtr = GetActiveApp(appName);
+
+    if (appContainerPtr == NULL)
+    {
+        LE_WARN("Application '%s' is not running and cannot be paused.", appName);
+        return LE_NOT_FOUND;
+    }
+
+    if (app_IsPaused(appContainerPtr->appRef))
+    {
+        return LE_DUPLICATE;
+    }
+
+    ReportAppPause(appContainerPtr->appRef, true);
+
+    le_result_t result = app_Pause(appContainerPtr->appRef, RespondToPauseAppCmd, cmdRef);
+
+    // Don't re-arm the watchdogs if the app is already being paused: that pause holds them.
+    if ((result != LE_OK) && (result != LE_DUPLICATE))
+    {
+        ReportAppPause(appContainerPtr->appRef, false);
+    }
+
+    return result;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resumes a paused app.  The watchdogs of its processes are re-armed once they are thawed.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the app is not running.
+ *      LE_DUPLICATE if the app is not paused.
+ *      LE_FAULT if the processes of the app could not be thawed.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t appCtrl_Resume
+(
+    const char* appName                 ///< [IN] Name of the application to resume.
+)
+{
+    if (!IsAppNameValid(appName))
+    {
+        LE_KILL_CLIENT("Invalid app name.");
+        return LE_FAULT;
+    }
+
+    LE_DEBUG("Received request to resume application '%s'.", appName);
+
+    AppContainer_t* appContainerPtr = GetActiveApp(appName);
+
+    if (appContainerPtr == NULL)
+    {
+        LE_WARN("Application '%s' is not running and cannot be resumed.", appName);
+        return LE_NOT_FOUND;
+    }
+
+    le_result_t result = app_Resume(appContainerPtr->appRef);
+
+    if (result == LE_OK)
+    {
+        ReportAppPause(appContainerPtr->appRef, false);
+    }
+
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets a reference to an application.
@@ -2121,6 +2291,64 @@ void le_appCtrl_Stop
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pauses an app. This function is called by the event loop when a separate process requests to
+ * pause an app.
+ *
+ * @note
+ *   The result code for this command should be sent back to the requesting process via
+ *   le_appCtrl_PauseRespond(). The possible result codes are:
+ *
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the app is not running.
+ *      LE_DUPLICATE if the app is already paused.
+ *      LE_FAULT if the processes of the app could not be frozen.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_appCtrl_Pause
+(
+    le_appCtrl_ServerCmdRef_t cmdRef,   ///< [IN] Command reference that must be passed to this
+                                        ///       command's response function.
+    const char* appName                 ///< [IN] Name of the application to pause.
+)
+{
+    le_result_t result = appCtrl_Pause(cmdRef, appName);
+
+    // Otherwise the command is responded to once the processes of the app are frozen.
+    if (result != LE_OK)
+    {
+        le_appCtrl_PauseRespond(cmdRef, result);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Resumes an app. This function is called by the event loop when a separate process requests to
+ * resume an app.
+ *
+ * @note
+ *   The result code for this command should be sent back to the requesting process via
+ *   le_appCtrl_ResumeRespond(). The possible result codes are:
+ *
+ *      LE_OK if successful.
+ *      LE_NOT_FOUND if the app is not running.
+ *      LE_DUPLICATE if the app is not paused.
+ *      LE_FAULT if the processes of the app could not be thawed.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_appCtrl_Resume
+(
+    le_appCtrl_ServerCmdRef_t cmdRef,   ///< [IN] Command reference that must be passed to this
+                                        ///       command's response function.
+    const char* appName                 ///< [IN] Name of the application to resume.
+)
+{
+    le_appCtrl_ResumeRespond(cmdRef, appCtrl_Resume(appName));
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the state of the specified application.  The state of unknown applications is STOPPED.
@@ -2412,6 +2640,53 @@ le_result_t le_appInfo_GetHash
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add handler function for EVENT 'wdog_AppPause'
+ *
+ * Only the Watchdog daemon registers this handler.  If it is restarted, the handler of its new
+ * instance replaces the previous one.
+ */
+//--------------------------------------------------------------------------------------------------
+wdog_AppPauseHandlerRef_t wdog_AddAppPauseHandler
+(
+    wdog_AppPauseHandlerFunc_t handlerPtr,
+    void* contextPtr
+)
+{
+    if (AppPauseHandlerRef != NULL)
+    {
+        le_ref_DeleteRef(AppPauseHandlerMap, AppPauseHandlerRef);
+    }
+
+    AppPauseHandler = handlerPtr;
+    AppPauseContextPtr = contextPtr;
+    AppPauseHandlerRef = le_ref_CreateRef(AppPauseHandlerMap, &AppPauseHandler);
+
+    return AppPauseHandlerRef;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove handler function for EVENT 'wdog_AppPause'
+ */
+//--------------------------------------------------------------------------------------------------
+void wdog_RemoveAppPauseHandler
+(
+    wdog_AppPauseHandlerRef_t handlerRef
+)
+{
+    if ((handlerRef != NULL) && (handlerRef == AppPauseHandlerRef))
+    {
+        le_ref_DeleteRef(AppPauseHandlerMap, AppPauseHandlerRef);
+        AppPauseHandler = NULL;
+        AppPauseContextPtr = NULL;
+        AppPauseHandlerRef = NULL;
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * A watchdog has timed out. This function determines the watchdogAction to take and applies it.
@@ -12,6 +12,7 @@
 #include "fileDescriptor.h"
 #include "killProc.h"
 #include "smack.h"
+#include "spawn.h"
 #include "sysPaths.h"
 #include "wait.h"
 
@@ -101,18 +102,11 @@ static void LoadIpcBindingConfig
     void
 )
 {
+    char* argv[] = { "sdir", "load", NULL };
+    spawn_Attr_t attr = { .pathPtr = "sdir", .argvPtr = argv };
 
-    // Fork a process.
-    pid_t pid = fork();
-    LE_FATAL_IF(pid < 0, "Failed to fork child process.  %m.");
-
-    if (pid == 0)
-    {
-        // Launch the child program.  This should not return unless there was an error.
-        execlp("sdir", "sdir", "load", (char*)NULL);
-        // The program could not be started.
-        LE_FATAL("'sdir' could not be started: %m");
-    }
+    pid_t pid = spawn_Start(&attr);
+    LE_FATAL_IF(pid < 0, "'sdir' could not be started: %m");
 
     int status;
     pid_t p;
@@ -216,58 +210,33 @@ static void StartDaemon
     int syncPipeFd[2];
     LE_FATAL_IF(pipe(syncPipeFd) != 0, "Could not create synchronization pipe.  %m.");
 
-    // Fork a process.
-    pid_t pid = fork();
-    LE_FATAL_IF(pid < 0, "Failed to fork child process.  %m.");
+    // Start the daemon with the write end of the pipe on its standard in, so that it knows where
+    // it is, all other non-standard fds closed and all signals unblocked.
+    char* argv[] = { (char*)daemonNamePtr, NULL };
+    sigset_t sigSet;
+    LE_ASSERT(sigemptyset(&sigSet) == 0);
 
-    if (pid == 0)
+    spawn_Attr_t attr =
     {
-        // Clear the signal mask so the child does not inherit our signal mask.
-        sigset_t sigSet;
-        LE_ASSERT(sigfillset(&sigSet) == 0);
-        LE_ASSERT(pthread_sigmask(SIG_UNBLOCK, &sigSet, NULL) == 0);
-
-        // The child does not need the read end of the pipe so close it.
-        fd_Close(syncPipeFd[0]);
-
-        // Duplicate the write end of the pipe on standard in so the execed program will know
-        // where it is.
-        if (syncPipeFd[1] != STDIN_FILENO)
-        {
-            int r;
-            do
-            {
-                r = dup2(syncPipeFd[1], STDIN_FILENO);
-            }
-            while ( (r == -1)  && (errno == EINTR) );
-
-            LE_FATAL_IF(r == -1, "Failed to duplicate fd.  %m.");
-
-            // Close the duplicate fd.
-            fd_Close(syncPipeFd[1]);
-        }
-
-        // Close all non-standard fds.
-        fd_CloseAllNonStd();
-
-        // Update daemon needs CAP_MAC_ADMIN during the update process
-        if (strcmp(daemonPtr->path, SYSTEM_BIN_PATH "/updateDaemon") == 0)
-        {
-            LE_INFO("Setting updateDaemon with admin label.");
-            smack_SetMyLabel("admin");
-        }
-        else
-        {
-            smack_SetMyLabel("framework");
-        }
-
-        // Launch the child program.  This should not return unless there was an error.
-        execl(daemonPtr->path, daemonNamePtr, (char*)NULL);
-
-        // The program could not be started.
-        LE_FATAL("'%s' could not be started: %m", daemonPtr->path);
+        .pathPtr = daemonPtr->path,
+        .argvPtr = argv,
+        .fdMap = { { syncPipeFd[1], STDIN_FILENO } },
+        .numFdMaps = 1,
+        .closeFdsFrom = STDERR_FILENO + 1,
+        .sigMaskPtr = &sigSet,
+        .smackLabelPtr = "framework"
+    };
+
+    // Update daemon needs CAP_MAC_ADMIN during the update process
+    if (strcmp(daemonPtr->path, SYSTEM_BIN_PATH "/updateDaemon") == 0)
+    {
+        LE_INFO("Setting updateDaemon with admin label.");
+        attr.smackLabelPtr = "admin";
     }
 
+    pid_t pid = spawn_Start(&attr);
+    LE_FATAL_IF(pid < 0, "'%s' could not be started: %m", daemonPtr->path);
+
     // Store the pid of the running daemon process.
     daemonPtr->pid = pid;
 
@@ -9,11 +9,14 @@
 #include "limit.h"
 #include "fileDescriptor.h"
 #include "smack.h"
+#include "spawn.h"
 #include "sysPaths.h"
 #include "kernelModules.h"
 #include "le_cfg_interface.h"
 #include "supervisor.h"
 
+#include <sys/syscall.h>
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Memory pool size for module objects and strings
@@ -57,6 +60,22 @@
 #define INSMOD_COMMAND "/sbin/insmod"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of the parameter string passed to finit_module(), including the null-terminator.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KMODULE_MAX_PARAMS_BYTES 4096
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of modules loaded concurrently at start-up.
+ */
+//--------------------------------------------------------------------------------------------------
+#define KMODULE_MAX_PARALLEL_LOADS 8
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Module remove command and format, argument is module name
@@ -110,6 +129,7 @@ typedef struct
     bool               isOptional;                           // is the module required or optional
     le_dls_Link_t      dependencyLink;                       // link object for dependency list
     le_dls_Link_t      alphabeticalLink;                     // link object for alphabetical list
+    le_dls_Link_t      loadLink;                             // link object for start-up load list
     le_sls_Link_t      cyclicDepLink;                        // link object for cyclic dep list
     uint32_t           useCount;                             // Counter of usage, safe to remove
                                                              // module when counter is 0
@@ -141,6 +161,30 @@ static struct {
 } KModuleHandler = {NULL};
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Module load job, run by a worker thread so that independent modules are loaded concurrently.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    KModuleObj_t       *module;                              // Module to load
+    char               params[KMODULE_MAX_PARAMS_BYTES];     // Module parameters
+    le_thread_Ref_t    thread;                               // Worker thread, NULL if not started
+    int                error;                                // errno of the load, 0 on success
+    le_result_t        result;                               // Result of the module installation
+}
+LoadJob_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Module load jobs of a start-up load wave.
+ */
+//--------------------------------------------------------------------------------------------------
+static LoadJob_t LoadJobs[KMODULE_MAX_PARALLEL_LOADS];
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Doubly linked list that stores the modules in alphabetical order of module name.
@@ -243,29 +287,22 @@ static le_result_t ExecuteCommand(char *argv[], int argc, int *filedes)
 
     LE_INFO("Execute '%s'", logStr);
 
-    pid = fork();
-    LE_FATAL_IF(-1 == pid, "fork() failed. (%m)");
+    spawn_Attr_t attr = { .pathPtr = argv[0], .argvPtr = argv };
 
-    if (0 == pid)
+    /* If file descriptor is provided, output of child process needs to be captured. */
+    if (filedes != NULL)
     {
-        /* If file descriptor is provided, output of child process needs to be captured. */
-        if (filedes != NULL)
-        {
-            int ret = dup2(filedes[1], STDOUT_FILENO);
-            if (ret == -1)
-            {
-                LE_ERROR("Internal error: cannot duplicate a file descriptor (%m)");
-                return LE_FAULT;
-            }
-
-            fd_Close(filedes[1]);
-            fd_Close(filedes[0]);
-        }
+        attr.fdMap[0].srcFd = filedes[1];
+        attr.fdMap[0].destFd = STDOUT_FILENO;
+        attr.numFdMaps = 1;
+        attr.closeFdsFrom = STDERR_FILENO + 1;
+    }
 
-        /* Child, exec command. */
-        execv(argv[0], argv);
-        /* Should never be here. */
-        LE_FATAL("Failed to run '%s %s'. Reason: (%d), %m", argv[0], argv[1], errno);
+    pid = spawn_Start(&attr);
+    if (-1 == pid)
+    {
+        LE_ERROR("Failed to run '%s %s'. Reason: (%d), %m", argv[0], argv[1], errno);
+        return LE_FAULT;
     }
 
     /* Wait for command to complete; restart on EINTR. */
@@ -925,6 +962,7 @@ static void ModuleInsert(char *modName)
     m->isOptional = false;
     m->dependencyLink = LE_DLS_LINK_INIT;
     m->alphabeticalLink = LE_DLS_LINK_INIT;
+    m->loadLink = LE_DLS_LINK_INIT;
     m->isRequiredModule = false;
     m->isCyclicDependency = false;
     m->visited = false;
@@ -1023,10 +1061,257 @@ static le_result_t TraverseDependencyInsert
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Build the parameter string of a module from its list of parameters.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t BuildLoadParams(KModuleObj_t *mod, char *params, size_t size)
+{
+    size_t len = 0;
+    int i;
+
+    params[0] = '\0';
+
+    for (i = 2; i < mod->argc; i++)
+    {
+        size_t printSize = snprintf(params + len, size - len, "%s%s",
+                                    (len == 0) ? "" : " ", mod->argv[i]);
+
+        if (printSize >= size - len)
+        {
+            LE_ERROR("Parameters list too long for module '%s'", mod->name);
+            return LE_OVERFLOW;
+        }
+
+        len += printSize;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load a module with finit_module().
+ *
+ * Run by the worker threads: it must not log nor call any other Legato API, since the main thread
+ * may fork at the same time.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* LoadModuleThread(void *contextPtr)
+{
+    LoadJob_t *job = contextPtr;
+
+#ifdef SYS_finit_module
+    int fd = open(job->module->path, O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1)
+    {
+        job->error = errno;
+        return NULL;
+    }
+
+    job->error = (syscall(SYS_finit_module, fd, job->params, 0) == 0) ? 0 : errno;
+
+    close(fd);
+#else
+    job->error = ENOSYS;
+#endif
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start loading a module in a worker thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartLoad(LoadJob_t *job)
+{
+    job->thread = NULL;
+    job->error = 0;
+
+    if (BuildLoadParams(job->module, job->params, sizeof(job->params)) != LE_OK)
+    {
+        job->error = E2BIG;
+        return;
+    }
+
+    LE_INFO("Load '%s %s'", job->module->path, job->params);
+
+    job->thread = le_thread_Create("ModuleLoad", LoadModuleThread, job);
+    le_thread_SetJoinable(job->thread);
+    le_thread_Start(job->thread);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wait for a module to be loaded and check the result.
+ * Kernels without finit_module() fall back to insmod.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FinishLoad(LoadJob_t *job)
+{
+    KModuleObj_t *mod = job->module;
+
+    if (job->thread != NULL)
+    {
+        le_thread_Join(job->thread, NULL);
+        job->thread = NULL;
+    }
+
+    switch (job->error)
+    {
+        case 0:
+            return LE_OK;
+
+        case EEXIST:
+            LE_INFO("Module '%s' is already loaded.", mod->name);
+            return LE_OK;
+
+        case ENOSYS:
+            mod->argv[0] = INSMOD_COMMAND;
+            return ExecuteCommand(mod->argv, mod->argc, NULL);
+
+        default:
+            LE_CRIT("Failed to load module '%s'. Reason: (%d), %s",
+                    mod->name, job->error, strerror(job->error));
+            return LE_FAULT;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Load a module from the calling thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t LoadModule(KModuleObj_t *mod)
+{
+    LoadJob_t job = { .module = mod, .thread = NULL, .error = 0 };
+
+    if (BuildLoadParams(mod, job.params, sizeof(job.params)) != LE_OK)
+    {
+        return LE_FAULT;
+    }
+
+    LE_INFO("Load '%s %s'", mod->path, job.params);
+
+    LoadModuleThread(&job);
+
+    return FinishLoad(&job);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * modprobe the system dependency modules of a Legato kernel module
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t InstallSystemDependencies(KModuleObj_t *mod)
+{
+    le_result_t result;
+    le_sls_Link_t *depModNameLinkPtr = le_sls_Peek(&(mod->dependsModuleName));
+
+    while (depModNameLinkPtr != NULL)
+    {
+        DepModNameNode_t* depModNameNodePtr = CONTAINER_OF(depModNameLinkPtr,
+                                                           DepModNameNode_t, link);
+        char *depargv[] = {MODPROBE_COMMAND, depModNameNodePtr->modName, NULL};
+
+        result = ExecuteCommand(depargv, ARRAY_LENGTH(depargv)-1, NULL);
+        if (result != LE_OK)
+        {
+            LE_CRIT("Command '%s' '%s' execution failed.", depargv[0], depargv[1]);
+            return result;
+        }
+
+        DepModNameNode_t *depModPtr = le_hashmap_Get(KModuleHandler.dependModuleTable,
+                                                     depModNameNodePtr->modName);
+        if (depModPtr == NULL)
+        {
+            LE_ERROR("Lookup for module '%s' failed.", depModNameNodePtr->modName);
+            return LE_NOT_FOUND;
+        }
+
+        depModPtr->useCount++;
+        depModNameLinkPtr = le_sls_PeekNext(&(mod->dependsModuleName), depModNameLinkPtr);
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Execute the install script of a module and check that the module is live
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t RunInstallScript(KModuleObj_t *mod)
+{
+    char *scriptargv[] = {mod->installScript, mod->path, NULL};
+    ProcModules_t procModules;
+
+    if (ExecuteCommand(scriptargv, ARRAY_LENGTH(scriptargv)-1, NULL) != LE_OK)
+    {
+        LE_CRIT("Install script '%s' execution failed", mod->installScript);
+        return LE_FAULT;
+    }
+
+    /* Read module load status from /proc/modules */
+    procModules =  CheckProcModules(mod->name);
+
+    if (procModules.loadStatus != STATUS_INSTALLED)
+    {
+        LE_INFO("Module '%s' not in 'Live' state, wait for 10 seconds.", mod->name);
+        sleep(10);
+
+        /* If the module is not in live state, wait for 10 seconds to see if the
+         * module recovers to live state, otherwise restart the system.
+         */
+        if (procModules.loadStatus != STATUS_INSTALLED)
+        {
+            LE_CRIT("Module '%s' not in 'Live' state.", mod->name);
+            return LE_FAULT;
+        }
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the result of a module installation. Failures of optional modules are ignored.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CompleteInstall(KModuleObj_t *mod, le_result_t result)
+{
+    if (result != LE_OK)
+    {
+        if (mod->isOptional)
+        {
+            LE_INFO("Ignoring failure. "
+                     "Module '%s' failed to load and is an optional module.", mod->name);
+            return LE_OK;
+        }
+        return result;
+    }
+
+    mod->moduleLoadStatus = STATUS_INSTALLED;
+    LE_INFO("New kernel module '%s'", mod->name);
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Install each kernel module.
- * modprobe the system dependency module and insmod the Legato kernel module.
+ * modprobe the system dependency module and load the Legato kernel module.
  */
 //--------------------------------------------------------------------------------------------------
 static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
@@ -1035,7 +1320,6 @@ static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
     le_dls_Link_t *listLink;
     /* The ordered list of required kernel modules to install */
     le_dls_List_t ModuleInsertList = LE_DLS_LIST_INIT;
-    ProcModules_t procModules;
 
     result = TraverseDependencyInsert(&ModuleInsertList, m, enableUseCount);
     if (result != LE_OK)
@@ -1061,97 +1345,28 @@ static le_result_t InstallEachKernelModule(KModuleObj_t *m, bool enableUseCount)
 
         if (mod->moduleLoadStatus != STATUS_INSTALLED)
         {
-            le_sls_Link_t *depModNameLinkPtr = le_sls_Peek(&(mod->dependsModuleName));
-
-            while (depModNameLinkPtr != NULL)
+            /* Install dependency system modules if any before installing the Legato module */
+            result = InstallSystemDependencies(mod);
+            if (result != LE_OK)
             {
-                /* Install dependency system modules if any before installing the Legato module */
-                DepModNameNode_t* depModNameNodePtr = CONTAINER_OF(depModNameLinkPtr,
-                                                                   DepModNameNode_t, link);
-                char *depargv[] = {MODPROBE_COMMAND, depModNameNodePtr->modName, NULL};
-
-                result = ExecuteCommand(depargv, ARRAY_LENGTH(depargv)-1, NULL);
-                if (result != LE_OK)
-                {
-                    LE_CRIT("Command '%s' '%s' execution failed.", depargv[0], depargv[1]);
-                    return result;
-                }
-
-                DepModNameNode_t *depModPtr = le_hashmap_Get(KModuleHandler.dependModuleTable,
-                                                             depModNameNodePtr->modName);
-                if (depModPtr == NULL)
-                {
-                    LE_ERROR("Lookup for module '%s' failed.", depModNameNodePtr->modName);
-                    return LE_NOT_FOUND;
-                }
-
-                depModPtr->useCount++;
-                depModNameLinkPtr = le_sls_PeekNext(&(mod->dependsModuleName), depModNameLinkPtr);
+                return result;
             }
 
-            /* If install script is provided, execute the script otherwise execute insmod */
+            /* If install script is provided, execute the script otherwise load the module */
             if (strcmp(mod->installScript, "") != 0)
             {
-                char *scriptargv[] = {mod->installScript, mod->path, NULL};
-
-                result = ExecuteCommand(scriptargv, ARRAY_LENGTH(scriptargv)-1, NULL);
-                if (result != LE_OK)
-                {
-                    LE_CRIT("Install script '%s' execution failed", mod->installScript);
-
-                    if (mod->isOptional)
-                    {
-                        continue;
-                    }
-                    return result;
-                }
-
-                /* Read module load status from /proc/modules */
-                procModules =  CheckProcModules(mod->name);
-
-                if (procModules.loadStatus != STATUS_INSTALLED)
-                {
-                    LE_INFO("Module '%s' not in 'Live' state, wait for 10 seconds.", mod->name);
-                    sleep(10);
-
-                    /* If the module is not in live state, wait for 10 seconds to see if the
-                     * module recovers to live state, otherwise restart the system.
-                     */
-                    if (procModules.loadStatus != STATUS_INSTALLED)
-                    {
-                        if (mod->isOptional)
-                        {
-                            LE_INFO(
-                                "Module '%s' not in 'Live' state and is optional. "
-                                "Skip restarting system.",
-                                mod->name);
-                            continue;
-                        }
-
-                        LE_CRIT("Module '%s' not in 'Live' state. Restart system ...", mod->name);
-                        return LE_FAULT;
-                    }
-                }
+                result = RunInstallScript(mod);
             }
             else
             {
-                mod->argv[0] = INSMOD_COMMAND;
-
-                result = ExecuteCommand(mod->argv, mod->argc, NULL);
-                if (result != LE_OK)
-                {
-                    if (mod->isOptional)
-                    {
-                        LE_INFO("Ignoring failure. "
-                                 "Module '%s' failed to load and is an optional module.", mod->name);
-                        continue;
-                    }
-                    return result;
-                }
+                result = LoadModule(mod);
             }
 
-            mod->moduleLoadStatus = STATUS_INSTALLED;
-            LE_INFO("New kernel module '%s'", mod->name);
+            result = CompleteInstall(mod, result);
+            if (result != LE_OK)
+            {
+                return result;
+            }
         }
     }
     return LE_OK;
@@ -1241,6 +1456,135 @@ static void setIsRequiredModule()
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if all the modules required by a module have been processed, so that it can be loaded
+ * with the current load wave.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsModuleReady
+(
+    KModuleObj_t *m,
+    le_dls_List_t *pendingListPtr,
+    le_dls_List_t *waveListPtr
+)
+{
+    le_sls_Link_t* modNameLinkPtr = le_sls_Peek(&(m->reqModuleName));
+
+    while (modNameLinkPtr != NULL)
+    {
+        ModNameNode_t* modNameNodePtr = CONTAINER_OF(modNameLinkPtr, ModNameNode_t, link);
+        KModuleObj_t* KModulePtr = le_hashmap_Get(KModuleHandler.moduleTable,
+                                                  modNameNodePtr->modName);
+
+        if ((KModulePtr != NULL) &&
+            (le_dls_IsInList(pendingListPtr, &(KModulePtr->loadLink)) ||
+             le_dls_IsInList(waveListPtr, &(KModulePtr->loadLink))))
+        {
+            return false;
+        }
+
+        modNameLinkPtr = le_sls_PeekNext(&(m->reqModuleName), modNameLinkPtr);
+    }
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Install a list of modules in waves: each wave holds modules whose required modules have all been
+ * processed by the previous waves, those modules are loaded concurrently.
+ *
+ * System dependency modules and install scripts are run from the main thread, while the other
+ * modules of the wave are loaded by worker threads.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t InstallModulesInWaves(le_dls_List_t *pendingListPtr)
+{
+    while (!le_dls_IsEmpty(pendingListPtr))
+    {
+        le_dls_List_t waveList = LE_DLS_LIST_INIT;
+        le_dls_Link_t* linkPtr = le_dls_Peek(pendingListPtr);
+        le_result_t result = LE_OK;
+        size_t numJobs = 0;
+        size_t i;
+
+        /* Pick the modules of the wave */
+        while ((linkPtr != NULL) && (numJobs < KMODULE_MAX_PARALLEL_LOADS))
+        {
+            KModuleObj_t *mod = CONTAINER_OF(linkPtr, KModuleObj_t, loadLink);
+            linkPtr = le_dls_PeekNext(pendingListPtr, linkPtr);
+
+            if (IsModuleReady(mod, pendingListPtr, &waveList))
+            {
+                le_dls_Remove(pendingListPtr, &(mod->loadLink));
+                le_dls_Queue(&waveList, &(mod->loadLink));
+                LoadJobs[numJobs].module = mod;
+                numJobs++;
+            }
+        }
+
+        if (numJobs == 0)
+        {
+            LE_ERROR("Remaining modules have unresolved dependencies.");
+            return LE_FAULT;
+        }
+
+        /* Install dependency system modules and start loading the Legato modules */
+        for (i = 0; i < numJobs; i++)
+        {
+            LoadJob_t *job = &LoadJobs[i];
+
+            job->thread = NULL;
+            job->result = InstallSystemDependencies(job->module);
+
+            if ((job->result == LE_OK) && (strcmp(job->module->installScript, "") == 0))
+            {
+                StartLoad(job);
+            }
+        }
+
+        /* Execute the install scripts while the other modules are loading */
+        for (i = 0; i < numJobs; i++)
+        {
+            LoadJob_t *job = &LoadJobs[i];
+
+            if ((job->result == LE_OK) && (strcmp(job->module->installScript, "") != 0))
+            {
+                job->result = CompleteInstall(job->module, RunInstallScript(job->module));
+            }
+        }
+
+        /* Wait for all the modules of the wave */
+        for (i = 0; i < numJobs; i++)
+        {
+            LoadJob_t *job = &LoadJobs[i];
+
+            if ((job->result == LE_OK) && (strcmp(job->module->installScript, "") == 0))
+            {
+                job->result = CompleteInstall(job->module, FinishLoad(job));
+            }
+
+            if (job->result != LE_OK)
+            {
+                LE_ERROR("Error in installing module %s.", job->module->name);
+                result = job->result;
+            }
+
+            le_dls_Remove(&waveList, &(job->module->loadLink));
+        }
+
+        if (result != LE_OK)
+        {
+            return result;
+        }
+    }
+
+    return LE_OK;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Iterate through the module table and install kernel module
@@ -1251,6 +1595,9 @@ static void installModules()
     KModuleObj_t *modPtr;
     le_result_t result;
     le_dls_Link_t* linkPtr;
+    le_dls_Link_t* listLink;
+    /* The modules to install, whatever the order */
+    le_dls_List_t pendingList = LE_DLS_LIST_INIT;
 
     /* Traverse linked list in alphabetical order of module name and traverse dependencies. */
     linkPtr = le_dls_Peek(&ModuleAlphaOrderList);
@@ -1258,6 +1605,7 @@ static void installModules()
     {
         modPtr = CONTAINER_OF(linkPtr, KModuleObj_t, alphabeticalLink);
         LE_ASSERT(modPtr != NULL);
+        linkPtr = le_dls_PeekNext(&ModuleAlphaOrderList, linkPtr);
 
         /*
          * Skip if the modules are loaded manually via app or if it is a required module.
@@ -1266,19 +1614,47 @@ static void installModules()
          */
         if (modPtr->isLoadManual)
         {
-            linkPtr = le_dls_PeekNext(&ModuleAlphaOrderList, linkPtr);
             continue;
         }
 
-        result = InstallEachKernelModule(modPtr, true);
+        /* The ordered list of required kernel modules to install */
+        le_dls_List_t ModuleInsertList = LE_DLS_LIST_INIT;
+
+        result = TraverseDependencyInsert(&ModuleInsertList, modPtr, true);
+
+        /* Add the modules to the list of modules to install */
+        while ((listLink = le_dls_Pop(&ModuleInsertList)) != NULL)
+        {
+            KModuleObj_t *mod = CONTAINER_OF(listLink, KModuleObj_t, dependencyLink);
+
+            if ((result == LE_OK) && (mod->moduleLoadStatus != STATUS_INSTALLED) &&
+                !le_dls_IsInList(&pendingList, &(mod->loadLink)))
+            {
+                le_dls_Queue(&pendingList, &(mod->loadLink));
+            }
+        }
+
         if (result != LE_OK)
         {
-            LE_ERROR("Error in installing module %s. Restarting system ...", modPtr->name);
+            /* If the module is marked optional, ignore fault, otherwise take fault action. */
+            if (modPtr->isOptional)
+            {
+                LE_WARN("Traversing module '%s' dependencies failed, ignore as module is optional",
+                        modPtr->name);
+                continue;
+            }
+
+            LE_ERROR("Traversing module '%s' dependencies failed. Restarting system ...",
+                     modPtr->name);
             framework_Reboot();
-            break;
+            return;
         }
+    }
 
-        linkPtr = le_dls_PeekNext(&ModuleAlphaOrderList, linkPtr);
+    if (InstallModulesInWaves(&pendingList) != LE_OK)
+    {
+        LE_ERROR("Error in installing modules. Restarting system ...");
+        framework_Reboot();
     }
 }
 
@@ -136,6 +136,52 @@
                                                                 // NULL-terminator.
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Largest size of the strings of a launch descriptor: the executable path and the command line
+ * arguments, then the name and value of the environment variables.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LAUNCH_DESC_MAX_STRINGS_BYTES   ((LIMIT_MAX_NUM_CMD_LINE_ARGS + 1) * LIMIT_MAX_ARGS_STR_BYTES \
+                                         + LIMIT_MAX_NUM_ENV_VARS *                                  \
+                                           (LIMIT_MAX_ENV_VAR_NAME_BYTES + LIMIT_MAX_PATH_BYTES))
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the strings of the small launch descriptors, which fit most processes.
+ */
+//--------------------------------------------------------------------------------------------------
+#define LAUNCH_DESC_SMALL_STRINGS_BYTES 1024
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Launch descriptor of a process.
+ *
+ * Holds everything that is read from the config tree to start the process.  It is built with a
+ * single read transaction the first time the process is started, and dropped when the generation
+ * of the config tree changes, so that restarting a process costs a single config tree request.
+ *
+ * The strings are packed one after the other, each null-terminated: the executable path and the
+ * command line arguments first, then the name and the value of each environment variable.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    resLim_ProcLimits_t limits;                     ///< Resource limits.
+    char    priority[LIMIT_MAX_PRIORITY_NAME_BYTES];///< Priority string.
+    size_t  numArgs;                                ///< Number of strings in the arguments list,
+                                                    ///  executable path included.  0 if there is
+                                                    ///  no arguments list.
+    size_t  numEnvVars;                             ///< Number of environment variables.
+    size_t  envVarsOffset;                          ///< Offset of the first environment variable
+                                                    ///  in the strings.
+    char    strings[];                              ///< Packed strings.
+}
+LaunchDesc_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * The process object.
@@ -167,6 +213,9 @@ typedef struct proc_Ref
     proc_BlockCallback_t  blockCallback;  ///< Callback function to indicate when the process is
                                           ///  has been blocked after the fork but before the exec.
     void* blockContextPtr;          ///< Context pointer for the blockCallback.
+    LaunchDesc_t* launchDescPtr;    ///< Launch descriptor.  NULL until the process is started.
+    uint32_t launchDescGeneration;  ///< Generation of the config tree the launch descriptor was
+                                    ///  read from.
 }
 Process_t;
 
@@ -218,25 +267,21 @@ static le_mem_PoolRef_t ArgsPool;
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Nice level definitions for the different Legato priority levels.
+ * The memory pools for launch descriptors: the small descriptors and the largest ones.
  */
 //--------------------------------------------------------------------------------------------------
-#define LOW_PRIORITY_NICE_LEVEL         10
-#define MEDIUM_PRIORITY_NICE_LEVEL      0
-#define HIGH_PRIORITY_NICE_LEVEL        -10
+static le_mem_PoolRef_t LaunchDescPool;
+static le_mem_PoolRef_t SmallLaunchDescPool;
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Environment variable type.
+ * Nice level definitions for the different Legato priority levels.
  */
 //--------------------------------------------------------------------------------------------------
-typedef struct
-{
-    char            name[LIMIT_MAX_ENV_VAR_NAME_BYTES];     // The variable name.
-    char            value[LIMIT_MAX_PATH_BYTES];            // The variable value.
-}
-EnvVar_t;
+#define LOW_PRIORITY_NICE_LEVEL         10
+#define MEDIUM_PRIORITY_NICE_LEVEL      0
+#define HIGH_PRIORITY_NICE_LEVEL        -10
 
 
 //--------------------------------------------------------------------------------------------------
@@ -386,6 +431,11 @@ void proc_Init
     PathPool = le_mem_CreatePool("Paths", LIMIT_MAX_PATH_BYTES);
     PriorityPool = le_mem_CreatePool("Priority", LIMIT_MAX_PRIORITY_NAME_BYTES);
     ArgsPool = le_mem_CreatePool("Args", sizeof(Arg_t));
+    LaunchDescPool = le_mem_CreatePool("LaunchDescs",
+                                       sizeof(LaunchDesc_t) + LAUNCH_DESC_MAX_STRINGS_BYTES);
+    SmallLaunchDescPool = le_mem_CreateReducedPool(LaunchDescPool, "SmallLaunchDescs", 0,
+                                                   sizeof(LaunchDesc_t) +
+                                                   LAUNCH_DESC_SMALL_STRINGS_BYTES);
 }
 
 
@@ -470,6 +520,8 @@ proc_Ref_t proc_Create
     procPtr->blockPipe = -1;
     procPtr->blockCallback = NULL;
     procPtr->blockContextPtr = NULL;
+    procPtr->launchDescPtr = NULL;
+    procPtr->launchDescGeneration = 0;
 
     // Get watchdog action & fault action from config tree now, if this process has a config
     // tree entry.
@@ -523,6 +575,12 @@ void proc_Delete
     // Delete arguments override list.
     proc_ClearArgs(procRef);
 
+    // Delete the launch descriptor.
+    if (procRef->launchDescPtr != NULL)
+    {
+        le_mem_Release(procRef->launchDescPtr);
+    }
+
     // Close any open file descriptors.
     if (procRef->stdInFd != -1)
     {
@@ -665,132 +723,184 @@ le_result_t SetProcPriority
 //--------------------------------------------------------------------------------------------------
 static void SetSchedulingPriority
 (
-    proc_Ref_t procRef      ///< [IN] The process to set the priority for.
+    proc_Ref_t procRef,             ///< [IN] The process to set the priority for.
+    const LaunchDesc_t* descPtr     ///< [IN] The launch descriptor of the process.
 )
 {
-    char priorStr[LIMIT_MAX_PRIORITY_NAME_BYTES] = "medium";
-    char* priorStrPtr = priorStr;
+    const char* priorStrPtr = descPtr->priority;
 
     if (procRef->priorityPtr != NULL)
     {
         priorStrPtr = procRef->priorityPtr;
     }
-    else if (procRef->cfgPathPtr != NULL)
+
+    if (SetProcPriority(priorStrPtr, procRef->pid) != LE_OK)
     {
-        // Read the priority setting from the config tree.
-        le_cfg_IteratorRef_t procCfg = le_cfg_CreateReadTxn(procRef->cfgPathPtr);
+        kill_Hard(procRef->pid);
+    }
+}
 
-        if (le_cfg_GetString(procCfg, CFG_NODE_PRIORITY, priorStr, sizeof(priorStr), "medium") != LE_OK)
-        {
-            LE_CRIT("Priority string for process %s is too long.  Using default priority.", procRef->namePtr);
 
-            LE_ASSERT(le_utf8_Copy(priorStr, "medium", sizeof(priorStr), NULL) == LE_OK);
-        }
+//--------------------------------------------------------------------------------------------------
+/**
+ * Appends the string value of the node under the iterator to the strings of a launch descriptor.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_OVERFLOW if the string did not fit in maxBytes.  The truncated string is left in the
+ *                  strings, for error reporting.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t AppendCfgString
+(
+    le_cfg_IteratorRef_t procCfg,   ///< [IN] Iterator on the node to read.
+    char* stringsPtr,               ///< [IN] The strings of the launch descriptor.
+    size_t* usedPtr,                ///< [IN/OUT] The number of bytes used in the strings.
+    size_t maxBytes                 ///< [IN] The maximum size of the string, null-terminator
+                                    ///       included.
+)
+{
+    char* strPtr = stringsPtr + *usedPtr;
 
-        le_cfg_CancelTxn(procCfg);
-    }
+    le_result_t result = le_cfg_GetString(procCfg, "", strPtr, maxBytes, "");
 
-    if (SetProcPriority(priorStrPtr, procRef->pid) != LE_OK)
+    if (result == LE_OK)
     {
-        kill_Hard(procRef->pid);
+        *usedPtr += strlen(strPtr) + 1;
     }
+
+    return result;
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Gets the environment variable from the list of environment variables in the config tree.
+ * Reads the executable path and the command line arguments of a process into its launch
+ * descriptor.  The iterator is moved back to the process node.
  *
  * @return
- *      The number of environment variables read from the config tree if successful.
+ *      LE_OK if successful.
  *      LE_FAULT if there was an error.
  */
 //--------------------------------------------------------------------------------------------------
-static le_result_t GetEnvironmentVariables
+static le_result_t ReadArgs
 (
-    proc_Ref_t procRef,     ///< [IN] The process to get the environment variables for.
-    EnvVar_t envVars[],     ///< [IN] The list of environment variables.
-    size_t maxNumEnvVars    ///< [IN] The maximum number of items envVars can hold.
+    proc_Ref_t procRef,             ///< [IN] The process.
+    le_cfg_IteratorRef_t procCfg,   ///< [IN] Iterator on the process node.
+    LaunchDesc_t* descPtr,          ///< [IN] The launch descriptor being built.
+    char* stringsPtr,               ///< [IN] The strings of the launch descriptor.
+    size_t* usedPtr                 ///< [IN/OUT] The number of bytes used in the strings.
 )
 {
-    int numEnvVars = 0;
+    le_cfg_GoToNode(procCfg, CFG_NODE_ARGS);
 
-    if (procRef->cfgPathPtr != NULL)
+    // A missing arguments list is only an error if the process is started without an executable
+    // path override, so it is reported when the process is started.
+    if (le_cfg_GoToFirstChild(procCfg) != LE_OK)
     {
-        le_cfg_IteratorRef_t procCfg = le_cfg_CreateReadTxn(procRef->cfgPathPtr);
-        le_cfg_GoToNode(procCfg, CFG_NODE_ENV_VARS);
+        le_cfg_GoToParent(procCfg);
+        return LE_OK;
+    }
 
-        if (le_cfg_GoToFirstChild(procCfg) != LE_OK)
-        {
-            LE_WARN("No environment variables for process '%s'.", procRef->namePtr);
+    // Record the executable path.
+    if (AppendCfgString(procCfg, stringsPtr, usedPtr, LIMIT_MAX_ARGS_STR_BYTES) != LE_OK)
+    {
+        LE_ERROR("Error reading argument '%s...' for process '%s'.",
+                 stringsPtr + *usedPtr,
+                 procRef->namePtr);
+        return LE_FAULT;
+    }
 
-            le_cfg_CancelTxn(procCfg);
-            return 0;
+    descPtr->numArgs = 1;
+
+    // Record the arguments.
+    while (le_cfg_GoToNextSibling(procCfg) == LE_OK)
+    {
+        if (descPtr->numArgs > LIMIT_MAX_NUM_CMD_LINE_ARGS)
+        {
+            LE_ERROR("Too many arguments for process '%s'.", procRef->namePtr);
+            return LE_FAULT;
         }
 
-        int i = 0;
-        for (i = 0; i < maxNumEnvVars; i++)
+        char* argPtr = stringsPtr + *usedPtr;
+
+        if (AppendCfgString(procCfg, stringsPtr, usedPtr, LIMIT_MAX_ARGS_STR_BYTES) != LE_OK)
         {
-            if ( (le_cfg_GetNodeName(procCfg, "", envVars[i].name, LIMIT_MAX_ENV_VAR_NAME_BYTES) != LE_OK) ||
-                 (le_cfg_GetString(procCfg, "", envVars[i].value, LIMIT_MAX_PATH_BYTES, "") != LE_OK) )
-            {
-                le_cfg_CancelTxn(procCfg);
-                goto errorReading;
-            }
+            LE_ERROR("Argument too long '%s...' for process '%s'.", argPtr, procRef->namePtr);
+            return LE_FAULT;
+        }
 
-            if (le_cfg_GoToNextSibling(procCfg) != LE_OK)
-            {
-                break;
-            }
-            else if (i >= maxNumEnvVars-1)
-            {
-                le_cfg_CancelTxn(procCfg);
-                goto errorReading;
-            }
+        // Only an empty string needs to be checked for an empty node.
+        if ((argPtr[0] == '\0') && le_cfg_IsEmpty(procCfg, ""))
+        {
+            LE_ERROR("Empty node in argument list for process '%s'.", procRef->namePtr);
+            return LE_FAULT;
         }
 
-        le_cfg_CancelTxn(procCfg);
+        descPtr->numArgs++;
+    }
+
+    le_cfg_GoToParent(procCfg);
+    le_cfg_GoToParent(procCfg);
 
-        numEnvVars = i + 1;
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reads the environment variables of a process into its launch descriptor.  The iterator is moved
+ * back to the process node.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReadEnvironmentVariables
+(
+    proc_Ref_t procRef,             ///< [IN] The process.
+    le_cfg_IteratorRef_t procCfg,   ///< [IN] Iterator on the process node.
+    LaunchDesc_t* descPtr,          ///< [IN] The launch descriptor being built.
+    char* stringsPtr,               ///< [IN] The strings of the launch descriptor.
+    size_t* usedPtr                 ///< [IN/OUT] The number of bytes used in the strings.
+)
+{
+    le_cfg_GoToNode(procCfg, CFG_NODE_ENV_VARS);
+
+    if (le_cfg_GoToFirstChild(procCfg) != LE_OK)
+    {
+        LE_WARN("No environment variables for process '%s'.", procRef->namePtr);
+
+        le_cfg_GoToParent(procCfg);
+        return LE_OK;
     }
-    // If the config path is NULL (likely because the process is auxiliary and thus "unconfigured"),
-    // then default PATH is provided depending on the app is sandboxed or not. This default PATH is
-    // the same as the one written to the config during app build-time.
-    else
+
+    do
     {
-        size_t size = sizeof(envVars[0].name);
-        if (snprintf(envVars[0].name, size, "PATH") >= size)
+        char* namePtr = stringsPtr + *usedPtr;
+
+        if ( (descPtr->numEnvVars >= LIMIT_MAX_NUM_ENV_VARS) ||
+             (le_cfg_GetNodeName(procCfg, "", namePtr, LIMIT_MAX_ENV_VAR_NAME_BYTES) != LE_OK) )
         {
             goto errorReading;
         }
 
-        size = sizeof(envVars[0].value);
-        if (app_GetIsSandboxed(procRef->appRef))
-        {
-            if (snprintf(envVars[0].value, size, "/usr/local/bin:/usr/bin:/bin") >= size)
-            {
-                goto errorReading;
-            }
-        }
-        else
+        *usedPtr += strlen(namePtr) + 1;
+
+        if (AppendCfgString(procCfg, stringsPtr, usedPtr, LIMIT_MAX_PATH_BYTES) != LE_OK)
         {
-            const char* appName = app_GetName(procRef->appRef);
-
-            if (snprintf(envVars[0].value, size,
-                         "/usr/local/bin:/usr/bin:/bin:/usr/local/sbin:/usr/sbin:/sbin:"
-                         "/legato/systems/current/appsWriteable/%s/bin:"
-                         "/legato/systems/current/appsWriteable/%s/usr/bin:"
-                         "/legato/systems/current/appsWriteable/%s/usr/local/bin",
-                         appName, appName, appName) >= size)
-            {
-                goto errorReading;
-            }
+            goto errorReading;
         }
 
-        numEnvVars = 1;
+        descPtr->numEnvVars++;
     }
+    while (le_cfg_GoToNextSibling(procCfg) == LE_OK);
+
+    le_cfg_GoToParent(procCfg);
+    le_cfg_GoToParent(procCfg);
 
-    return numEnvVars;
+    return LE_OK;
 
 errorReading:
 
@@ -799,6 +909,173 @@ errorReading:
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the default environment variables of an unconfigured process in its launch descriptor.
+ *
+ * The config path is NULL when the process is auxiliary and thus "unconfigured", a default PATH
+ * is then provided depending on the app is sandboxed or not.  This default PATH is the same as the
+ * one written to the config during app build-time.
+ *
+ * @return
+ *      LE_OK if successful.
+ *      LE_FAULT if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t SetDefaultEnvironmentVariables
+(
+    proc_Ref_t procRef,             ///< [IN] The process.
+    LaunchDesc_t* descPtr,          ///< [IN] The launch descriptor being built.
+    char* stringsPtr,               ///< [IN] The strings of the launch descriptor.
+    size_t* usedPtr                 ///< [IN/OUT] The number of bytes used in the strings.
+)
+{
+    size_t len;
+
+    strcpy(stringsPtr + *usedPtr, "PATH");
+    *usedPtr += sizeof("PATH");
+
+    if (app_GetIsSandboxed(procRef->appRef))
+    {
+        len = snprintf(stringsPtr + *usedPtr, LIMIT_MAX_PATH_BYTES,
+                       "/usr/local/bin:/usr/bin:/bin");
+    }
+    else
+    {
+        const char* appName = app_GetName(procRef->appRef);
+
+        len = snprintf(stringsPtr + *usedPtr, LIMIT_MAX_PATH_BYTES,
+                       "/usr/local/bin:/usr/bin:/bin:/usr/local/sbin:/usr/sbin:/sbin:"
+                       "/legato/systems/current/appsWriteable/%s/bin:"
+                       "/legato/systems/current/appsWriteable/%s/usr/bin:"
+                       "/legato/systems/current/appsWriteable/%s/usr/local/bin",
+                       appName, appName, appName);
+    }
+
+    if (len >= LIMIT_MAX_PATH_BYTES)
+    {
+        LE_ERROR("Error reading environment variables for process '%s'.", procRef->namePtr);
+        return LE_FAULT;
+    }
+
+    *usedPtr += len + 1;
+    descPtr->numEnvVars = 1;
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Builds the launch descriptor of a process, reading its configuration in a single transaction.
+ *
+ * @return
+ *      The launch descriptor if successful.
+ *      NULL if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static LaunchDesc_t* BuildLaunchDesc
+(
+    proc_Ref_t procRef              ///< [IN] The process.
+)
+{
+    LaunchDesc_t desc = { .priority = "medium" };
+    char strings[LAUNCH_DESC_MAX_STRINGS_BYTES];
+    size_t used = 0;
+    le_result_t result;
+
+    if (procRef->cfgPathPtr != NULL)
+    {
+        le_cfg_IteratorRef_t procCfg = le_cfg_CreateReadTxn(procRef->cfgPathPtr);
+
+        if (le_cfg_GetString(procCfg, CFG_NODE_PRIORITY,
+                             desc.priority, sizeof(desc.priority), "medium") != LE_OK)
+        {
+            LE_CRIT("Priority string for process %s is too long.  Using default priority.",
+                    procRef->namePtr);
+
+            LE_ASSERT(le_utf8_Copy(desc.priority, "medium", sizeof(desc.priority), NULL) == LE_OK);
+        }
+
+        result = ReadArgs(procRef, procCfg, &desc, strings, &used);
+
+        if (result == LE_OK)
+        {
+            desc.envVarsOffset = used;
+            result = ReadEnvironmentVariables(procRef, procCfg, &desc, strings, &used);
+        }
+
+        // Done last, as the iterator is moved to the app node.
+        resLim_GetProcLimits(procCfg, &desc.limits);
+
+        le_cfg_CancelTxn(procCfg);
+    }
+    else
+    {
+        resLim_GetProcLimits(NULL, &desc.limits);
+
+        result = SetDefaultEnvironmentVariables(procRef, &desc, strings, &used);
+    }
+
+    if (result != LE_OK)
+    {
+        return NULL;
+    }
+
+    LaunchDesc_t* descPtr = le_mem_ForceVarAlloc(SmallLaunchDescPool, sizeof(LaunchDesc_t) + used);
+
+    *descPtr = desc;
+    memcpy(descPtr->strings, strings, used);
+
+    return descPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the launch descriptor of a process, building it if it is not available or if the config
+ * tree changed since it was built.
+ *
+ * The generation of the config tree is checked synchronously, so a change committed just before
+ * the process is started is never missed.
+ *
+ * @return
+ *      The launch descriptor if successful.
+ *      NULL if there was an error.
+ */
+//--------------------------------------------------------------------------------------------------
+static LaunchDesc_t* GetLaunchDesc
+(
+    proc_Ref_t procRef              ///< [IN] The process.
+)
+{
+    // Processes without a config tree entry use default settings only.  Otherwise, get the
+    // generation before reading the configuration so that no change is missed.
+    uint32_t generation = 0;
+
+    if (procRef->cfgPathPtr != NULL)
+    {
+        generation = le_cfg_GetTreeGeneration(procRef->cfgPathPtr);
+    }
+
+    if ( (procRef->launchDescPtr != NULL) && (procRef->launchDescGeneration != generation) )
+    {
+        LE_DEBUG("Configuration of process '%s' may have changed.", procRef->namePtr);
+
+        le_mem_Release(procRef->launchDescPtr);
+        procRef->launchDescPtr = NULL;
+    }
+
+    if (procRef->launchDescPtr == NULL)
+    {
+        procRef->launchDescPtr = BuildLaunchDesc(procRef);
+        procRef->launchDescGeneration = generation;
+    }
+
+    return procRef->launchDescPtr;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets the environment variable for the calling process.
@@ -808,8 +1085,7 @@ errorReading:
 //--------------------------------------------------------------------------------------------------
 static void SetEnvironmentVariables
 (
-    EnvVar_t envVars[],     ///< [IN] The list of environment variables.
-    int numEnvVars          ///< [IN] The number environment variables in the list.
+    const LaunchDesc_t* descPtr     ///< [IN] The launch descriptor of the process.
 )
 {
 #define OVER_WRITE_ENV_VAR      1
@@ -818,11 +1094,16 @@ static void SetEnvironmentVariables
     LE_ASSERT(clearenv() == 0);
 
     // Set the environment variables list.
-    int i;
-    for (i = 0; i < numEnvVars; i++)
+    const char* namePtr = descPtr->strings + descPtr->envVarsOffset;
+    size_t i;
+    for (i = 0; i < descPtr->numEnvVars; i++)
     {
+        const char* valuePtr = namePtr + strlen(namePtr) + 1;
+
         // Set the environment variable, overwriting anything that was previously there.
-        LE_ASSERT(setenv(envVars[i].name, envVars[i].value, OVER_WRITE_ENV_VAR) == 0);
+        LE_ASSERT(setenv(namePtr, valuePtr, OVER_WRITE_ENV_VAR) == 0);
+
+        namePtr = valuePtr + strlen(valuePtr) + 1;
     }
 }
 
@@ -835,11 +1116,8 @@ static void SetEnvironmentVariables
  * the process name to for this process.  Subsequent elements in the list will contain command line
  * arguments for the process.  The list of arguments will be terminated by a NULL pointer.
  *
- * The arguments list will be passed out to the caller in argsPtr.
- *
- * The caller must provide a list of buffers, argsBuffers, that can be used to store the fetched
- * arguments.  Note that this buffer does not necessarily store the arguments in the correct order.
- * The caller should read argsPtr to see the proper arguments list.
+ * The arguments list will be passed out to the caller in argsPtr.  The arguments point to the
+ * strings of the launch descriptor and of the overrides.
  *
  * @return
  *      LE_OK if successful.
@@ -849,10 +1127,7 @@ static void SetEnvironmentVariables
 static le_result_t GetArgs
 (
     proc_Ref_t procRef,             ///< [IN] The process to get the args for.
-    char argsBuffers[LIMIT_MAX_NUM_CMD_LINE_ARGS][LIMIT_MAX_ARGS_STR_BYTES], ///< [OUT] A pointer to
-                                                                             /// an array of buffers
-                                                                             /// used to store
-                                                                             /// arguments.
+    LaunchDesc_t* descPtr,          ///< [IN] The launch descriptor of the process.
     char* argsPtr[NUM_ARGS_PTRS]    ///< [OUT] An array of pointers that will point to the valid
                                     ///       arguments list.  The list is terminated by NULL.
 )
@@ -862,7 +1137,6 @@ static le_result_t GetArgs
 #define INDEX_ARGS      INDEX_PROC + 1
 
     size_t ptrIndex = 0;
-    size_t bufIndex = 0;
 
     // Initialize the executable path.
     argsPtr[INDEX_EXEC] = procRef->execPathPtr;
@@ -889,80 +1163,35 @@ static le_result_t GetArgs
     // Set the executable and the args if necessary.
     if (procRef->cfgPathPtr != NULL)
     {
-        // Get a config iterator to the arguments list.
-        le_cfg_IteratorRef_t procCfg = le_cfg_CreateReadTxn(procRef->cfgPathPtr);
-        le_cfg_GoToNode(procCfg, CFG_NODE_ARGS);
-
-        if (le_cfg_GoToFirstChild(procCfg) != LE_OK)
+        if (descPtr->numArgs == 0)
         {
             LE_ERROR("No arguments for process '%s'.", procRef->namePtr);
-            le_cfg_CancelTxn(procCfg);
             return LE_FAULT;
         }
 
         // Record the executable path.
+        char* strPtr = descPtr->strings;
+
         if (procRef->execPathPtr == NULL)
         {
-            if (le_cfg_GetString(procCfg, "", argsBuffers[bufIndex],
-                                 LIMIT_MAX_ARGS_STR_BYTES, "") != LE_OK)
-            {
-                LE_ERROR("Error reading argument '%s...' for process '%s'.",
-                         argsBuffers[bufIndex],
-                         procRef->namePtr);
-
-                le_cfg_CancelTxn(procCfg);
-                return LE_FAULT;
-            }
-
-            argsPtr[INDEX_EXEC] = argsBuffers[bufIndex];
-            bufIndex++;
+            argsPtr[INDEX_EXEC] = strPtr;
         }
 
-        // Record the arguments in the caller's list of buffers.
+        // Record the arguments.
         if (!procRef->argsListValid)
         {
+            size_t i;
+
             ptrIndex = 0;
 
-            while(1)
+            for (i = 1; i < descPtr->numArgs; i++)
             {
-                if (le_cfg_GoToNextSibling(procCfg) != LE_OK)
-                {
-                    break;
-                }
-                else if (bufIndex >= LIMIT_MAX_NUM_CMD_LINE_ARGS)
-                {
-                    LE_ERROR("Too many arguments for process '%s'.", procRef->namePtr);
-                    le_cfg_CancelTxn(procCfg);
-                    return LE_FAULT;
-                }
-
-                if (le_cfg_IsEmpty(procCfg, ""))
-                {
-                    LE_ERROR("Empty node in argument list for process '%s'.", procRef->namePtr);
-
-                    le_cfg_CancelTxn(procCfg);
-                    return LE_FAULT;
-                }
-
-                if (le_cfg_GetString(procCfg, "", argsBuffers[bufIndex],
-                                     LIMIT_MAX_ARGS_STR_BYTES, "") != LE_OK)
-                {
-                    LE_ERROR("Argument too long '%s...' for process '%s'.",
-                             argsBuffers[bufIndex],
-                             procRef->namePtr);
-
-                    le_cfg_CancelTxn(procCfg);
-                    return LE_FAULT;
-                }
-
-                // Point to the string.
-                argsPtr[INDEX_ARGS + ptrIndex] = argsBuffers[bufIndex];
+                strPtr += strlen(strPtr) + 1;
+
+                argsPtr[INDEX_ARGS + ptrIndex] = strPtr;
                 ptrIndex++;
-                bufIndex++;
             }
         }
-
-        le_cfg_CancelTxn(procCfg);
     }
 
     // Terminate the list.
@@ -1261,32 +1490,27 @@ le_result_t proc_Start
     // @Note The current IPC system does not support forking so any reads to the config DB must be
     //       done in the parent process.
 
-    // Get the environment variables from the config tree for this process.
-    EnvVar_t envVars[LIMIT_MAX_NUM_ENV_VARS] = {{{ 0 }}};
-    int numEnvVars = GetEnvironmentVariables(procRef, envVars, LIMIT_MAX_NUM_ENV_VARS);
+    // Get the launch descriptor, built from the config tree the first time the process is
+    // started.
+    LaunchDesc_t* descPtr = GetLaunchDesc(procRef);
 
-    if ((numEnvVars < 0) || (numEnvVars > LIMIT_MAX_NUM_ENV_VARS))
+    if (descPtr == NULL)
     {
-        LE_ERROR("Error getting environment variables.  Process '%s' cannot be started.",
+        LE_ERROR("Could not read the configuration, process '%s' cannot be started.",
                  procRef->namePtr);
         return LE_FAULT;
     }
 
-    // Get the command line arguments from the config tree for this process.
-    char argsBuffers[LIMIT_MAX_NUM_CMD_LINE_ARGS][LIMIT_MAX_ARGS_STR_BYTES];
+    // Get the command line arguments for this process.
     char* argsPtr[NUM_ARGS_PTRS];
 
-    if (GetArgs(procRef, argsBuffers, argsPtr) != LE_OK)
+    if (GetArgs(procRef, descPtr, argsPtr) != LE_OK)
     {
         LE_ERROR("Could not get command line arguments, process '%s' cannot be started.",
                  procRef->namePtr);
         return LE_FAULT;
     }
 
-    // Get the resource limits from the config tree for this process.
-    resLim_ProcLimits_t procLimits;
-    resLim_GetProcLimits(procRef, &procLimits);
-
     // Create pipes for the process's standard error and standard out streams.
     int logStdOutPipe[2];
     int logStdErrPipe[2];
@@ -1327,7 +1551,7 @@ le_result_t proc_Start
         LE_ASSERT(0 == sigfillset(&sigSet));
         LE_ASSERT(0 == pthread_sigmask(SIG_UNBLOCK, &sigSet, NULL));
 
-        SetEnvironmentVariables(envVars, numEnvVars);
+        SetEnvironmentVariables(descPtr);
 
         // Setup the process environment.
         if (app_GetIsSandboxed(procRef->appRef))
@@ -1367,7 +1591,7 @@ le_result_t proc_Start
 
         // Set resource limits.  This needs to be done as late as possible to avoid failures
         // when opening files before closing supervisor file descriptors
-        resLim_SetProcLimits(&procLimits);
+        resLim_SetProcLimits(&descPtr->limits);
 
         // If starting under debugger, wait for debugger to attach.
         if (procRef->debug)
@@ -1391,7 +1615,7 @@ le_result_t proc_Start
     fd_Close(syncPipeFd[READ_PIPE]);
 
     // Set the scheduling priority for the child process while the child process is blocked.
-    SetSchedulingPriority(procRef);
+    SetSchedulingPriority(procRef, descPtr);
 
     // Send standard pipes to the log daemon so they will show up in the logs.
     SendStdPipeToLogDaemon(procRef, logStdErrPipe, STDERR_FILENO);
@@ -1546,30 +1770,18 @@ bool proc_IsRealtime
     proc_Ref_t procRef             ///< [IN] The process reference.
 )
 {
-    char priorStr[LIMIT_MAX_PRIORITY_NAME_BYTES] = "medium";
-    char* priorStrPtr = priorStr;
+    const char* priorStrPtr = procRef->priorityPtr;
 
-    if (procRef->priorityPtr != NULL)
+    if (priorStrPtr == NULL)
     {
-        priorStrPtr = procRef->priorityPtr;
-    }
-    else if (procRef->cfgPathPtr != NULL)
-    {
-        // Read the priority setting from the config tree.
-        le_cfg_IteratorRef_t procCfg = le_cfg_CreateReadTxn(procRef->cfgPathPtr);
-
-        le_result_t result = le_cfg_GetString(procCfg,
-                                              CFG_NODE_PRIORITY,
-                                              priorStr,
-                                              sizeof(priorStr),
-                                              "medium");
+        LaunchDesc_t* descPtr = GetLaunchDesc(procRef);
 
-        le_cfg_CancelTxn(procCfg);
-
-        if (result != LE_OK)
+        if (descPtr == NULL)
         {
             return false;
         }
+
+        priorStrPtr = descPtr->priority;
     }
 
     if ( (priorStrPtr[0] == 'r') && (priorStrPtr[1] == 't') )
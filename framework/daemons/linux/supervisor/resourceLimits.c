@@ -199,32 +199,34 @@ static int GetCfgResourceLimit
         return defaultValue;
     }
 
-    int limitValue = le_cfg_GetInt(limitCfg, nodeName, defaultValue);
-
-    if (!le_cfg_NodeExists(limitCfg, nodeName))
+    // The node type tells whether the node is missing, empty or of the wrong type, so that a
+    // valid limit is read with two requests to the config tree.
+    switch (le_cfg_GetNodeType(limitCfg, nodeName))
     {
-        LE_INFO("Configured resource limit %s is not available.  Using the default value %d.",
-                 nodeName, defaultValue);
+        case LE_CFG_TYPE_INT:
+            break;
 
-        return defaultValue;
-    }
+        case LE_CFG_TYPE_DOESNT_EXIST:
+            LE_INFO("Configured resource limit %s is not available.  Using the default value %d.",
+                     nodeName, defaultValue);
 
-    if (le_cfg_IsEmpty(limitCfg, nodeName))
-    {
-        LE_WARN("Configured resource limit %s is empty.  Using the default value %d.",
-                 nodeName, defaultValue);
+            return defaultValue;
 
-        return defaultValue;
-    }
+        case LE_CFG_TYPE_EMPTY:
+            LE_WARN("Configured resource limit %s is empty.  Using the default value %d.",
+                     nodeName, defaultValue);
 
-    if (le_cfg_GetNodeType(limitCfg, nodeName) != LE_CFG_TYPE_INT)
-    {
-        LE_ERROR("Configured resource limit %s is the wrong type.  Using the default value %d.",
-                 nodeName, defaultValue);
+            return defaultValue;
 
-        return defaultValue;
+        default:
+            LE_ERROR("Configured resource limit %s is the wrong type.  Using the default value %d.",
+                     nodeName, defaultValue);
+
+            return defaultValue;
     }
 
+    int limitValue = le_cfg_GetInt(limitCfg, nodeName, defaultValue);
+
     if (limitValue < 0)
     {
         LE_ERROR("Configured resource limit %s is negative.  Using the default value %d.",
@@ -379,29 +381,17 @@ le_result_t resLim_SetAppLimits
 /**
  * Read the resource limits from the config tree.
  *
- * @return
- *      LE_OK if successful.
- *      LE_FAULT if there was an error.
+ * The process limits are read from the process node, the application limits from the application
+ * node, two levels up.  The iterator is left on the application node.
  */
 //--------------------------------------------------------------------------------------------------
 void resLim_GetProcLimits
 (
-    proc_Ref_t procRef,             ///< [IN] The process to get resource limits for.
+    le_cfg_IteratorRef_t procCfg,   ///< [IN] Iterator on the process node, NULL to use the default
+                                    ///       limits.
     resLim_ProcLimits_t* limitsPtr  ///< [OUT] The limits for the process
 )
 {
-    le_cfg_IteratorRef_t procCfg;
-
-    // Create an iterator for this process.
-    if (proc_GetConfigPath(procRef) != NULL)
-    {
-        procCfg = le_cfg_CreateReadTxn(proc_GetConfigPath(procRef));
-    }
-    else
-    {
-        procCfg = NULL;
-    }
-
     // Set the process resource limits.
     limitsPtr->maxCoreDumpFileBytes =
         GetCfgResourceLimit( procCfg, CFG_NODE_LIMIT_MAX_CORE_DUMP_FILE_BYTES,
@@ -446,11 +436,6 @@ void resLim_GetProcLimits
     limitsPtr->maxQueuedSignals =
         GetCfgResourceLimit( procCfg, CFG_NODE_LIMIT_MAX_QUEUED_SIGNALS,
                              DEFAULT_LIMIT_MAX_QUEUED_SIGNALS);
-
-    if (procCfg)
-    {
-        le_cfg_CancelTxn(procCfg);
-    }
 }
 
 
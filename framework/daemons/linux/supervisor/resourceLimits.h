@@ -12,6 +12,7 @@
 
 #include "app.h"
 #include "proc.h"
+#include "le_cfg_interface.h"
 
 
 //--------------------------------------------------------------------------------------------------
@@ -64,14 +65,14 @@ le_result_t resLim_SetAppLimits
 /**
  * Read the resource limits from the config tree.
  *
- * @return
- *      LE_OK if successful.
- *      LE_FAULT if there was an error.
+ * The process limits are read from the process node, the application limits from the application
+ * node, two levels up.  The iterator is left on the application node.
  */
 //--------------------------------------------------------------------------------------------------
 void resLim_GetProcLimits
 (
-    proc_Ref_t procRef,             ///< [IN] The process to get resource limits for.
+    le_cfg_IteratorRef_t procCfg,   ///< [IN] Iterator on the process node, NULL to use the default
+                                    ///       limits.
     resLim_ProcLimits_t* limitPtr   ///< [OUT] The limits for the process
 );
 
@@ -20,9 +20,9 @@
  * @section c_sup_kernelModules Kernel Modules
  *
  * Prior to starting any executables, Supervisor inserts kernel modules bundled with Legato app.
- * Legato-supplied modules are considered to be self-contained and independent from each-other.
- * They are inserted in alphabetical order, i.e. in the order in which they are listed in Legato's
- * system/modules directory.
+ * Modules are loaded directly by the Supervisor, with the parameters found in the config tree, in
+ * the order of their dependencies: modules which do not depend on each other are loaded
+ * concurrently.  Modules provided with an install script are installed by running the script.
  *
  * @section c_sup_frameworkDaemons Framework Daemons
  *
@@ -695,11 +695,11 @@ le_result_t app_InstallIndividual
 //--------------------------------------------------------------------------------------------------
 {
     bool systemHasThisApp = false;
+    char currentAppHash[LIMIT_MD5_STR_BYTES];
 
     if (system_HasApp(appNamePtr))
     {
        // If it has the same hash, we don't have to do anything,
-       char currentAppHash[LIMIT_MD5_STR_BYTES];
        systemHasThisApp =true;
        app_Hash(appNamePtr, currentAppHash);
        if (strcmp(appMd5Ptr, currentAppHash) == 0)
@@ -724,6 +724,16 @@ le_result_t app_InstallIndividual
 
         LE_ASSERT(snprintf(path, sizeof(path), "/legato/apps/%s", appMd5Ptr) < sizeof(path));
 
+        // The whole app was extracted: files which did not change since the installed version
+        // are now deduplicated, so that they are only stored once.
+        if (systemHasThisApp &&
+            (installer_DedupeUnchangedAppFiles(app_UnpackPath, currentAppHash) != LE_OK))
+        {
+            LE_WARN("Failed to link unchanged files of app '%s' to <%s>.",
+                    appNamePtr,
+                    currentAppHash);
+        }
+
         // In case there is a dangling symlink there, unlink it.
         // Ignore failure, because most of the time there won't be anything there.
         (void)unlink(path);
@@ -64,6 +64,14 @@
 #define MAX_CFGTREE_NAME_BYTES   LIMIT_MAX_USER_NAME_BYTES
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Path of the security-unpack tool.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SECURITY_UNPACK_PATH    "/legato/systems/current/bin/security-unpack"
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * State of the Update Daemon state machine.
@@ -284,44 +292,6 @@ static bool IsValidFileDesc
 }
 
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Function that runs in the security-unpack child process inside the pipeline.
- */
-//--------------------------------------------------------------------------------------------------
-static int SecurityUnpack
-(
-    void* param  // unused.
-)
-//--------------------------------------------------------------------------------------------------
-{
-    // Close all fds except stdin, stdout, stderr.
-    fd_CloseAllNonStd();
-
-    // Create a user account for the security-unpack tool (or don't if the account already exists).
-    const char* userName = "SecurityUnpack";
-    uid_t uid;
-    gid_t gid;
-    LE_FATAL_IF(user_Create(userName, &uid, &gid) == LE_FAULT, "Can't create user: %s", userName);
-
-    // Clear our supplementary groups list.
-    LE_FATAL_IF(setgroups(0, NULL) == -1, "Could not set the supplementary groups list.  %m.");
-
-    // Set our process's primary group ID.
-    LE_FATAL_IF(setgid(gid) == -1, "Could not set the group ID.  %m.");
-
-    // Set our process's user ID.  This sets all of our user IDs (real, effective, saved).  This
-    // call also clears all capabilities.  This function in particular MUST be called after all
-    // the previous system calls because once we make this call we will lose root priviledges.
-    LE_FATAL_IF(setuid(uid) == -1, "Could not set the user ID.  %m.");
-
-    // Execute the program.
-    const char* exePath = "/legato/systems/current/bin/security-unpack";
-    execl(exePath, exePath, (char *)NULL);
-    LE_FATAL("Failed to exec '%s' (%m)", exePath);
-}
-
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Checks whether or not a file exists at a given file system path.
@@ -516,6 +486,23 @@ static le_result_t InstallSystemApps
                                        appMd5Hash)
                                        < sizeof(appPath));
 
+                    // The whole app was extracted: files which did not change since the version
+                    // of the app in the current system are now deduplicated, so that they are
+                    // only stored once.
+                    if (system_HasApp(appName))
+                    {
+                        char currentAppHash[LIMIT_MD5_STR_BYTES];
+
+                        app_Hash(appName, currentAppHash);
+                        if (installer_DedupeUnchangedAppFiles(entPtr->fts_path, currentAppHash)
+                            != LE_OK)
+                        {
+                            LE_WARN("Failed to link unchanged files of app '%s' to <%s>.",
+                                    appName,
+                                    currentAppHash);
+                        }
+                    }
+
                     (void)unlink(appPath);
 
                     LE_DEBUG("Renaming '%s' to '%s'",
@@ -2108,10 +2095,19 @@ le_result_t le_update_Start
     //Reset the InstallReady flag
     InstallReady = false;
 
+    // Create a user account for the security-unpack tool (or don't if the account already exists).
+    // The tool runs as that user, without supplementary groups.
+    const char* userName = "SecurityUnpack";
+    char* argv[] = { SECURITY_UNPACK_PATH, NULL };
+    spawn_Attr_t attr = { .pathPtr = SECURITY_UNPACK_PATH, .argvPtr = argv, .setIds = true };
+
+    LE_FATAL_IF(user_Create(userName, &attr.uid, &attr.gid) == LE_FAULT,
+                "Can't create user: %s", userName);
+
     // Create a pipeline: clientfd -> security-unpack -> readFd
     SecurityUnpackPipeline = pipeline_Create();
     pipeline_SetInput(SecurityUnpackPipeline, clientFd);
-    pipeline_Append(SecurityUnpackPipeline, SecurityUnpack, NULL);
+    pipeline_AppendProgram(SecurityUnpackPipeline, &attr);
     int readFd = pipeline_CreateOutputPipe(SecurityUnpackPipeline);
     pipeline_Start(SecurityUnpackPipeline, PipelineDone);
 
@@ -687,31 +687,6 @@ static void InputFdEventHandler
 }
 
 
-//--------------------------------------------------------------------------------------------------
-/**
- * Function that runs in the unpack pipeline's "tar" process.
- **/
-//--------------------------------------------------------------------------------------------------
-static int Untar
-(
-    void* param
-)
-//--------------------------------------------------------------------------------------------------
-{
-    const char* unpackDir = param;
-
-    // Close all open file descriptors except for stdin, stdout, and stderr.
-    // This ensures that we don't keep copies of things like the pipeline input write pipe open.
-    fd_CloseAllNonStd();
-
-    // Try bsdtar first.  If that fails, fallback to tar.
-    execl("/usr/bin/bsdtar", "bsdtar", "xjmop", "-f", "-", "-C", unpackDir, (char*)NULL);
-    execl("/bin/tar", "tar", "xjop", "-C", unpackDir, (char*)NULL);
-
-    LE_FATAL("Failed to exec tar (%m)");
-}
-
-
 //--------------------------------------------------------------------------------------------------
 /**
  * Start unpacking a tarball.
@@ -727,10 +702,21 @@ static void StartUntar
 
     PayloadBytesCopied = 0;
 
+    // Use bsdtar if available, otherwise fallback to tar.
+    char* bsdtarArgv[] = { "bsdtar", "xjmop", "-f", "-", "-C", (char*)dirPath, NULL };
+    char* tarArgv[] = { "tar", "xjop", "-C", (char*)dirPath, NULL };
+    spawn_Attr_t attr = { .pathPtr = "/usr/bin/bsdtar", .argvPtr = bsdtarArgv };
+
+    if (access(attr.pathPtr, X_OK) != 0)
+    {
+        attr.pathPtr = "/bin/tar";
+        attr.argvPtr = tarArgv;
+    }
+
     // Create a pipeline: PipelineFd -> tar
     Pipeline = pipeline_Create();
     PipelineFd = pipeline_CreateInputPipe(Pipeline);
-    pipeline_Append(Pipeline, Untar, (void*)dirPath);
+    pipeline_AppendProgram(Pipeline, &attr);
     pipeline_Start(Pipeline, UntarDone);
 
     fd_SetNonBlocking(InputFd);
@@ -41,14 +41,43 @@
  * have a faultAction and watchdogAction which restarts the process.
  *
  * Algorithm
- * When a process kicks us, if we have no timer for it we will:
- *    create a timer,
- *    add it to our timer list and
- *    set it running with the appropriate time out (for now, that configured for the app).
- * If the timer times out before the next kick then the watchdog will
+ * When a process kicks us, if we have no watchdog for it we will:
+ *    create a watchdog,
+ *    add it to our watchdog list and
+ *    arm its deadline with the appropriate time out (for now, that configured for the app).
+ * If the deadline expires before the next kick then the watchdog will
  *    attempt to alert the supervisor that the app has timed out.
  *          The supervisor can then apply the configured fault action.
- *    delist the timer and dispose of it.
+ *    delist the watchdog and dispose of it.
+ *
+ * Deadlines of all watchdogs are kept in a single min-heap ordered by expiry time, served by a
+ * single timer armed for the earliest deadline.  A kick only moves a deadline later, so it costs
+ * a heap update and never re-arms the timer: if the timer fires for a deadline which has been
+ * kicked in the meantime, it is simply re-armed for the new earliest deadline.
+ *
+ * Watchdog groups
+ * An app can be given an app-level deadline in the config tree, in milliseconds:
+ *
+ *      /apps/<appName>/watchdogGroupTimeout
+ *
+ * The deadline of the group is renewed only when every watched process of the app has kicked
+ * since its last renewal.  If it expires, the processes which did not kick are reported to the
+ * supervisor as timed out, even though their own watchdogs are still running.  This catches an
+ * app whose processes individually keep kicking but no longer make progress together.
+ *
+ * Paused apps
+ * When an app is paused, its processes are frozen and can't kick their watchdogs.  The supervisor
+ * reports it through the AppPause event, and the deadlines of the watchdogs of the app (including
+ * its mandatory watchdogs and its group) are held: they are taken out of the heap, and kicks only
+ * update them.  When the app is resumed, the deadlines which were armed are re-armed with their
+ * full interval, giving the processes of the app time to kick again.
+ *
+ * Kick statistics
+ * For each watchdog, the number of kicks, the shortest and longest interval between kicks (the
+ * difference is the kick jitter) and the smallest margin left before expiry when a kick was
+ * received are recorded.  A process can retrieve its own statistics with
+ * le_wdog_GetKickStatistics(), and they are traced on the "wdog" trace keyword when a watchdog is
+ * released.
  *
  * Analysis
  *
@@ -159,6 +188,16 @@
 #define CFG_NODE_WDOG_START_MANUAL                    "startManual"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * The name of the node in the config tree that contains the app-level group timeout.
+ *
+ * If this node is empty the processes of the app are not grouped.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CFG_NODE_WDOG_GROUP_TIMEOUT                   "watchdogGroupTimeout"
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Size of the watchdog hash table.  Roughly equal to the expected number of watchdog users
@@ -203,6 +242,27 @@
 //--------------------------------------------------------------------------------------------------
 #define NO_PROC      -1
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Heap index of a deadline which is not armed.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEADLINE_NOT_ARMED  SIZE_MAX
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Heap index of a held deadline which is armed.  It is put in the heap when released.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEADLINE_HELD       (SIZE_MAX - 1)
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initial number of deadlines the deadline heap can hold.  The heap is doubled when full.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEADLINE_HEAP_INITIAL_SIZE  32
+
 //--------------------------------------------------------------------------------------------------
 /**
  * System framework configuration
@@ -224,6 +284,70 @@
 //--------------------------------------------------------------------------------------------------
 static le_log_TraceRef_t TraceRef;
 
+#ifdef WDOG_UNIT_TEST
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look-ups of the app and process of a client, provided by the unit test as its clients are not
+ * real processes.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t GetAppNameFromPid(int32_t pid, char* appName, size_t appNameNumElements);
+le_result_t GetProcessNameFromPid(pid_t pId, char* name, size_t length);
+#endif
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * A deadline kept in the deadline heap.  Deadlines are embedded in the objects they belong to.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct Deadline
+{
+    le_clk_Time_t expiryTime;           ///< Relative time at which the deadline expires
+    le_clk_Time_t interval;             ///< Interval the deadline was last armed with
+    size_t heapIndex;                   ///< Index in the heap, DEADLINE_NOT_ARMED or
+                                        ///< DEADLINE_HELD
+    bool isHeld;                        ///< Held while the app is paused: kept out of the heap
+    void (*expiryFunc)(struct Deadline* deadlinePtr); ///< Called when the deadline expires
+}
+Deadline_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Kick statistics of a watchdog.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t kickCount;                 ///< Number of kicks received
+    le_clk_Time_t lastKickTime;         ///< Relative time of the last kick
+    le_clk_Time_t minKickInterval;      ///< Shortest interval between two kicks
+    le_clk_Time_t maxKickInterval;      ///< Longest interval between two kicks
+    le_clk_Time_t minMargin;            ///< Smallest time left before expiry when kicked
+}
+KickStats_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Watchdog group, gathering the watchdogs of all the processes of an app under a single app-level
+ * deadline.
+ *
+ * Members kick the group in rounds: a member has kicked in the current round if its
+ * groupRound matches the round of the group.  When all members have kicked, the round is over
+ * and the group deadline is renewed.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char appName[LIMIT_MAX_APP_NAME_BYTES]; ///< App name, key in the group hash map
+    Deadline_t deadline;                ///< App-level deadline
+    uint32_t memberCount;               ///< Number of watchdogs in the group
+    uint32_t kickedCount;               ///< Number of members which kicked in the current round
+    uint32_t round;                     ///< Current round
+    bool isExpiring;                    ///< Members which did not kick are being reported: no
+                                        ///< round is started until they all are
+}
+WatchdogGroup_t;
+
 //--------------------------------------------------------------------------------------------------
 /**
  *  Definition of Watchdog object, pool for allocation of watchdogs and container for organizing and
@@ -239,7 +363,10 @@ typedef struct
                                         ///< mandatory watchdog will not accidentally get set
                                         ///< beyond it's maximum period by being treated as a
                                         ///< non-mandatory watchdog.
-    le_timer_Ref_t timer;               ///< The timer this watchdog uses
+    Deadline_t deadline;                ///< The deadline this watchdog uses
+    KickStats_t stats;                  ///< Kick statistics
+    WatchdogGroup_t* groupPtr;          ///< Group of the app, or NULL if not grouped
+    uint32_t groupRound;                ///< Last group round in which this watchdog kicked
 }
 WatchdogObj_t;
 
@@ -287,6 +414,483 @@ static le_hashmap_Ref_t MandatoryWatchdogRefs;  ///< The container used to track
 
 static le_timer_Ref_t DefaultExternalWdogTimer; ///< Default external wdog timer
 
+static le_mem_PoolRef_t WatchdogGroupPool;      ///< The memory pool the watchdog groups come from
+static le_hashmap_Ref_t WatchdogGroupRefs;      ///< The container used to track watchdog groups
+
+static Deadline_t** DeadlineHeap;               ///< Min-heap of armed deadlines, by expiry time
+static size_t DeadlineCount;                    ///< Number of deadlines in the heap
+static size_t DeadlineHeapSize;                 ///< Number of deadlines the heap can hold
+static le_timer_Ref_t DeadlineTimer;            ///< Timer serving the earliest deadline
+static le_clk_Time_t DeadlineTimerExpiry;       ///< Expiry time the deadline timer is armed for
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if a deadline is armed.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool IsDeadlineArmed
+(
+    const Deadline_t* deadlinePtr
+)
+{
+    return (DEADLINE_NOT_ARMED != deadlinePtr->heapIndex);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Place a deadline at a given index of the heap.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void HeapPlace
+(
+    Deadline_t* deadlinePtr,
+    size_t index
+)
+{
+    DeadlineHeap[index] = deadlinePtr;
+    deadlinePtr->heapIndex = index;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a deadline up the heap until its parent expires before it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HeapSiftUp
+(
+    size_t index
+)
+{
+    Deadline_t* deadlinePtr = DeadlineHeap[index];
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+
+        if (!le_clk_GreaterThan(DeadlineHeap[parent]->expiryTime, deadlinePtr->expiryTime))
+        {
+            break;
+        }
+        HeapPlace(DeadlineHeap[parent], index);
+        index = parent;
+    }
+    HeapPlace(deadlinePtr, index);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Move a deadline down the heap until both its children expire after it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HeapSiftDown
+(
+    size_t index
+)
+{
+    Deadline_t* deadlinePtr = DeadlineHeap[index];
+
+    for (;;)
+    {
+        size_t child = (2 * index) + 1;
+
+        if (child >= DeadlineCount)
+        {
+            break;
+        }
+        if (((child + 1) < DeadlineCount) &&
+            le_clk_GreaterThan(DeadlineHeap[child]->expiryTime,
+                               DeadlineHeap[child + 1]->expiryTime))
+        {
+            child++;
+        }
+        if (!le_clk_GreaterThan(deadlinePtr->expiryTime, DeadlineHeap[child]->expiryTime))
+        {
+            break;
+        }
+        HeapPlace(DeadlineHeap[child], index);
+        index = child;
+    }
+    HeapPlace(deadlinePtr, index);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Arm the deadline timer for the earliest deadline, unless it is already armed to expire before.
+ *
+ * The timer is never delayed: if the earliest deadline has been moved later by a kick, the timer
+ * expires early and is re-armed from its handler.  This keeps timer system calls out of kicks.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ArmDeadlineTimer
+(
+    void
+)
+{
+    if (0 == DeadlineCount)
+    {
+        return;
+    }
+
+    le_clk_Time_t expiryTime = DeadlineHeap[0]->expiryTime;
+
+    if (le_timer_IsRunning(DeadlineTimer) &&
+        !le_clk_GreaterThan(DeadlineTimerExpiry, expiryTime))
+    {
+        return;
+    }
+
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+    le_clk_Time_t interval = { .sec = 0, .usec = 1 };
+
+    if (le_clk_GreaterThan(expiryTime, now))
+    {
+        interval = le_clk_Sub(expiryTime, now);
+    }
+
+    le_timer_Stop(DeadlineTimer);
+    LE_ASSERT(LE_OK == le_timer_SetInterval(DeadlineTimer, interval));
+    LE_ASSERT(LE_OK == le_timer_Start(DeadlineTimer));
+    DeadlineTimerExpiry = expiryTime;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a deadline from the heap.  Nothing is done if the deadline is not armed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StopDeadline
+(
+    Deadline_t* deadlinePtr
+)
+{
+    size_t index = deadlinePtr->heapIndex;
+
+    if (DEADLINE_NOT_ARMED == index)
+    {
+        return;
+    }
+
+    if (DEADLINE_HELD == index)
+    {
+        deadlinePtr->heapIndex = DEADLINE_NOT_ARMED;
+        return;
+    }
+
+    deadlinePtr->heapIndex = DEADLINE_NOT_ARMED;
+    DeadlineCount--;
+    if (index != DeadlineCount)
+    {
+        // Move the last deadline into the hole, then restore the heap order around it.
+        HeapPlace(DeadlineHeap[DeadlineCount], index);
+        HeapSiftUp(index);
+        HeapSiftDown(DeadlineHeap[index]->heapIndex);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Arm (or re-arm) a deadline to expire after the given interval from now.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartDeadline
+(
+    Deadline_t* deadlinePtr,
+    le_clk_Time_t interval
+)
+{
+    deadlinePtr->interval = interval;
+    deadlinePtr->expiryTime = le_clk_Add(le_clk_GetRelativeTime(), interval);
+
+    if (deadlinePtr->isHeld)
+    {
+        deadlinePtr->heapIndex = DEADLINE_HELD;
+        return;
+    }
+
+    if (IsDeadlineArmed(deadlinePtr))
+    {
+        size_t index = deadlinePtr->heapIndex;
+
+        HeapSiftUp(index);
+        HeapSiftDown(deadlinePtr->heapIndex);
+    }
+    else
+    {
+        if (DeadlineCount == DeadlineHeapSize)
+        {
+            DeadlineHeapSize = (DeadlineHeapSize ? (2 * DeadlineHeapSize)
+                                                 : DEADLINE_HEAP_INITIAL_SIZE);
+            DeadlineHeap = realloc(DeadlineHeap, DeadlineHeapSize * sizeof(Deadline_t*));
+            LE_ASSERT(NULL != DeadlineHeap);
+        }
+        HeapPlace(deadlinePtr, DeadlineCount);
+        DeadlineCount++;
+        HeapSiftUp(deadlinePtr->heapIndex);
+    }
+
+    ArmDeadlineTimer();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Re-arm a deadline with the interval it was last armed with.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline void RestartDeadline
+(
+    Deadline_t* deadlinePtr
+)
+{
+    StartDeadline(deadlinePtr, deadlinePtr->interval);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hold a deadline: it does not expire until released, even if it is re-armed in the meantime.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HoldDeadline
+(
+    Deadline_t* deadlinePtr
+)
+{
+    if (deadlinePtr->isHeld)
+    {
+        return;
+    }
+
+    if (IsDeadlineArmed(deadlinePtr))
+    {
+        StopDeadline(deadlinePtr);
+        deadlinePtr->heapIndex = DEADLINE_HELD;
+    }
+    deadlinePtr->isHeld = true;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release a held deadline.  If it is armed, it is re-armed with its full interval from now.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReleaseDeadline
+(
+    Deadline_t* deadlinePtr
+)
+{
+    if (!deadlinePtr->isHeld)
+    {
+        return;
+    }
+
+    deadlinePtr->isHeld = false;
+    if (DEADLINE_HELD == deadlinePtr->heapIndex)
+    {
+        deadlinePtr->heapIndex = DEADLINE_NOT_ARMED;
+        RestartDeadline(deadlinePtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize a deadline, not armed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InitDeadline
+(
+    Deadline_t* deadlinePtr,
+    le_clk_Time_t interval,
+    void (*expiryFunc)(Deadline_t* deadlinePtr)
+)
+{
+    deadlinePtr->interval = interval;
+    deadlinePtr->heapIndex = DEADLINE_NOT_ARMED;
+    deadlinePtr->isHeld = false;
+    deadlinePtr->expiryFunc = expiryFunc;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler of the deadline timer.  Expires all deadlines which are due, then re-arms the timer for
+ * the next one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DeadlineTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    while ((DeadlineCount > 0) && !le_clk_GreaterThan(DeadlineHeap[0]->expiryTime, now))
+    {
+        Deadline_t* deadlinePtr = DeadlineHeap[0];
+
+        StopDeadline(deadlinePtr);
+        deadlinePtr->expiryFunc(deadlinePtr);
+    }
+
+    ArmDeadlineTimer();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Convert a time interval to milliseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t IntervalToMs
+(
+    le_clk_Time_t interval
+)
+{
+    return ((uint64_t)interval.sec * 1000) + (interval.usec / 1000);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Update the kick statistics of a watchdog on a kick.  Must be called before the deadline is
+ * re-armed.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UpdateKickStats
+(
+    WatchdogObj_t* dogPtr
+)
+{
+    KickStats_t* statsPtr = &dogPtr->stats;
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+
+    if (IsDeadlineArmed(&dogPtr->deadline) && !dogPtr->deadline.isHeld)
+    {
+        le_clk_Time_t margin = { .sec = 0, .usec = 0 };
+
+        if (le_clk_GreaterThan(dogPtr->deadline.expiryTime, now))
+        {
+            margin = le_clk_Sub(dogPtr->deadline.expiryTime, now);
+        }
+        if ((0 == statsPtr->kickCount) || le_clk_GreaterThan(statsPtr->minMargin, margin))
+        {
+            statsPtr->minMargin = margin;
+        }
+    }
+
+    if (statsPtr->kickCount > 0)
+    {
+        le_clk_Time_t interval = le_clk_Sub(now, statsPtr->lastKickTime);
+
+        if ((1 == statsPtr->kickCount) || le_clk_GreaterThan(statsPtr->minKickInterval, interval))
+        {
+            statsPtr->minKickInterval = interval;
+        }
+        if (le_clk_GreaterThan(interval, statsPtr->maxKickInterval))
+        {
+            statsPtr->maxKickInterval = interval;
+        }
+    }
+
+    statsPtr->lastKickTime = now;
+    statsPtr->kickCount++;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Trace the kick statistics of a watchdog.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TraceKickStats
+(
+    const WatchdogObj_t* dogPtr
+)
+{
+    if (IS_TRACE_ENABLED)
+    {
+        const KickStats_t* statsPtr = &dogPtr->stats;
+
+        TRACE("Watchdog for proc %d: %" PRIu32 " kicks, interval %" PRIu64 "..%" PRIu64
+              " ms, min margin %" PRIu64 " ms",
+              dogPtr->procId, statsPtr->kickCount,
+              IntervalToMs(statsPtr->minKickInterval), IntervalToMs(statsPtr->maxKickInterval),
+              IntervalToMs(statsPtr->minMargin));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Renew the deadline of a group and start a new round.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartGroupRound
+(
+    WatchdogGroup_t* groupPtr
+)
+{
+    groupPtr->round++;
+    groupPtr->kickedCount = 0;
+    RestartDeadline(&groupPtr->deadline);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the kick of a group member.  The group deadline is renewed when all members have kicked.
+ */
+//--------------------------------------------------------------------------------------------------
+static void KickGroup
+(
+    WatchdogObj_t* dogPtr
+)
+{
+    WatchdogGroup_t* groupPtr = dogPtr->groupPtr;
+
+    if ((NULL == groupPtr) || (dogPtr->groupRound == groupPtr->round))
+    {
+        return;
+    }
+
+    dogPtr->groupRound = groupPtr->round;
+    groupPtr->kickedCount++;
+    if (groupPtr->kickedCount >= groupPtr->memberCount)
+    {
+        StartGroupRound(groupPtr);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Remove a watchdog from its group.  The group is released when its last member leaves.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LeaveGroup
+(
+    WatchdogObj_t* dogPtr
+)
+{
+    WatchdogGroup_t* groupPtr = dogPtr->groupPtr;
+
+    if (NULL == groupPtr)
+    {
+        return;
+    }
+
+    dogPtr->groupPtr = NULL;
+    if (dogPtr->groupRound == groupPtr->round)
+    {
+        groupPtr->kickedCount--;
+    }
+    groupPtr->memberCount--;
+
+    if (0 == groupPtr->memberCount)
+    {
+        LE_DEBUG("Releasing watchdog group of app %s", groupPtr->appName);
+        StopDeadline(&groupPtr->deadline);
+        LE_ASSERT(groupPtr == le_hashmap_Remove(WatchdogGroupRefs, groupPtr->appName));
+        le_mem_Release(groupPtr);
+    }
+    else if ((groupPtr->kickedCount >= groupPtr->memberCount) && !groupPtr->isExpiring)
+    {
+        // The member leaving was the last one the round was waiting for.
+        StartGroupRound(groupPtr);
+    }
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Remove the watchdog from our container, free the timer it contains and then free the storage
@@ -303,14 +907,18 @@ static void DeleteWatchdog
     {
         // All good. The dog was in the hash
         LE_DEBUG("Cleaning up watchdog resources for %d", deadDogPtr->procId);
+        TraceKickStats(deadDogPtr);
+        LeaveGroup(deadDogPtr);
         // Give the watchdog one more kick if it hasn't had one, then release it.
         // This allows mandatory watchdogs (which still exist in the MandatoryWatchdogRefs
         // one more kick to restart before they're considered expired.
         if (deadDogPtr->procId >= 0)
         {
             deadDogPtr->procId = NO_PROC;
-            le_timer_SetContextPtr(deadDogPtr->timer, deadDogPtr);
-            le_timer_Start(deadDogPtr->timer);
+            if (!IsDeadlineArmed(&deadDogPtr->deadline))
+            {
+                RestartDeadline(&deadDogPtr->deadline);
+            }
         }
         le_mem_Release(deadDogPtr);
     }
@@ -374,6 +982,7 @@ static WatchdogObj_t* LookupClientWatchdogPtrById
     return le_hashmap_Get(WatchdogRefsContainer, &clientPid);
 }
 
+#ifndef WDOG_UNIT_TEST
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets the application name of the process with the specified PID.
@@ -463,6 +1072,7 @@ static le_result_t GetAppNameFromPid
     // Note that the leading slash of the token has to be removed.
     return le_utf8_Copy(appName, (token + 1), appNameNumElements, NULL);
 }
+#endif /* WDOG_UNIT_TEST */
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -475,10 +1085,10 @@ static le_result_t GetAppNameFromPid
 //--------------------------------------------------------------------------------------------------
 static void WatchdogHandleExpiry
 (
-    le_timer_Ref_t timerRef ///< [IN] The reference to the expired timer
+    Deadline_t* deadlinePtr ///< [IN] The expired deadline
 )
 {
-    WatchdogObj_t* watchDogPtr = le_timer_GetContextPtr(timerRef);
+    WatchdogObj_t* watchDogPtr = CONTAINER_OF(deadlinePtr, WatchdogObj_t, deadline);
     if (watchDogPtr->procId == NO_PROC)
     {
         // Mandatory watchdog expired without the process restarting.  Restart Legato.
@@ -525,6 +1135,72 @@ static void WatchdogHandleExpiry
     }
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a member of a group which has not kicked in the current round.
+ *
+ * @return The process ID of the member, or NO_PROC if all members have kicked.
+ */
+//--------------------------------------------------------------------------------------------------
+static pid_t FindStaleGroupMember
+(
+    const WatchdogGroup_t* groupPtr
+)
+{
+    le_hashmap_It_Ref_t iter = le_hashmap_GetIterator(WatchdogRefsContainer);
+
+    while (LE_OK == le_hashmap_NextNode(iter))
+    {
+        const WatchdogObj_t* dogPtr = le_hashmap_GetValue(iter);
+
+        if ((dogPtr->groupPtr == groupPtr) && (dogPtr->groupRound != groupPtr->round))
+        {
+            return dogPtr->procId;
+        }
+    }
+
+    return NO_PROC;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * The handler for group time outs.  The members which did not kick during the round are reported
+ * to the supervisor as timed out.
+ */
+//--------------------------------------------------------------------------------------------------
+static void GroupHandleExpiry
+(
+    Deadline_t* deadlinePtr ///< [IN] The expired deadline
+)
+{
+    WatchdogGroup_t* groupPtr = CONTAINER_OF(deadlinePtr, WatchdogGroup_t, deadline);
+    pid_t procId;
+
+    LE_CRIT("Watchdog group of app %s timed out: %" PRIu32 " of %" PRIu32 " processes kicked",
+            groupPtr->appName, groupPtr->kickedCount, groupPtr->memberCount);
+
+    // Hold the group: it is released if all its members are deleted.
+    le_mem_AddRef(groupPtr);
+
+    // Keep the round until all the stale members are deleted, otherwise deleting the last one
+    // would start a new round in which the members which did kick would look stale.
+    groupPtr->isExpiring = true;
+    while ((groupPtr->memberCount > 0) && (NO_PROC != (procId = FindStaleGroupMember(groupPtr))))
+    {
+        LE_CRIT("proc %d did not kick the watchdog group of app %s", procId, groupPtr->appName);
+        DeleteWatchdog(procId);
+        wdog_WatchdogTimedOut(procId);
+    }
+    groupPtr->isExpiring = false;
+
+    if (groupPtr->memberCount > 0)
+    {
+        StartGroupRound(groupPtr);
+    }
+
+    le_mem_Release(groupPtr);
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Construct le_clk_Time_t object that will give an interval of the provided number
@@ -562,9 +1238,8 @@ bool CheckWatchdog
     const WatchdogObj_t* dogPtr = valuePtr;
 
     // If watchdog is operating correctly...
-    if (   (dogPtr->timer) &&
-           (le_clk_Equal(dogPtr->maxKickTimeoutInterval, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)) ||
-            le_timer_IsRunning(dogPtr->timer)))
+    if (le_clk_Equal(dogPtr->maxKickTimeoutInterval, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)) ||
+        IsDeadlineArmed(&dogPtr->deadline))
     {
         // ...  continue to next watchdog
         return true;
@@ -612,12 +1287,14 @@ static void ExternalWatchdogHandler
     le_timer_Ref_t timerRef
 )
 {
-    bool kick = true;
+    // The deadline timer must be running as long as a deadline is armed.
+    bool kick = (0 == DeadlineCount) || le_timer_IsRunning(DeadlineTimer);
 
     // Check both watchdogs and mandatory watchdogs -- this will double count most mandatory
     // watchdogs since all running mandatory are also in the WatchdogRefContainer, but we need
     // to check if any mandatory watchdogs have expired.
-    if (le_hashmap_ForEach(WatchdogRefsContainer,
+    if (kick &&
+        le_hashmap_ForEach(WatchdogRefsContainer,
                            CheckWatchdog,
                            &kick) &&
         le_hashmap_ForEach(MandatoryWatchdogRefs,
@@ -637,6 +1314,7 @@ static void ExternalWatchdogHandler
     }
 }
 
+#ifndef WDOG_UNIT_TEST
 //--------------------------------------------------------------------------------------------------
 /**
  * Given the pid, find out what the process name is. The process name, if found, is written to
@@ -722,6 +1400,7 @@ static le_result_t GetProcessNameFromPid
     }
     return LE_OK;
 }
+#endif /* WDOG_UNIT_TEST */
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -820,8 +1499,6 @@ static void InitNewWatchdog
     le_clk_Time_t maxKickTimeoutInterval
 )
 {
-    char timerName[LIMIT_MAX_TIMER_NAME_BYTES];
-
     newDogPtr->procId = clientPid;
     newDogPtr->kickTimeoutInterval = kickTimeoutInterval;
     newDogPtr->maxKickTimeoutInterval = maxKickTimeoutInterval;
@@ -831,15 +1508,69 @@ static void InitNewWatchdog
         newDogPtr->kickTimeoutInterval = newDogPtr->maxKickTimeoutInterval;
     }
 
-    LE_ASSERT(0 <= snprintf(timerName, sizeof(timerName),
-                            "wdog_p%p", newDogPtr));
-    newDogPtr->timer = le_timer_Create(timerName);
-    _Static_assert (sizeof(pid_t) <= sizeof(intptr_t), "pid_t is truncated by cast to void*");
-    LE_ASSERT(LE_OK == le_timer_SetContextPtr(newDogPtr->timer, newDogPtr));
-    LE_ASSERT(LE_OK == le_timer_SetHandler(newDogPtr->timer, WatchdogHandleExpiry));
+    InitDeadline(&newDogPtr->deadline, newDogPtr->kickTimeoutInterval, WatchdogHandleExpiry);
+    memset(&newDogPtr->stats, 0, sizeof(newDogPtr->stats));
+    newDogPtr->groupPtr = NULL;
+    newDogPtr->groupRound = 0;
+}
+
 
-    // Do not wake up a suspended system.
-    LE_ASSERT(LE_OK == le_timer_SetWakeup(newDogPtr->timer, false));
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a watchdog to the group of its app, creating the group if needed.  Nothing is done if no
+ * group timeout is configured for the app.
+ *
+ * A new member is considered as having kicked in the current round.
+ */
+//--------------------------------------------------------------------------------------------------
+static void JoinGroup
+(
+    WatchdogObj_t* dogPtr
+)
+{
+    char appName[LIMIT_MAX_APP_NAME_BYTES] = "";
+    char configPath[LIMIT_MAX_PATH_BYTES] = "";
+    WatchdogGroup_t* groupPtr;
+
+    if ((NULL != dogPtr->groupPtr) ||
+        (LE_OK != GetAppNameFromPid(dogPtr->procId, appName, sizeof(appName))))
+    {
+        return;
+    }
+
+    groupPtr = le_hashmap_Get(WatchdogGroupRefs, appName);
+    if (NULL == groupPtr)
+    {
+        int groupTimeout = 0;
+
+        if (le_path_Concat("/", configPath, sizeof(configPath), CFG_NODE_APPS_LIST, appName,
+                           CFG_NODE_WDOG_GROUP_TIMEOUT, NULL) == LE_OK)
+        {
+            groupTimeout = le_cfg_QuickGetInt(configPath, 0);
+        }
+        if (groupTimeout <= 0)
+        {
+            return;
+        }
+
+        LE_INFO("Creating watchdog group for app %s, timeout %d ms", appName, groupTimeout);
+        groupPtr = le_mem_ForceAlloc(WatchdogGroupPool);
+        memset(groupPtr, 0, sizeof(WatchdogGroup_t));
+        LE_ASSERT(LE_OK == le_utf8_Copy(groupPtr->appName, appName, sizeof(groupPtr->appName),
+                                        NULL));
+        InitDeadline(&groupPtr->deadline, MakeTimerInterval(groupTimeout), GroupHandleExpiry);
+        LE_ASSERT(NULL == le_hashmap_Put(WatchdogGroupRefs, groupPtr->appName, groupPtr));
+        StartGroupRound(groupPtr);
+    }
+
+    dogPtr->groupPtr = groupPtr;
+    dogPtr->groupRound = groupPtr->round;
+    groupPtr->memberCount++;
+    groupPtr->kickedCount++;
+    if (groupPtr->kickedCount >= groupPtr->memberCount)
+    {
+        StartGroupRound(groupPtr);
+    }
 }
 
 
@@ -872,13 +1603,12 @@ static WatchdogObj_t* CreateNewWatchdog
         LE_DEBUG("Attaching %d to mandatory watchdog", clientPid);
         newDogPtr = &(mandatoryWdogPtr->watchdog);
         le_mem_AddRef(mandatoryWdogPtr);
-        // Stop the timer -- mandatory timers are always running, even if process
+        // Stop the deadline -- mandatory deadlines are always armed, even if process
         // doesn't exist.
-        le_timer_Stop(newDogPtr->timer);
-        // Then update the proc ID to point to this new process.
-        LE_ASSERT(LE_OK == le_timer_SetContextPtr(newDogPtr->timer,
-                                                  newDogPtr));
+        StopDeadline(&newDogPtr->deadline);
+        // Then update the proc ID to point to this new process, whose kicks are counted afresh.
         newDogPtr->procId = clientPid;
+        memset(&newDogPtr->stats, 0, sizeof(newDogPtr->stats));
     }
     else
     {
@@ -924,9 +1654,7 @@ static void CreateMandatoryWatchdog
     LE_ASSERT(NULL == le_hashmap_Put(MandatoryWatchdogRefs, &(newDogPtr->key), newDogPtr));
 
     // Immediately start this watchdog.
-    LE_ASSERT(LE_OK == le_timer_SetInterval(newDogPtr->watchdog.timer,
-                                            newDogPtr->watchdog.kickTimeoutInterval));
-    le_timer_Start(newDogPtr->watchdog.timer);
+    StartDeadline(&newDogPtr->watchdog.deadline, newDogPtr->watchdog.kickTimeoutInterval);
 }
 
 
@@ -959,9 +1687,7 @@ static MandatoryWatchdogObj_t* CreateFrameworkWatchdog
     LE_ASSERT(NULL == le_hashmap_Put(MandatoryWatchdogRefs, &(newDogPtr->key), newDogPtr));
 
     // Immediately start this watchdog.
-    LE_ASSERT(LE_OK == le_timer_SetInterval(newDogPtr->watchdog.timer,
-                                            newDogPtr->watchdog.kickTimeoutInterval));
-    le_timer_Start(newDogPtr->watchdog.timer);
+    StartDeadline(&newDogPtr->watchdog.deadline, newDogPtr->watchdog.kickTimeoutInterval);
 
     return newDogPtr;
 }
@@ -979,11 +1705,8 @@ static void CleanupWdog
 {
     WatchdogObj_t* deadDogPtr = objectPtr;
 
-    // If this watchdog has a timer, delete it.
-    if (deadDogPtr->timer)
-    {
-        le_timer_Delete(deadDogPtr->timer);
-    }
+    // If this watchdog is still armed, remove it from the deadlines.
+    StopDeadline(&deadDogPtr->deadline);
 }
 
 
@@ -1013,6 +1736,7 @@ static WatchdogObj_t* GetClientWatchdogPtr
         {
             watchdogPtr = CreateNewWatchdog(clientProcId);
             AddWatchdog(watchdogPtr);
+            JoinGroup(watchdogPtr);
         }
     }
     else
@@ -1037,9 +1761,10 @@ static void ResetClientWatchdog
     WatchdogObj_t* watchDogPtr = GetClientWatchdogPtr();
     if (watchDogPtr != NULL)
     {
-        le_timer_Stop(watchDogPtr->timer);
         if (timeout == TIMEOUT_KICK)
         {
+            UpdateKickStats(watchDogPtr);
+            KickGroup(watchDogPtr);
             timeoutValue = watchDogPtr->kickTimeoutInterval;
         }
         else
@@ -1061,12 +1786,12 @@ static void ResetClientWatchdog
 
         if (!le_clk_Equal(timeoutValue, MakeTimerInterval(LE_WDOG_TIMEOUT_NEVER)))
         {
-            // timer should be stopped here so this should never fail
-            LE_ASSERT(LE_OK == le_timer_SetInterval(watchDogPtr->timer, timeoutValue));
-            le_timer_Start(watchDogPtr->timer);
+            // Moves the deadline if it is already armed.
+            StartDeadline(&watchDogPtr->deadline, timeoutValue);
         }
         else
         {
+            StopDeadline(&watchDogPtr->deadline);
             LE_DEBUG("Timeout set to NEVER!");
         }
     }
@@ -1090,7 +1815,8 @@ void ResetFrameworkWatchdog
 
     if (watchDogPtr != NULL)
     {
-        le_timer_Restart(watchDogPtr->watchdog.timer);
+        UpdateKickStats(&watchDogPtr->watchdog);
+        RestartDeadline(&watchDogPtr->watchdog.deadline);
     }
 }
 
@@ -1208,6 +1934,47 @@ le_result_t le_wdog_GetMaxWatchdogTimeout
     return LE_NOT_FOUND;
 }
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the kick statistics of the watchdog of this process
+ *
+ * @return
+ *      - LE_OK            The statistics are returned
+ *      - LE_NOT_FOUND     The process has no watchdog
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_wdog_GetKickStatistics
+(
+    uint32_t* kickCountPtr,
+        ///< [OUT] Number of kicks received
+    uint64_t* minKickIntervalPtr,
+        ///< [OUT] Shortest interval between two kicks, in milliseconds
+    uint64_t* maxKickIntervalPtr,
+        ///< [OUT] Longest interval between two kicks, in milliseconds
+    uint64_t* minMarginPtr
+        ///< [OUT] Smallest time left before expiry when a kick was received, in milliseconds
+)
+{
+    if ((kickCountPtr == NULL) || (minKickIntervalPtr == NULL) ||
+        (maxKickIntervalPtr == NULL) || (minMarginPtr == NULL))
+    {
+        LE_KILL_CLIENT("Output pointer is NULL.");
+        return LE_FAULT;
+    }
+
+    WatchdogObj_t* watchDogPtr = GetClientWatchdogPtr();
+    if (watchDogPtr != NULL)
+    {
+        *kickCountPtr = watchDogPtr->stats.kickCount;
+        *minKickIntervalPtr = IntervalToMs(watchDogPtr->stats.minKickInterval);
+        *maxKickIntervalPtr = IntervalToMs(watchDogPtr->stats.maxKickInterval);
+        *minMarginPtr = IntervalToMs(watchDogPtr->stats.minMargin);
+        return LE_OK;
+    }
+
+    return LE_NOT_FOUND;
+}
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Signal to the supervisor that we are set up and ready
@@ -1265,6 +2032,19 @@ static le_result_t InitializeTimerContainer
     LE_ASSERT(NULL != MandatoryWatchdogRefs);
     le_hashmap_MakeTraceable(MandatoryWatchdogRefs);
 
+    WatchdogGroupPool = le_mem_CreatePool("WatchdogGroupPool", sizeof(WatchdogGroup_t));
+    WatchdogGroupRefs = le_hashmap_Create(
+        "wdog_watchdogGroupRefs",
+        LE_WDOG_HASTABLE_WIDTH,
+        le_hashmap_HashString,
+        le_hashmap_EqualsString);
+    LE_ASSERT(NULL != WatchdogGroupRefs);
+
+    // A single timer serves all deadlines.  Do not wake up a suspended system.
+    DeadlineTimer = le_timer_Create("WatchdogDeadlines");
+    LE_ASSERT(LE_OK == le_timer_SetHandler(DeadlineTimer, DeadlineTimerHandler));
+    LE_ASSERT(LE_OK == le_timer_SetWakeup(DeadlineTimer, false));
+
     return LE_OK;
 }
 
@@ -1398,8 +2178,8 @@ void HandleAppUninstall
         if (0 == strcmp(mandatoryWdogPtr->key.appName, appName))
         {
             // This watchdog belongs to the app which has just been uninstalled.
-            // Stop timer and remove it.
-            le_timer_Stop(mandatoryWdogPtr->watchdog.timer);
+            // Stop its deadline and remove it.
+            StopDeadline(&mandatoryWdogPtr->watchdog.deadline);
             LE_ASSERT(NULL != le_hashmap_Remove(MandatoryWatchdogRefs, &(mandatoryWdogPtr->key)));
             le_mem_Release(mandatoryWdogPtr);
         }
@@ -1407,6 +2187,57 @@ void HandleAppUninstall
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handle app pause and resume.  Hold the deadlines of all the watchdogs of the app while it is
+ * paused.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HandleAppPause
+(
+    const char* appName,
+    bool isPaused,
+    void* contextPtr
+)
+{
+    void (*applyFunc)(Deadline_t* deadlinePtr) = (isPaused ? HoldDeadline : ReleaseDeadline);
+    char procAppName[LIMIT_MAX_APP_NAME_BYTES];
+    le_hashmap_It_Ref_t iter;
+
+    LE_INFO("%s watchdogs of app %s", (isPaused ? "Suspending" : "Resuming"), appName);
+
+    iter = le_hashmap_GetIterator(WatchdogRefsContainer);
+    while (LE_OK == le_hashmap_NextNode(iter))
+    {
+        WatchdogObj_t* dogPtr = le_hashmap_GetValue(iter);
+
+        if ((LE_OK == GetAppNameFromPid(dogPtr->procId, procAppName, sizeof(procAppName))) &&
+            (0 == strcmp(procAppName, appName)))
+        {
+            applyFunc(&dogPtr->deadline);
+        }
+    }
+
+    // Mandatory watchdogs also run while their process is not.
+    iter = le_hashmap_GetIterator(MandatoryWatchdogRefs);
+    while (LE_OK == le_hashmap_NextNode(iter))
+    {
+        MandatoryWatchdogObj_t* mandatoryWdogPtr = le_hashmap_GetValue(iter);
+
+        if (0 == strcmp(mandatoryWdogPtr->key.appName, appName))
+        {
+            applyFunc(&mandatoryWdogPtr->watchdog.deadline);
+        }
+    }
+
+    WatchdogGroup_t* groupPtr = le_hashmap_Get(WatchdogGroupRefs, appName);
+    if (NULL != groupPtr)
+    {
+        applyFunc(&groupPtr->deadline);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Create watchdogs for all framework daemons.
@@ -1499,6 +2330,7 @@ COMPONENT_INIT
 
     SystemProcessNotifySupervisor();
     wdog_ConnectService();
+    wdog_AddAppPauseHandler(HandleAppPause, NULL);
     le_appInfo_ConnectService();
 
     // Read the system defined external watchdog timeout from configtree
@@ -0,0 +1,187 @@
+/** @page c_arena Arena Allocator API
+ *
+ * @subpage le_arena.h "API Reference"
+ *
+ * <HR>
+ *
+ * An arena hands out memory by bumping a pointer through chunks of memory, and releases all of it
+ * at once.  It suits temporary objects whose lifetime ends at a well-known point, such as the end
+ * of the processing of a message: allocating from an arena takes no lock and has no per-object
+ * bookkeeping, and nothing needs to be released object by object.
+ *
+ * @section c_arena_alloc Allocating and Releasing
+ *
+ * le_arena_Alloc() allocates memory from an arena.  The memory is aligned on 8 bytes and is not
+ * initialized.  It stays valid until the arena is reset: le_arena_Reset() releases everything
+ * allocated from the arena, and le_arena_ResetToMark() releases everything allocated since
+ * le_arena_GetMark() returned the mark, which allows nested scopes to share an arena:
+ *
+ * @code
+ * le_arena_Mark_t mark = le_arena_GetMark(arenaRef);
+ *
+ * char* pathPtr = le_arena_Alloc(arenaRef, pathLen + 1);
+ * ...
+ *
+ * le_arena_ResetToMark(arenaRef, mark);
+ * @endcode
+ *
+ * The chunks are kept by the arena when it is reset, so an arena that is reset regularly soon
+ * stops allocating memory altogether.  Allocations larger than a chunk get a chunk of their own,
+ * which is freed on reset.
+ *
+ * @section c_arena_scratch Scratch Arena
+ *
+ * Each thread has a scratch arena, returned by le_arena_GetScratch().  The generated IPC server
+ * code allocates the buffers of the string and array parameters of a function from it, sized for
+ * the actual parameters rather than for the maximum allowed by the API, and resets it to where it
+ * was once the message has been handled.  A server function can therefore use the scratch arena
+ * for its own temporary memory, which is released when the function returns:
+ *
+ * @code
+ * void le_foo_SetName(const char* namePtr)
+ * {
+ *     char* upperPtr = le_arena_Alloc(le_arena_GetScratch(), strlen(namePtr) + 1);
+ *     ...
+ * }
+ * @endcode
+ *
+ * @warning Memory allocated from the scratch arena by a server function must not be used after
+ *          the function returns, even by an asynchronous server function that responds later.
+ *
+ * Outside of server functions, code using the scratch arena must restore it with
+ * le_arena_ResetToMark() when done, as nothing else resets it.
+ *
+ * @section c_arena_threads Threads
+ *
+ * An arena must only be used by one thread at a time.  The scratch arena of a thread is deleted
+ * when the thread exits.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+//--------------------------------------------------------------------------------------------------
+/** @file le_arena.h
+ *
+ * Legato @ref c_arena include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_ARENA_INCLUDE_GUARD
+#define LEGATO_ARENA_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_arena* le_arena_Ref_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Position in an arena, to reset it to later.  Obtained with le_arena_GetMark().
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    void*  chunkPtr;    ///< Chunk being allocated from.
+    size_t usedBytes;   ///< Bytes allocated from the chunk.
+}
+le_arena_Mark_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an arena.
+ *
+ * @return Reference to the arena.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_Create
+(
+    void
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete an arena, releasing all the memory allocated from it.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Delete
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate memory from an arena.
+ *
+ * @return Pointer to the memory, aligned on 8 bytes.  Never NULL: the process exits if the memory
+ *         can't be allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_Alloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] Arena.
+    size_t size                 ///< [IN] Size in bytes.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the current position in an arena.
+ *
+ * @return Mark to pass to le_arena_ResetToMark().
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Mark_t le_arena_GetMark
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the memory allocated from an arena since a mark was obtained.
+ *
+ * @note The memory allocated before the mark stays valid, and so do the marks obtained before it.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_ResetToMark
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] Arena.
+    le_arena_Mark_t mark        ///< [IN] Mark obtained with le_arena_GetMark().
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release all the memory allocated from an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Reset
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the scratch arena of the calling thread, creating it if needed.
+ *
+ * @return Reference to the arena.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_GetScratch
+(
+    void
+);
+
+
+#endif // LEGATO_ARENA_INCLUDE_GUARD
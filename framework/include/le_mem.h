@@ -233,6 +233,8 @@
  *  - Number of allocations.
  *  - Number of currently free objects.
  *  - Number of overflows (times that le_mem_ForceAlloc() had to expand the pool).
+ *  - Maximum number of objects in the pool (see @ref mem_trimming).
+ *  - Number of objects given back to the system (see @ref mem_trimming).
  *
  * Statistics (and other pool properties) can be checked using functions:
  *  - @c le_mem_GetStats()
@@ -351,6 +353,30 @@
  * a problem because we can't @a shrink pools or delete pools when clients go away.  This is where
  * @ref mem_sub_pools is useful.
  *
+ * @section mem_trimming Giving Memory Back
+ *
+ * When le_mem_ForceAlloc() expands a pool, the new objects are allocated from the heap as a chunk
+ * and are kept in the pool once released.  A burst of allocations therefore permanently raises
+ * the memory used by the process, even though the pool sits idle afterwards.
+ *
+ * To give this memory back, call @c le_mem_SetAutoTrim() with the time a chunk must stay unused
+ * before it is freed.  The chunks added by le_mem_ForceAlloc() from then on are freed once all
+ * their objects have been free for that time, while the objects added by le_mem_ExpandPool() stay
+ * in the pool:
+ *
+ * @code
+ *     le_mem_SetNumObjsToForce(MsgPool, 16);
+ *     le_mem_SetAutoTrim(MsgPool, 30000);
+ * @endcode
+ *
+ * Chunks are only tracked for the pools with auto-trimming enabled, so that the other pools don't
+ * pay for it.  @c le_mem_Trim() frees the idle chunks of such a pool at once.
+ *
+ * The objects of a sub-pool belong to its super-pool, which is the one to be trimmed.
+ *
+ * The maximum number of objects the pool ever held and the number of objects given back are
+ * part of the pool statistics, and are shown by the "inspect" tool.
+ *
  * @section mem_sub_pools Sub-Pools
  *
  * Essentially, a Sub-Pool is a memory pool that gets its blocks from another pool (the super-pool).
@@ -506,9 +532,16 @@ typedef struct le_mem_Pool
     uint64_t numAllocations;            ///< Total number of times an object has been allocated
                                         ///  from this pool.
     size_t maxNumBlocksUsed;            ///< Maximum number of allocated blocks at any one time.
+    size_t maxNumBlocks;                ///< Maximum number of blocks in the pool at any one time.
+    size_t numTrimmedBlocks;            ///< Number of blocks given back to the system.
 #endif
 #if LE_CONFIG_MEM_POOLS
     le_sls_List_t freeList;             ///< List of free memory blocks.
+    le_dls_List_t chunkList;            ///< Chunks of blocks added by le_mem_ForceAlloc() while
+                                        ///  auto-trimming is enabled, which can be given back to
+                                        ///  the system.
+    uint32_t autoTrimMs;                ///< Time a chunk must stay free before it is given back
+                                        ///  automatically (ms), 0 if auto-trimming is disabled.
 #endif
 
     size_t userDataSize;                ///< Size of the object requested by the client in bytes.
@@ -552,6 +585,8 @@ typedef struct
     size_t      numOverflows;       ///< Number of times le_mem_ForceAlloc() had to expand the pool.
     uint64_t    numAllocs;          ///< Number of times an object has been allocated from this pool.
     size_t      numFree;            ///< Number of free objects currently available in this pool.
+    size_t      maxNumBlocks;       ///< Maximum number of objects in this pool at any one time.
+    size_t      numTrimmed;         ///< Number of free objects given back to the system.
 }
 le_mem_PoolStats_t;
 
@@ -1157,6 +1192,51 @@ void le_mem_SetDestructor
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives the chunks of free objects added by le_mem_ForceAlloc() back to the system.
+ *
+ * Only the chunks in which all objects are free are given back, and only the chunks added while
+ * auto-trimming was enabled for the pool (see le_mem_SetAutoTrim()).  The objects added by
+ * le_mem_ExpandPool() or le_mem_InitStaticPool() are never given back.
+ *
+ * See @ref mem_trimming for more information.
+ *
+ * @return
+ *      Number of objects removed from the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_Trim
+(
+    le_mem_PoolRef_t    pool        ///< [IN] Pool to trim.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the time after which the chunks of free objects added by le_mem_ForceAlloc() are
+ * automatically given back to the system.
+ *
+ * Only the chunks added by le_mem_ForceAlloc() after auto-trimming is enabled can be given back,
+ * so it should be enabled right after the pool is created.
+ *
+ * The pools are checked from the event loop of the first thread that enables auto-trimming, so
+ * that thread must run its event loop.
+ *
+ * See @ref mem_trimming for more information.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_SetAutoTrim
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] Pool to trim automatically.
+    uint32_t            idleTimeMs  ///< [IN] Time all the objects of a chunk must stay free before
+                                    ///       it is given back (ms), 0 to disable auto-trimming.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the statistics for a specified pool.
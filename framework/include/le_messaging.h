@@ -173,11 +173,14 @@
  *     responseMsgRef = le_msg_RequestSyncResponse(msgRef);
  * @endcode
  *
+ * @note When the client and server are running in the same process, messages are handed over
+ * between the two sides of the session without going through the socket, and the response to a
+ * synchronous request wakes up the client directly.  This is transparent to both sides.
+ *
  * @warning If the client and server are running in the same thread, and the
- * client calls le_msg_RequestSyncResponse(), it will return an error immediately, instead of
- * blocking the thread.  If the thread were blocked in this scenario, the server would also be
- * blocked and would therefore be unable to receive the request and respond to it, resulting in
- * a deadlock.
+ * client calls le_msg_RequestSyncResponse(), the request is passed directly to the server's
+ * receive handler, which must respond to it before returning.  If it doesn't, the thread would
+ * never be woken up (the server would be blocked too), so the process is terminated instead.
  *
  * When the client is finished with it, the <b> client must release its reference
  * to the response message </b> by calling le_msg_ReleaseMsg().
@@ -554,6 +557,42 @@
  * }
  * @endcode
  *
+ * @subsection c_messagingServerSlowClients Slow Clients
+ *
+ * Messages that can't be written to the socket of a session right away are queued until the
+ * client reads them.  Responses are always sent before the queued non-response messages (the
+ * "indications"), so that a client waiting for a response does not wait behind a backlog of
+ * events.
+ *
+ * To stop a client that does not keep up from making a server use up its message pool, the number
+ * of indications queued per session can be limited.  The default limit,
+ * LE_CONFIG_MSG_TX_QUEUE_LIMIT, is 0 (no limit) unless the system is configured otherwise, and the
+ * oldest queued indication is dropped when a session reaches it.  A server can set its own limit
+ * and overflow policy with le_msg_SetServiceTxQueueLimit():
+ *  - @ref LE_MSG_TX_OVERFLOW_DROP_OLDEST drops the oldest queued indication.
+ *  - @ref LE_MSG_TX_OVERFLOW_COALESCE drops the oldest queued indication superseded by a newer one
+ *    (queued or new) with the same coalescing key, which suits indications reporting a state, such
+ *    as a signal strength or a position, of which only the latest value matters.  The oldest
+ *    indication is dropped if none is superseded.  Indications have no key unless the server sets
+ *    one, so the events that are not states are only dropped once no stale state is left, and
+ *    nothing is coalesced before the limit is reached.
+ *  - @ref LE_MSG_TX_OVERFLOW_DISCONNECT closes the session.  Only use it for services whose clients
+ *    handle the closing of their session: the client code generated by ifgen treats it as fatal.
+ *
+ * A server sets the key of a message with le_msg_SetCoalesceKey().  As the messages of the events
+ * of a generated API are created by the generated code, a server sets the key of those with
+ * le_msg_SetThreadCoalesceKey() around its call to the handler of a client, typically to the
+ * address of the handler registration, so that only the reports of the same handler are coalesced:
+ *
+ * @code
+ * le_msg_SetThreadCoalesceKey((uintptr_t)le_event_GetContextPtr());
+ * clientHandlerFunc(state, le_event_GetContextPtr());
+ * le_msg_SetThreadCoalesceKey(0);
+ * @endcode
+ *
+ * The depth of the queue of each session, its peak and the number of indications dropped can be
+ * displayed with "inspect ipc servers sessions".
+ *
  * @subsection c_messagingServerCleanUp Cleaning up when Sessions Close
  *
  * If a server keeps state on behalf of its clients, it can call le_msg_AddServiceCloseHandler()
@@ -796,6 +835,11 @@
  * You can also inspect message queues and view lists of outstanding message objects within
  * processes using the Process Inspector tool.
  *
+ * If the framework is built with @c LE_CONFIG_IPC_TRACE, the generated client and server code
+ * counts the calls to each function of each API and records a histogram of their latency
+ * (round-trip time for clients, handler time for servers).  @c inspect @c ipctrace displays them
+ * without stopping the process.
+ *
  * If you're leaking messages by forgetting to release them when you're finished with them,
  * you'll see warning messages in the log indicating your message pool is growing.
  * You should be able to tell the related messaging service by the name of the expanding pool.
@@ -932,6 +976,24 @@ typedef void (* le_msg_ResponseCallback_t)
 
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * What to do with a new indication (non-response message sent by a server) when the transmit
+ * queue of a session already holds as many indications as the limit of its service allows.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_MSG_TX_OVERFLOW_DISCONNECT,  ///< Drop the new indication and close the session.  Generated
+                                    ///  clients treat the closing of their session as fatal.
+    LE_MSG_TX_OVERFLOW_DROP_OLDEST, ///< Drop the oldest queued indication.
+    LE_MSG_TX_OVERFLOW_COALESCE     ///< Drop the oldest queued indication superseded by a newer
+                                    ///  one with the same coalescing key, if any, else the oldest
+                                    ///  queued one.
+}
+le_msg_TxOverflowPolicy_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Generic service object.  Used internally as part of low-level messaging implementation.
@@ -1501,6 +1563,40 @@ void le_msg_Send
     le_msg_MessageRef_t msgRef      ///< [in] Reference to the message.
 );
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the coalescing key of a message sent by a server.  If the message has to be queued while
+ * the queue of the session is full, and the service uses the @ref LE_MSG_TX_OVERFLOW_COALESCE
+ * policy, the queued indications with the same key, which it supersedes, are dropped before the
+ * others to make room for it.
+ *
+ * Messages have the key set by le_msg_SetThreadCoalesceKey() by default, or else 0, which never
+ * matches.
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetCoalesceKey
+(
+    le_msg_MessageRef_t msgRef,     ///< [in] Reference to the message.
+    uint64_t            key         ///< [in] Coalescing key.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the coalescing key given to the messages created by the calling thread from now on (see
+ * le_msg_SetCoalesceKey()).  This lets a server key the messages that the generated code creates
+ * for the events of its API.  Set it back to 0 once the messages of a state report are created.
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetThreadCoalesceKey
+(
+    uintptr_t           key         ///< [in] Coalescing key, or 0 for none.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets a reference to the session to which a given message belongs.
@@ -1562,7 +1658,8 @@ void le_msg_RequestResponse
  *          deadlines to be missed by the client.  Consider using le_msg_RequestResponse()
  *          instead.
  *        - If this function is used when the client and server are in the same thread, then the
- *          message will be discarded and NULL will be returned.  This is a deadlock prevention
+ *          request is passed directly to the server's receive handler, which must respond to it
+ *          before returning, or the process will be terminated.  This is a deadlock prevention
  *          measure.
  */
 //--------------------------------------------------------------------------------------------------
@@ -1698,6 +1795,23 @@ void le_msg_SetServiceRecvHandler
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of indications (non-response messages) queued for each session of a
+ * service, and what to do when a session reaches it.  See @ref c_messagingServerSlowClients.
+ *
+ * @note    Server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_FULL_API void le_msg_SetServiceTxQueueLimit
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      maxCount,   ///< [in] Maximum number of queued indications, or 0
+                                            ///       for no limit.
+    le_msg_TxOverflowPolicy_t   policy      ///< [in] What to do when the limit is reached.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Associates an opaque context value (void pointer) with a given service that can be retrieved
@@ -1802,6 +1916,65 @@ le_msg_MessageRef_t le_msg_GetServiceRxMsg
 );
 
 
+#if LE_CONFIG_IPC_TRACE
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to the call trace of an API.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_msg_Trace* le_msg_TraceRef_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Starts tracing the calls to the functions of an API.  Used by the generated client and server
+ * code, which identifies the functions by their message ID.
+ *
+ * The call counts and latency histograms can be displayed with "inspect ipctrace".
+ *
+ * @return  Reference to the trace, or NULL if the API can't be traced.  A NULL reference can be
+ *          passed to le_msg_TraceStart() and le_msg_TraceEnd(), which then do nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_TraceRef_t le_msg_CreateTrace
+(
+    const char* apiNamePtr,             ///< [in] Name of the API or service instance.
+    bool isServer,                      ///< [in] true for the server side of the API.
+    const char* const* funcNamesPtr,    ///< [in] Function names, indexed by message ID.
+    size_t numFuncs                     ///< [in] Number of functions.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records the start of a call to a function of a traced API.
+ *
+ * @return  Start time of the call, to pass to le_msg_TraceEnd().
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_msg_TraceStart
+(
+    le_msg_TraceRef_t traceRef,         ///< [in] Reference to the trace.
+    uint32_t funcId                     ///< [in] Message ID of the function.
+);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Records the end of a call to a function of a traced API.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_TraceEnd
+(
+    le_msg_TraceRef_t traceRef,         ///< [in] Reference to the trace.
+    uint32_t funcId,                    ///< [in] Message ID of the function.
+    uint64_t startNs                    ///< [in] Value returned by le_msg_TraceStart().
+);
+
+#endif // LE_CONFIG_IPC_TRACE
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Logs an error message (at EMERGENCY level) and:
@@ -0,0 +1,245 @@
+/** @page c_shmChannel Shared Memory Channel API
+ *
+ * @subpage le_shmChannel.h "API Reference"
+ *
+ * <HR>
+ *
+ * A shared memory channel is a single-producer, single-consumer ring of fixed-size records held
+ * in shared memory.  It is meant for services streaming many small records (positioning samples,
+ * unsolicited indications, data records, etc.) to a client: sending a record only costs a copy
+ * into the ring, and the consumer is only woken up when the ring goes from empty to non-empty,
+ * instead of one IPC message, and its system calls, per record.
+ *
+ * @section c_shmChannel_create Creating and Sharing a Channel
+ *
+ * The producer creates the channel with le_shmChannel_Create(), giving the maximum size of a
+ * record and the number of records the ring can hold.  The channel is made of two file
+ * descriptors: the shared memory and an eventfd used to signal the consumer.  Both are obtained
+ * with le_shmChannel_GetFds() and handed to the consumer over the service's existing IPC session,
+ * by passing them as @c file parameters of a function of the service's .api file:
+ *
+ * @code
+ * FUNCTION le_result_t OpenSampleChannel
+ * (
+ *     file memFd OUT,
+ *     file eventFd OUT
+ * );
+ * @endcode
+ *
+ * The consumer then attaches to the channel with le_shmChannel_Attach(), which takes ownership of
+ * the two file descriptors.
+ *
+ * @section c_shmChannel_transfer Transferring Records
+ *
+ * The producer calls le_shmChannel_Write() to append a record to the ring.  The consumer registers
+ * a handler with le_shmChannel_SetReadHandler(); it is called from the consumer thread's event
+ * loop when records are available, and must call le_shmChannel_Read() until it returns
+ * LE_WOULD_BLOCK.  A consumer which does not use an event loop can call le_shmChannel_Read()
+ * directly.
+ *
+ * @section c_shmChannel_full Full Ring
+ *
+ * What happens when the ring is full is chosen when the channel is created:
+ *  - LE_SHMCHANNEL_FULL_BACKPRESSURE: le_shmChannel_Write() returns LE_WOULD_BLOCK and the
+ *    producer keeps the record, to retry later.
+ *  - LE_SHMCHANNEL_FULL_DROP: the record is dropped and le_shmChannel_Write() returns
+ *    LE_NO_MEMORY.
+ *
+ * Both cases are counted, and the counters can be read by both sides with
+ * le_shmChannel_GetStats().
+ *
+ * @section c_shmChannel_threads Threads
+ *
+ * Each side of a channel must only be used by a single thread at a time.
+ *
+ * @note This API is only available on Linux.
+ *
+ * <HR>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+/** @file le_shmChannel.h
+ *
+ * Legato @ref c_shmChannel include file.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef LEGATO_SHMCHANNEL_INCLUDE_GUARD
+#define LEGATO_SHMCHANNEL_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to a shared memory channel.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_shmChannel* le_shmChannel_Ref_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * What to do when a record is written to a full ring.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    LE_SHMCHANNEL_FULL_BACKPRESSURE = 0,    ///< Refuse the record, the producer keeps it.
+    LE_SHMCHANNEL_FULL_DROP = 1             ///< Drop the record.
+}
+le_shmChannel_FullPolicy_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Channel statistics.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t writeCount;        ///< Number of records written into the ring.
+    uint64_t readCount;         ///< Number of records read from the ring.
+    uint64_t droppedCount;      ///< Number of records dropped because the ring was full.
+    uint64_t fullCount;         ///< Number of records refused because the ring was full.
+    uint64_t signalCount;       ///< Number of times the consumer was signalled.
+}
+le_shmChannel_Stats_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype for the handler called when records are available in a channel.
+ *
+ * The handler must read records with le_shmChannel_Read() until it returns LE_WOULD_BLOCK.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*le_shmChannel_ReadHandlerFunc_t)
+(
+    le_shmChannel_Ref_t channelRef,     ///< Channel with records available.
+    void*               contextPtr      ///< Context pointer given to le_shmChannel_SetReadHandler().
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a shared memory channel, on the producer side.
+ *
+ * @return Reference to the channel, or NULL on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_shmChannel_Ref_t le_shmChannel_Create
+(
+    const char*                 name,           ///< [IN] Name of the channel, for diagnostics.
+    size_t                      maxRecordSize,  ///< [IN] Maximum size of a record, in bytes.
+    size_t                      recordCount,    ///< [IN] Number of records the ring can hold.
+                                                ///<      Rounded up to a power of two.
+    le_shmChannel_FullPolicy_t  fullPolicy      ///< [IN] What to do when the ring is full.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the file descriptors of a channel, to hand them to the consumer.
+ *
+ * The file descriptors are duplicates owned by the caller.  They are typically passed as @c file
+ * parameters of an IPC function, which closes them once sent.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_FAULT if the file descriptors could not be duplicated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_GetFds
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    int*                memFdPtr,       ///< [OUT] Shared memory file descriptor.
+    int*                eventFdPtr      ///< [OUT] Signalling file descriptor.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Attach to a shared memory channel, on the consumer side.
+ *
+ * The file descriptors are owned by the channel from now on, even on failure.
+ *
+ * @return Reference to the channel, or NULL if the file descriptors are not a valid channel.
+ */
+//--------------------------------------------------------------------------------------------------
+le_shmChannel_Ref_t le_shmChannel_Attach
+(
+    const char* name,       ///< [IN] Name of the channel, for diagnostics.
+    int         memFd,      ///< [IN] Shared memory file descriptor.
+    int         eventFd     ///< [IN] Signalling file descriptor.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a record into a channel.  Must be called by the producer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_BAD_PARAMETER if the record is larger than the maximum record size.
+ *      - LE_WOULD_BLOCK if the ring is full and the channel applies backpressure.
+ *      - LE_NO_MEMORY if the ring is full and the record was dropped.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_Write
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    const void*         dataPtr,        ///< [IN] Record.
+    size_t              size            ///< [IN] Size of the record, in bytes.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the oldest record from a channel.  Must be called by the consumer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_WOULD_BLOCK if the ring is empty.
+ *      - LE_OVERFLOW if the buffer is too small for the record, which is left in the ring.
+ *        *sizePtr is set to the size of the record.
+ *      - LE_FAULT if the ring is corrupted.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_Read
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    void*               bufPtr,         ///< [OUT] Buffer receiving the record.
+    size_t*             sizePtr         ///< [IN/OUT] Size of the buffer, then of the record.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the handler called, from the calling thread's event loop, when records are available in a
+ * channel.  Must be called by the consumer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_DUPLICATE if a handler is already set.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_SetReadHandler
+(
+    le_shmChannel_Ref_t             channelRef,     ///< [IN] Channel reference.
+    le_shmChannel_ReadHandlerFunc_t handlerFunc,    ///< [IN] Handler function.
+    void*                           contextPtr      ///< [IN] Context pointer for the handler.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a channel.  Can be called on both sides.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_shmChannel_GetStats
+(
+    le_shmChannel_Ref_t     channelRef,     ///< [IN] Channel reference.
+    le_shmChannel_Stats_t*  statsPtr        ///< [OUT] Statistics.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a channel.  The shared memory is freed when both sides have deleted the channel.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_shmChannel_Delete
+(
+    le_shmChannel_Ref_t channelRef      ///< [IN] Channel reference.
+);
+
+#endif // LEGATO_SHMCHANNEL_INCLUDE_GUARD
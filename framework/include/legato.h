@@ -185,6 +185,7 @@ extern "C" {
 #include "le_backtrace.h"
 #include "le_log.h"
 #include "le_mem.h"
+#include "le_arena.h"
 #include "le_mutex.h"
 #include "le_clock.h"
 #include "le_cdata.h"
@@ -214,6 +215,7 @@ extern "C" {
 #include "le_fd.h"
 #include "le_base64.h"
 #include "le_process.h"
+#include "le_shmChannel.h"
 
 #ifdef __cplusplus
 }
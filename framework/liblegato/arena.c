@@ -0,0 +1,372 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file arena.c
+ *
+ * Implementation of the arena allocator.
+ *
+ * An arena is a stack of chunks.  Memory is allocated from the chunk at the top of the stack by
+ * bumping its used byte count; when it is full, a new chunk is pushed.  Resetting to a mark pops
+ * the chunks pushed after the mark and restores the used byte count of the chunk of the mark.
+ *
+ * Regular chunks come from a pool and the last few ones popped are kept by the arena as spares,
+ * so that an arena which is reset regularly stops going to the pool.  Allocations too large for a
+ * regular chunk get a chunk of their own, allocated from the heap and freed when popped.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "arena.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of a regular chunk, including its header.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHUNK_BYTES         2048
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Alignment of the allocations.
+ */
+//--------------------------------------------------------------------------------------------------
+#define ALIGNMENT           8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of spare chunks kept by an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_SPARE_CHUNKS    4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of regular chunks statically allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STATIC_CHUNK_COUNT  4
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Chunk.  Followed by the memory allocated from it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct Chunk
+{
+    struct Chunk* belowPtr;     ///< Chunk below this one in the stack, or next spare chunk.
+    size_t size;                ///< Bytes available for allocation.
+    bool isLarge;               ///< Allocated from the heap rather than from ChunkPool.
+    uint64_t data[];            ///< Memory allocated from the chunk.
+}
+Chunk_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Bytes available for allocation in a regular chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHUNK_DATA_BYTES    (CHUNK_BYTES - sizeof(Chunk_t))
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Arena.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_arena
+{
+    Chunk_t* topPtr;            ///< Chunk at the top of the stack, or NULL if empty.
+    size_t usedBytes;           ///< Bytes allocated from the top chunk.
+    Chunk_t* sparePtr;          ///< List of spare chunks.
+    size_t numSpares;           ///< Number of spare chunks.
+}
+Arena_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pools of arenas and of regular chunks.
+ */
+//--------------------------------------------------------------------------------------------------
+LE_MEM_DEFINE_STATIC_POOL(Arena, LE_CONFIG_MAX_THREAD_POOL_SIZE, sizeof(Arena_t));
+static le_mem_PoolRef_t ArenaPool;
+
+LE_MEM_DEFINE_STATIC_POOL(ArenaChunk, STATIC_CHUNK_COUNT, CHUNK_BYTES);
+static le_mem_PoolRef_t ChunkPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key of the thread-local pointer to the scratch arena of the thread.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t ScratchKey;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Push a chunk with room for an allocation on top of an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PushChunk
+(
+    Arena_t* arenaPtr,
+    size_t size
+)
+{
+    Chunk_t* chunkPtr;
+
+    if (size > CHUNK_DATA_BYTES)
+    {
+        chunkPtr = malloc(sizeof(Chunk_t) + size);
+        LE_FATAL_IF(chunkPtr == NULL, "Can't allocate %" PRIuS " bytes for arena.", size);
+        chunkPtr->size = size;
+        chunkPtr->isLarge = true;
+    }
+    else if (arenaPtr->sparePtr != NULL)
+    {
+        chunkPtr = arenaPtr->sparePtr;
+        arenaPtr->sparePtr = chunkPtr->belowPtr;
+        arenaPtr->numSpares--;
+    }
+    else
+    {
+        chunkPtr = le_mem_ForceAlloc(ChunkPool);
+        chunkPtr->size = CHUNK_DATA_BYTES;
+        chunkPtr->isLarge = false;
+    }
+
+    chunkPtr->belowPtr = arenaPtr->topPtr;
+    arenaPtr->topPtr = chunkPtr;
+    arenaPtr->usedBytes = 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pop the chunk at the top of an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PopChunk
+(
+    Arena_t* arenaPtr
+)
+{
+    Chunk_t* chunkPtr = arenaPtr->topPtr;
+
+    arenaPtr->topPtr = chunkPtr->belowPtr;
+
+    if (chunkPtr->isLarge)
+    {
+        free(chunkPtr);
+    }
+    else if (arenaPtr->numSpares < MAX_SPARE_CHUNKS)
+    {
+        chunkPtr->belowPtr = arenaPtr->sparePtr;
+        arenaPtr->sparePtr = chunkPtr;
+        arenaPtr->numSpares++;
+    }
+    else
+    {
+        le_mem_Release(chunkPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the arena module.
+ *
+ * Must be called exactly once at start-up before any other arena functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void arena_Init
+(
+    void
+)
+{
+    ArenaPool = le_mem_InitStaticPool(Arena, LE_CONFIG_MAX_THREAD_POOL_SIZE, sizeof(Arena_t));
+    ChunkPool = le_mem_InitStaticPool(ArenaChunk, STATIC_CHUNK_COUNT, CHUNK_BYTES);
+
+    LE_FATAL_IF(pthread_key_create(&ScratchKey, NULL) != 0,
+                "Failed to create thread local storage for scratch arena");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete the scratch arena (if any) of the current thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void arena_DestructThread
+(
+    void
+)
+{
+    Arena_t* arenaPtr = pthread_getspecific(ScratchKey);
+
+    if (arenaPtr != NULL)
+    {
+        pthread_setspecific(ScratchKey, NULL);
+        le_arena_Delete(arenaPtr);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create an arena.
+ *
+ * @return Reference to the arena.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_Create
+(
+    void
+)
+{
+    Arena_t* arenaPtr = le_mem_ForceAlloc(ArenaPool);
+
+    arenaPtr->topPtr = NULL;
+    arenaPtr->usedBytes = 0;
+    arenaPtr->sparePtr = NULL;
+    arenaPtr->numSpares = 0;
+
+    return arenaPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete an arena, releasing all the memory allocated from it.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Delete
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+)
+{
+    le_arena_Reset(arenaRef);
+
+    while (arenaRef->sparePtr != NULL)
+    {
+        Chunk_t* chunkPtr = arenaRef->sparePtr;
+
+        arenaRef->sparePtr = chunkPtr->belowPtr;
+        le_mem_Release(chunkPtr);
+    }
+
+    le_mem_Release(arenaRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate memory from an arena.
+ *
+ * @return Pointer to the memory, aligned on 8 bytes.  Never NULL: the process exits if the memory
+ *         can't be allocated.
+ */
+//--------------------------------------------------------------------------------------------------
+void* le_arena_Alloc
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] Arena.
+    size_t size                 ///< [IN] Size in bytes.
+)
+{
+    size = (size + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1);
+
+    if ((arenaRef->topPtr == NULL) || (size > arenaRef->topPtr->size - arenaRef->usedBytes))
+    {
+        PushChunk(arenaRef, size);
+    }
+
+    void* ptr = (uint8_t*)arenaRef->topPtr->data + arenaRef->usedBytes;
+    arenaRef->usedBytes += size;
+
+    return ptr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the current position in an arena.
+ *
+ * @return Mark to pass to le_arena_ResetToMark().
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Mark_t le_arena_GetMark
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+)
+{
+    le_arena_Mark_t mark = { .chunkPtr = arenaRef->topPtr, .usedBytes = arenaRef->usedBytes };
+
+    return mark;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release the memory allocated from an arena since a mark was obtained.
+ *
+ * @note The memory allocated before the mark stays valid, and so do the marks obtained before it.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_ResetToMark
+(
+    le_arena_Ref_t arenaRef,    ///< [IN] Arena.
+    le_arena_Mark_t mark        ///< [IN] Mark obtained with le_arena_GetMark().
+)
+{
+    while (arenaRef->topPtr != mark.chunkPtr)
+    {
+        LE_FATAL_IF(arenaRef->topPtr == NULL, "Mark does not belong to arena %p.", arenaRef);
+        PopChunk(arenaRef);
+    }
+
+    arenaRef->usedBytes = mark.usedBytes;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Release all the memory allocated from an arena.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_arena_Reset
+(
+    le_arena_Ref_t arenaRef     ///< [IN] Arena.
+)
+{
+    le_arena_Mark_t mark = { .chunkPtr = NULL, .usedBytes = 0 };
+
+    le_arena_ResetToMark(arenaRef, mark);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the scratch arena of the calling thread, creating it if needed.
+ *
+ * @return Reference to the arena.
+ */
+//--------------------------------------------------------------------------------------------------
+le_arena_Ref_t le_arena_GetScratch
+(
+    void
+)
+{
+    Arena_t* arenaPtr = pthread_getspecific(ScratchKey);
+
+    if (arenaPtr == NULL)
+    {
+        arenaPtr = le_arena_Create();
+        LE_ASSERT(pthread_setspecific(ScratchKey, arenaPtr) == 0);
+    }
+
+    return arenaPtr;
+}
@@ -0,0 +1,37 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file arena.h
+ *
+ * Interfaces exported by the arena allocator to other modules inside the Legato framework
+ * implementation.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef ARENA_H_INCLUDE_GUARD
+#define ARENA_H_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the arena module.
+ *
+ * Must be called exactly once at start-up before any other arena functions are called.
+ */
+//--------------------------------------------------------------------------------------------------
+void arena_Init
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete the scratch arena (if any) of the current thread.
+ */
+//--------------------------------------------------------------------------------------------------
+void arena_DestructThread
+(
+    void
+);
+
+#endif // ARENA_H_INCLUDE_GUARD
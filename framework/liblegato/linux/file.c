@@ -877,6 +877,81 @@ le_result_t file_CopyRecursive
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether two files have the same content, owner and permissions.  The sizes are compared
+ * first, so the contents are only read if they could match.
+ *
+ * @return true if both paths are regular files with the same content, owner and permissions.
+ *         false otherwise, or if either file could not be read.
+ */
+//--------------------------------------------------------------------------------------------------
+bool file_IsSame
+(
+    const char* path1Ptr,   ///< [IN] Path to the first file.
+    const char* path2Ptr    ///< [IN] Path to the second file.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    struct stat status1;
+    struct stat status2;
+
+    if ((lstat(path1Ptr, &status1) != 0) || (lstat(path2Ptr, &status2) != 0))
+    {
+        return false;
+    }
+
+    if (   (!S_ISREG(status1.st_mode))
+        || (status1.st_mode != status2.st_mode)
+        || (status1.st_uid != status2.st_uid)
+        || (status1.st_gid != status2.st_gid)
+        || (status1.st_size != status2.st_size))
+    {
+        return false;
+    }
+
+    // The same inode under two names.
+    if ((status1.st_dev == status2.st_dev) && (status1.st_ino == status2.st_ino))
+    {
+        return true;
+    }
+
+    int fd1;
+    int fd2;
+
+    if (OpenRead(path1Ptr, &fd1) != LE_OK)
+    {
+        return false;
+    }
+    if (OpenRead(path2Ptr, &fd2) != LE_OK)
+    {
+        fd_Close(fd1);
+        return false;
+    }
+
+    bool isSame = true;
+    off_t remaining = status1.st_size;
+
+    while (isSame && (remaining > 0))
+    {
+        char buf1[1024];
+        char buf2[1024];
+        ssize_t chunkSize = (remaining < (off_t)sizeof(buf1)) ? remaining : (off_t)sizeof(buf1);
+
+        isSame = (fd_ReadSize(fd1, buf1, chunkSize) == chunkSize) &&
+                 (fd_ReadSize(fd2, buf2, chunkSize) == chunkSize) &&
+                 (memcmp(buf1, buf2, chunkSize) == 0);
+
+        remaining -= chunkSize;
+    }
+
+    fd_Close(fd1);
+    fd_Close(fd2);
+
+    return isSame;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Rename a file or directory.
@@ -135,6 +135,22 @@ le_result_t file_CopyRecursive
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether two files have the same content, owner and permissions.  The sizes are compared
+ * first, so the contents are only read if they could match.
+ *
+ * @return true if both paths are regular files with the same content, owner and permissions.
+ *         false otherwise, or if either file could not be read.
+ */
+//--------------------------------------------------------------------------------------------------
+bool file_IsSame
+(
+    const char* path1Ptr,   ///< [IN] Path to the first file.
+    const char* path2Ptr    ///< [IN] Path to the second file.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Rename a file or directory.
@@ -7,6 +7,7 @@
 
 #include "legato.h"
 
+#include "arena.h"
 #include "args.h"
 #include "atomFile.h"
 #include "eventLoop.h"
@@ -21,6 +22,7 @@
 #include "properties.h"
 #include "rand.h"
 #include "safeRef.h"
+#include "shmChannel.h"
 #include "signals.h"
 #include "test.h"
 #include "thread.h"
@@ -65,6 +67,7 @@ __attribute__((constructor)) void _legato_InitFramework
     timer_Init();       // Uses event loop.
     thread_Init();      // Uses event loop, memory pools and safe references.
     arg_Init();         // Uses memory pools.
+    arena_Init();       // Uses memory pools.
     msg_Init();         // Uses event loop.
     kill_Init();        // Uses memory pools and timers.
     properties_Init();  // Uses memory pools and safe references.
@@ -72,6 +75,7 @@ __attribute__((constructor)) void _legato_InitFramework
     pipeline_Init();    // Uses memory pools and FD Monitors.
     atomFile_Init();    // Uses memory pools.
     fs_Init();          // Uses memory pools and safe references.
+    shmChannel_Init();  // Uses memory pools.
     test_Init();        // Initialize test infrastructure last.
 
     // This must be called last, because it calls several subsystems to perform the
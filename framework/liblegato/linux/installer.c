@@ -18,6 +18,20 @@
 #include "user.h"
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Extended attribute holding a file's IMA signature.
+ */
+//--------------------------------------------------------------------------------------------------
+#define IMA_XATTR_NAME          "security.ima"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum size of an IMA signature.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_IMA_SIGNATURE_BYTES 1024
+
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -90,6 +104,184 @@ void installer_GetAppHashFromSymlink
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check whether two files carry the same IMA signature, or both have none.
+ *
+ * @return true if the signatures are the same.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool HasSameImaSignature
+(
+    const char* path1Ptr,   ///< [IN] Path to the first file.
+    const char* path2Ptr    ///< [IN] Path to the second file.
+)
+{
+    char sig1[MAX_IMA_SIGNATURE_BYTES];
+    char sig2[MAX_IMA_SIGNATURE_BYTES];
+
+    ssize_t size1 = lgetxattr(path1Ptr, IMA_XATTR_NAME, sig1, sizeof(sig1));
+    bool isUnsigned1 = (size1 < 0) && ((errno == ENODATA) || (errno == ENOTSUP));
+    ssize_t size2 = lgetxattr(path2Ptr, IMA_XATTR_NAME, sig2, sizeof(sig2));
+    bool isUnsigned2 = (size2 < 0) && ((errno == ENODATA) || (errno == ENOTSUP));
+
+    if ((size1 < 0) || (size2 < 0))
+    {
+        // Unsigned, or no extended attribute support.
+        return (isUnsigned1 && isUnsigned2);
+    }
+
+    return ((size1 == size2) && (memcmp(sig1, sig2, size1) == 0));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Replace a file by a hard link to another file.  The file is replaced atomically, so that if
+ * power is lost the file is either the original or the link.
+ *
+ * @return LE_OK if successful.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t ReplaceWithLink
+(
+    const char* targetPathPtr,  ///< [IN] Path to the file to link to.
+    const char* pathPtr         ///< [IN] Path to the file to replace.
+)
+{
+    char tempPath[PATH_MAX];
+
+    if (snprintf(tempPath, sizeof(tempPath), "%s.link~", pathPtr) >= sizeof(tempPath))
+    {
+        LE_CRIT("Path '%s' is too long.", pathPtr);
+        return LE_FAULT;
+    }
+
+    // Remove any link left over by an interrupted install.
+    (void)unlink(tempPath);
+
+    if (link(targetPathPtr, tempPath) != 0)
+    {
+        // Cross-device or unsupported links are not errors; the file is just kept.
+        LE_DEBUG("Failed to link '%s' to '%s' (%m).", tempPath, targetPathPtr);
+        return LE_UNSUPPORTED;
+    }
+
+    if (rename(tempPath, pathPtr) != 0)
+    {
+        LE_CRIT("Failed to rename '%s' to '%s' (%m).", tempPath, pathPtr);
+        (void)unlink(tempPath);
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deduplicate the files of a newly unpacked app against an installed version of the app: files
+ * which are the same in both are replaced by hard links to the installed files, so that they only
+ * take space on flash once.  Files are only linked if their content, owner, permissions and IMA
+ * signature match.
+ *
+ * Can be run again on a partially processed directory, e.g. after power loss.
+ *
+ * @note This is not an incremental install: it runs once the whole app has been extracted, so the
+ *       flash writes and the time of the install are unchanged.  It only saves the space taken by
+ *       duplicate copies while both versions of the app are kept, e.g. for a system rollback.
+ *
+ * @return LE_OK if successful.
+ **/
+//--------------------------------------------------------------------------------------------------
+le_result_t installer_DedupeUnchangedAppFiles
+(
+    const char* unpackDirPtr,   ///< [IN] Directory the new version of the app was unpacked into.
+    const char* oldAppMd5Ptr    ///< [IN] Hash ID of the installed version of the app.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_result_t result = LE_OK;
+    size_t linkedCount = 0;
+    off_t linkedBytes = 0;
+    char oldAppDir[PATH_MAX];
+
+    LE_ASSERT(snprintf(oldAppDir, sizeof(oldAppDir), "/legato/apps/%s", oldAppMd5Ptr)
+              < sizeof(oldAppDir));
+
+    if (!le_dir_IsDir(oldAppDir))
+    {
+        return LE_OK;
+    }
+
+    size_t baseDirPathLen = strlen(unpackDirPtr);
+    char* pathArrayPtr[] = { (char*)unpackDirPtr, NULL };
+    FTS* ftsPtr = fts_open(pathArrayPtr, FTS_PHYSICAL, NULL);
+
+    if (ftsPtr == NULL)
+    {
+        LE_CRIT("Failed to open '%s' for traversal (%m).", unpackDirPtr);
+        return LE_FAULT;
+    }
+
+    FTSENT* entPtr;
+    while ((entPtr = fts_read(ftsPtr)) != NULL)
+    {
+        if (entPtr->fts_info != FTS_F)
+        {
+            continue;
+        }
+
+        // Compute the path the file would appear at in the installed version.
+        char oldVersionPath[PATH_MAX];
+        if (snprintf(oldVersionPath,
+                     sizeof(oldVersionPath),
+                     "%s%s",
+                     oldAppDir,
+                     entPtr->fts_path + baseDirPathLen) >= sizeof(oldVersionPath))
+        {
+            LE_CRIT("Path to file '%s' in app <%s> is too long.", entPtr->fts_path, oldAppMd5Ptr);
+            result = LE_FAULT;
+            break;
+        }
+
+        struct stat oldStatus;
+        if (   (lstat(oldVersionPath, &oldStatus) != 0)
+            || (oldStatus.st_ino == entPtr->fts_statp->st_ino)
+            || (!file_IsSame(entPtr->fts_path, oldVersionPath))
+            || (!HasSameImaSignature(entPtr->fts_path, oldVersionPath)))
+        {
+            continue;
+        }
+
+        le_result_t linkResult = ReplaceWithLink(oldVersionPath, entPtr->fts_path);
+        if (linkResult == LE_OK)
+        {
+            linkedCount++;
+            linkedBytes += oldStatus.st_size;
+        }
+        else if (linkResult == LE_UNSUPPORTED)
+        {
+            break;
+        }
+        else
+        {
+            result = LE_FAULT;
+            break;
+        }
+    }
+
+    fts_close(ftsPtr);
+
+    LE_INFO("Linked %zu unchanged files (%jd bytes) to app <%s>.",
+            linkedCount,
+            (intmax_t)linkedBytes,
+            oldAppMd5Ptr);
+
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Install a given app's writeable files in the "unpack" system from either the app's install
@@ -226,23 +418,20 @@ le_result_t installer_InstallAppWriteableFiles
                     goto cleanup;
                 }
 
-                // If the file exists in the old system, copy that.
-                if (file_Exists(oldVersionPath))
+                // If the file exists in the old system, copy that.  Otherwise, install the
+                // fresh one.
+                const char* srcPath = file_Exists(oldVersionPath) ? oldVersionPath
+                                                                  : entPtr->fts_path;
+
+                // The file may already be there, e.g. if a previous install was interrupted.
+                if (file_IsSame(srcPath, destPath))
                 {
-                    if (file_Copy(oldVersionPath, destPath, appLabel) != LE_OK)
-                    {
-                        result = LE_FAULT;
-                        goto cleanup;
-                    }
+                    LE_DEBUG("'%s' is unchanged.", destPath);
                 }
-                // If the file does not exist in the old system, install the fresh one.
-                else
+                else if (file_Copy(srcPath, destPath, appLabel) != LE_OK)
                 {
-                    if (file_Copy(entPtr->fts_path, destPath, appLabel) != LE_OK)
-                    {
-                        result = LE_FAULT;
-                        goto cleanup;
-                    }
+                    result = LE_FAULT;
+                    goto cleanup;
                 }
 
                 break;
@@ -27,6 +27,29 @@ void installer_GetAppHashFromSymlink
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Deduplicate the files of a newly unpacked app against an installed version of the app: files
+ * which are the same in both are replaced by hard links to the installed files, so that they only
+ * take space on flash once.  Files are only linked if their content, owner, permissions and IMA
+ * signature match.
+ *
+ * Can be run again on a partially processed directory, e.g. after power loss.
+ *
+ * @note This is not an incremental install: it runs once the whole app has been extracted, so the
+ *       flash writes and the time of the install are unchanged.  It only saves the space taken by
+ *       duplicate copies while both versions of the app are kept, e.g. for a system rollback.
+ *
+ * @return LE_OK if successful.
+ **/
+//--------------------------------------------------------------------------------------------------
+le_result_t installer_DedupeUnchangedAppFiles
+(
+    const char* unpackDirPtr,   ///< [IN] Directory the new version of the app was unpacked into.
+    const char* oldAppMd5Ptr    ///< [IN] Hash ID of the installed version of the app.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Install a given app's writeable files in the "unpack" system from either the app's install
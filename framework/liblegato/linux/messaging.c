@@ -54,6 +54,12 @@
  * placed on a queue for that socket (in the Session object) and the messaging system waits for
  * notification from the Event Loop that the socket has become clear-to-send before trying again.
  *
+ * On the server side, indications (messages that are not responses) go on a second queue, which
+ * is only sent from once the first one is empty, so that responses are not held up by a backlog
+ * of indications.  The number of indications queued per session is limited by the service; when
+ * the limit is reached, indications are dropped or coalesced, or the session's socket is shut
+ * down so that the session is deleted as if the client had closed it.
+ *
  * Another potential deadlock occurs when two threads are sending messages to each other.
  * If they both send a lot of messages to each other, they can both get blocked waiting for the
  * other side to receive messages that had been sent earlier, and because they are both blocked,
@@ -236,6 +236,9 @@ static msgInterface_UnixService_t* CreateService
     servicePtr->recvHandler = NULL;
     servicePtr->recvContextPtr = NULL;
 
+    servicePtr->txQueueLimit = LE_CONFIG_MSG_TX_QUEUE_LIMIT;
+    servicePtr->txOverflowPolicy = LE_MSG_TX_OVERFLOW_DROP_OLDEST;
+
     // Initialize the close handlers dls
     servicePtr->closeListPtr = LE_DLS_LIST_INIT;
 
@@ -1300,6 +1303,48 @@ void le_msg_SetServiceRecvHandler
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of indications (non-response messages) queued for each session of a
+ * service, and what to do when a session reaches it.
+ *
+ * @note    This is a server-only function.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetServiceTxQueueLimit
+(
+    le_msg_ServiceRef_t         serviceRef, ///< [in] Reference to the service.
+    size_t                      maxCount,   ///< [in] Maximum number of queued indications, or 0
+                                            ///       for no limit.
+    le_msg_TxOverflowPolicy_t   policy      ///< [in] What to do when the limit is reached.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    switch (serviceRef->type)
+    {
+        case LE_MSG_SERVICE_LOCAL:
+            // Messages are never queued for sending on a local service.
+            break;
+        case LE_MSG_SERVICE_UNIX_SOCKET:
+        {
+            msgInterface_UnixService_t* servicePtr =
+                CONTAINER_OF(serviceRef, msgInterface_UnixService_t, service);
+            LE_FATAL_IF(servicePtr->serverThread != le_thread_GetCurrent(),
+                        "Service (%s:%s) not owned by calling thread.",
+                        servicePtr->interface.id.name,
+                        le_msg_GetProtocolIdStr(servicePtr->interface.id.protocolRef));
+
+            servicePtr->txQueueLimit = maxCount;
+            servicePtr->txOverflowPolicy = policy;
+            break;
+        }
+        default:
+            LE_FATAL("Corrupted service type: %d", serviceRef->type);
+            break;
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Associates an opaque context value (void pointer) with a given service that can be retrieved
@@ -88,6 +88,9 @@ typedef struct msgInterface_UnixService
 
     le_msg_ReceiveHandler_t         recvHandler;    ///< Handler for when messages are received.
     void*                           recvContextPtr; ///< contextPtr parameter for recvHandler.
+    size_t                          txQueueLimit;   ///< Maximum number of indications queued
+                                                    ///  per session (0 = no limit).
+    le_msg_TxOverflowPolicy_t       txOverflowPolicy;///< What to do when txQueueLimit is reached.
 
     le_dls_List_t                   openListPtr; ///< open List: list of open session handlers
                                                  ///  called when a session is opened
@@ -16,6 +16,19 @@
 #include "fileDescriptor.h"
 #include "unixSocket.h"
 
+// =======================================
+//  PRIVATE DATA
+// =======================================
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Key of the thread-local coalescing key given to the messages created by a thread.  See
+ * le_msg_SetThreadCoalesceKey().
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_key_t ThreadCoalesceKeyKey;
+
+
 // =======================================
 //  PRIVATE FUNCTIONS
 // =======================================
@@ -106,6 +119,30 @@ static void MessageDestructor
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Moves the fd to be sent with a response message to the normal fd position in the message object.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrepareResponseFd
+(
+    UnixMessage_t* msgPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    // If there was an fd that was received from the client but not fetched from the message
+    // generate a warning and close that fd.
+    if (msgPtr->fd >= 0)
+    {
+        LE_WARN("File descriptor not retrieved from message received from client.");
+        fd_Close(msgPtr->fd);
+    }
+
+    msgPtr->fd = msgPtr->clientServer.server.responseFd;
+    msgPtr->clientServer.server.responseFd = -1;
+}
+
+
 // =======================================
 //  PROTECTED (INTER-MODULE) FUNCTIONS
 // =======================================
@@ -122,7 +159,11 @@ void msgMessage_Init
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // Don't actually need to do anything here.
+    int result = pthread_key_create(&ThreadCoalesceKeyKey, NULL);
+    if (result != 0)
+    {
+        LE_FATAL("Failed to create thread local key: result = %d (%s).", result, strerror(result));
+    }
 }
 
 
@@ -183,20 +224,10 @@ le_result_t msgMessage_Send
 {
     UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
 
-    // If this is a response message,
+    // If this is a response message, it carries the fd set by the server.
     if (le_msg_NeedsResponse(msgRef))
     {
-        // If there was an fd that was received from the client but not fetched from the message
-        // generate a warning and close that fd.
-        if (msgPtr->fd >= 0)
-        {
-            LE_WARN("File descriptor not retrieved from message received from client.");
-            fd_Close(msgPtr->fd);
-        }
-
-        // Move the responseFd to the normal fd position in the message object.
-        msgPtr->fd = msgPtr->clientServer.server.responseFd;
-        msgPtr->clientServer.server.responseFd = -1;
+        PrepareResponseFd(msgPtr);
     }
 
     // The first bytes come from our transaction ID and the rest (if any)
@@ -247,6 +278,35 @@ le_result_t msgMessage_Receive
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands a Message object over to the other end of a session whose client and server are in the
+ * same process, instead of sending it through the socket.  The payload is not copied: the message
+ * becomes a message of the given session.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgMessage_MoveToSession
+(
+    le_msg_MessageRef_t msgRef,     ///< [IN] The Message to be handed over.
+    le_msg_SessionRef_t sessionRef  ///< [IN] Session at the other end.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    UnixMessage_t* msgPtr = msgMessage_GetUnixMessagePtr(msgRef);
+
+    // The fd goes along with the message, as it would through the socket.  The transaction ID and
+    // the client's completion callback are kept, so that the client can match the response.
+    if (le_msg_NeedsResponse(msgRef))
+    {
+        PrepareResponseFd(msgPtr);
+    }
+
+    le_mem_AddRef(sessionRef);
+    le_mem_Release(msgRef->sessionRef);
+    msgRef->sessionRef = sessionRef;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Sets a Message object's transaction ID.
@@ -284,6 +344,23 @@ void* msgMessage_GetTxnId
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a Message object's coalescing key.
+ *
+ * @return The key.  (Zero = the message can't be coalesced.)
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t msgMessage_GetCoalesceKey
+(
+    le_msg_MessageRef_t msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return msgMessage_GetUnixMessagePtr(msgRef)->coalesceKey;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Call the completion callback function for a given message, if it has one.
@@ -348,23 +425,14 @@ le_msg_MessageRef_t le_msg_CreateMsg
     msgPtr->message.sessionRef = sessionRef;
     le_mem_AddRef(sessionRef);  // Message object holds a reference to the Session object.
 
-    msgInterface_Type_t interfaceType = msgSession_GetInterfaceType(sessionRef);
-    switch (interfaceType)
-    {
-        case LE_MSG_INTERFACE_CLIENT:
-            msgPtr->clientServer.client.completionCallback = NULL;
-            msgPtr->clientServer.client.contextPtr = NULL;
-            break;
-
-        case LE_MSG_INTERFACE_SERVER:
-            msgPtr->clientServer.server.responseFd = -1;
-            break;
-
-        default:
-            LE_FATAL("Unhandled interface type (%d).", interfaceType);
-    }
+    // Both sides' fields are initialized, as the message may be handed over to the other end of
+    // the session.
+    msgPtr->clientServer.client.completionCallback = NULL;
+    msgPtr->clientServer.client.contextPtr = NULL;
+    msgPtr->clientServer.server.responseFd = -1;
 
     msgPtr->fd = -1;
+    msgPtr->coalesceKey = (uintptr_t)pthread_getspecific(ThreadCoalesceKeyKey);
     msgPtr->txnId = 0;
     memset(msgPtr->payload, 0, le_msg_GetProtocolMaxMsgSize(protocolRef));
 
@@ -631,6 +699,48 @@ void le_msg_Send
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the coalescing key of a message sent by a server.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetCoalesceKey
+(
+    le_msg_MessageRef_t msgRef,     ///< [in] Reference to the message.
+    uint64_t            key         ///< [in] Coalescing key.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(msgRef);
+    switch (msgRef->sessionRef->type)
+    {
+        case LE_MSG_SESSION_LOCAL:
+            // Messages are never queued for sending on a local session.
+            break;
+        case LE_MSG_SESSION_UNIX_SOCKET:
+            msgMessage_GetUnixMessagePtr(msgRef)->coalesceKey = key;
+            break;
+        default:
+            LE_FATAL("Corrupted session type: %d", msgRef->sessionRef->type);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the coalescing key of the messages created by the calling thread from now on.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_SetThreadCoalesceKey
+(
+    uintptr_t key                   ///< [in] Coalescing key, or 0 for none.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(pthread_setspecific(ThreadCoalesceKeyKey, (void*)key) == 0);
+}
+
+
 
 //--------------------------------------------------------------------------------------------------
 /**
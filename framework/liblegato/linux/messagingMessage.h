@@ -20,7 +20,9 @@ typedef struct le_msg_UnixMessage
     le_dls_Link_t               link;       ///< Used to link onto message queues.
     struct le_msg_Message       message;    ///< Base message
 
-    union
+    /// Not a union: a message can be handed over as is between the client and server sides of a
+    /// session whose two ends are in the same process (see msgMessage_MoveToSession()).
+    struct
     {
         /// Fields needed on the client side only
         struct
@@ -41,6 +43,8 @@ typedef struct le_msg_UnixMessage
     clientServer;
 
     int                         fd;         ///< File descriptor to send or received (-1 = no fd)
+    uint64_t                    coalesceKey;///< Key of an indication that can be replaced by a
+                                            ///  newer one while queued (0 = none).
     void*                       txnId;      ///< Safe reference value used as a transaction ID.
     void*                       payload[0]; ///< Variable-length payload buffer appears at the end.
 }
@@ -108,6 +112,20 @@ le_result_t msgMessage_Receive
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands a Message object over to the other end of a session whose client and server are in the
+ * same process, instead of sending it through the socket.  The payload is not copied: the message
+ * becomes a message of the given session.
+ */
+//--------------------------------------------------------------------------------------------------
+void msgMessage_MoveToSession
+(
+    le_msg_MessageRef_t msgRef,     ///< [IN] The Message to be handed over.
+    le_msg_SessionRef_t sessionRef  ///< [IN] Session at the other end.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Gets a pointer to the queue link inside a Message object.
@@ -180,6 +198,19 @@ void* msgMessage_GetTxnId
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets a Message object's coalescing key.
+ *
+ * @return The key.  (Zero = the message can't be coalesced.)
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t msgMessage_GetCoalesceKey
+(
+    le_msg_MessageRef_t msgRef
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Call the completion callback function for a given message.
@@ -31,6 +31,13 @@
 #define MAX_EXPECTED_TXNS 32
 
 
+//--------------------------------------------------------------------------------------------------
+/// The peak number of sessions that we expect to be opening at the same time between a client and
+/// a server in the same process.
+//--------------------------------------------------------------------------------------------------
+#define MAX_EXPECTED_LOCAL_SESSIONS 8
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Mutex used to protect data structures in this module from multi-threaded race conditions.
@@ -74,6 +81,32 @@ static le_mem_PoolRef_t SessionPoolRef;
 static le_ref_MapRef_t TxnMapRef;
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Local Session Map.  This is a Safe Reference Map of the server-side sessions whose client is in
+ * the same process and has not linked to them yet.  The reference is sent to the client in the
+ * session open response.
+ *
+ * @note    Because this is shared by multiple threads, it must be protected using the Mutex.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t LocalSessionMapRef;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Session open response sent by the server.  Only a client in the same process gets the reference
+ * to the server-side session, other clients only receive the result code.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_result_t result;     ///< Always LE_OK.
+    void*       localRef;   ///< Reference to the server-side session in the Local Session Map.
+}
+OpenResponse_t;
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * A counter that increments every time a change is made to a session list in ANY interface obj.
@@ -95,12 +128,173 @@ static void AttemptOpen(msgSession_UnixSession_t* sessionPtr);
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Pushes a message onto the tail of the Transmit Queue.
+ * Checks whether a message to be sent is an indication: a message sent by a server that is not a
+ * response.  Indications are only sent once no response is waiting to be sent, and their number
+ * is limited by the transmit queue limit of the service.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool IsIndication
+(
+    msgSession_UnixSession_t* sessionPtr,
+    le_msg_MessageRef_t     msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    return (sessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_SERVER) &&
+           (msgMessage_GetTxnId(msgRef) == NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether a queued indication is superseded: a newer indication with the same coalescing
+ * key is queued after it, or is the new one.
+ *
+ * @note    Must be called with the Mutex locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsSuperseded
+(
+    msgSession_UnixSession_t* sessionPtr,
+    le_dls_Link_t*          linkPtr,        ///< Link of the queued indication.
+    uint64_t                newKey          ///< Coalescing key of the new indication.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint64_t key = msgMessage_GetCoalesceKey(msgMessage_GetMessageContainingLink(linkPtr));
+
+    if (key == 0)
+    {
+        return false;
+    }
+    if (key == newKey)
+    {
+        return true;
+    }
+
+    linkPtr = le_dls_PeekNext(&sessionPtr->indicationQueue, linkPtr);
+    while (linkPtr != NULL)
+    {
+        if (msgMessage_GetCoalesceKey(msgMessage_GetMessageContainingLink(linkPtr)) == key)
+        {
+            return true;
+        }
+        linkPtr = le_dls_PeekNext(&sessionPtr->indicationQueue, linkPtr);
+    }
+
+    return false;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the indication to remove from a full Indication Queue to make room for a new one: the
+ * oldest superseded one if the service coalesces its indications, or else the oldest one.
+ *
+ * @return  The link of the indication in the queue.
+ *
+ * @note    Must be called with the Mutex locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_dls_Link_t* FindIndicationToDrop
+(
+    msgSession_UnixSession_t* sessionPtr,
+    msgInterface_UnixService_t* servicePtr,
+    uint64_t                newKey          ///< Coalescing key of the new indication.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_dls_Link_t* linkPtr;
+
+    // The queue is at most as long as the limit, so scanning it is cheap enough.
+    if (servicePtr->txOverflowPolicy == LE_MSG_TX_OVERFLOW_COALESCE)
+    {
+        linkPtr = le_dls_Peek(&sessionPtr->indicationQueue);
+        while (linkPtr != NULL)
+        {
+            if (IsSuperseded(sessionPtr, linkPtr, newKey))
+            {
+                sessionPtr->txCoalesceCount++;
+                return linkPtr;
+            }
+            linkPtr = le_dls_PeekNext(&sessionPtr->indicationQueue, linkPtr);
+        }
+    }
+
+    sessionPtr->txDropCount++;
+
+    return le_dls_Peek(&sessionPtr->indicationQueue);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pushes an indication onto the tail of the Indication Queue, applying the transmit queue limit
+ * of the service.
+ *
+ * @return  The indication removed from the queue to make room for the new one, which must be
+ *          released, or NULL if none was.  Sets *overflowPtr if the new indication could not be
+ *          queued at all.
+ *
+ * @note    Must be called with the Mutex locked.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_MessageRef_t QueueIndication
+(
+    msgSession_UnixSession_t* sessionPtr,
+    le_msg_MessageRef_t     msgRef,
+    bool*                   overflowPtr     ///< [OUT] Set to true if the queue was full.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgInterface_UnixService_t* servicePtr = CONTAINER_OF(sessionPtr->interfaceRef,
+                                                          msgInterface_UnixService_t,
+                                                          interface);
+    le_dls_Link_t* oldLinkPtr = NULL;
+
+    *overflowPtr = false;
+
+    if ((servicePtr->txQueueLimit != 0) &&
+        (sessionPtr->indicationCount >= servicePtr->txQueueLimit))
+    {
+        if (servicePtr->txOverflowPolicy == LE_MSG_TX_OVERFLOW_DISCONNECT)
+        {
+            sessionPtr->txDropCount++;
+            *overflowPtr = true;
+            return NULL;
+        }
+
+        // The new indication always goes to the tail, so that the client never gets an older state
+        // after a newer one.
+        oldLinkPtr = FindIndicationToDrop(sessionPtr, servicePtr,
+                                          msgMessage_GetCoalesceKey(msgRef));
+        le_dls_Remove(&sessionPtr->indicationQueue, oldLinkPtr);
+        sessionPtr->indicationCount--;
+        sessionPtr->txQueueCount--;
+    }
+
+    le_dls_Queue(&sessionPtr->indicationQueue, msgMessage_GetQueueLinkPtr(msgRef));
+    sessionPtr->indicationCount++;
+    sessionPtr->txQueueCount++;
+
+    return (oldLinkPtr != NULL) ? msgMessage_GetMessageContainingLink(oldLinkPtr) : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pushes a message onto the tail of the Transmit Queue, or of the Indication Queue if it is an
+ * indication.
+ *
+ * @return
+ *  - LE_OK if the message was queued.
+ *  - LE_OVERFLOW if the Indication Queue is full and the service disconnects the sessions that
+ *    overflow.  The message has not been queued.
  *
  * @note    This is used on both the client side and the server side.
  */
 //--------------------------------------------------------------------------------------------------
-static void PushTransmitQueue
+static le_result_t PushTransmitQueue
 (
     msgSession_UnixSession_t* sessionPtr,
     le_msg_MessageRef_t     msgRef
@@ -108,16 +302,51 @@ static void PushTransmitQueue
 //--------------------------------------------------------------------------------------------------
 {
     le_dls_Link_t* linkPtr = msgMessage_GetQueueLinkPtr(msgRef);
+    le_msg_MessageRef_t droppedMsgRef = NULL;
+    bool isOverflow = false;
+    bool isFirstDrop;
 
     LOCK
-    le_dls_Queue(&sessionPtr->transmitQueue, linkPtr);
+    isFirstDrop = (sessionPtr->txDropCount == 0);
+    if (IsIndication(sessionPtr, msgRef))
+    {
+        droppedMsgRef = QueueIndication(sessionPtr, msgRef, &isOverflow);
+    }
+    else
+    {
+        le_dls_Queue(&sessionPtr->transmitQueue, linkPtr);
+        sessionPtr->txQueueCount++;
+    }
+    if (sessionPtr->txQueueCount > sessionPtr->txQueuePeak)
+    {
+        sessionPtr->txQueuePeak = sessionPtr->txQueueCount;
+    }
+    isFirstDrop = isFirstDrop && (sessionPtr->txDropCount != 0);
     UNLOCK
+
+    // Warn once per session, rather than for every message dropped while the client is stuck.
+    // Coalescing a superseded indication is not worth a warning.
+    if (isFirstDrop)
+    {
+        LE_WARN("Transmit queue full for client of service (%s:%s); %s.",
+                le_msg_GetInterfaceName(sessionPtr->interfaceRef),
+                le_msg_GetProtocolIdStr(le_msg_GetInterfaceProtocol(sessionPtr->interfaceRef)),
+                isOverflow ? "disconnecting it" : "dropping indications");
+    }
+
+    if (droppedMsgRef != NULL)
+    {
+        le_msg_ReleaseMsg(droppedMsgRef);
+    }
+
+    return (isOverflow ? LE_OVERFLOW : LE_OK);
 }
 
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Pops a message off of the Transmit Queue.
+ * Pops a message off of the Transmit Queue, or off of the Indication Queue if the Transmit Queue
+ * is empty.
  *
  * @return A reference to the Message object that was popped from the queue, or NULL if the queue
  *         is empty.
@@ -135,6 +364,18 @@ static le_msg_MessageRef_t PopTransmitQueue
 
     LOCK
     linkPtr = le_dls_Pop(&sessionPtr->transmitQueue);
+    if (linkPtr == NULL)
+    {
+        linkPtr = le_dls_Pop(&sessionPtr->indicationQueue);
+        if (linkPtr != NULL)
+        {
+            sessionPtr->indicationCount--;
+        }
+    }
+    if (linkPtr != NULL)
+    {
+        sessionPtr->txQueueCount--;
+    }
     UNLOCK
 
     if (linkPtr != NULL)
@@ -148,7 +389,7 @@ static le_msg_MessageRef_t PopTransmitQueue
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Puts a message back onto the head of the Transmit Queue.
+ * Puts a message back onto the head of the queue it was popped from.
  *
  * @note    This is used on both the client side and the server side.
  */
@@ -163,7 +404,16 @@ static void UnPopTransmitQueue
     le_dls_Link_t* linkPtr = msgMessage_GetQueueLinkPtr(msgRef);
 
     LOCK
-    le_dls_Stack(&sessionPtr->transmitQueue, linkPtr);
+    if (IsIndication(sessionPtr, msgRef))
+    {
+        le_dls_Stack(&sessionPtr->indicationQueue, linkPtr);
+        sessionPtr->indicationCount++;
+    }
+    else
+    {
+        le_dls_Stack(&sessionPtr->transmitQueue, linkPtr);
+    }
+    sessionPtr->txQueueCount++;
     UNLOCK
 }
 
@@ -171,16 +421,28 @@ static void UnPopTransmitQueue
 //--------------------------------------------------------------------------------------------------
 /**
  * Pushes a message onto the tail of the Receive Queue.
+ *
+ * @return true if the queue was empty.
+ *
+ * @note    When the session at the other end is in the same process, its thread pushes the
+ *          messages it hands over onto this session's Receive Queue.
  */
 //--------------------------------------------------------------------------------------------------
-static inline void PushReceiveQueue
+static bool PushReceiveQueue
 (
     msgSession_UnixSession_t*   sessionPtr,
     le_msg_MessageRef_t     msgRef
 )
 //--------------------------------------------------------------------------------------------------
 {
+    bool wasEmpty;
+
+    LOCK
+    wasEmpty = le_dls_IsEmpty(&sessionPtr->receiveQueue);
     le_dls_Queue(&sessionPtr->receiveQueue, msgMessage_GetQueueLinkPtr(msgRef));
+    UNLOCK
+
+    return wasEmpty;
 }
 
 
@@ -200,7 +462,9 @@ static le_msg_MessageRef_t PopReceiveQueue
 {
     le_dls_Link_t* linkPtr;
 
+    LOCK
     linkPtr = le_dls_Pop(&sessionPtr->receiveQueue);
+    UNLOCK
 
     if (linkPtr != NULL)
     {
@@ -417,6 +681,121 @@ static void PurgeReceiveQueue
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks whether the process at the other end of a connected socket is this process.
+ *
+ * @return  true if the client and the server are in the same process.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsPeerInProcess
+(
+    int socketFd    ///< [IN] Connected socket.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    struct ucred credentials;
+    socklen_t credSize = sizeof(credentials);
+
+    return ((getsockopt(socketFd, SOL_SOCKET, SO_PEERCRED, &credentials, &credSize) == 0) &&
+            (credentials.pid == getpid()));
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Links a client-side session to the server-side session at the other end, which is in the same
+ * process.  From then on, messages are handed over between the two sessions instead of going
+ * through the socket.  The socket is kept open, so that each end still sees the other one close
+ * the session.
+ *
+ * @note    This is used only on the client side, when the session open response is received.
+ *          As the server can't know about the client's handlers before receiving requests from
+ *          it, nothing it sends can be overtaken by the messages that it hands over.
+ */
+//--------------------------------------------------------------------------------------------------
+static void LinkLocalPeer
+(
+    msgSession_UnixSession_t* sessionPtr,
+    void* localRef                          ///< [IN] Reference received from the server.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LOCK
+
+    msgSession_UnixSession_t* peerPtr = le_ref_Lookup(LocalSessionMapRef, localRef);
+
+    // If the server has closed the session in the meantime, the socket will tell us.
+    if (peerPtr != NULL)
+    {
+        le_ref_DeleteRef(LocalSessionMapRef, localRef);
+        peerPtr->localRef = NULL;
+
+        // Each session holds a reference to the other one while they are linked.
+        peerPtr->localPeerPtr = sessionPtr;
+        sessionPtr->localPeerPtr = peerPtr;
+        le_mem_AddRef(peerPtr);
+        le_mem_AddRef(sessionPtr);
+    }
+
+    UNLOCK
+
+    if (peerPtr != NULL)
+    {
+        TRACE("Service (%s:%s) is in the same process, bypassing the socket.",
+              le_msg_GetInterfaceName(sessionPtr->interfaceRef),
+              le_msg_GetProtocolIdStr(le_msg_GetInterfaceProtocol(sessionPtr->interfaceRef)));
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Breaks the link between a session and the session at the other end, if it is in the same
+ * process.  A client waiting for the response to a synchronous request is woken up.
+ *
+ * @note    This is used on both the client side and the server side.
+ */
+//--------------------------------------------------------------------------------------------------
+static void UnlinkLocalPeer
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* peerPtr;
+
+    LOCK
+
+    if (sessionPtr->localRef != NULL)
+    {
+        le_ref_DeleteRef(LocalSessionMapRef, sessionPtr->localRef);
+        sessionPtr->localRef = NULL;
+    }
+
+    peerPtr = sessionPtr->localPeerPtr;
+    if (peerPtr != NULL)
+    {
+        sessionPtr->localPeerPtr = NULL;
+        peerPtr->localPeerPtr = NULL;
+
+        if (peerPtr->syncMsgRef != NULL)
+        {
+            peerPtr->syncMsgRef = NULL;
+            le_sem_Post(peerPtr->syncSemRef);
+        }
+    }
+
+    UNLOCK
+
+    if (peerPtr != NULL)
+    {
+        le_mem_Release(peerPtr);
+        le_mem_Release(sessionPtr);
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Creates a Session object.
@@ -443,7 +822,13 @@ static msgSession_UnixSession_t* CreateSession
 
     sessionPtr->txnList = LE_DLS_LIST_INIT;
     sessionPtr->transmitQueue = LE_DLS_LIST_INIT;
+    sessionPtr->indicationQueue = LE_DLS_LIST_INIT;
     sessionPtr->receiveQueue = LE_DLS_LIST_INIT;
+    sessionPtr->txQueueCount = 0;
+    sessionPtr->txQueuePeak = 0;
+    sessionPtr->indicationCount = 0;
+    sessionPtr->txDropCount = 0;
+    sessionPtr->txCoalesceCount = 0;
 
     sessionPtr->contextPtr = NULL;
     sessionPtr->rxHandler = NULL;
@@ -453,6 +838,12 @@ static msgSession_UnixSession_t* CreateSession
     sessionPtr->closeHandler = NULL;
     sessionPtr->closeContextPtr = NULL;
 
+    sessionPtr->localPeerPtr = NULL;
+    sessionPtr->localRef = NULL;
+    sessionPtr->syncSemRef = NULL;
+    sessionPtr->syncMsgRef = NULL;
+    sessionPtr->syncRspRef = NULL;
+
     sessionPtr->interfaceRef = interfaceRef;
 
     SessionObjListChangeCount++;
@@ -488,6 +879,9 @@ static void CloseSession
                                       msgSession_GetSessionRef(sessionPtr));
     }
 
+    // Stop handing messages over to a peer in the same process, before it sees the socket close.
+    UnlinkLocalPeer(sessionPtr);
+
     // Delete the socket and the FD Monitor.
     if (sessionPtr->fdMonitorRef != NULL)
     {
@@ -532,6 +926,12 @@ static void DeleteSession
     msgInterface_RemoveSession(sessionPtr->interfaceRef,
                                msgSession_GetSessionRef(sessionPtr));
 
+    if (sessionPtr->syncSemRef != NULL)
+    {
+        le_sem_Delete(sessionPtr->syncSemRef);
+        sessionPtr->syncSemRef = NULL;
+    }
+
     // Release the Session object itself.
     le_mem_Release(sessionPtr);
 }
@@ -666,18 +1066,26 @@ static le_result_t ReceiveSessionOpenResponse
 )
 //--------------------------------------------------------------------------------------------------
 {
-    // We expect to receive a very small message (one le_result_t).
-    le_result_t serverResponse;
-    size_t  bytesReceived = sizeof(serverResponse);
+    // We expect to receive a very small message (one le_result_t, followed by a reference to the
+    // server-side session if the server is in the same process).
+    OpenResponse_t openResponse;
+    size_t  bytesReceived = sizeof(openResponse);
 
     // Receive the message.
     le_result_t result;
-    result = unixSocket_ReceiveDataMsg(sessionPtr->socketFd, &serverResponse, &bytesReceived);
+    result = unixSocket_ReceiveDataMsg(sessionPtr->socketFd, &openResponse, &bytesReceived);
 
     if (result == LE_OK)
     {
+        le_result_t serverResponse = openResponse.result;
+
         if (serverResponse == LE_OK)
         {
+            if (bytesReceived == sizeof(openResponse))
+            {
+                LinkLocalPeer(sessionPtr, openResponse.localRef);
+            }
+
             le_msg_InterfaceRef_t interfaceRef =
                 le_msg_GetSessionInterface(msgSession_GetSessionRef(sessionPtr));
             TRACE("Session opened on interface (%s:%s)",
@@ -710,7 +1118,8 @@ static le_result_t ReceiveSessionOpenResponse
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Sends an LE_OK session open response to the client.
+ * Sends an LE_OK session open response to the client.  A client in the same process also gets
+ * a reference to the session, so that it can hand its messages over directly.
  *
  * @return  LE_OK if successful, LE_COMM_ERROR if failed.
  *
@@ -719,16 +1128,30 @@ static le_result_t ReceiveSessionOpenResponse
 //--------------------------------------------------------------------------------------------------
 static le_result_t SendSessionOpenResponse
 (
-    int socketFd    ///< [IN] Connected socket to send through.
+    msgSession_UnixSession_t* sessionPtr
 )
 //--------------------------------------------------------------------------------------------------
 {
-    const le_result_t response = LE_OK;
+    OpenResponse_t response;
+    size_t responseSize = sizeof(response.result);
     ssize_t bytesSent;
 
+    memset(&response, 0, sizeof(response));
+    response.result = LE_OK;
+
+    if (IsPeerInProcess(sessionPtr->socketFd))
+    {
+        LOCK
+        sessionPtr->localRef = le_ref_CreateRef(LocalSessionMapRef, sessionPtr);
+        UNLOCK
+
+        response.localRef = sessionPtr->localRef;
+        responseSize = sizeof(response);
+    }
+
     do
     {
-        bytesSent = send(socketFd, &response, sizeof(response), MSG_EOR);
+        bytesSent = send(sessionPtr->socketFd, &response, responseSize, MSG_EOR);
     }
     while ((bytesSent == -1) && (errno == EINTR));
 
@@ -740,7 +1163,7 @@ static le_result_t SendSessionOpenResponse
     }
     else
     {
-        LE_ASSERT(bytesSent == sizeof(response));
+        LE_ASSERT(bytesSent == (ssize_t)responseSize);
         return LE_OK;
     }
 }
@@ -769,6 +1192,14 @@ static void ProcessMessageFromServer
         // The transaction is complete!  Remove it from the Transaction Map.
         DeleteTxnId(requestMsgRef);
 
+        // A response handed over by a server in the same process is the request message itself,
+        // which is not on the Transaction List.  Its reference goes to the completion callback.
+        if (requestMsgRef == msgRef)
+        {
+            msgMessage_CallCompletionCallback(requestMsgRef, msgRef);
+            return;
+        }
+
         // Remove the request message from the session's Transaction List.
         RemoveFromTxnList(sessionPtr, requestMsgRef);
 
@@ -806,12 +1237,10 @@ static void ProcessReceivedMessages
 )
 //--------------------------------------------------------------------------------------------------
 {
-    le_dls_Link_t* linkPtr;
+    le_msg_MessageRef_t msgRef;
 
-    while (NULL != (linkPtr = le_dls_Pop(&sessionPtr->receiveQueue)))
+    while (NULL != (msgRef = PopReceiveQueue(sessionPtr)))
     {
-        le_msg_MessageRef_t msgRef = msgMessage_GetMessageContainingLink(linkPtr);
-
         if (sessionPtr->interfaceRef->interfaceType == LE_MSG_INTERFACE_CLIENT)
         {
             ProcessMessageFromServer(sessionPtr, msgRef);
@@ -827,6 +1256,34 @@ static void ProcessReceivedMessages
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Process the messages that a peer in the same process handed over before closing the session,
+ * as the messages left in the socket are received before a hang-up is handled.
+ *
+ * @return  true if the session is still open afterwards.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ProcessMessagesBeforeHangUp
+(
+    msgSession_UnixSession_t* sessionPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    bool isOpen;
+
+    // A handler may close or delete the session.
+    le_mem_AddRef(sessionPtr);
+
+    ProcessReceivedMessages(sessionPtr);
+    isOpen = (sessionPtr->state == LE_MSG_SESSION_STATE_OPEN);
+
+    le_mem_Release(sessionPtr);
+
+    return isOpen;
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Client-side handler for when the server closes a session's socket connection.
@@ -853,6 +1310,11 @@ static void ClientSocketHangUp
             break;
 
         case LE_MSG_SESSION_STATE_OPEN:
+            if (!ProcessMessagesBeforeHangUp(sessionPtr))
+            {
+                break;
+            }
+
             // If the session has a close handler registered, then close the session and call
             // the handler.
             if (sessionPtr->closeHandler != NULL)
@@ -974,7 +1436,10 @@ static void ServerSocketHangUp
           le_msg_GetInterfaceName(sessionPtr->interfaceRef),
           le_msg_GetProtocolIdStr(le_msg_GetInterfaceProtocol(sessionPtr->interfaceRef)));
 
-    DeleteSession(sessionPtr);
+    if (ProcessMessagesBeforeHangUp(sessionPtr))
+    {
+        DeleteSession(sessionPtr);
+    }
 }
 
 
@@ -1502,7 +1967,16 @@ static void ProcessDeferredMessages
 {
     msgSession_UnixSession_t* sessionPtr = param1Ptr;
 
-    ProcessReceivedMessages(sessionPtr);
+    // Messages handed over by a peer in the same process may have been queued after the session
+    // closed.
+    if (sessionPtr->state == LE_MSG_SESSION_STATE_OPEN)
+    {
+        ProcessReceivedMessages(sessionPtr);
+    }
+    else
+    {
+        PurgeReceiveQueue(sessionPtr);
+    }
 
     // NOTE: Each of these queued functions holds a reference to the session object so that
     //       the session object doesn't go away.  But it could go away as soon as we release it.
@@ -1512,7 +1986,7 @@ static void ProcessDeferredMessages
 
 //--------------------------------------------------------------------------------------------------
 /**
- * Trigger deferred message queue processing.
+ * Trigger deferred message queue processing, by the thread that handles the session.
  */
 //--------------------------------------------------------------------------------------------------
 static void TriggerDeferredProcessing
@@ -1524,7 +1998,147 @@ static void TriggerDeferredProcessing
     // NOTE: Each of these queued functions holds a reference to the session object so that
     //       the session object doesn't go away before the queued function is run.
     le_mem_AddRef(sessionPtr);
-    le_event_QueueFunction(ProcessDeferredMessages, sessionPtr, NULL);
+    le_event_QueueFunctionToThread(sessionPtr->threadRef, ProcessDeferredMessages, sessionPtr,
+                                   NULL);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hands a message over to the session at the other end, if it is in the same process.  The
+ * message is pushed onto the peer's Receive Queue and processed by the peer's thread, unless it is
+ * the response to a synchronous request that the peer is waiting for.
+ *
+ * @return  true if the message was handed over, false if it must be sent through the socket.
+ *
+ * @note    This is used on both the client side and the server side.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SendLocal
+(
+    msgSession_UnixSession_t* sessionPtr,
+    le_msg_MessageRef_t msgRef
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* peerPtr;
+    bool isSyncResponse = false;
+
+    LOCK
+    peerPtr = sessionPtr->localPeerPtr;
+    if (peerPtr != NULL)
+    {
+        le_mem_AddRef(peerPtr);
+    }
+    UNLOCK
+
+    if (peerPtr == NULL)
+    {
+        return false;
+    }
+
+    msgMessage_MoveToSession(msgRef, msgSession_GetSessionRef(peerPtr));
+
+    LOCK
+    if ((peerPtr->syncMsgRef != NULL) && (peerPtr->syncMsgRef == msgRef))
+    {
+        // The response is the request message itself.
+        peerPtr->syncMsgRef = NULL;
+        peerPtr->syncRspRef = msgRef;
+        le_sem_Post(peerPtr->syncSemRef);
+        isSyncResponse = true;
+    }
+    UNLOCK
+
+    if ((!isSyncResponse) && PushReceiveQueue(peerPtr, msgRef))
+    {
+        TriggerDeferredProcessing(peerPtr);
+    }
+
+    le_mem_Release(peerPtr);
+
+    return true;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Do a synchronous request-response transaction with a server in the same process.
+ *
+ * If the server is handled by the calling thread, its Receive Queue is processed right away, up to
+ * this request, which must be responded to by its handler.  Blocking would be a deadlock.
+ *
+ * @return  true if the server is in the same process, false if the request must be sent through
+ *          the socket.
+ *
+ * @note    This is used only on the client side.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool DoLocalSyncRequestResponse
+(
+    msgSession_UnixSession_t* sessionPtr,
+    le_msg_MessageRef_t msgRef,
+    le_msg_MessageRef_t* rspMsgRefPtr   ///< [OUT] Response, or NULL if the session closed.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    msgSession_UnixSession_t* peerPtr;
+
+    // The request is handed over, so its transaction ID must be saved for later.
+    void* txnId = msgMessage_GetTxnId(msgRef);
+
+    if (sessionPtr->syncSemRef == NULL)
+    {
+        sessionPtr->syncSemRef = le_sem_Create("MsgSyncRsp", 0);
+    }
+
+    LOCK
+    peerPtr = sessionPtr->localPeerPtr;
+    if (peerPtr != NULL)
+    {
+        le_mem_AddRef(peerPtr);
+        sessionPtr->syncMsgRef = msgRef;
+        sessionPtr->syncRspRef = NULL;
+    }
+    UNLOCK
+
+    if (peerPtr == NULL)
+    {
+        return false;
+    }
+
+    // If the server closed the session just now, we have been woken up already.
+    if (!SendLocal(sessionPtr, msgRef))
+    {
+        le_msg_ReleaseMsg(msgRef);
+    }
+    else if (peerPtr->threadRef == sessionPtr->threadRef)
+    {
+        ProcessReceivedMessages(peerPtr);
+    }
+
+    if (peerPtr->threadRef == sessionPtr->threadRef)
+    {
+        LE_FATAL_IF(le_sem_TryWait(sessionPtr->syncSemRef) != LE_OK,
+                    "Synchronous request not responded to by server in the same thread (%s:%s).",
+                    le_msg_GetInterfaceName(sessionPtr->interfaceRef),
+                    le_msg_GetProtocolIdStr(
+                        le_msg_GetInterfaceProtocol(sessionPtr->interfaceRef)));
+    }
+    else
+    {
+        le_sem_Wait(sessionPtr->syncSemRef);
+    }
+
+    le_mem_Release(peerPtr);
+
+    LOCK
+    *rspMsgRefPtr = sessionPtr->syncRspRef;
+    sessionPtr->syncRspRef = NULL;
+    le_ref_DeleteRef(TxnMapRef, txnId);
+    UNLOCK
+
+    return true;
 }
 
 
@@ -1563,6 +2177,8 @@ void msgSession_Init
 
     TxnMapRef = le_ref_CreateMap("MsgTxnIDs", MAX_EXPECTED_TXNS);
 
+    LocalSessionMapRef = le_ref_CreateMap("MsgLocalSessions", MAX_EXPECTED_LOCAL_SESSIONS);
+
     // Get a reference to the trace keyword that is used to control tracing in this module.
     TraceRef = le_log_GetTraceRef("messaging");
 }
@@ -1630,11 +2246,20 @@ void msgSession_SendMessage
 
         le_msg_ReleaseMsg(messageRef);
     }
+    else if (SendLocal(unixSessionPtr, messageRef))
+    {
+        // Handed over to the other end of the session directly.
+    }
+    else if (PushTransmitQueue(unixSessionPtr, messageRef) != LE_OK)
+    {
+        // The client doesn't keep up with the indications.  Shut the socket down rather than
+        // delete the session here, as the caller may still be using it: the session will be
+        // deleted as if the client had closed it.
+        le_msg_ReleaseMsg(messageRef);
+        shutdown(unixSessionPtr->socketFd, SHUT_RDWR);
+    }
     else
     {
-        // Put the message on the Transmit Queue.
-        PushTransmitQueue(unixSessionPtr, messageRef);
-
         // Try to send something from the Transmit Queue.
         SendFromTransmitQueue(unixSessionPtr);
     }
@@ -1668,11 +2293,15 @@ void msgSession_RequestResponse
     // Create an ID for this transaction.
     CreateTxnId(msgRef);
 
-    // Put the message on the Transmit Queue.
-    PushTransmitQueue(unixSessionPtr, msgRef);
+    // A server in the same process gets the request directly.
+    if (!SendLocal(unixSessionPtr, msgRef))
+    {
+        // Put the message on the Transmit Queue.
+        PushTransmitQueue(unixSessionPtr, msgRef);
 
-    // Try to send something from the Transmit Queue.
-    SendFromTransmitQueue(unixSessionPtr);
+        // Try to send something from the Transmit Queue.
+        SendFromTransmitQueue(unixSessionPtr);
+    }
 }
 
 
@@ -1700,6 +2329,12 @@ le_msg_MessageRef_t msgSession_DoSyncRequestResponse
     // Create an ID for this transaction.
     CreateTxnId(msgRef);
 
+    // A server in the same process gets the request directly.
+    if (DoLocalSyncRequestResponse(unixSessionPtr, msgRef, &rxMsgRef))
+    {
+        return rxMsgRef;
+    }
+
     // Put the socket into blocking mode.
     fd_SetBlocking(unixSessionPtr->socketFd);
 
@@ -1733,16 +2368,14 @@ le_msg_MessageRef_t msgSession_DoSyncRequestResponse
 
         // Got some other message that we weren't waiting for.
 
-        // If the Receive Queue is empty, queue up a function call on the Event Queue so that
+        // Queue the received message to the Receive Queue for later processing.
+        // If the Receive Queue was empty, queue up a function call on the Event Queue so that
         // the Event Loop will kick start processing of the Receive Queue later.
-        // (If there's already something on the Receive Queue, then we've already done that.)
-        if (le_dls_IsEmpty(&unixSessionPtr->receiveQueue))
+        // (If there was already something on the Receive Queue, then we've already done that.)
+        if (PushReceiveQueue(unixSessionPtr, rxMsgRef))
         {
             TriggerDeferredProcessing(unixSessionPtr);
         }
-
-        // Queue the received message to the Receive Queue for later processing.
-        PushReceiveQueue(unixSessionPtr, rxMsgRef);
     }
 
     // Invalidate the ID for this transaction.
@@ -1892,10 +2525,20 @@ le_msg_SessionRef_t msgSession_CreateServerSideSession
     msgInterface_UnixService_t* servicePtr = CONTAINER_OF(serviceRef,
                                                           msgInterface_UnixService_t,
                                                           service);
+
+    // Create the Session object (adding it to the Service's list of sessions).  It must exist
+    // before the Hello message is sent, as a client in the same process gets a reference to it.
+    msgSession_UnixSession_t* sessionPtr = CreateSession(&servicePtr->interface);
+
+    // Record the client connection file descriptor.
+    sessionPtr->socketFd = fd;
+
     // Send a Hello message (LE_OK) to the client.
-    if (SendSessionOpenResponse(fd) != LE_OK)
+    if (SendSessionOpenResponse(sessionPtr) != LE_OK)
     {
         // Something went wrong.  Abort.
+        UnlinkLocalPeer(sessionPtr);
+        DeleteSession(sessionPtr);
         fd_Close(fd);
         return NULL;
     }
@@ -1904,12 +2547,6 @@ le_msg_SessionRef_t msgSession_CreateServerSideSession
     // Set the socket non-blocking for future operation.
     fd_SetNonBlocking(fd);
 
-    // Create the Session object (adding it to the Service's list of sessions)
-    msgSession_UnixSession_t* sessionPtr = CreateSession(&servicePtr->interface);
-
-    // Record the client connection file descriptor.
-    sessionPtr->socketFd = fd;
-
     // Start monitoring the server-side session connection socket for events.
     StartSocketMonitoring(sessionPtr, ServerSocketEventHandler);
 
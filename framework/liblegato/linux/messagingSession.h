@@ -52,6 +52,15 @@ typedef struct msg_UnixSession
                                                     ///  sent and are waiting for their response.
 
     le_dls_List_t                   transmitQueue;  ///< Queue of messages waiting to be sent.
+    le_dls_List_t                   indicationQueue;///< Server side: queue of indications
+                                                    ///  (non-response messages) waiting to be
+                                                    ///  sent after the transmit queue.
+    size_t                          txQueueCount;   ///< Messages in both queues.
+    size_t                          txQueuePeak;    ///< Highest value of txQueueCount.
+    size_t                          indicationCount;///< Messages in the indication queue.
+    size_t                          txDropCount;    ///< Indications dropped because the
+                                                    ///  indication queue was full.
+    size_t                          txCoalesceCount;///< Indications replaced by newer ones.
 
     le_dls_List_t                   receiveQueue;   ///< Queue of received messages waiting to be
                                                     /// processed.
@@ -63,6 +72,18 @@ typedef struct msg_UnixSession
     void*                           openContextPtr; ///< Open handler's context pointer.
     le_msg_SessionEventHandler_t    closeHandler;   ///< Close handler function.
     void*                           closeContextPtr;///< Close handler's context pointer.
+
+    struct msg_UnixSession*         localPeerPtr;   ///< Session at the other end, if it is in the
+                                                    ///  same process (messages are then handed
+                                                    ///  over without going through the socket).
+    void*                           localRef;       ///< Server side: reference sent to a client in
+                                                    ///  the same process, until it links to us.
+    le_sem_Ref_t                    syncSemRef;     ///< Client side: posted when a synchronous
+                                                    ///  request to a local peer completes.
+    le_msg_MessageRef_t             syncMsgRef;     ///< Synchronous request waiting for a response
+                                                    ///  from the local peer.
+    le_msg_MessageRef_t             syncRspRef;     ///< Response to the synchronous request, NULL
+                                                    ///  if the session closed first.
 }
 msgSession_UnixSession_t;
 
@@ -0,0 +1,322 @@
+//--------------------------------------------------------------------------------------------------
+/** @file messagingTrace.c
+ *
+ * IPC call tracing, used by the generated client and server stubs when LE_CONFIG_IPC_TRACE is
+ * enabled.
+ *
+ * Each traced API gets a contiguous range of entries in the trace segment (see messagingTrace.h),
+ * one per function, indexed by message ID.  The segment is a memfd, so that the inspect tool can
+ * map it through /proc/PID/fd and read the counters while the process keeps running.  It is
+ * created on first use and left open for the lifetime of the process.
+ *
+ * Counters are updated with relaxed atomic operations: a reader may see the counters of a call
+ * that is being recorded partially updated, but never torn.
+ *
+ * A child process forked without exec'ing gets its own copy of the segment, mapped at the same
+ * address, so that it does not update the counters of its parent.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+
+#if LE_CONFIG_IPC_TRACE
+
+#include "messagingTrace.h"
+#include <sys/mman.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Trace of an API.  Kept in process memory, so that a corrupted segment can't make the process
+ * write outside of it.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_msg_Trace
+{
+    msgTrace_Entry_t* entriesPtr;       ///< First entry of the API in the segment.
+    uint32_t numFuncs;                  ///< Number of entries of the API.
+}
+Trace_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Trace segment, the memfd it is mapped from, and the number of entries allocated in it.  NULL and
+ * -1 until the first API is traced.
+ *
+ * @warning Use Mutex to protect accesses to these.
+ */
+//--------------------------------------------------------------------------------------------------
+static msgTrace_Header_t* SegmentPtr;
+static int SegmentFd = -1;
+static uint32_t NumEntries;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool of Trace_t.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t TracePool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Mutex protecting the segment creation and the entry allocation.
+ */
+//--------------------------------------------------------------------------------------------------
+static pthread_mutex_t Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the monotonic time in nanoseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint64_t GetTimeNs
+(
+    void
+)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Give a child process forked without exec'ing its own copy of the segment, at the same address.
+ *
+ * Runs in the child, after fork().
+ */
+//--------------------------------------------------------------------------------------------------
+static void ForkChildHandler
+(
+    void
+)
+{
+    if (SegmentPtr == NULL)
+    {
+        return;
+    }
+
+    int memFd = memfd_create(MSGTRACE_MEMFD_NAME, MFD_CLOEXEC);
+    void* copyPtr = MAP_FAILED;
+
+    if ((memFd >= 0) && (ftruncate(memFd, MSGTRACE_SEGMENT_BYTES) == 0))
+    {
+        copyPtr = mmap(NULL, MSGTRACE_SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, memFd, 0);
+    }
+
+    if (copyPtr == MAP_FAILED)
+    {
+        // Keep the counters of the parent rather than fail the fork.
+        if (memFd >= 0)
+        {
+            close(memFd);
+        }
+        return;
+    }
+
+    memcpy(copyPtr, SegmentPtr, MSGTRACE_SEGMENT_BYTES);
+    munmap(copyPtr, MSGTRACE_SEGMENT_BYTES);
+
+    // Only the thread that forked runs in the child, and it is not in the middle of a call.
+    if (mmap(SegmentPtr, MSGTRACE_SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+             memFd, 0) == MAP_FAILED)
+    {
+        close(memFd);
+        return;
+    }
+
+    uint32_t i;
+    for (i = 0; i < NumEntries; i++)
+    {
+        SegmentPtr->entries[i].inFlight = 0;
+    }
+
+    close(SegmentFd);
+    SegmentFd = memFd;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create the trace segment.
+ *
+ * @return LE_OK, or LE_FAULT if it could not be created (logged).
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t CreateSegment
+(
+    void
+)
+{
+    int memFd = memfd_create(MSGTRACE_MEMFD_NAME, MFD_CLOEXEC);
+    if (memFd < 0)
+    {
+        LE_ERROR("Failed to create IPC trace segment (%m).");
+        return LE_FAULT;
+    }
+
+    if (ftruncate(memFd, MSGTRACE_SEGMENT_BYTES) != 0)
+    {
+        LE_ERROR("Failed to size IPC trace segment (%m).");
+        close(memFd);
+        return LE_FAULT;
+    }
+
+    void* mapPtr = mmap(NULL, MSGTRACE_SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, memFd, 0);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map IPC trace segment (%m).");
+        close(memFd);
+        return LE_FAULT;
+    }
+
+    SegmentPtr = mapPtr;
+    SegmentPtr->magic = MSGTRACE_MAGIC;
+    SegmentPtr->version = MSGTRACE_VERSION;
+    SegmentPtr->maxEntries = MSGTRACE_MAX_ENTRIES;
+    SegmentPtr->numEntries = 0;
+    SegmentFd = memFd;
+
+    TracePool = le_mem_CreatePool("IpcTrace", sizeof(Trace_t));
+
+    LE_ASSERT(pthread_atfork(NULL, NULL, ForkChildHandler) == 0);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start tracing the calls to the functions of an API.
+ *
+ * @return Reference to the trace, or NULL if there is no room left for the API (logged).
+ */
+//--------------------------------------------------------------------------------------------------
+le_msg_TraceRef_t le_msg_CreateTrace
+(
+    const char* apiNamePtr,
+    bool isServer,
+    const char* const* funcNamesPtr,
+    size_t numFuncs
+)
+{
+    Trace_t* tracePtr = NULL;
+
+    LE_ASSERT(pthread_mutex_lock(&Mutex) == 0);
+
+    if ((SegmentPtr == NULL) && (CreateSegment() != LE_OK))
+    {
+        // Already logged.
+    }
+    else if (numFuncs > MSGTRACE_MAX_ENTRIES - NumEntries)
+    {
+        LE_WARN("No room left to trace %s API '%s'.", isServer ? "server" : "client", apiNamePtr);
+    }
+    else
+    {
+        msgTrace_Entry_t* entriesPtr = &SegmentPtr->entries[NumEntries];
+        size_t i;
+
+        for (i = 0; i < numFuncs; i++)
+        {
+            LE_WARN_IF(le_utf8_Copy(entriesPtr[i].apiName, apiNamePtr,
+                                    sizeof(entriesPtr[i].apiName), NULL) != LE_OK,
+                       "API name '%s' truncated.", apiNamePtr);
+            LE_WARN_IF(le_utf8_Copy(entriesPtr[i].funcName, funcNamesPtr[i],
+                                    sizeof(entriesPtr[i].funcName), NULL) != LE_OK,
+                       "Function name '%s' truncated.", funcNamesPtr[i]);
+            entriesPtr[i].isServer = isServer;
+        }
+
+        // Publish the entries once they are initialized.
+        NumEntries += numFuncs;
+        __atomic_store_n(&SegmentPtr->numEntries, NumEntries, __ATOMIC_RELEASE);
+
+        tracePtr = le_mem_ForceAlloc(TracePool);
+        tracePtr->entriesPtr = entriesPtr;
+        tracePtr->numFuncs = numFuncs;
+    }
+
+    LE_ASSERT(pthread_mutex_unlock(&Mutex) == 0);
+
+    return tracePtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the start of a call.
+ *
+ * @return Start time of the call, to pass to le_msg_TraceEnd().
+ */
+//--------------------------------------------------------------------------------------------------
+uint64_t le_msg_TraceStart
+(
+    le_msg_TraceRef_t traceRef,
+    uint32_t funcId
+)
+{
+    if ((traceRef == NULL) || (funcId >= traceRef->numFuncs))
+    {
+        return 0;
+    }
+
+    __atomic_add_fetch(&traceRef->entriesPtr[funcId].inFlight, 1, __ATOMIC_RELAXED);
+
+    return GetTimeNs();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Record the end of a call.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_msg_TraceEnd
+(
+    le_msg_TraceRef_t traceRef,
+    uint32_t funcId,
+    uint64_t startNs
+)
+{
+    if ((traceRef == NULL) || (funcId >= traceRef->numFuncs))
+    {
+        return;
+    }
+
+    msgTrace_Entry_t* entryPtr = &traceRef->entriesPtr[funcId];
+    uint64_t latencyNs = GetTimeNs() - startNs;
+    uint64_t latencyUs = latencyNs / 1000;
+
+    // Bucket N > 0 holds [2^(N-1), 2^N) us, i.e. the latencies of N significant bits.
+    uint32_t bucket = (latencyUs == 0) ? 0 : 64 - __builtin_clzll(latencyUs);
+    if (bucket >= MSGTRACE_NUM_BUCKETS)
+    {
+        bucket = MSGTRACE_NUM_BUCKETS - 1;
+    }
+
+    __atomic_add_fetch(&entryPtr->buckets[bucket], 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&entryPtr->totalNs, latencyNs, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&entryPtr->count, 1, __ATOMIC_RELAXED);
+
+    uint64_t maxNs = __atomic_load_n(&entryPtr->maxNs, __ATOMIC_RELAXED);
+    while ((latencyNs > maxNs) &&
+           !__atomic_compare_exchange_n(&entryPtr->maxNs, &maxNs, latencyNs, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        // maxNs has been updated with the current value, try again.
+    }
+
+    __atomic_sub_fetch(&entryPtr->inFlight, 1, __ATOMIC_RELAXED);
+}
+
+#endif // LE_CONFIG_IPC_TRACE
@@ -0,0 +1,96 @@
+//--------------------------------------------------------------------------------------------------
+/** @file messagingTrace.h
+ *
+ * Layout of the IPC trace segment, shared between the Low-Level Messaging API implementation,
+ * which updates it, and the inspect tool, which reads it through /proc/PID/fd.
+ *
+ * The segment is a memfd named MSGTRACE_MEMFD_NAME.  It starts with a msgTrace_Header_t, followed
+ * by an array of msgTrace_Entry_t, one per function of each traced API.  Entries are only ever
+ * appended: they are initialized before numEntries is increased to cover them.
+ *
+ * Latencies are recorded in a log2 histogram of microseconds: bucket 0 counts the calls that took
+ * less than 1 us, bucket N (N > 0) the calls that took [2^(N-1), 2^N) us, and the last bucket all
+ * the longer ones.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_MESSAGING_TRACE_H_INCLUDE_GUARD
+#define LEGATO_MESSAGING_TRACE_H_INCLUDE_GUARD
+
+
+//--------------------------------------------------------------------------------------------------
+/// Name of the memfd holding the trace segment (shown as "/memfd:le_ipcTrace" in /proc/PID/fd).
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_MEMFD_NAME     "le_ipcTrace"
+
+//--------------------------------------------------------------------------------------------------
+/// Magic number identifying a trace segment ("LIPT").
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_MAGIC          0x4C495054
+
+//--------------------------------------------------------------------------------------------------
+/// Version of the segment layout.
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_VERSION        1
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum number of traced functions in a process.
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_MAX_ENTRIES    512
+
+//--------------------------------------------------------------------------------------------------
+/// Size of the API and function names, including the null terminator.
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_NAME_BYTES     48
+
+//--------------------------------------------------------------------------------------------------
+/// Number of buckets of the latency histograms.  The last one starts at 2^22 us (about 4 s).
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_NUM_BUCKETS    24
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Counters of a function of a traced API.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    char apiName[MSGTRACE_NAME_BYTES];      ///< API (client) or service instance (server) name.
+    char funcName[MSGTRACE_NAME_BYTES];     ///< Function name.
+    uint32_t isServer;                      ///< 1 for the server side, 0 for the client side.
+    uint32_t inFlight;                      ///< Number of calls in progress.
+    uint64_t count;                         ///< Number of completed calls.
+    uint64_t totalNs;                       ///< Total latency of the completed calls (ns).
+    uint64_t maxNs;                         ///< Highest latency (ns).
+    uint64_t buckets[MSGTRACE_NUM_BUCKETS]; ///< Latency histogram.
+}
+msgTrace_Entry_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header of the trace segment.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    uint32_t magic;                         ///< MSGTRACE_MAGIC.
+    uint32_t version;                       ///< MSGTRACE_VERSION.
+    uint32_t maxEntries;                    ///< Capacity of the entry array.
+    uint32_t numEntries;                    ///< Number of entries in use.
+    msgTrace_Entry_t entries[];             ///< Entries.
+}
+msgTrace_Header_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Size of the trace segment.
+//--------------------------------------------------------------------------------------------------
+#define MSGTRACE_SEGMENT_BYTES \
+    (sizeof(msgTrace_Header_t) + MSGTRACE_MAX_ENTRIES * sizeof(msgTrace_Entry_t))
+
+
+#endif // LEGATO_MESSAGING_TRACE_H_INCLUDE_GUARD
@@ -69,6 +69,7 @@ typedef struct
     le_sls_Link_t link;     ///< Used to link into Pipeline_t's processList.
     pipeline_ProcessFunc_t func;    ///< Function to call in the child after setting up stdin/out.
     void* param;            ///< Parameter to pass to func when it is called in the child process.
+    const spawn_Attr_t* attrPtr;    ///< Program to spawn, instead of calling func (or NULL).
     pid_t pid;              ///< Process ID of running process (0 if not running).
 }
 Process_t;
@@ -294,6 +295,36 @@ void pipeline_Append
     processPtr->link = LE_SLS_LINK_INIT;
     processPtr->func = func;
     processPtr->param = param;
+    processPtr->attrPtr = NULL;
+    processPtr->pid = 0;
+
+    le_sls_Queue(&pipeline->processList, &processPtr->link);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a process that just executes a program to the end of the pipeline.
+ *
+ * @warning Be sure that attrPtr, and the strings and arrays it points to, remain valid until
+ *          the pipeline is started.
+ */
+//--------------------------------------------------------------------------------------------------
+void pipeline_AppendProgram
+(
+    pipeline_Ref_t pipeline,
+    const spawn_Attr_t* attrPtr     ///< Attributes of the process.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_ASSERT(attrPtr->numFdMaps == 0);
+
+    Process_t* processPtr = le_mem_ForceAlloc(ProcessPool);
+
+    processPtr->link = LE_SLS_LINK_INIT;
+    processPtr->func = NULL;
+    processPtr->param = NULL;
+    processPtr->attrPtr = attrPtr;
     processPtr->pid = 0;
 
     le_sls_Queue(&pipeline->processList, &processPtr->link);
@@ -437,6 +468,8 @@ static void MoveFd
  * In the child, sets up stdin and stdout, and calls the process function.
  * Will not return in the child process.
  *
+ * Processes added by pipeline_AppendProgram() are spawned instead.
+ *
  * In the parent process, stores the child's process ID (pid) in the Process object and returns.
  **/
 //--------------------------------------------------------------------------------------------------
@@ -448,6 +481,27 @@ static void Fork
 )
 //--------------------------------------------------------------------------------------------------
 {
+    if (processPtr->attrPtr != NULL)
+    {
+        // Spawn the program with inFd and outFd as its stdin and stdout.
+        spawn_Attr_t attr = *processPtr->attrPtr;
+        sigset_t sigSet;
+
+        LE_FATAL_IF(sigemptyset(&sigSet) == -1, "Can't empty sigset. %m");
+        attr.fdMap[0].srcFd = inFd;
+        attr.fdMap[0].destFd = STDIN_FILENO;
+        attr.fdMap[1].srcFd = outFd;
+        attr.fdMap[1].destFd = STDOUT_FILENO;
+        attr.numFdMaps = 2;
+        attr.closeFdsFrom = STDERR_FILENO + 1;
+        attr.sigMaskPtr = &sigSet;
+
+        processPtr->pid = spawn_Start(&attr);
+
+        LE_FATAL_IF(processPtr->pid == -1, "Can't start '%s', errno: %d (%m)", attr.pathPtr, errno);
+        return;
+    }
+
     processPtr->pid = fork();
 
     LE_FATAL_IF(processPtr->pid == -1, "Can't create child process, errno: %d (%m)", errno);
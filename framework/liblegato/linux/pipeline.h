@@ -80,6 +80,9 @@
  *
  * - pipeline_Append() adds a process to the end of the pipeline.
  *
+ * - pipeline_AppendProgram() adds a process that just executes a program to the end of the
+ *   pipeline.
+ *
  * - pipeline_SetInput() provides a file descriptor for the pipeline to read its input from.
  *
  * - pipeline_CreateInputPipe() creates a pipe to be connected to the input of the first process
@@ -116,6 +119,8 @@
 #ifndef LEGATO_PIPELINE_H_INCLUDE_GUARD
 #define LEGATO_PIPELINE_H_INCLUDE_GUARD
 
+#include "spawn.h"
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Reference to a pipeline.
@@ -191,6 +196,27 @@ void pipeline_Append
 );
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Adds a process that just executes a program to the end of the pipeline.  The process is spawned
+ * without copying the address space of the caller (see spawn.h), which is faster than running
+ * a process function that execs the program, in particular when the caller is large.
+ *
+ * The pipeline sets the standard input and output of the process up, closes its other
+ * non-standard file descriptors and unblocks all its signals, so attrPtr must not remap any file
+ * descriptor.
+ *
+ * @warning Be sure that attrPtr, and the strings and arrays it points to, remain valid until
+ *          the pipeline is started.
+ */
+//--------------------------------------------------------------------------------------------------
+void pipeline_AppendProgram
+(
+    pipeline_Ref_t pipeline,
+    const spawn_Attr_t* attrPtr     ///< Attributes of the process.
+);
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Provides a file descriptor for the pipeline to read its input from.
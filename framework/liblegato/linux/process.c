@@ -6,6 +6,7 @@
  */
 
 #include "legato.h"
+#include "spawn.h"
 
 /**
  * Write to stderr in an async-thread-safe manner.
@@ -88,6 +89,27 @@ pid_t le_proc_Execute
         environmentPtr = paramPtr->environmentPtr;
     }
 
+    // Nothing to run in the child before the exec: spawn the process without copying the address
+    // space of the caller.  (spawn_Start() would search a bare program name in PATH.)
+    if (!paramPtr->detach && (paramPtr->init == NULL) && (paramPtr->closeFds != 0) &&
+        (strchr(paramPtr->executableStr, '/') != NULL))
+    {
+        spawn_Attr_t attr =
+        {
+            .pathPtr = paramPtr->executableStr,
+            .argvPtr = argumentsPtr,
+            .envPtr = environmentPtr,
+            .closeFdsFrom = (paramPtr->closeFds > LE_PROC_NO_FDS) ? paramPtr->closeFds : 0
+        };
+
+        pid = spawn_Start(&attr);
+        if (pid > 0)
+        {
+            LE_INFO("Executing '%s'", paramPtr->executableStr);
+        }
+        return pid;
+    }
+
     if (paramPtr->closeFds > LE_PROC_NO_FDS)
     {
         maxFds = sysconf(_SC_OPEN_MAX);
@@ -0,0 +1,724 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file shmChannel.c Implementation of the shared memory channel API.
+ *
+ * A channel is a memfd holding a ring header followed by the ring slots, and an eventfd used by
+ * the producer to wake up the consumer.
+ *
+ * The ring is a classic single-producer, single-consumer ring: the producer only writes the head
+ * index and the consumer only writes the tail index.  Indexes are free-running 64-bit counters;
+ * the slot of an index is the index modulo the (power of two) slot count.  Each slot starts with
+ * the 32-bit size of the record it holds.
+ *
+ * The consumer is only signalled when the ring goes from empty to non-empty.  To avoid lost
+ * wake-ups, both sides issue a full memory barrier between publishing their own index and reading
+ * the other side's one: either the producer sees that the consumer caught up and signals it, or
+ * the consumer sees the new record.
+ *
+ * Each side keeps its own copy of the ring geometry and of its index, so the other side (which
+ * may be another process) cannot make it access memory outside of the ring by corrupting the
+ * shared header.  The memfd is sealed against resizing for the same reason.
+ *
+ * <hr>
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "shmChannel.h"
+#include "fileDescriptor.h"
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/// Magic number identifying a ring header ("LSHC").
+//--------------------------------------------------------------------------------------------------
+#define RING_MAGIC              0x4C534843
+
+//--------------------------------------------------------------------------------------------------
+/// Version of the ring layout.
+//--------------------------------------------------------------------------------------------------
+#define RING_VERSION            1
+
+//--------------------------------------------------------------------------------------------------
+/// Alignment of the fields written by each side, to avoid false sharing.
+//--------------------------------------------------------------------------------------------------
+#define CACHE_LINE_BYTES        64
+
+//--------------------------------------------------------------------------------------------------
+/// Size of the record size field at the start of each slot.
+//--------------------------------------------------------------------------------------------------
+#define RECORD_HEADER_BYTES     sizeof(uint32_t)
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum size of the shared memory of a channel.
+//--------------------------------------------------------------------------------------------------
+#define MAX_RING_BYTES          (16 * 1024 * 1024)
+
+//--------------------------------------------------------------------------------------------------
+/// Maximum size of a channel name, including the null terminator.
+//--------------------------------------------------------------------------------------------------
+#define MAX_NAME_BYTES          32
+
+//--------------------------------------------------------------------------------------------------
+/// Seals applied to the shared memory.
+//--------------------------------------------------------------------------------------------------
+#define RING_SEALS              (F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Ring header, at the start of the shared memory.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    // Set by the producer before the channel is shared.
+    uint32_t magic;             ///< RING_MAGIC.
+    uint32_t version;           ///< RING_VERSION.
+    uint32_t slotSize;          ///< Size of a slot, in bytes.
+    uint32_t slotCount;         ///< Number of slots, a power of two.
+    uint32_t maxRecordSize;     ///< Maximum size of a record, in bytes.
+
+    // Written by the producer.
+    uint64_t head __attribute__((aligned(CACHE_LINE_BYTES))); ///< Index of the next record written.
+    uint64_t droppedCount;      ///< Number of records dropped because the ring was full.
+    uint64_t fullCount;         ///< Number of records refused because the ring was full.
+    uint64_t signalCount;       ///< Number of times the consumer was signalled.
+
+    // Written by the consumer.
+    uint64_t tail __attribute__((aligned(CACHE_LINE_BYTES))); ///< Index of the next record read.
+}
+RingHeader_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Channel object.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct le_shmChannel
+{
+    char name[MAX_NAME_BYTES];          ///< Name, for diagnostics.
+    bool isProducer;                    ///< true on the producer side, false on the consumer side.
+    le_shmChannel_FullPolicy_t fullPolicy;  ///< What to do when the ring is full (producer only).
+    int memFd;                          ///< Shared memory file descriptor.
+    int eventFd;                        ///< Signalling file descriptor.
+    RingHeader_t* ringPtr;              ///< Mapped shared memory.
+    size_t mapSize;                     ///< Size of the mapping.
+    uint8_t* slotsPtr;                  ///< First slot.
+    uint32_t slotSize;                  ///< Size of a slot, in bytes.
+    uint32_t slotCount;                 ///< Number of slots.
+    uint32_t maxRecordSize;             ///< Maximum size of a record, in bytes.
+    uint64_t index;                     ///< Head (producer) or tail (consumer) index.
+    le_fdMonitor_Ref_t monitorRef;      ///< Monitor of the eventfd, or NULL (consumer only).
+    le_shmChannel_ReadHandlerFunc_t handlerFunc;    ///< Read handler (consumer only).
+    void* contextPtr;                   ///< Read handler context.
+}
+Channel_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/// Channel memory pool.
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t ChannelPool;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Channel destructor.  Unmaps the shared memory and closes the file descriptors.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ChannelDestructor
+(
+    void* objPtr
+)
+{
+    Channel_t* channelPtr = objPtr;
+
+    if (channelPtr->ringPtr != NULL)
+    {
+        munmap(channelPtr->ringPtr, channelPtr->mapSize);
+    }
+    if (channelPtr->memFd >= 0)
+    {
+        fd_Close(channelPtr->memFd);
+    }
+    if (channelPtr->eventFd >= 0)
+    {
+        fd_Close(channelPtr->eventFd);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialize the shared memory channel module.
+ *
+ * This should be called by liblegato's init.c module at start-up.
+ */
+//--------------------------------------------------------------------------------------------------
+void shmChannel_Init
+(
+    void
+)
+{
+    ChannelPool = le_mem_CreatePool("ShmChannel", sizeof(Channel_t));
+    le_mem_SetDestructor(ChannelPool, ChannelDestructor);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a channel object, with no resources.
+ */
+//--------------------------------------------------------------------------------------------------
+static Channel_t* NewChannel
+(
+    const char* name,
+    bool isProducer
+)
+{
+    Channel_t* channelPtr = le_mem_ForceAlloc(ChannelPool);
+
+    memset(channelPtr, 0, sizeof(*channelPtr));
+    if (le_utf8_Copy(channelPtr->name, name, sizeof(channelPtr->name), NULL) == LE_OVERFLOW)
+    {
+        LE_WARN("Channel name '%s' truncated to '%s'.", name, channelPtr->name);
+    }
+    channelPtr->isProducer = isProducer;
+    channelPtr->memFd = -1;
+    channelPtr->eventFd = -1;
+
+    return channelPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a pointer to a slot.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline uint8_t* GetSlot
+(
+    Channel_t* channelPtr,
+    uint64_t index
+)
+{
+    return channelPtr->slotsPtr + (index & (channelPtr->slotCount - 1)) * channelPtr->slotSize;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Wake up the consumer.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Signal
+(
+    Channel_t* channelPtr
+)
+{
+    uint64_t count = 1;
+    ssize_t result;
+
+    do
+    {
+        result = write(channelPtr->eventFd, &count, sizeof(count));
+    }
+    while ((result == -1) && (errno == EINTR));
+
+    // EAGAIN means the counter is saturated, so the consumer is signalled anyway.
+    if ((result == -1) && (errno != EAGAIN))
+    {
+        LE_ERROR("Failed to signal channel '%s' (%m).", channelPtr->name);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Check if the ring is empty, from the consumer side.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool IsEmpty
+(
+    Channel_t* channelPtr
+)
+{
+    return (__atomic_load_n(&channelPtr->ringPtr->head, __ATOMIC_ACQUIRE) == channelPtr->index);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a shared memory channel, on the producer side.
+ *
+ * @return Reference to the channel, or NULL on failure.
+ */
+//--------------------------------------------------------------------------------------------------
+le_shmChannel_Ref_t le_shmChannel_Create
+(
+    const char*                 name,           ///< [IN] Name of the channel, for diagnostics.
+    size_t                      maxRecordSize,  ///< [IN] Maximum size of a record, in bytes.
+    size_t                      recordCount,    ///< [IN] Number of records the ring can hold.
+                                                ///<      Rounded up to a power of two.
+    le_shmChannel_FullPolicy_t  fullPolicy      ///< [IN] What to do when the ring is full.
+)
+{
+    char memName[MAX_NAME_BYTES + 8];
+    uint64_t slotSize;
+    uint64_t slotCount = 1;
+    uint64_t mapSize;
+
+    if ((maxRecordSize == 0) || (recordCount == 0) || (maxRecordSize > MAX_RING_BYTES) ||
+        (recordCount > MAX_RING_BYTES))
+    {
+        LE_ERROR("Invalid channel '%s' geometry: %zu records of %zu bytes.",
+                 name, recordCount, maxRecordSize);
+        return NULL;
+    }
+
+    slotSize = (maxRecordSize + RECORD_HEADER_BYTES + 7) & ~(uint64_t)7;
+    while (slotCount < recordCount)
+    {
+        slotCount <<= 1;
+    }
+    mapSize = sizeof(RingHeader_t) + slotSize * slotCount;
+    if (mapSize > MAX_RING_BYTES)
+    {
+        LE_ERROR("Channel '%s' too large: %" PRIu64 " slots of %" PRIu64 " bytes.",
+                 name, slotCount, slotSize);
+        return NULL;
+    }
+
+    Channel_t* channelPtr = NewChannel(name, true);
+    channelPtr->fullPolicy = fullPolicy;
+    channelPtr->slotSize = (uint32_t)slotSize;
+    channelPtr->slotCount = (uint32_t)slotCount;
+    channelPtr->maxRecordSize = (uint32_t)maxRecordSize;
+    channelPtr->mapSize = mapSize;
+
+    snprintf(memName, sizeof(memName), "le_shm_%s", channelPtr->name);
+    channelPtr->memFd = memfd_create(memName, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (channelPtr->memFd < 0)
+    {
+        LE_ERROR("Failed to create shared memory for channel '%s' (%m).", name);
+        goto error;
+    }
+
+    if ((ftruncate(channelPtr->memFd, mapSize) != 0) ||
+        (fcntl(channelPtr->memFd, F_ADD_SEALS, RING_SEALS) != 0))
+    {
+        LE_ERROR("Failed to size shared memory for channel '%s' (%m).", name);
+        goto error;
+    }
+
+    void* mapPtr = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, channelPtr->memFd, 0);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map shared memory for channel '%s' (%m).", name);
+        goto error;
+    }
+    channelPtr->ringPtr = mapPtr;
+    channelPtr->slotsPtr = (uint8_t*)mapPtr + sizeof(RingHeader_t);
+
+    channelPtr->eventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (channelPtr->eventFd < 0)
+    {
+        LE_ERROR("Failed to create eventfd for channel '%s' (%m).", name);
+        goto error;
+    }
+
+    // The memfd is zero-filled, so only the geometry needs to be set.
+    channelPtr->ringPtr->magic = RING_MAGIC;
+    channelPtr->ringPtr->version = RING_VERSION;
+    channelPtr->ringPtr->slotSize = channelPtr->slotSize;
+    channelPtr->ringPtr->slotCount = channelPtr->slotCount;
+    channelPtr->ringPtr->maxRecordSize = channelPtr->maxRecordSize;
+
+    LE_DEBUG("Created channel '%s': %" PRIu32 " slots of %" PRIu32 " bytes.",
+             channelPtr->name, channelPtr->slotCount, channelPtr->slotSize);
+
+    return channelPtr;
+
+error:
+    le_mem_Release(channelPtr);
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the file descriptors of a channel, to hand them to the consumer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_FAULT if the file descriptors could not be duplicated.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_GetFds
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    int*                memFdPtr,       ///< [OUT] Shared memory file descriptor.
+    int*                eventFdPtr      ///< [OUT] Signalling file descriptor.
+)
+{
+    LE_ASSERT(channelRef != NULL);
+    LE_ASSERT((memFdPtr != NULL) && (eventFdPtr != NULL));
+
+    *memFdPtr = fcntl(channelRef->memFd, F_DUPFD_CLOEXEC, 0);
+    if (*memFdPtr < 0)
+    {
+        LE_ERROR("Failed to duplicate channel '%s' shared memory (%m).", channelRef->name);
+        return LE_FAULT;
+    }
+
+    *eventFdPtr = fcntl(channelRef->eventFd, F_DUPFD_CLOEXEC, 0);
+    if (*eventFdPtr < 0)
+    {
+        LE_ERROR("Failed to duplicate channel '%s' eventfd (%m).", channelRef->name);
+        fd_Close(*memFdPtr);
+        *memFdPtr = -1;
+        return LE_FAULT;
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Attach to a shared memory channel, on the consumer side.
+ *
+ * @return Reference to the channel, or NULL if the file descriptors are not a valid channel.
+ */
+//--------------------------------------------------------------------------------------------------
+le_shmChannel_Ref_t le_shmChannel_Attach
+(
+    const char* name,       ///< [IN] Name of the channel, for diagnostics.
+    int         memFd,      ///< [IN] Shared memory file descriptor.
+    int         eventFd     ///< [IN] Signalling file descriptor.
+)
+{
+    struct stat memStat;
+    int seals;
+
+    Channel_t* channelPtr = NewChannel(name, false);
+    channelPtr->memFd = memFd;
+    channelPtr->eventFd = eventFd;
+
+    if ((memFd < 0) || (eventFd < 0))
+    {
+        LE_ERROR("Invalid file descriptors for channel '%s'.", name);
+        goto error;
+    }
+
+    // The size must not change while mapped, or accesses could fault.
+    seals = fcntl(memFd, F_GET_SEALS);
+    if ((seals < 0) || ((seals & (F_SEAL_SHRINK | F_SEAL_GROW)) != (F_SEAL_SHRINK | F_SEAL_GROW)))
+    {
+        LE_ERROR("Channel '%s' shared memory is not sealed.", name);
+        goto error;
+    }
+
+    if ((fstat(memFd, &memStat) != 0) || (memStat.st_size < (off_t)sizeof(RingHeader_t)) ||
+        (memStat.st_size > MAX_RING_BYTES))
+    {
+        LE_ERROR("Invalid channel '%s' shared memory.", name);
+        goto error;
+    }
+    channelPtr->mapSize = memStat.st_size;
+
+    void* mapPtr = mmap(NULL, channelPtr->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, memFd, 0);
+    if (mapPtr == MAP_FAILED)
+    {
+        LE_ERROR("Failed to map shared memory for channel '%s' (%m).", name);
+        goto error;
+    }
+    channelPtr->ringPtr = mapPtr;
+    channelPtr->slotsPtr = (uint8_t*)mapPtr + sizeof(RingHeader_t);
+
+    // Take a private copy of the geometry, and check it fits in the mapping.
+    channelPtr->slotSize = channelPtr->ringPtr->slotSize;
+    channelPtr->slotCount = channelPtr->ringPtr->slotCount;
+    channelPtr->maxRecordSize = channelPtr->ringPtr->maxRecordSize;
+    if ((channelPtr->ringPtr->magic != RING_MAGIC) ||
+        (channelPtr->ringPtr->version != RING_VERSION) ||
+        (channelPtr->maxRecordSize == 0) ||
+        ((uint64_t)channelPtr->maxRecordSize + RECORD_HEADER_BYTES > channelPtr->slotSize) ||
+        (channelPtr->slotCount == 0) ||
+        ((channelPtr->slotCount & (channelPtr->slotCount - 1)) != 0) ||
+        (sizeof(RingHeader_t) + (uint64_t)channelPtr->slotSize * channelPtr->slotCount >
+            channelPtr->mapSize))
+    {
+        LE_ERROR("Invalid channel '%s' header.", name);
+        goto error;
+    }
+
+    channelPtr->index = __atomic_load_n(&channelPtr->ringPtr->tail, __ATOMIC_ACQUIRE);
+
+    LE_DEBUG("Attached to channel '%s': %" PRIu32 " slots of %" PRIu32 " bytes.",
+             channelPtr->name, channelPtr->slotCount, channelPtr->slotSize);
+
+    return channelPtr;
+
+error:
+    le_mem_Release(channelPtr);
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a record into a channel.  Must be called by the producer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_BAD_PARAMETER if the record is larger than the maximum record size.
+ *      - LE_WOULD_BLOCK if the ring is full and the channel applies backpressure.
+ *      - LE_NO_MEMORY if the ring is full and the record was dropped.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_Write
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    const void*         dataPtr,        ///< [IN] Record.
+    size_t              size            ///< [IN] Size of the record, in bytes.
+)
+{
+    LE_ASSERT((channelRef != NULL) && channelRef->isProducer);
+
+    RingHeader_t* ringPtr = channelRef->ringPtr;
+    uint64_t head = channelRef->index;
+    uint32_t recordSize = size;
+
+    if (size > channelRef->maxRecordSize)
+    {
+        LE_ERROR("Record of %zu bytes too large for channel '%s'.", size, channelRef->name);
+        return LE_BAD_PARAMETER;
+    }
+
+    // If the consumer corrupted the tail index, the ring just looks full.
+    if (head - __atomic_load_n(&ringPtr->tail, __ATOMIC_ACQUIRE) >= channelRef->slotCount)
+    {
+        if (channelRef->fullPolicy == LE_SHMCHANNEL_FULL_DROP)
+        {
+            __atomic_fetch_add(&ringPtr->droppedCount, 1, __ATOMIC_RELAXED);
+            return LE_NO_MEMORY;
+        }
+
+        __atomic_fetch_add(&ringPtr->fullCount, 1, __ATOMIC_RELAXED);
+        return LE_WOULD_BLOCK;
+    }
+
+    uint8_t* slotPtr = GetSlot(channelRef, head);
+    memcpy(slotPtr, &recordSize, RECORD_HEADER_BYTES);
+    memcpy(slotPtr + RECORD_HEADER_BYTES, dataPtr, size);
+
+    channelRef->index = ++head;
+    __atomic_store_n(&ringPtr->head, head, __ATOMIC_RELEASE);
+
+    // Only signal the consumer if it had caught up with the previous records.  The barrier
+    // pairs with the one in le_shmChannel_Read().
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ringPtr->tail, __ATOMIC_RELAXED) == head - 1)
+    {
+        __atomic_fetch_add(&ringPtr->signalCount, 1, __ATOMIC_RELAXED);
+        Signal(channelRef);
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read the oldest record from a channel.  Must be called by the consumer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_WOULD_BLOCK if the ring is empty.
+ *      - LE_OVERFLOW if the buffer is too small for the record, which is left in the ring.
+ *        *sizePtr is set to the size of the record.
+ *      - LE_FAULT if the ring is corrupted.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_Read
+(
+    le_shmChannel_Ref_t channelRef,     ///< [IN] Channel reference.
+    void*               bufPtr,         ///< [OUT] Buffer receiving the record.
+    size_t*             sizePtr         ///< [IN/OUT] Size of the buffer, then of the record.
+)
+{
+    LE_ASSERT((channelRef != NULL) && !channelRef->isProducer);
+    LE_ASSERT(sizePtr != NULL);
+
+    RingHeader_t* ringPtr = channelRef->ringPtr;
+    uint64_t tail = channelRef->index;
+    uint64_t head = __atomic_load_n(&ringPtr->head, __ATOMIC_ACQUIRE);
+    uint32_t recordSize;
+
+    if (head == tail)
+    {
+        return LE_WOULD_BLOCK;
+    }
+    if (head - tail > channelRef->slotCount)
+    {
+        LE_ERROR("Channel '%s' corrupted: head %" PRIu64 ", tail %" PRIu64 ".",
+                 channelRef->name, head, tail);
+        return LE_FAULT;
+    }
+
+    const uint8_t* slotPtr = GetSlot(channelRef, tail);
+    memcpy(&recordSize, slotPtr, RECORD_HEADER_BYTES);
+    if (recordSize > channelRef->maxRecordSize)
+    {
+        LE_ERROR("Channel '%s' corrupted: record of %" PRIu32 " bytes.",
+                 channelRef->name, recordSize);
+        return LE_FAULT;
+    }
+    if (recordSize > *sizePtr)
+    {
+        *sizePtr = recordSize;
+        return LE_OVERFLOW;
+    }
+
+    memcpy(bufPtr, slotPtr + RECORD_HEADER_BYTES, recordSize);
+    *sizePtr = recordSize;
+
+    channelRef->index = ++tail;
+    __atomic_store_n(&ringPtr->tail, tail, __ATOMIC_RELEASE);
+
+    // Pairs with the barrier in le_shmChannel_Write(): the next head read sees a record written
+    // after this point, or the producer sees this tail and signals.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handler for the eventfd of a channel on the consumer side.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventFdHandler
+(
+    int fd,
+    short events
+)
+{
+    Channel_t* channelPtr = le_fdMonitor_GetContextPtr();
+    uint64_t count;
+
+    if (events & POLLIN)
+    {
+        // Reset the eventfd counter.  EAGAIN is possible if re-armed by ourselves below.
+        if ((read(fd, &count, sizeof(count)) < 0) && (errno != EAGAIN) && (errno != EINTR))
+        {
+            LE_ERROR("Failed to read channel '%s' eventfd (%m).", channelPtr->name);
+        }
+    }
+
+    // The handler may delete the channel.
+    le_mem_AddRef(channelPtr);
+
+    channelPtr->handlerFunc(channelPtr, channelPtr->contextPtr);
+
+    // If the handler left records in the ring, come back after other events have been handled.
+    if ((channelPtr->monitorRef != NULL) && !IsEmpty(channelPtr))
+    {
+        Signal(channelPtr);
+    }
+
+    le_mem_Release(channelPtr);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set the handler called, from the calling thread's event loop, when records are available in a
+ * channel.  Must be called by the consumer.
+ *
+ * @return
+ *      - LE_OK on success.
+ *      - LE_DUPLICATE if a handler is already set.
+ */
+//--------------------------------------------------------------------------------------------------
+le_result_t le_shmChannel_SetReadHandler
+(
+    le_shmChannel_Ref_t             channelRef,     ///< [IN] Channel reference.
+    le_shmChannel_ReadHandlerFunc_t handlerFunc,    ///< [IN] Handler function.
+    void*                           contextPtr      ///< [IN] Context pointer for the handler.
+)
+{
+    LE_ASSERT((channelRef != NULL) && !channelRef->isProducer);
+    LE_ASSERT(handlerFunc != NULL);
+
+    if (channelRef->monitorRef != NULL)
+    {
+        return LE_DUPLICATE;
+    }
+
+    channelRef->handlerFunc = handlerFunc;
+    channelRef->contextPtr = contextPtr;
+    channelRef->monitorRef = le_fdMonitor_Create(channelRef->name, channelRef->eventFd,
+                                                 EventFdHandler, POLLIN);
+    le_fdMonitor_SetContextPtr(channelRef->monitorRef, channelRef);
+
+    // Records written before the handler was set did not necessarily signal the consumer.
+    if (!IsEmpty(channelRef))
+    {
+        Signal(channelRef);
+    }
+
+    return LE_OK;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the statistics of a channel.  Can be called on both sides.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_shmChannel_GetStats
+(
+    le_shmChannel_Ref_t     channelRef,     ///< [IN] Channel reference.
+    le_shmChannel_Stats_t*  statsPtr        ///< [OUT] Statistics.
+)
+{
+    LE_ASSERT((channelRef != NULL) && (statsPtr != NULL));
+
+    RingHeader_t* ringPtr = channelRef->ringPtr;
+
+    statsPtr->writeCount = __atomic_load_n(&ringPtr->head, __ATOMIC_RELAXED);
+    statsPtr->readCount = __atomic_load_n(&ringPtr->tail, __ATOMIC_RELAXED);
+    statsPtr->droppedCount = __atomic_load_n(&ringPtr->droppedCount, __ATOMIC_RELAXED);
+    statsPtr->fullCount = __atomic_load_n(&ringPtr->fullCount, __ATOMIC_RELAXED);
+    statsPtr->signalCount = __atomic_load_n(&ringPtr->signalCount, __ATOMIC_RELAXED);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Delete a channel.  The shared memory is freed when both sides have deleted the channel.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_shmChannel_Delete
+(
+    le_shmChannel_Ref_t channelRef      ///< [IN] Channel reference.
+)
+{
+    LE_ASSERT(channelRef != NULL);
+
+    if (channelRef->monitorRef != NULL)
+    {
+        le_fdMonitor_Delete(channelRef->monitorRef);
+        channelRef->monitorRef = NULL;
+    }
+
+    le_mem_Release(channelRef);
+}
@@ -0,0 +1,409 @@
+//--------------------------------------------------------------------------------------------------
+/** @file spawn.c
+ *
+ * Implementation of process spawning.
+ *
+ * The child is created by clone() with CLONE_VM | CLONE_VFORK: it runs on its own stack, in the
+ * memory of the caller, and the caller is suspended until the child execs or exits.  The child
+ * must therefore only make system calls, and must not touch the state of the caller (no heap
+ * allocation, no logging, no lock).  Everything that can be prepared is prepared by the caller,
+ * and errors in the child are reported through the shared SpawnContext_t.
+ *
+ * While the child runs, the caller blocks all its signals, and the child resets the signal
+ * handlers to their default action before restoring the signal mask, so that no handler of the
+ * caller ever runs in the child.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "spawn.h"
+#include "smack.h"
+#include "limit.h"
+
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of the stack of the child, until it execs.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHILD_STACK_SIZE    (64 * 1024)
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File the SMACK label of a process is written to.
+ */
+//--------------------------------------------------------------------------------------------------
+#define PROC_SMACK_FILE     "/proc/self/attr/current"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Search path used if PATH is not set.
+ */
+//--------------------------------------------------------------------------------------------------
+#define DEFAULT_PATH        "/usr/local/bin:/bin:/usr/bin"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * System calls setting the user and group IDs.  The C library wrappers can't be used in the child,
+ * as they synchronize the IDs of all the threads of the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+#ifdef SYS_setuid32
+#define SYS_SETUID          SYS_setuid32
+#define SYS_SETGID          SYS_setgid32
+#define SYS_SETGROUPS       SYS_setgroups32
+#else
+#define SYS_SETUID          SYS_setuid
+#define SYS_SETGID          SYS_setgid
+#define SYS_SETGROUPS       SYS_setgroups
+#endif
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State shared by the caller and the child.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const spawn_Attr_t* attrPtr;    ///< Attributes of the process.
+    const char* pathPtr;            ///< Resolved path of the program.
+    char* const* envPtr;            ///< Environment of the program.
+    const sigset_t* sigMaskPtr;     ///< Signal mask of the child.
+    bool setSmackLabel;             ///< true if the SMACK label must be set.
+    int maxFds;                     ///< Maximum number of file descriptors of a process.
+    const char* failedStepPtr;      ///< Set by the child to the step that failed, if any.
+    int error;                      ///< Set by the child to the errno of the failure.
+}
+SpawnContext_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Find a program in the directories listed in PATH.
+ *
+ * @return
+ *      LE_OK if found, LE_NOT_FOUND otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_result_t FindInPath
+(
+    const char* namePtr,            ///< [IN] Name of the program.
+    char* pathPtr,                  ///< [OUT] Path of the program.
+    size_t pathSize                 ///< [IN] Size of the path buffer.
+)
+{
+    const char* dirPtr = getenv("PATH");
+
+    if ((dirPtr == NULL) || (*dirPtr == '\0'))
+    {
+        dirPtr = DEFAULT_PATH;
+    }
+
+    while (*dirPtr != '\0')
+    {
+        size_t dirLen = strcspn(dirPtr, ":");
+
+        // An empty entry is the current directory.
+        int len = (dirLen == 0) ? snprintf(pathPtr, pathSize, "%s", namePtr) :
+                                  snprintf(pathPtr, pathSize, "%.*s/%s", (int)dirLen, dirPtr,
+                                           namePtr);
+
+        if (((size_t)len < pathSize) && (access(pathPtr, X_OK) == 0))
+        {
+            return LE_OK;
+        }
+
+        dirPtr += dirLen;
+        if (*dirPtr == ':')
+        {
+            dirPtr++;
+        }
+    }
+
+    return LE_NOT_FOUND;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a string to a file, in the child.
+ *
+ * @return
+ *      0 if successful, -1 otherwise with errno set.
+ */
+//--------------------------------------------------------------------------------------------------
+static int WriteFile
+(
+    const char* pathPtr,
+    const char* strPtr
+)
+{
+    size_t len = strlen(strPtr);
+    ssize_t result;
+    int fd;
+
+    do
+    {
+        fd = open(pathPtr, O_WRONLY | O_CLOEXEC);
+    }
+    while ((fd == -1) && (errno == EINTR));
+
+    if (fd == -1)
+    {
+        return -1;
+    }
+
+    do
+    {
+        result = write(fd, strPtr, len);
+    }
+    while ((result == -1) && (errno == EINTR));
+
+    if ((result != -1) && ((size_t)result != len))
+    {
+        result = -1;
+        errno = EIO;
+    }
+
+    close(fd);
+
+    return (result == -1) ? -1 : 0;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Close all the file descriptors from a given one up, in the child.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CloseFrom
+(
+    int firstFd,
+    int maxFds
+)
+{
+    int fd;
+
+#ifdef SYS_close_range
+    if (syscall(SYS_close_range, firstFd, ~0U, 0) == 0)
+    {
+        return;
+    }
+#endif
+
+    for (fd = firstFd; fd < maxFds; fd++)
+    {
+        close(fd);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Body of the child, until it execs the program.
+ *
+ * @return
+ *      Never returns if successful.  Exit code of the child otherwise.
+ */
+//--------------------------------------------------------------------------------------------------
+static int Child
+(
+    void* contextPtr
+)
+{
+    SpawnContext_t* ctxPtr = contextPtr;
+    const spawn_Attr_t* attrPtr = ctxPtr->attrPtr;
+    struct sigaction action;
+    size_t i;
+    int sigNum;
+
+    // Reset the signal handlers of the caller.  The signal dispositions are not shared with the
+    // caller, only its memory.
+    for (sigNum = 1; sigNum < _NSIG; sigNum++)
+    {
+        if (   (sigaction(sigNum, NULL, &action) == 0)
+            && (action.sa_handler != SIG_DFL)
+            && (action.sa_handler != SIG_IGN))
+        {
+            memset(&action, 0, sizeof(action));
+            action.sa_handler = SIG_DFL;
+            sigaction(sigNum, &action, NULL);
+        }
+    }
+
+    if (attrPtr->newSession && (setsid() == -1))
+    {
+        ctxPtr->failedStepPtr = "start a new session";
+        goto failed;
+    }
+
+    for (i = 0; i < attrPtr->numFdMaps; i++)
+    {
+        const spawn_FdMap_t* mapPtr = &attrPtr->fdMap[i];
+        int result;
+
+        if (mapPtr->srcFd == mapPtr->destFd)
+        {
+            // Already in place, only make sure that it is inherited by the program.
+            result = fcntl(mapPtr->destFd, F_SETFD, 0);
+        }
+        else
+        {
+            do
+            {
+                result = dup2(mapPtr->srcFd, mapPtr->destFd);
+            }
+            while ((result == -1) && (errno == EINTR));
+        }
+
+        if (result == -1)
+        {
+            ctxPtr->failedStepPtr = "remap a file descriptor";
+            goto failed;
+        }
+    }
+
+    if (attrPtr->closeFdsFrom > 0)
+    {
+        CloseFrom(attrPtr->closeFdsFrom, ctxPtr->maxFds);
+    }
+
+    if (ctxPtr->setSmackLabel && (WriteFile(PROC_SMACK_FILE, attrPtr->smackLabelPtr) == -1))
+    {
+        ctxPtr->failedStepPtr = "set the SMACK label";
+        goto failed;
+    }
+
+    if (attrPtr->setIds)
+    {
+        // The groups and group ID must be set first, as setting the user ID drops the privileges.
+        if (   (syscall(SYS_SETGROUPS, 0, NULL) == -1)
+            || (syscall(SYS_SETGID, attrPtr->gid) == -1)
+            || (syscall(SYS_SETUID, attrPtr->uid) == -1))
+        {
+            ctxPtr->failedStepPtr = "set the user and group IDs";
+            goto failed;
+        }
+    }
+
+    sigprocmask(SIG_SETMASK, ctxPtr->sigMaskPtr, NULL);
+
+    execve(ctxPtr->pathPtr, attrPtr->argvPtr, ctxPtr->envPtr);
+    ctxPtr->failedStepPtr = "execute the program";
+
+failed:
+    ctxPtr->error = errno;
+    _exit(EXIT_FAILURE);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Spawn a process.
+ *
+ * Signal handlers of the caller are reset to their default action in the child.
+ *
+ * @return
+ *      Process ID of the child, or -1 if the child could not be created or could not execute the
+ *      program, with errno set.  The failure is logged.
+ */
+//--------------------------------------------------------------------------------------------------
+pid_t spawn_Start
+(
+    const spawn_Attr_t* attrPtr     ///< [IN] Attributes of the process.
+)
+{
+    char path[PATH_MAX];
+    sigset_t allSignals;
+    sigset_t callerMask;
+    SpawnContext_t ctx =
+    {
+        .attrPtr = attrPtr,
+        .pathPtr = attrPtr->pathPtr,
+        .envPtr = (attrPtr->envPtr != NULL) ? attrPtr->envPtr : environ,
+        .sigMaskPtr = (attrPtr->sigMaskPtr != NULL) ? attrPtr->sigMaskPtr : &callerMask,
+        .setSmackLabel = (attrPtr->smackLabelPtr != NULL) && smack_IsEnabled(),
+        .maxFds = sysconf(_SC_OPEN_MAX),
+        .failedStepPtr = NULL,
+        .error = 0
+    };
+    size_t i;
+    pid_t pid;
+
+    LE_ASSERT((attrPtr->pathPtr != NULL) && (attrPtr->argvPtr != NULL));
+    LE_ASSERT(attrPtr->numFdMaps <= SPAWN_MAX_FD_MAPS);
+
+    for (i = 0; i < attrPtr->numFdMaps; i++)
+    {
+        LE_ASSERT((attrPtr->closeFdsFrom <= 0) ||
+                  (attrPtr->fdMap[i].destFd < attrPtr->closeFdsFrom));
+    }
+
+    if (ctx.maxFds == -1)
+    {
+        ctx.maxFds = LIMIT_MAX_NUM_PROCESS_FD;
+    }
+
+    // Search the program in the caller, which can allocate memory.
+    if (strchr(attrPtr->pathPtr, '/') == NULL)
+    {
+        if (FindInPath(attrPtr->pathPtr, path, sizeof(path)) != LE_OK)
+        {
+            LE_ERROR("Program '%s' not found.", attrPtr->pathPtr);
+            errno = ENOENT;
+            return -1;
+        }
+        ctx.pathPtr = path;
+    }
+
+    void* stackPtr = mmap(NULL, CHILD_STACK_SIZE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+
+    if (stackPtr == MAP_FAILED)
+    {
+        LE_ERROR("Can't allocate a stack to start '%s' (%m).", ctx.pathPtr);
+        return -1;
+    }
+
+    LE_ASSERT(sigfillset(&allSignals) == 0);
+    LE_ASSERT(pthread_sigmask(SIG_SETMASK, &allSignals, &callerMask) == 0);
+
+    // The stack grows down on all the supported architectures.
+    pid = clone(Child, (uint8_t*)stackPtr + CHILD_STACK_SIZE, CLONE_VM | CLONE_VFORK | SIGCHLD,
+                &ctx);
+
+    int cloneErrno = errno;
+
+    LE_ASSERT(pthread_sigmask(SIG_SETMASK, &callerMask, NULL) == 0);
+    munmap(stackPtr, CHILD_STACK_SIZE);
+
+    if (pid == -1)
+    {
+        LE_ERROR("Can't create a process for '%s' (%s).", ctx.pathPtr, strerror(cloneErrno));
+        errno = cloneErrno;
+        return -1;
+    }
+
+    if (ctx.failedStepPtr != NULL)
+    {
+        // The child has exited: reap it.
+        while ((waitpid(pid, NULL, 0) == -1) && (errno == EINTR));
+
+        LE_ERROR("Failed to %s for '%s' (%s).", ctx.failedStepPtr, ctx.pathPtr,
+                 strerror(ctx.error));
+        errno = ctx.error;
+        return -1;
+    }
+
+    return pid;
+}
@@ -0,0 +1,102 @@
+//--------------------------------------------------------------------------------------------------
+/** @file spawn.h
+ *
+ * Process spawning, for the framework daemons that start other programs.
+ *
+ * spawn_Start() creates the child process with clone(CLONE_VM | CLONE_VFORK), like posix_spawn()
+ * does: the child shares the memory of the caller until it execs the program, so no page table is
+ * copied and no copy-on-write fault is taken, whatever the size of the caller.  The time taken to
+ * start a program therefore does not grow with the memory footprint of the caller, unlike with
+ * fork().
+ *
+ * As the child shares the memory of the caller, it can't run arbitrary code before the exec.  The
+ * setup done in the child is described by a spawn_Attr_t: standard stream redirection, closing of
+ * the other file descriptors, new session, signal mask, SMACK label and user/group IDs.
+ *
+ * Exec failures are reported to the caller by spawn_Start(), as the caller only resumes once the
+ * child has exec'd the program or has failed to.
+ *
+ * @code
+ *
+ * char* argv[] = { "sdir", "load", NULL };
+ * spawn_Attr_t attr = { .pathPtr = "sdir", .argvPtr = argv, .closeFdsFrom = 3 };
+ *
+ * pid_t pid = spawn_Start(&attr);
+ * LE_FATAL_IF(pid == -1, "Could not start 'sdir' (%m).");
+ *
+ * @endcode
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_SPAWN_H_INCLUDE_GUARD
+#define LEGATO_SPAWN_H_INCLUDE_GUARD
+
+#include "legato.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of file descriptors that can be remapped in the child.
+ */
+//--------------------------------------------------------------------------------------------------
+#define SPAWN_MAX_FD_MAPS   3
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * File descriptor to remap in the child, in general to one of its standard streams.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    int srcFd;                      ///< File descriptor of the caller.
+    int destFd;                     ///< File descriptor number it gets in the child.
+}
+spawn_FdMap_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Attributes of a process to spawn.  Fields left to zero keep the defaults, i.e. the child
+ * inherits the file descriptors, session, signal mask, SMACK label and IDs of the caller.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char* pathPtr;            ///< Program to execute, searched in PATH if it has no '/'.
+    char* const* argvPtr;           ///< NULL-terminated argument list.
+    char* const* envPtr;            ///< NULL-terminated environment, NULL to inherit the caller's.
+    spawn_FdMap_t fdMap[SPAWN_MAX_FD_MAPS];    ///< File descriptors to remap, in order.
+    size_t numFdMaps;               ///< Number of entries used in fdMap.
+    int closeFdsFrom;               ///< Close all the file descriptors from this one up (after the
+                                    ///< remapping), 0 to close none.
+    bool newSession;                ///< Start a new session (setsid()).
+    const sigset_t* sigMaskPtr;     ///< Signal mask of the child, NULL to inherit the caller's.
+    const char* smackLabelPtr;      ///< SMACK label of the child, NULL to inherit the caller's.
+    bool setIds;                    ///< Run as uid/gid, without supplementary groups.
+    uid_t uid;                      ///< User ID, if setIds is true.
+    gid_t gid;                      ///< Group ID, if setIds is true.
+}
+spawn_Attr_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Spawn a process.
+ *
+ * Signal handlers of the caller are reset to their default action in the child.
+ *
+ * @return
+ *      Process ID of the child, or -1 if the child could not be created or could not execute the
+ *      program, with errno set.  The failure is logged.
+ */
+//--------------------------------------------------------------------------------------------------
+pid_t spawn_Start
+(
+    const spawn_Attr_t* attrPtr     ///< [IN] Attributes of the process.
+);
+
+
+#endif // LEGATO_SPAWN_H_INCLUDE_GUARD
@@ -7,8 +7,8 @@
  * object, the number of blocks and objects in a memory pool are always the same.
  *
  * Memory for the memory blocks (including the user object) is allocated from system
- * memory when a memory pool is expanded.  Memory blocks are never released back to system memory.
- * Instead, when they are "free", they are kept on their pool's "free list".  The free list is
+ * memory when a memory pool is expanded.  When they are "free", memory blocks are kept on their
+ * pool's "free list".  The free list is
  * O(1) for both insertion and removal.  It is treated as a stack, in that blocks are popped from
  * the head of the free list when they are allocated and pushed back onto the head of the free
  * list when they are deallocated.  The hope is that this will speed things up by utilizing the
@@ -30,6 +30,17 @@
  * delete a sub-pool while there are still blocks allocated from it.  The sub-pool itself is then
  * removed from the list of pools and released back into the pool of sub-pools.
  *
+ * TRIMMING
+ * ========
+ *
+ * The blocks added to a pool by le_mem_ForceAlloc() are allocated as "chunks", each with a header
+ * linking it in the pool's list of chunks, kept sorted by address.  Nothing is tracked per block,
+ * so that allocation and release are unchanged.  Instead, when a pool is trimmed, its free list is
+ * sorted by address and walked along with the list of chunks to count the free blocks of each
+ * chunk.  The chunks whose blocks are all free (and have been for long enough, when trimming
+ * automatically) are removed from the free list and freed.  The blocks added by le_mem_ExpandPool()
+ * are the intended size of the pool and are never freed.
+ *
  * GUARD BANDS
  * ===========
  *
@@ -45,6 +56,10 @@
 #include "legato.h"
 #include "mem.h"
 
+#if defined(__GLIBC__)
+#   include <malloc.h>
+#endif
+
 #define GUARD_WORD ((uint32_t)0xDEADBEEF)
 #define GUARD_BAND_SIZE (sizeof(GUARD_WORD) * LE_CONFIG_NUM_GUARD_BAND_WORDS)
 
@@ -151,6 +166,44 @@ typedef struct
 MemBlock_t;
 
 
+#if LE_CONFIG_MEM_POOLS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Header of a chunk of blocks added by le_mem_ForceAlloc() to a pool with auto-trimming enabled.
+ * The blocks follow the header.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    le_dls_Link_t link;         ///< Link in the pool's list of chunks.
+    size_t numBlocks;           ///< Number of blocks in the chunk.
+    size_t numFree;             ///< Number of free blocks, only valid while the pool is trimmed.
+    bool isReleased;            ///< Chunk to be freed, only valid while the pool is trimmed.
+    le_clk_Time_t idleSince;    ///< When the chunk was first seen with all its blocks free,
+                                ///  zero if it has been seen in use since.
+}
+MemChunk_t;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Size of a chunk header, rounded up to keep the blocks aligned on the processor word size.
+ */
+//--------------------------------------------------------------------------------------------------
+#define CHUNK_HEADER_SIZE \
+    ((sizeof(MemChunk_t) + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*))
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer checking the pools to trim automatically, and the thread it runs in.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t AutoTrimTimer;
+static le_thread_Ref_t AutoTrimThread;
+#endif /* end LE_CONFIG_MEM_POOLS */
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Local list of all memory pools created with le_mem_CreatePool and le_mem_CreateSubPool
@@ -411,6 +464,9 @@ static void InitPool
     pool->numBlocksToForce = DEFAULT_NUM_BLOCKS_TO_FORCE;
 
     pool->poolLink = LE_DLS_LINK_INIT;
+#if LE_CONFIG_MEM_POOLS
+    pool->chunkList = LE_DLS_LIST_INIT;
+#endif
 
 #if LE_CONFIG_MEM_TRACE
     pool->memTrace = NULL;
@@ -622,17 +678,38 @@ static void InitBlock
     static void AddBlocks
     (
         le_mem_PoolRef_t    pool,       ///< [IN] The pool to be expanded.
-        size_t              numBlocks   ///< [IN] The number of blocks to add to the pool.
+        size_t              numBlocks,  ///< [IN] The number of blocks to add to the pool.
+        bool                isOverflow  ///< [IN] The blocks are added by le_mem_ForceAlloc(), and
+                                        ///       can be given back to the system if the pool is
+                                        ///       trimmed automatically.
     )
     {
         size_t i;
         size_t blockSize = pool->blockSize;
         size_t mallocSize = numBlocks * blockSize;
+        MemBlock_t* newBlockPtr;
+
+        // Allocate the chunk, with a header if it can be trimmed.  The chunks are sorted by
+        // address when the pool is trimmed.
+        if (isOverflow && (pool->autoTrimMs != 0))
+        {
+            MemChunk_t* chunkPtr = malloc(CHUNK_HEADER_SIZE + mallocSize);
 
-        // Allocate the chunk.
-        MemBlock_t* newBlockPtr = malloc(mallocSize);
+            LE_ASSERT(chunkPtr);
 
-        LE_ASSERT(newBlockPtr);
+            chunkPtr->numBlocks = numBlocks;
+            chunkPtr->idleSince = (le_clk_Time_t){ 0, 0 };
+            chunkPtr->link = LE_DLS_LINK_INIT;
+            le_dls_Queue(&pool->chunkList, &chunkPtr->link);
+
+            newBlockPtr = (MemBlock_t*)(((uint8_t*)chunkPtr) + CHUNK_HEADER_SIZE);
+        }
+        else
+        {
+            newBlockPtr = malloc(mallocSize);
+
+            LE_ASSERT(newBlockPtr);
+        }
 
         for (i = 0; i < numBlocks; i++)
         {
@@ -933,6 +1010,9 @@ le_mem_PoolRef_t _le_mem_InitStaticPool
 
     // Update the pool.
     poolPtr->totalBlocks += numBlocks;
+#   if LE_CONFIG_MEM_POOL_STATS
+    poolPtr->maxNumBlocks = poolPtr->totalBlocks;
+#   endif
 #endif
 
     return poolPtr;
@@ -953,7 +1033,8 @@ le_mem_PoolRef_t _le_mem_InitStaticPool
 static le_mem_PoolRef_t ExpandPool_NoLock
 (
     le_mem_PoolRef_t    pool,       ///< [IN] The pool to be expanded.
-    size_t              numObjects  ///< [IN] The number of objects to add to the pool.
+    size_t              numObjects, ///< [IN] The number of objects to add to the pool.
+    bool                isOverflow  ///< [IN] The pool is expanded by le_mem_ForceAlloc().
 )
 {
 #if LE_CONFIG_MEM_POOLS
@@ -971,7 +1052,7 @@ static le_mem_PoolRef_t ExpandPool_NoLock
         {
             // Expand the super-pool.
             LE_DEBUG("Expanding super-pool by %" PRIuS " blocks", numBlocksToAdd);
-            ExpandPool_NoLock(pool->superPoolPtr, numBlocksToAdd);
+            ExpandPool_NoLock(pool->superPoolPtr, numBlocksToAdd, isOverflow);
 
 #   if LE_CONFIG_MEM_POOL_STATS
             // This counts as an overflow for the super-pool -- expect super pools to be
@@ -999,8 +1080,15 @@ static le_mem_PoolRef_t ExpandPool_NoLock
     else
     {
         // This is not a sub-pool.
-        AddBlocks(pool, numObjects);
+        AddBlocks(pool, numObjects, isOverflow);
+    }
+
+#   if LE_CONFIG_MEM_POOL_STATS
+    if (pool->totalBlocks > pool->maxNumBlocks)
+    {
+        pool->maxNumBlocks = pool->totalBlocks;
     }
+#   endif /* end LE_CONFIG_MEM_POOL_STATS */
 #endif /* end LE_CONFIG_MEM_POOLS */
 
     return pool;
@@ -1028,7 +1116,7 @@ le_mem_PoolRef_t le_mem_ExpandPool
 
     mem_Lock();
 
-    pool = ExpandPool_NoLock(pool, numObjects);
+    pool = ExpandPool_NoLock(pool, numObjects, false);
 
     mem_Unlock();
 #endif
@@ -1155,10 +1243,11 @@ void* le_mem_ForceAlloc
 #if LE_CONFIG_MEM_POOLS
     while ((objPtr = le_mem_TryAlloc(pool)) == NULL)
     {
+        mem_Lock();
+
         // Expand the pool.
-        le_mem_ExpandPool(pool, pool->numBlocksToForce);
+        ExpandPool_NoLock(pool, pool->numBlocksToForce, true);
 
-        mem_Lock();
 #    if LE_CONFIG_MEM_POOL_STATS
         pool->numOverflows++;
 #    endif
@@ -1502,6 +1591,353 @@ void le_mem_SetDestructor
 }
 
 
+#if LE_CONFIG_MEM_POOLS
+//--------------------------------------------------------------------------------------------------
+/**
+ * Orders chunks by their addresses.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool ChunkAddrCompare
+(
+    le_dls_Link_t*      aPtr,       ///< [IN] Link of a chunk.
+    le_dls_Link_t*      bPtr        ///< [IN] Link of another chunk.
+)
+{
+    // The link is the first member of the chunk header.
+    return aPtr < bPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Finds the chunk that may hold a block, walking the pool's list of chunks in address order.
+ *
+ * @return The first chunk, from the given chunk, which does not end before the block, or NULL if
+ *         there is none.  The block may still be before that chunk.
+ */
+//--------------------------------------------------------------------------------------------------
+static MemChunk_t* FindChunk
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool.
+    MemChunk_t*         chunkPtr,   ///< [IN] Chunk to start from, NULL if there is none left.
+    void*               blockPtr    ///< [IN] Address of the block.
+)
+{
+    while ((chunkPtr != NULL) &&
+           ((uint8_t*)blockPtr >=
+            (uint8_t*)chunkPtr + CHUNK_HEADER_SIZE + chunkPtr->numBlocks * pool->blockSize))
+    {
+        le_dls_Link_t* linkPtr = le_dls_PeekNext(&pool->chunkList, &chunkPtr->link);
+
+        chunkPtr = (linkPtr != NULL) ? CONTAINER_OF(linkPtr, MemChunk_t, link) : NULL;
+    }
+
+    return chunkPtr;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks if a block is in a chunk returned by FindChunk().
+ */
+//--------------------------------------------------------------------------------------------------
+static inline bool IsInChunk
+(
+    MemChunk_t*         chunkPtr,   ///< [IN] Chunk returned by FindChunk().
+    void*               blockPtr    ///< [IN] Address of the block.
+)
+{
+    return (chunkPtr != NULL) && ((uint8_t*)blockPtr >= (uint8_t*)chunkPtr + CHUNK_HEADER_SIZE);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gets the first chunk of a pool.
+ *
+ * @return The chunk, or NULL if the pool has none.
+ */
+//--------------------------------------------------------------------------------------------------
+static inline MemChunk_t* FirstChunk
+(
+    le_mem_PoolRef_t    pool        ///< [IN] The pool.
+)
+{
+    le_dls_Link_t* linkPtr = le_dls_Peek(&pool->chunkList);
+
+    return (linkPtr != NULL) ? CONTAINER_OF(linkPtr, MemChunk_t, link) : NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Frees the chunks of a pool whose blocks are all free, and have been for a given time.
+ *
+ * The time a chunk has been free is measured from the first time it was seen with all its blocks
+ * free by this function.
+ *
+ * @note
+ *      Assumes that the mutex is locked.
+ *
+ * @return The number of blocks removed from the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t TrimPool_NoLock
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool to trim.
+    uint32_t            idleTimeMs, ///< [IN] Time the chunks must have been free (ms).
+    le_clk_Time_t       now         ///< [IN] Current relative time.
+)
+{
+    le_dls_Link_t* linkPtr;
+    le_sls_Link_t* blockLinkPtr;
+    MemChunk_t* chunkPtr;
+    size_t numReleased = 0;
+
+    if (le_dls_IsEmpty(&pool->chunkList))
+    {
+        return 0;
+    }
+
+    // Count the free blocks of each chunk, walking the free list and the chunks in address order.
+    le_dls_Sort(&pool->chunkList, ChunkAddrCompare);
+
+    for (linkPtr = le_dls_Peek(&pool->chunkList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&pool->chunkList, linkPtr))
+    {
+        CONTAINER_OF(linkPtr, MemChunk_t, link)->numFree = 0;
+    }
+
+    le_sls_Sort(&pool->freeList, AddrCompare);
+
+    chunkPtr = FirstChunk(pool);
+    for (blockLinkPtr = le_sls_Peek(&pool->freeList);
+         (blockLinkPtr != NULL) && (chunkPtr != NULL);
+         blockLinkPtr = le_sls_PeekNext(&pool->freeList, blockLinkPtr))
+    {
+        chunkPtr = FindChunk(pool, chunkPtr, blockLinkPtr);
+        if (IsInChunk(chunkPtr, blockLinkPtr))
+        {
+            chunkPtr->numFree++;
+        }
+    }
+
+    // Select the chunks to free.
+    le_clk_Time_t idleTime = { idleTimeMs / 1000, (idleTimeMs % 1000) * 1000 };
+
+    for (linkPtr = le_dls_Peek(&pool->chunkList);
+         linkPtr != NULL;
+         linkPtr = le_dls_PeekNext(&pool->chunkList, linkPtr))
+    {
+        chunkPtr = CONTAINER_OF(linkPtr, MemChunk_t, link);
+        chunkPtr->isReleased = false;
+
+        if (chunkPtr->numFree < chunkPtr->numBlocks)
+        {
+            chunkPtr->idleSince = (le_clk_Time_t){ 0, 0 };
+            continue;
+        }
+
+        if ((chunkPtr->idleSince.sec == 0) && (chunkPtr->idleSince.usec == 0))
+        {
+            chunkPtr->idleSince = now;
+        }
+
+        if (!le_clk_GreaterThan(idleTime, le_clk_Sub(now, chunkPtr->idleSince)))
+        {
+            chunkPtr->isReleased = true;
+            numReleased += chunkPtr->numBlocks;
+        }
+    }
+
+    if (numReleased == 0)
+    {
+        return 0;
+    }
+
+    // Rebuild the free list without the blocks of the chunks to free.
+    le_sls_List_t freeList = LE_SLS_LIST_INIT;
+
+    chunkPtr = FirstChunk(pool);
+    while ((blockLinkPtr = le_sls_Pop(&pool->freeList)) != NULL)
+    {
+        chunkPtr = FindChunk(pool, chunkPtr, blockLinkPtr);
+        if (!IsInChunk(chunkPtr, blockLinkPtr) || !chunkPtr->isReleased)
+        {
+            *blockLinkPtr = LE_SLS_LINK_INIT;
+            le_sls_Queue(&freeList, blockLinkPtr);
+        }
+    }
+    pool->freeList = freeList;
+
+    // Free the chunks.
+    linkPtr = le_dls_Peek(&pool->chunkList);
+    while (linkPtr != NULL)
+    {
+        chunkPtr = CONTAINER_OF(linkPtr, MemChunk_t, link);
+        linkPtr = le_dls_PeekNext(&pool->chunkList, linkPtr);
+
+        if (chunkPtr->isReleased)
+        {
+            le_dls_Remove(&pool->chunkList, &chunkPtr->link);
+            free(chunkPtr);
+        }
+    }
+
+    pool->totalBlocks -= numReleased;
+#   if LE_CONFIG_MEM_POOL_STATS
+    pool->numTrimmedBlocks += numReleased;
+#   endif
+
+    LE_DEBUG("Memory pool '%s' trimmed to %" PRIuS " blocks.",
+             MEMPOOL_NAME(pool->name), pool->totalBlocks);
+
+    return numReleased;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Asks the C library to give the free memory at the top of the heap, and the free pages inside
+ * it, back to the system.  Freed chunks too small to be allocated with mmap() otherwise stay in
+ * the heap.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TrimHeap
+(
+    void
+)
+{
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer handler trimming the pools for which auto-trimming is enabled.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AutoTrimTimerHandler
+(
+    le_timer_Ref_t timerRef     ///< [IN] Auto-trim timer.
+)
+{
+    le_clk_Time_t now = le_clk_GetRelativeTime();
+    size_t numReleased = 0;
+
+    mem_Lock();
+
+    le_dls_Link_t* poolLinkPtr = le_dls_Peek(&PoolList);
+    while (poolLinkPtr != NULL)
+    {
+        le_mem_Pool_t* poolPtr = CONTAINER_OF(poolLinkPtr, le_mem_Pool_t, poolLink);
+
+        if (poolPtr->autoTrimMs != 0)
+        {
+            numReleased += TrimPool_NoLock(poolPtr, poolPtr->autoTrimMs, now);
+        }
+
+        poolLinkPtr = le_dls_PeekNext(&PoolList, poolLinkPtr);
+    }
+
+    mem_Unlock();
+
+    if (numReleased != 0)
+    {
+        TrimHeap();
+    }
+}
+#endif /* end LE_CONFIG_MEM_POOLS */
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Gives the chunks of free objects added by le_mem_ForceAlloc() back to the system.
+ *
+ * @return
+ *      Number of objects removed from the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+size_t le_mem_Trim
+(
+    le_mem_PoolRef_t    pool        ///< [IN] The pool to trim.
+)
+{
+    LE_ASSERT(pool != NULL);
+
+    size_t numReleased = 0;
+
+#if LE_CONFIG_MEM_POOLS
+    mem_Lock();
+    numReleased = TrimPool_NoLock(pool, 0, le_clk_GetRelativeTime());
+    mem_Unlock();
+
+    if (numReleased != 0)
+    {
+        TrimHeap();
+    }
+#endif
+
+    return numReleased;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Sets the time after which the chunks of free objects added by le_mem_ForceAlloc() are
+ * automatically given back to the system.
+ *
+ * @return
+ *      Nothing.
+ */
+//--------------------------------------------------------------------------------------------------
+void le_mem_SetAutoTrim
+(
+    le_mem_PoolRef_t    pool,       ///< [IN] The pool to trim automatically.
+    uint32_t            idleTimeMs  ///< [IN] Time all the objects of a chunk must stay free before
+                                    ///       it is given back (ms), 0 to disable auto-trimming.
+)
+{
+    LE_ASSERT(pool != NULL);
+
+#if LE_CONFIG_MEM_POOLS
+    le_thread_Ref_t currentThread = le_thread_GetCurrent();
+    bool isFirst = false;
+
+    mem_Lock();
+    pool->autoTrimMs = idleTimeMs;
+    if ((idleTimeMs != 0) && (AutoTrimThread == NULL))
+    {
+        AutoTrimThread = currentThread;
+        isFirst = true;
+    }
+    mem_Unlock();
+
+    // The timer can't be created with the mutex locked, as it is allocated from a pool.  It is
+    // only used from its own thread, so it doesn't need the mutex anyway.  The pools are checked
+    // as often as the shortest idle time set from that thread.
+    if (isFirst)
+    {
+        AutoTrimTimer = le_timer_Create("MemAutoTrim");
+        le_timer_SetHandler(AutoTrimTimer, AutoTrimTimerHandler);
+        le_timer_SetRepeat(AutoTrimTimer, 0);
+        le_timer_SetMsInterval(AutoTrimTimer, idleTimeMs);
+        le_timer_Start(AutoTrimTimer);
+    }
+    else if ((idleTimeMs != 0) && (AutoTrimThread == currentThread) &&
+             (idleTimeMs < le_timer_GetMsInterval(AutoTrimTimer)))
+    {
+        le_timer_Stop(AutoTrimTimer);
+        le_timer_SetMsInterval(AutoTrimTimer, idleTimeMs);
+        le_timer_Start(AutoTrimTimer);
+    }
+#endif
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Fetches the statistics for a given pool.
@@ -1524,10 +1960,14 @@ void le_mem_GetStats
     statsPtr->numAllocs = pool->numAllocations;
     statsPtr->numOverflows = pool->numOverflows;
     statsPtr->maxNumBlocksUsed = pool->maxNumBlocksUsed;
+    statsPtr->maxNumBlocks = pool->maxNumBlocks;
+    statsPtr->numTrimmed = pool->numTrimmedBlocks;
 #else
     statsPtr->numAllocs = 0;
     statsPtr->numOverflows = 0;
     statsPtr->maxNumBlocksUsed = 0;
+    statsPtr->maxNumBlocks = 0;
+    statsPtr->numTrimmed = 0;
 #endif
     statsPtr->numFree = pool->totalBlocks - pool->numBlocksInUse;
     statsPtr->numBlocksInUse = pool->numBlocksInUse;
@@ -1555,6 +1995,7 @@ void le_mem_ResetStats
     mem_Lock();
     pool->numAllocations = 0;
     pool->numOverflows = 0;
+    pool->numTrimmedBlocks = 0;
     mem_Unlock();
 #endif
 }
@@ -1865,7 +2306,7 @@ le_mem_PoolRef_t _le_mem_CreateReducedPool
 
         if (numObjects > superPool->totalBlocks)
         {
-            ExpandPool_NoLock(superPool, numObjects - superPool->totalBlocks);
+            ExpandPool_NoLock(superPool, numObjects - superPool->totalBlocks, false);
         }
 
         mem_Unlock();
@@ -50,14 +50,18 @@ void msgCommon_CallRecvHandler
     void*                    recvContextPtr ///< [IN] contextPtr parameter for recvHandler
 )
 {
+    // Handlers may be nested, when a service in the same process and thread is called
+    // synchronously from a handler.
+    void* prevMsgRef = pthread_getspecific(ThreadLocalRxMsgKey);
+
     // Set the thread-local received message reference so it can be retrieved by the handler.
     pthread_setspecific(ThreadLocalRxMsgKey, msgRef);
 
     // Call the handler function.
     recvHandler(msgRef, recvContextPtr);
 
-    // Clear the thread-local reference.
-    pthread_setspecific(ThreadLocalRxMsgKey, NULL);
+    // Restore the thread-local reference.
+    pthread_setspecific(ThreadLocalRxMsgKey, prevMsgRef);
 }
 
 
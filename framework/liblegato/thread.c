@@ -33,6 +33,7 @@
 
 #include "legato.h"
 #include "args.h"
+#include "arena.h"
 #include "thread.h"
 
 #ifndef HAVE_PTHREAD_SETNAME
@@ -335,6 +336,9 @@ static void CleanupThread
     // Release any argument info associated with the thread.
     arg_DestructThread();
 
+    // Delete the thread's scratch arena.
+    arena_DestructThread();
+
     // If this thread is NOT joinable, then immediately invalidate its safe reference, remove it
     // from the thread object list, and free the thread object.  Otherwise, wait until someone
     // joins with it.
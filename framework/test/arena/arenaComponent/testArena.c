@@ -0,0 +1,85 @@
+/**
+ * Test of the Legato Arena Allocator API.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get the scratch arena of a thread and allocate from it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ScratchThread
+(
+    void* contextPtr
+)
+{
+    le_arena_Ref_t* arenaRefPtr = contextPtr;
+
+    *arenaRefPtr = le_arena_GetScratch();
+    memset(le_arena_Alloc(*arenaRefPtr, 100), 0xA5, 100);
+
+    return NULL;
+}
+
+
+COMPONENT_INIT
+{
+    int i;
+
+    LE_TEST_PLAN(9);
+
+    le_arena_Ref_t arenaRef = le_arena_Create();
+
+    // Allocations are aligned and packed.
+    le_arena_Mark_t startMark = le_arena_GetMark(arenaRef);
+    char* firstPtr = le_arena_Alloc(arenaRef, 3);
+    char* secondPtr = le_arena_Alloc(arenaRef, 5);
+    LE_TEST_OK(((uintptr_t)firstPtr % 8) == 0, "Allocation is aligned on 8 bytes");
+    LE_TEST_OK(secondPtr == firstPtr + 8, "Allocations are contiguous");
+    memcpy(firstPtr, "ab", 3);
+
+    // Fill several chunks, including a large one, and reset to the mark taken before them.
+    le_arena_Mark_t mark = le_arena_GetMark(arenaRef);
+    for (i = 0; i < 100; i++)
+    {
+        memset(le_arena_Alloc(arenaRef, 500), i, 500);
+    }
+    memset(le_arena_Alloc(arenaRef, 50000), 0x5A, 50000);
+
+    le_arena_ResetToMark(arenaRef, mark);
+    LE_TEST_OK(le_arena_Alloc(arenaRef, 1) == secondPtr + 8,
+               "Allocation after reset to mark reuses the memory released");
+    LE_TEST_OK(strcmp(firstPtr, "ab") == 0, "Memory allocated before the mark is preserved");
+
+    le_arena_ResetToMark(arenaRef, startMark);
+    LE_TEST_OK(le_arena_GetMark(arenaRef).chunkPtr == NULL,
+               "Reset to the first mark releases all the chunks");
+
+    for (i = 0; i < 1000; i++)
+    {
+        le_arena_Alloc(arenaRef, 1000);
+    }
+    le_arena_Reset(arenaRef);
+    LE_TEST_OK(le_arena_GetMark(arenaRef).chunkPtr == NULL, "Reset releases all the chunks");
+
+    le_arena_Delete(arenaRef);
+
+    // Each thread has its own scratch arena.
+    le_arena_Ref_t scratchRef = le_arena_GetScratch();
+    LE_TEST_OK(scratchRef != NULL, "Got the scratch arena");
+    LE_TEST_OK(le_arena_GetScratch() == scratchRef, "Scratch arena is the same for a thread");
+
+    le_arena_Ref_t otherScratchRef = NULL;
+    le_thread_Ref_t threadRef = le_thread_Create("ScratchThread", ScratchThread, &otherScratchRef);
+    le_thread_SetJoinable(threadRef);
+    le_thread_Start(threadRef);
+    le_thread_Join(threadRef, NULL);
+    LE_TEST_OK((otherScratchRef != NULL) && (otherScratchRef != scratchRef),
+               "Other thread got its own scratch arena");
+
+    LE_TEST_EXIT;
+}
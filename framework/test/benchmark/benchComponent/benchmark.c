@@ -0,0 +1,261 @@
+/**
+ * Framework benchmark harness.
+ *
+ * The benchmarks are run one after the other from the event loop.  Each benchmark is run once to
+ * warm up, then for the requested number of samples, and the median, minimum and maximum time per
+ * operation over the samples are reported.  The results are written as a JSON document, which
+ * compareBenchmarks.py compares with a baseline.
+ *
+ * Options:
+ *  - -s, --samples=N       Number of samples per benchmark (default 5).
+ *  - -f, --filter=TEXT     Only run the benchmarks whose name contains TEXT.
+ *  - -o, --output=PATH     Result file (default /tmp/benchmark.json), "-" for the standard output.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "benchmark.h"
+
+#include <sys/utsname.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum number of benchmarks and samples.
+ */
+//--------------------------------------------------------------------------------------------------
+#define MAX_BENCHMARKS      32
+#define MAX_SAMPLES         100
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Benchmark and its results.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef struct
+{
+    const char* namePtr;            ///< Name, "<module>.<operation>".
+    size_t numOps;                  ///< Number of operations per sample.
+    size_t bytesPerOp;              ///< Bytes processed per operation, 0 if not relevant.
+    bench_RunFunc_t runFunc;        ///< Benchmark function.
+    double medianNs;                ///< Median time per operation (ns).
+    double minNs;                   ///< Minimum time per operation (ns).
+    double maxNs;                   ///< Maximum time per operation (ns).
+}
+Benchmark_t;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Benchmark suite.
+ */
+//--------------------------------------------------------------------------------------------------
+static Benchmark_t Benchmarks[MAX_BENCHMARKS];
+static size_t NumBenchmarks;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Options.
+ */
+//--------------------------------------------------------------------------------------------------
+static int NumSamples = 5;
+static const char* FilterPtr = "";
+static const char* OutputPathPtr = "/tmp/benchmark.json";
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the run: benchmark and sample being run (sample 0 is the warm-up), start time of the
+ * sample and time per operation of the samples.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t CurrentBenchmark;
+static int CurrentSample;
+static struct timespec StartTime;
+static double SampleNs[MAX_SAMPLES + 1];
+
+static void RunSample(void* param1Ptr, void* param2Ptr);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a benchmark to the suite.
+ */
+//--------------------------------------------------------------------------------------------------
+void bench_Add
+(
+    const char* namePtr,            ///< [IN] Name, "<module>.<operation>".
+    size_t numOps,                  ///< [IN] Number of operations per sample.
+    size_t bytesPerOp,              ///< [IN] Bytes processed per operation, 0 if not relevant.
+    bench_RunFunc_t runFunc         ///< [IN] Benchmark function.
+)
+{
+    LE_ASSERT(NumBenchmarks < MAX_BENCHMARKS);
+
+    if (strstr(namePtr, FilterPtr) == NULL)
+    {
+        return;
+    }
+
+    Benchmarks[NumBenchmarks].namePtr = namePtr;
+    Benchmarks[NumBenchmarks].numOps = numOps;
+    Benchmarks[NumBenchmarks].bytesPerOp = bytesPerOp;
+    Benchmarks[NumBenchmarks].runFunc = runFunc;
+    NumBenchmarks++;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Compare two samples, for qsort().
+ */
+//--------------------------------------------------------------------------------------------------
+static int CompareSamples
+(
+    const void* aPtr,
+    const void* bPtr
+)
+{
+    double a = *(const double*)aPtr;
+    double b = *(const double*)bPtr;
+
+    return (a > b) - (a < b);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the results as a JSON document.
+ */
+//--------------------------------------------------------------------------------------------------
+static void WriteResults
+(
+    FILE* filePtr
+)
+{
+    struct utsname system;
+    size_t i;
+
+    LE_ASSERT(uname(&system) == 0);
+
+    fprintf(filePtr, "{\n");
+    fprintf(filePtr, "    \"system\": {\"machine\": \"%s\", \"kernel\": \"%s\", \"cpus\": %ld},\n",
+            system.machine, system.release, sysconf(_SC_NPROCESSORS_ONLN));
+    fprintf(filePtr, "    \"samples\": %d,\n", NumSamples);
+    fprintf(filePtr, "    \"results\": [");
+
+    for (i = 0; i < NumBenchmarks; i++)
+    {
+        const Benchmark_t* benchPtr = &Benchmarks[i];
+
+        fprintf(filePtr, "%s\n        {\"name\": \"%s\", \"ops\": %" PRIuS ", \"bytesPerOp\": %"
+                PRIuS ", \"nsPerOp\": {\"median\": %.2f, \"min\": %.2f, \"max\": %.2f}}",
+                (i == 0) ? "" : ",", benchPtr->namePtr, benchPtr->numOps, benchPtr->bytesPerOp,
+                benchPtr->medianNs, benchPtr->minNs, benchPtr->maxNs);
+    }
+
+    fprintf(filePtr, "\n    ]\n}\n");
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write the results and exit.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Finish
+(
+    void
+)
+{
+    if (strcmp(OutputPathPtr, "-") == 0)
+    {
+        WriteResults(stdout);
+    }
+    else
+    {
+        FILE* filePtr = fopen(OutputPathPtr, "w");
+
+        LE_FATAL_IF(filePtr == NULL, "Can't open '%s' (%m).", OutputPathPtr);
+        WriteResults(filePtr);
+        LE_FATAL_IF(fclose(filePtr) != 0, "Can't write '%s' (%m).", OutputPathPtr);
+        LE_INFO("Results written to '%s'.", OutputPathPtr);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Signal the end of the operations of the running benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+void bench_Done
+(
+    void
+)
+{
+    struct timespec endTime;
+    Benchmark_t* benchPtr = &Benchmarks[CurrentBenchmark];
+
+    LE_ASSERT(clock_gettime(CLOCK_MONOTONIC, &endTime) == 0);
+
+    SampleNs[CurrentSample] = ((endTime.tv_sec - StartTime.tv_sec) * 1e9 +
+                               (endTime.tv_nsec - StartTime.tv_nsec)) / benchPtr->numOps;
+    CurrentSample++;
+
+    if (CurrentSample > NumSamples)
+    {
+        // Leave the warm-up out.
+        qsort(&SampleNs[1], NumSamples, sizeof(double), CompareSamples);
+        benchPtr->minNs = SampleNs[1];
+        benchPtr->maxNs = SampleNs[NumSamples];
+        benchPtr->medianNs = (NumSamples % 2) ? SampleNs[1 + NumSamples / 2] :
+                             (SampleNs[NumSamples / 2] + SampleNs[1 + NumSamples / 2]) / 2;
+
+        LE_INFO("%s: %.2f ns/op (%.2f - %.2f)",
+                benchPtr->namePtr, benchPtr->medianNs, benchPtr->minNs, benchPtr->maxNs);
+
+        CurrentBenchmark++;
+        CurrentSample = 0;
+    }
+
+    // Run the next sample from the event loop, as this may be called from the benchmark.
+    le_event_QueueFunction(RunSample, NULL, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Run a sample of the current benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RunSample
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    if (CurrentBenchmark == NumBenchmarks)
+    {
+        Finish();
+    }
+
+    LE_ASSERT(clock_gettime(CLOCK_MONOTONIC, &StartTime) == 0);
+    Benchmarks[CurrentBenchmark].runFunc(Benchmarks[CurrentBenchmark].numOps);
+}
+
+COMPONENT_INIT
+{
+    le_arg_SetIntVar(&NumSamples, "s", "samples");
+    le_arg_SetStringVar(&FilterPtr, "f", "filter");
+    le_arg_SetStringVar(&OutputPathPtr, "o", "output");
+    le_arg_Scan();
+
+    LE_FATAL_IF((NumSamples < 1) || (NumSamples > MAX_SAMPLES),
+                "Number of samples must be between 1 and %d.", MAX_SAMPLES);
+
+    memBench_Init();
+    containerBench_Init();
+    eventBench_Init();
+    ipcBench_Init();
+    jsonBench_Init();
+    configBench_Init();
+
+    LE_INFO("Running %" PRIuS " benchmarks, %d samples each.", NumBenchmarks, NumSamples);
+
+    le_event_QueueFunction(RunSample, NULL, NULL);
+}
@@ -0,0 +1,63 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * @file benchmark.h
+ *
+ * Framework benchmark harness.
+ *
+ * Each benchmark runs a number of operations, then calls bench_Done().  It may do so before
+ * returning, or later from the event loop, which lets timers, events, IPC and the JSON parser be
+ * measured through the event loop as they are normally used.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#ifndef LEGATO_BENCHMARK_INCLUDE_GUARD
+#define LEGATO_BENCHMARK_INCLUDE_GUARD
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prototype of the benchmark functions.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef void (*bench_RunFunc_t)
+(
+    size_t numOps                   ///< [IN] Number of operations to run.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add a benchmark to the suite.
+ */
+//--------------------------------------------------------------------------------------------------
+void bench_Add
+(
+    const char* namePtr,            ///< [IN] Name, "<module>.<operation>".
+    size_t numOps,                  ///< [IN] Number of operations per sample.
+    size_t bytesPerOp,              ///< [IN] Bytes processed per operation, 0 if not relevant.
+    bench_RunFunc_t runFunc         ///< [IN] Benchmark function.
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Signal the end of the operations of the running benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+void bench_Done
+(
+    void
+);
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Initialization functions of the benchmark modules, adding their benchmarks to the suite.
+ */
+//--------------------------------------------------------------------------------------------------
+void memBench_Init(void);
+void containerBench_Init(void);
+void eventBench_Init(void);
+void ipcBench_Init(void);
+void jsonBench_Init(void);
+void configBench_Init(void);
+
+#endif // LEGATO_BENCHMARK_INCLUDE_GUARD
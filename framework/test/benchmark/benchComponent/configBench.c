@@ -0,0 +1,75 @@
+/**
+ * Configuration tree benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Node read and written by the benchmarks, in the app's own tree.
+ */
+//--------------------------------------------------------------------------------------------------
+#define VALUE_PATH      "benchmark/value"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Read a value with a quick (implicit transaction) read.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QuickGet
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        LE_ASSERT(le_cfg_QuickGetInt(VALUE_PATH, -1) >= 0);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Write a value in a write transaction, and commit it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SetCommit
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        le_cfg_IteratorRef_t iteratorRef = le_cfg_CreateWriteTxn("benchmark");
+
+        le_cfg_SetInt(iteratorRef, "value", i);
+        le_cfg_CommitTxn(iteratorRef);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the configuration tree benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+void configBench_Init
+(
+    void
+)
+{
+    le_cfg_QuickSetInt(VALUE_PATH, 0);
+
+    bench_Add("config.quickGet", 5000, 0, QuickGet);
+    bench_Add("config.setCommit", 1000, 0, SetCommit);
+}
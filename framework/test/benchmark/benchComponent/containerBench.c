@@ -0,0 +1,146 @@
+/**
+ * Hashmap and safe reference benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of entries in the hashmap and the safe reference map, and size of the keys.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NUM_ENTRIES     1024
+#define KEY_BYTES       16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Hashmap, and its keys.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_hashmap_Ref_t Map;
+static char Keys[NUM_ENTRIES][KEY_BYTES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Safe reference map, and references created in it.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_ref_MapRef_t RefMap;
+static void* Refs[NUM_ENTRIES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up a key in the hashmap.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HashMapGet
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        LE_ASSERT(le_hashmap_Get(Map, Keys[i % NUM_ENTRIES]) != NULL);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add and remove a key to and from the hashmap.
+ */
+//--------------------------------------------------------------------------------------------------
+static void HashMapPutRemove
+(
+    size_t numOps
+)
+{
+    static char key[KEY_BYTES] = "extraKey";
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        le_hashmap_Put(Map, key, key);
+        le_hashmap_Remove(Map, key);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Look up a safe reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SafeRefLookup
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        LE_ASSERT(le_ref_Lookup(RefMap, Refs[i % NUM_ENTRIES]) != NULL);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create, look up and delete a safe reference.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SafeRefCreateDelete
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        void* ref = le_ref_CreateRef(RefMap, &RefMap);
+
+        LE_ASSERT(le_ref_Lookup(RefMap, ref) == &RefMap);
+        le_ref_DeleteRef(RefMap, ref);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the hashmap and safe reference benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+void containerBench_Init
+(
+    void
+)
+{
+    size_t i;
+
+    Map = le_hashmap_Create("containerBench", NUM_ENTRIES, le_hashmap_HashString,
+                            le_hashmap_EqualsString);
+    RefMap = le_ref_CreateMap("containerBench", NUM_ENTRIES + 1);
+
+    for (i = 0; i < NUM_ENTRIES; i++)
+    {
+        snprintf(Keys[i], sizeof(Keys[i]), "key%" PRIuS, i);
+        le_hashmap_Put(Map, Keys[i], Keys[i]);
+        Refs[i] = le_ref_CreateRef(RefMap, Keys[i]);
+    }
+
+    bench_Add("hashMap.get", 1000000, 0, HashMapGet);
+    bench_Add("hashMap.putRemove", 1000000, 0, HashMapPutRemove);
+    bench_Add("safeRef.lookup", 1000000, 0, SafeRefLookup);
+    bench_Add("safeRef.createDelete", 1000000, 0, SafeRefCreateDelete);
+}
@@ -0,0 +1,197 @@
+/**
+ * Event loop and timer benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of timers left running while the timer start/stop benchmark runs, so that the timer
+ * list is not empty.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NUM_BACKGROUND_TIMERS   64
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of operations left to run by the chained benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t RemainingOps;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event reported by the report benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_event_Id_t EventId;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timers used by the timer benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_timer_Ref_t Timer;
+static le_timer_Ref_t BackgroundTimers[NUM_BACKGROUND_TIMERS];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queued function, queuing itself until all the operations are done.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueuedFunction
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+{
+    if (--RemainingOps == 0)
+    {
+        bench_Done();
+    }
+    else
+    {
+        le_event_QueueFunction(QueuedFunction, NULL, NULL);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Queue a function to the event loop.
+ */
+//--------------------------------------------------------------------------------------------------
+static void QueueFunction
+(
+    size_t numOps
+)
+{
+    RemainingOps = numOps;
+    le_event_QueueFunction(QueuedFunction, NULL, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Event handler, reporting the event again until all the operations are done.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventHandler
+(
+    void* reportPtr
+)
+{
+    if (--RemainingOps == 0)
+    {
+        bench_Done();
+    }
+    else
+    {
+        le_event_Report(EventId, &RemainingOps, sizeof(RemainingOps));
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Report an event to a handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Report
+(
+    size_t numOps
+)
+{
+    RemainingOps = numOps;
+    le_event_Report(EventId, &RemainingOps, sizeof(RemainingOps));
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Timer expiry handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    if (--RemainingOps == 0)
+    {
+        bench_Done();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Start and stop a timer.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimerStartStop
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    LE_ASSERT(le_timer_SetMsInterval(Timer, 1000) == LE_OK);
+    LE_ASSERT(le_timer_SetRepeat(Timer, 1) == LE_OK);
+
+    for (i = 0; i < numOps; i++)
+    {
+        le_timer_Start(Timer);
+        le_timer_Stop(Timer);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Let a repeating timer with a very short interval expire, which measures the cost of the timer
+ * expiry handling.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TimerExpire
+(
+    size_t numOps
+)
+{
+    le_clk_Time_t interval = { .sec = 0, .usec = 1 };
+
+    RemainingOps = numOps;
+    LE_ASSERT(le_timer_SetInterval(Timer, interval) == LE_OK);
+    LE_ASSERT(le_timer_SetRepeat(Timer, numOps) == LE_OK);
+    LE_ASSERT(le_timer_Start(Timer) == LE_OK);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the event loop and timer benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+void eventBench_Init
+(
+    void
+)
+{
+    size_t i;
+
+    EventId = le_event_CreateId("eventBench", sizeof(RemainingOps));
+    le_event_AddHandler("eventBench", EventId, EventHandler);
+
+    Timer = le_timer_Create("eventBench");
+    le_timer_SetHandler(Timer, TimerHandler);
+
+    for (i = 0; i < NUM_BACKGROUND_TIMERS; i++)
+    {
+        BackgroundTimers[i] = le_timer_Create("eventBenchBackground");
+        le_timer_SetMsInterval(BackgroundTimers[i], 3600000 + i);
+        le_timer_Start(BackgroundTimers[i]);
+    }
+
+    bench_Add("event.queueFunction", 1000000, 0, QueueFunction);
+    bench_Add("event.report", 1000000, 0, Report);
+    bench_Add("timer.startStop", 1000000, 0, TimerStartStop);
+    bench_Add("timer.expire", 10000, 0, TimerExpire);
+}
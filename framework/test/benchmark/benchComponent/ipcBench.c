@@ -0,0 +1,98 @@
+/**
+ * IPC benchmarks, run against the benchmark server.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data block exchanged with the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t Data[BENCHIPC_DATA_BYTES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a request and wait for its response.
+ */
+//--------------------------------------------------------------------------------------------------
+static void RoundTrip
+(
+    size_t numOps
+)
+{
+    uint32_t echoedValue;
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        benchIpc_Echo(i, &echoedValue);
+        LE_ASSERT(echoedValue == (uint32_t)i);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a data block to the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Write
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        benchIpc_Write(Data, sizeof(Data));
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Get a data block from the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Read
+(
+    size_t numOps
+)
+{
+    size_t size;
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        size = sizeof(Data);
+        benchIpc_Read(Data, &size);
+        LE_ASSERT(size == sizeof(Data));
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the IPC benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+void ipcBench_Init
+(
+    void
+)
+{
+    memset(Data, 0xA5, sizeof(Data));
+
+    bench_Add("ipc.roundTrip", 20000, 0, RoundTrip);
+    bench_Add("ipc.write1K", 20000, sizeof(Data), Write);
+    bench_Add("ipc.read1K", 20000, sizeof(Data), Read);
+}
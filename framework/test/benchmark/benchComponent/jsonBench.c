@@ -0,0 +1,114 @@
+/**
+ * JSON parser benchmark.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of records in the parsed document, and size of the buffer holding it.
+ */
+//--------------------------------------------------------------------------------------------------
+#define NUM_RECORDS     24
+#define DOCUMENT_BYTES  4096
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsed document, an array of records as typically exchanged with a cloud service.
+ */
+//--------------------------------------------------------------------------------------------------
+static char Document[DOCUMENT_BYTES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of documents left to parse.
+ */
+//--------------------------------------------------------------------------------------------------
+static size_t RemainingOps;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsing error handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ErrorHandler
+(
+    le_json_Error_t error,
+    const char* msg
+)
+{
+    LE_FATAL("JSON parsing error %d: %s", error, msg);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parsing event handler, parsing the document again at its end until all the operations are done.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EventHandler
+(
+    le_json_Event_t event
+)
+{
+    if (event != LE_JSON_DOC_END)
+    {
+        return;
+    }
+
+    le_json_Cleanup(le_json_GetSession());
+
+    if (--RemainingOps == 0)
+    {
+        bench_Done();
+    }
+    else
+    {
+        le_json_ParseString(Document, EventHandler, ErrorHandler, NULL);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Parse the document.
+ */
+//--------------------------------------------------------------------------------------------------
+static void Parse
+(
+    size_t numOps
+)
+{
+    RemainingOps = numOps;
+    le_json_ParseString(Document, EventHandler, ErrorHandler, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the JSON parser benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+void jsonBench_Init
+(
+    void
+)
+{
+    size_t length = 0;
+    int i;
+
+    length += snprintf(Document + length, sizeof(Document) - length, "[");
+    for (i = 0; i < NUM_RECORDS; i++)
+    {
+        length += snprintf(Document + length, sizeof(Document) - length,
+                           "%s{\"id\":%d,\"name\":\"sensor%d\",\"value\":%d.%02d,"
+                           "\"valid\":%s,\"unit\":null,\"tags\":[\"a\",\"b\"]}",
+                           (i == 0) ? "" : ",", i, i, i * 7, i % 100,
+                           (i % 2) ? "true" : "false");
+        LE_ASSERT(length < sizeof(Document));
+    }
+    length += snprintf(Document + length, sizeof(Document) - length, "]");
+    LE_ASSERT(length < sizeof(Document));
+
+    bench_Add("json.parse", 2000, length, Parse);
+}
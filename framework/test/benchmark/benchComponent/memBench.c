@@ -0,0 +1,139 @@
+/**
+ * Memory pool benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "benchmark.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of objects allocated at once by the batch benchmark, and of threads sharing the pool in
+ * the multi-threaded benchmark.
+ */
+//--------------------------------------------------------------------------------------------------
+#define BATCH_SIZE      64
+#define NUM_THREADS     4
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Pool the objects are allocated from.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_mem_PoolRef_t Pool;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate and release an object.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AllocRelease
+(
+    size_t numOps
+)
+{
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        le_mem_Release(le_mem_ForceAlloc(Pool));
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate a batch of objects, then release them.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AllocReleaseBatch
+(
+    size_t numOps
+)
+{
+    void* objPtr[BATCH_SIZE];
+    size_t i, j;
+
+    for (i = 0; i < numOps; i += BATCH_SIZE)
+    {
+        for (j = 0; j < BATCH_SIZE; j++)
+        {
+            objPtr[j] = le_mem_ForceAlloc(Pool);
+        }
+        for (j = 0; j < BATCH_SIZE; j++)
+        {
+            le_mem_Release(objPtr[j]);
+        }
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Thread allocating and releasing objects.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* AllocReleaseThread
+(
+    void* contextPtr
+)
+{
+    size_t numOps = (size_t)contextPtr;
+    size_t i;
+
+    for (i = 0; i < numOps; i++)
+    {
+        le_mem_Release(le_mem_ForceAlloc(Pool));
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Allocate and release objects from several threads sharing the pool.
+ */
+//--------------------------------------------------------------------------------------------------
+static void AllocReleaseThreads
+(
+    size_t numOps
+)
+{
+    le_thread_Ref_t threads[NUM_THREADS];
+    size_t i;
+
+    for (i = 0; i < NUM_THREADS; i++)
+    {
+        threads[i] = le_thread_Create("memBench", AllocReleaseThread,
+                                      (void*)(numOps / NUM_THREADS));
+        le_thread_SetJoinable(threads[i]);
+        le_thread_Start(threads[i]);
+    }
+    for (i = 0; i < NUM_THREADS; i++)
+    {
+        le_thread_Join(threads[i], NULL);
+    }
+
+    bench_Done();
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Add the memory pool benchmarks.
+ */
+//--------------------------------------------------------------------------------------------------
+void memBench_Init
+(
+    void
+)
+{
+    Pool = le_mem_CreatePool("memBench", 64);
+    le_mem_ExpandPool(Pool, BATCH_SIZE + NUM_THREADS);
+
+    bench_Add("mem.allocRelease", 1000000, 0, AllocRelease);
+    bench_Add("mem.allocReleaseBatch", 1000000, 0, AllocReleaseBatch);
+    bench_Add("mem.allocReleaseThreads", 1000000, 0, AllocReleaseThreads);
+}
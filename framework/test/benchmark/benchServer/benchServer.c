@@ -0,0 +1,67 @@
+/**
+ * Server side of the IPC benchmarks.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#include "legato.h"
+#include "interfaces.h"
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Data block returned by benchIpc_Read().
+ */
+//--------------------------------------------------------------------------------------------------
+static uint8_t Data[BENCHIPC_DATA_BYTES];
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Return the value passed in.
+ */
+//--------------------------------------------------------------------------------------------------
+void benchIpc_Echo
+(
+    uint32_t value,
+    uint32_t* echoedValuePtr
+)
+{
+    *echoedValuePtr = value;
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Receive a data block from the client.
+ */
+//--------------------------------------------------------------------------------------------------
+void benchIpc_Write
+(
+    const uint8_t* dataPtr,
+    size_t dataSize
+)
+{
+    // Touch the data, as a real server would.
+    if (dataSize > 0)
+    {
+        Data[0] = dataPtr[dataSize - 1];
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Send a data block to the client.
+ */
+//--------------------------------------------------------------------------------------------------
+void benchIpc_Read
+(
+    uint8_t* dataPtr,
+    size_t* dataSizePtr
+)
+{
+    memcpy(dataPtr, Data, sizeof(Data));
+    *dataSizePtr = sizeof(Data);
+}
+
+COMPONENT_INIT
+{
+    memset(Data, 0x5A, sizeof(Data));
+}
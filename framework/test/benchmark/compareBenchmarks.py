@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+#
+# Compare the results of the framework benchmark suite (test_Benchmark) with a baseline.
+#
+# A benchmark regresses when its median time per operation exceeds the baseline median by more
+# than the threshold and is also above the slowest baseline sample, so that the noise measured in
+# the baseline itself is not reported as a regression.  Exits with status 1 if any benchmark
+# regressed.
+#
+# Copyright (C) Sierra Wireless Inc.
+#
+
+from __future__ import print_function
+import argparse, json, sys
+
+def load(path):
+    with open(path) as resultFile:
+        document = json.load(resultFile)
+    return document, dict((result["name"], result) for result in document["results"])
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark results with a baseline.")
+    parser.add_argument("baseline", help="baseline result file")
+    parser.add_argument("results", help="result file to check")
+    parser.add_argument("-t", "--threshold", type=float, default=10.0,
+                        help="allowed slowdown of the median, in percent (default 10)")
+    args = parser.parse_args()
+
+    baselineDoc, baseline = load(args.baseline)
+    resultsDoc, results = load(args.results)
+
+    if baselineDoc["system"] != resultsDoc["system"]:
+        print("warning: results from different systems ({} vs {})".format(
+              baselineDoc["system"], resultsDoc["system"]), file=sys.stderr)
+
+    regressions = 0
+    print("{:<28} {:>12} {:>12} {:>9}  {}".format("benchmark", "base ns/op", "ns/op",
+                                                   "change", "status"))
+
+    for name, result in sorted(results.items()):
+        median = result["nsPerOp"]["median"]
+        if name not in baseline:
+            print("{:<28} {:>12} {:>12.2f} {:>9}  new".format(name, "-", median, "-"))
+            continue
+
+        base = baseline[name]["nsPerOp"]
+        change = (median - base["median"]) * 100.0 / base["median"] if base["median"] else 0.0
+        if change > args.threshold and median > base["max"]:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold and median < base["min"]:
+            status = "improved"
+        else:
+            status = "ok"
+        print("{:<28} {:>12.2f} {:>12.2f} {:>+8.1f}%  {}".format(name, base["median"], median,
+                                                                  change, status))
+
+    for name in sorted(set(baseline) - set(results)):
+        print("{:<28} {:>12.2f} {:>12} {:>9}  missing".format(
+              name, baseline[name]["nsPerOp"]["median"], "-", "-"))
+
+    if regressions:
+        print("{} benchmark(s) regressed by more than {}%.".format(regressions, args.threshold))
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -41,6 +41,10 @@ colourObj_t;
 #define FORCE_SIZE          3
 #define NUM_EXPAND_SUB_POOL 2
 #define NUM_ALLOC_SUPER_POOL    1
+#define TRIM_POOL_SIZE      10
+#define TRIM_FORCE_SIZE     8
+#define NUM_TRIM_BURST      42
+#define TRIM_IDLE_MS        3600000     // The test ends long before chunks are trimmed automatically
 
 static unsigned int NumRelease = 0;
 static unsigned int ReleaseId;
@@ -550,6 +554,82 @@ static void TestPools
 }
 
 
+static void TestTrim
+(
+    void
+)
+{
+    le_mem_PoolRef_t untrimmedPool = le_mem_CreatePool("Untrimmed Pool", sizeof(idObj_t));
+    le_mem_PoolRef_t trimPool = le_mem_CreatePool("Trim Pool", sizeof(idObj_t));
+    idObj_t* idsPtr[NUM_TRIM_BURST];
+    le_mem_PoolStats_t stats;
+    int i;
+
+    //
+    // Chunks are only tracked for the pools trimmed automatically.
+    //
+    le_mem_SetNumObjsToForce(untrimmedPool, TRIM_FORCE_SIZE);
+    le_mem_Release(le_mem_ForceAlloc(untrimmedPool));
+    LE_TEST_OK(le_mem_Trim(untrimmedPool) == 0, "Pool without auto-trimming not trimmed");
+
+    le_mem_ExpandPool(trimPool, TRIM_POOL_SIZE);
+    le_mem_SetNumObjsToForce(trimPool, TRIM_FORCE_SIZE);
+    le_mem_SetAutoTrim(trimPool, TRIM_IDLE_MS);
+
+    //
+    // Force allocate a burst of objects, then release all but the last one.
+    //
+    for (i = 0; i < NUM_TRIM_BURST; i++)
+    {
+        idsPtr[i] = le_mem_ForceAlloc(trimPool);
+        idsPtr[i]->id = i;
+    }
+    for (i = 0; i < NUM_TRIM_BURST - 1; i++)
+    {
+        le_mem_Release(idsPtr[i]);
+    }
+
+    //
+    // Trim: only the chunk holding the object still in use stays in the pool, with the objects
+    // from le_mem_ExpandPool().
+    //
+    LE_TEST_BEGIN_SKIP(TEST_MEM_VALGRIND, 3);
+    LE_TEST_OK(le_mem_Trim(trimPool) == NUM_TRIM_BURST - TRIM_POOL_SIZE - TRIM_FORCE_SIZE,
+               "Trim pool");
+    LE_TEST_OK(le_mem_GetObjectCount(trimPool) == TRIM_POOL_SIZE + TRIM_FORCE_SIZE,
+               "Check trimmed pool size");
+    LE_TEST_OK(idsPtr[NUM_TRIM_BURST - 1]->id == NUM_TRIM_BURST - 1,
+               "Check object in use after trimming");
+    LE_TEST_END_SKIP();
+
+    le_mem_Release(idsPtr[NUM_TRIM_BURST - 1]);
+
+    LE_TEST_BEGIN_SKIP(TEST_MEM_VALGRIND || !LE_CONFIG_IS_ENABLED(LE_CONFIG_MEM_POOL_STATS), 1);
+    le_mem_GetStats(trimPool, &stats);
+    LE_TEST_OK((stats.maxNumBlocks == NUM_TRIM_BURST) &&
+               (stats.numTrimmed == NUM_TRIM_BURST - TRIM_POOL_SIZE - TRIM_FORCE_SIZE),
+               "Check trim stats");
+    LE_TEST_END_SKIP();
+
+    LE_TEST_BEGIN_SKIP(TEST_MEM_VALGRIND, 2);
+    LE_TEST_OK(le_mem_Trim(trimPool) == TRIM_FORCE_SIZE, "Trim last chunk");
+    LE_TEST_OK(le_mem_GetObjectCount(trimPool) == TRIM_POOL_SIZE, "Check pool size after trim");
+    LE_TEST_END_SKIP();
+
+    //
+    // The pool can still grow after trimming.
+    //
+    for (i = 0; i < NUM_TRIM_BURST; i++)
+    {
+        idsPtr[i] = le_mem_ForceAlloc(trimPool);
+    }
+    for (i = 0; i < NUM_TRIM_BURST; i++)
+    {
+        le_mem_Release(idsPtr[i]);
+    }
+    LE_TEST_OK(le_mem_TryAlloc(trimPool) != NULL, "Allocate after trimming");
+}
+
 
 COMPONENT_INIT
 {
@@ -607,6 +687,9 @@ COMPONENT_INIT
     LE_TEST_INFO("Testing static pools");
     TestPools(staticIdPool, staticColourPool, staticStringsPool);
 
+    LE_TEST_INFO("Testing pool trimming");
+    TestTrim();
+
 
     // FIXME: Find pool by name is currently suffering from issues
     // Failure is tracked by ticket LE-5909
@@ -7,5 +7,7 @@
 import os
 
 def pytest_ignore_collect(path, config):
-    if os.environ.get('LE_CONFIG_LINUX') != "y" and path.basename == "testUnixMessaging.adef":
+    if ((os.environ.get('LE_CONFIG_LINUX') != "y") and
+        (path.basename == "testUnixMessaging.adef" or
+        path.basename == "test_UnixTxQueue.adef")):
         return True
@@ -0,0 +1,358 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Automated unit test for the transmit queues of the Low-Level Messaging APIs.
+ *
+ * Client side: for each service of the server (see txQueueServer.c), asks for a flood of
+ * indications and a response, then stops reading its socket for a while so that the server has to
+ * queue them, and checks what it receives:
+ * - The indications that fit in the socket arrive first, in order.
+ * - The response then overtakes the indications still queued.
+ * - Only the last TXQUEUE_LIMIT indications are left in the queue of the service that drops the
+ *   oldest ones, only the last state report of each key and the last events in the queue of the
+ *   service that coalesces them, and the session with the service that disconnects is closed.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "../txQueueProtocol.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of indications the server is asked for.  Much more than the socket buffers hold.
+ */
+//--------------------------------------------------------------------------------------------------
+#define FLOOD_COUNT 1000
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Services tested, in order.
+ */
+//--------------------------------------------------------------------------------------------------
+typedef enum
+{
+    TEST_DROP_OLDEST,
+    TEST_COALESCE,
+    TEST_DISCONNECT,
+    TEST_COUNT
+}
+Test_t;
+
+static const char* const ServiceNames[TEST_COUNT] =
+{
+    TXQUEUE_DROP_OLDEST_SERVICE,
+    TXQUEUE_COALESCE_SERVICE,
+    TXQUEUE_DISCONNECT_SERVICE
+};
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * State of the current test.
+ */
+//--------------------------------------------------------------------------------------------------
+static Test_t CurrentTest;
+static le_msg_SessionRef_t SessionRef;
+static bool IsResponseReceived;
+static bool IsPrefixInOrder;            ///< Indications received before the response are in order.
+static uint32_t PrefixCount;            ///< Number of indications received before the response.
+static uint32_t TailCount;              ///< Number of indications received after the response.
+static uint32_t TailSeqs[TXQUEUE_LIMIT];///< Sequence numbers of the first of them.
+static bool IsDoneReceived;
+
+
+static void StartTest(Test_t test);
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks what was received from the service that drops the oldest indications.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckDropOldest
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint32_t i;
+    bool isTailLast = true;
+
+    // The queue holds TXQUEUE_LIMIT messages: the last indications and TXQUEUE_DONE.
+    LE_TEST_OK(PrefixCount + TXQUEUE_LIMIT < FLOOD_COUNT,
+               "%"PRIu32" indications sent before the queue filled up", PrefixCount);
+    LE_TEST_OK(TailCount == TXQUEUE_LIMIT - 1,
+               "%"PRIu32" queued indications kept", TailCount);
+
+    for (i = 0; (i < TailCount) && (i < TXQUEUE_LIMIT); i++)
+    {
+        if (TailSeqs[i] != FLOOD_COUNT - (TXQUEUE_LIMIT - 1) + i)
+        {
+            isTailLast = false;
+        }
+    }
+    LE_TEST_OK(isTailLast, "the oldest queued indications were dropped");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Checks what was received from the service that coalesces the indications.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CheckCoalesce
+(
+    void
+)
+//--------------------------------------------------------------------------------------------------
+{
+    uint32_t expectedSeqs[TXQUEUE_LIMIT - 1];
+    uint32_t stateCount = 0;
+    uint32_t eventCount = 0;
+    uint32_t seq;
+    uint32_t i = TXQUEUE_LIMIT - 1;
+    bool isTailExpected;
+
+    // The stale state reports are dropped first, so the queue ends up holding the last report of
+    // each key and the last events but one, which makes room for TXQUEUE_DONE.
+    for (seq = FLOOD_COUNT; i > 0; )
+    {
+        seq--;
+        if (TXQUEUE_COALESCE_KEY(seq) != 0)
+        {
+            if (stateCount < TXQUEUE_KEY_COUNT)
+            {
+                stateCount++;
+                expectedSeqs[--i] = seq;
+            }
+        }
+        else if (eventCount < TXQUEUE_LIMIT - 1 - TXQUEUE_KEY_COUNT)
+        {
+            eventCount++;
+            expectedSeqs[--i] = seq;
+        }
+    }
+
+    LE_TEST_OK(PrefixCount + TXQUEUE_LIMIT < FLOOD_COUNT,
+               "%"PRIu32" indications sent before the queue filled up", PrefixCount);
+    LE_TEST_OK(TailCount == TXQUEUE_LIMIT - 1,
+               "%"PRIu32" queued indications kept", TailCount);
+
+    isTailExpected = (TailCount == TXQUEUE_LIMIT - 1);
+    for (i = 0; isTailExpected && (i < TailCount); i++)
+    {
+        isTailExpected = (TailSeqs[i] == expectedSeqs[i]);
+    }
+    LE_TEST_OK(isTailExpected, "the stale state reports were dropped before the events");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Closes the session of the current test and starts the next one.
+ */
+//--------------------------------------------------------------------------------------------------
+static void EndTest
+(
+    void* param1Ptr,
+    void* param2Ptr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_CloseSession(SessionRef);
+    le_msg_DeleteSession(SessionRef);
+
+    StartTest(CurrentTest + 1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the response from the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResponseHandler
+(
+    le_msg_MessageRef_t msgRef,
+    void*               contextPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_TEST_ASSERT(msgRef != NULL, "response received");
+
+    txQueue_Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+    LE_TEST_OK(msgPtr->type == TXQUEUE_RESPONSE, "response type");
+    LE_TEST_OK(!IsDoneReceived && (TailCount == 0),
+               "response sent before the queued indications");
+
+    IsResponseReceived = true;
+    le_msg_ReleaseMsg(msgRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Handles the indications from the server.
+ */
+//--------------------------------------------------------------------------------------------------
+static void IndicationRecvHandler
+(
+    le_msg_MessageRef_t msgRef,
+    void*               contextPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    txQueue_Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+
+    switch (msgPtr->type)
+    {
+        case TXQUEUE_INDICATION:
+            if (!IsResponseReceived)
+            {
+                if (msgPtr->seq != PrefixCount)
+                {
+                    IsPrefixInOrder = false;
+                }
+                PrefixCount++;
+            }
+            else
+            {
+                if (TailCount < TXQUEUE_LIMIT)
+                {
+                    TailSeqs[TailCount] = msgPtr->seq;
+                }
+                TailCount++;
+            }
+            break;
+
+        case TXQUEUE_DONE:
+            LE_TEST_INFO("%s: %"PRIu32" indications before the response, %"PRIu32" after",
+                         ServiceNames[CurrentTest], PrefixCount, TailCount);
+            IsDoneReceived = true;
+
+            LE_TEST_OK(CurrentTest != TEST_DISCONNECT, "flood ended");
+            LE_TEST_OK(IsResponseReceived, "response received before the end of the flood");
+            LE_TEST_OK(IsPrefixInOrder, "indications sent before the response in order");
+
+            if (CurrentTest == TEST_DROP_OLDEST)
+            {
+                CheckDropOldest();
+            }
+            else
+            {
+                CheckCoalesce();
+            }
+
+            // Don't close the session from its own receive handler.
+            le_event_QueueFunction(EndTest, NULL, NULL);
+            break;
+
+        default:
+            LE_TEST_FATAL("Unexpected message type (%"PRIu32")", msgPtr->type);
+    }
+
+    le_msg_ReleaseMsg(msgRef);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when the server closes the session with the service that disconnects.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SessionCloseHandler
+(
+    le_msg_SessionRef_t sessionRef,
+    void*               contextPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_TEST_INFO("%s: %"PRIu32" indications before the session was closed",
+                 ServiceNames[CurrentTest], PrefixCount);
+
+    LE_TEST_OK(CurrentTest == TEST_DISCONNECT, "session closed by the server");
+    LE_TEST_OK(!IsDoneReceived && (PrefixCount < FLOOD_COUNT), "session closed during the flood");
+    LE_TEST_OK(IsPrefixInOrder, "indications sent before the session was closed in order");
+
+    LE_TEST_EXIT;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Asks the server for the flood, and a response unless the session is going to be closed, then
+ * stops reading the socket for a while.
+ */
+//--------------------------------------------------------------------------------------------------
+static void SessionOpenHandler
+(
+    le_msg_SessionRef_t sessionRef,
+    void*               contextPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_MessageRef_t msgRef;
+    txQueue_Message_t* msgPtr;
+
+    msgRef = le_msg_CreateMsg(sessionRef);
+    msgPtr = le_msg_GetPayloadPtr(msgRef);
+    msgPtr->type = TXQUEUE_FLOOD;
+    msgPtr->seq = FLOOD_COUNT;
+    le_msg_Send(msgRef);
+
+    if (CurrentTest != TEST_DISCONNECT)
+    {
+        msgRef = le_msg_CreateMsg(sessionRef);
+        msgPtr = le_msg_GetPayloadPtr(msgRef);
+        msgPtr->type = TXQUEUE_REQUEST;
+        le_msg_RequestResponse(msgRef, ResponseHandler, NULL);
+    }
+
+    // Let the server fill the socket and its queue.
+    sleep(1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Opens a session with the service of a test.
+ */
+//--------------------------------------------------------------------------------------------------
+static void StartTest
+(
+    Test_t test
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetProtocolRef(TXQUEUE_PROTOCOL_ID_STR,
+                                                             sizeof(txQueue_Message_t));
+
+    CurrentTest = test;
+    IsResponseReceived = false;
+    IsPrefixInOrder = true;
+    PrefixCount = 0;
+    TailCount = 0;
+    IsDoneReceived = false;
+
+    LE_TEST_INFO("Testing %s", ServiceNames[test]);
+
+    SessionRef = le_msg_CreateSession(protocolRef, ServiceNames[test]);
+    le_msg_SetSessionRecvHandler(SessionRef, IndicationRecvHandler, NULL);
+    if (test == TEST_DISCONNECT)
+    {
+        le_msg_SetSessionCloseHandler(SessionRef, SessionCloseHandler, NULL);
+    }
+    le_msg_OpenSession(SessionRef, SessionOpenHandler, NULL);
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(LE_TEST_NO_PLAN);
+    LE_TEST_INFO("Transmit queues of a server in another process");
+
+    StartTest(TEST_DROP_OLDEST);
+}
@@ -0,0 +1,48 @@
+/**
+ * Protocol of the transmit queue test.
+ *
+ * - The client sends TXQUEUE_FLOOD, with the number of indications it wants in the sequence
+ *   number.  The server sends that many TXQUEUE_INDICATION messages, numbered from 0, followed by
+ *   TXQUEUE_DONE.
+ * - The client can do a request-response transaction with TXQUEUE_REQUEST, which the server
+ *   answers with TXQUEUE_RESPONSE.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+
+#ifndef TXQUEUE_PROTOCOL_H_INCLUDE_GUARD
+#define TXQUEUE_PROTOCOL_H_INCLUDE_GUARD
+
+#define TXQUEUE_PROTOCOL_ID_STR "TxQueueProtocol"
+
+// Services advertised by the server, one per overflow policy.
+#define TXQUEUE_DROP_OLDEST_SERVICE "TxQueueDropOldest"
+#define TXQUEUE_COALESCE_SERVICE    "TxQueueCoalesce"
+#define TXQUEUE_DISCONNECT_SERVICE  "TxQueueDisconnect"
+
+// Maximum number of indications queued per session, for all the services.
+#define TXQUEUE_LIMIT 10
+
+// Number of coalescing keys used by the server.  Even indications are events, with no key, and
+// odd ones are state reports, with one of TXQUEUE_KEY_COUNT keys.
+#define TXQUEUE_KEY_COUNT 3
+#define TXQUEUE_COALESCE_KEY(seq) ((((seq) % 2) == 0) ? 0 : ((((seq) / 2) % TXQUEUE_KEY_COUNT) + 1))
+
+typedef enum
+{
+    TXQUEUE_FLOOD,
+    TXQUEUE_REQUEST,
+    TXQUEUE_RESPONSE,
+    TXQUEUE_INDICATION,
+    TXQUEUE_DONE
+}
+txQueue_MessageType_t;
+
+typedef struct
+{
+    uint32_t type;  ///< txQueue_MessageType_t
+    uint32_t seq;   ///< Sequence number of an indication, or number of indications to flood.
+}
+txQueue_Message_t;
+
+#endif // TXQUEUE_PROTOCOL_H_INCLUDE_GUARD
@@ -0,0 +1,126 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Automated unit test for the transmit queues of the Low-Level Messaging APIs.
+ *
+ * Server side: advertises one service per overflow policy and floods its clients with indications
+ * on request.  Runs in its own process, so that messages go through the sockets.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include "../txQueueProtocol.h"
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Message receive handler, shared by all the services.
+ **/
+//--------------------------------------------------------------------------------------------------
+static void MsgRecvHandler
+(
+    le_msg_MessageRef_t msgRef,             ///< Reference to the received message.
+    void*               contextPtr          ///< Not used.
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_SessionRef_t sessionRef = le_msg_GetSession(msgRef);
+    txQueue_Message_t* msgPtr = le_msg_GetPayloadPtr(msgRef);
+    uint32_t i;
+
+    switch (msgPtr->type)
+    {
+        case TXQUEUE_FLOOD:
+        {
+            uint32_t count = msgPtr->seq;
+
+            le_msg_ReleaseMsg(msgRef);
+
+            LE_INFO("Sending %"PRIu32" indications.", count);
+
+            for (i = 0; i < count; i++)
+            {
+                // Key the messages through the thread, as done for the events of generated APIs.
+                le_msg_SetThreadCoalesceKey(TXQUEUE_COALESCE_KEY(i));
+                msgRef = le_msg_CreateMsg(sessionRef);
+                le_msg_SetThreadCoalesceKey(0);
+
+                msgPtr = le_msg_GetPayloadPtr(msgRef);
+                msgPtr->type = TXQUEUE_INDICATION;
+                msgPtr->seq = i;
+                le_msg_Send(msgRef);
+            }
+
+            msgRef = le_msg_CreateMsg(sessionRef);
+            msgPtr = le_msg_GetPayloadPtr(msgRef);
+            msgPtr->type = TXQUEUE_DONE;
+            msgPtr->seq = count;
+            le_msg_Send(msgRef);
+            break;
+        }
+
+        case TXQUEUE_REQUEST:
+            msgPtr->type = TXQUEUE_RESPONSE;
+            le_msg_Respond(msgRef);
+            break;
+
+        default:
+            LE_FATAL("Unexpected message type (%"PRIu32")", msgPtr->type);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Called when the client closes its session with the last service it tests, or when the session
+ * is closed for overflowing.
+ */
+//--------------------------------------------------------------------------------------------------
+static void DisconnectSessionCloseHandler
+(
+    le_msg_SessionRef_t sessionRef,
+    void*               contextPtr
+)
+//--------------------------------------------------------------------------------------------------
+{
+    LE_INFO("Session of the disconnecting service closed.  Exiting.");
+
+    exit(EXIT_SUCCESS);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Creates and advertises a service with a given overflow policy.
+ **/
+//--------------------------------------------------------------------------------------------------
+static le_msg_ServiceRef_t StartService
+(
+    const char*                 serviceInstanceName,
+    le_msg_TxOverflowPolicy_t   policy
+)
+//--------------------------------------------------------------------------------------------------
+{
+    le_msg_ProtocolRef_t protocolRef = le_msg_GetProtocolRef(TXQUEUE_PROTOCOL_ID_STR,
+                                                             sizeof(txQueue_Message_t));
+    le_msg_ServiceRef_t serviceRef = le_msg_CreateService(protocolRef, serviceInstanceName);
+
+    le_msg_SetServiceRecvHandler(serviceRef, MsgRecvHandler, NULL);
+    le_msg_SetServiceTxQueueLimit(serviceRef, TXQUEUE_LIMIT, policy);
+    le_msg_AdvertiseService(serviceRef);
+
+    return serviceRef;
+}
+
+
+COMPONENT_INIT
+{
+    le_msg_ServiceRef_t serviceRef;
+
+    StartService(TXQUEUE_DROP_OLDEST_SERVICE, LE_MSG_TX_OVERFLOW_DROP_OLDEST);
+    StartService(TXQUEUE_COALESCE_SERVICE, LE_MSG_TX_OVERFLOW_COALESCE);
+
+    serviceRef = StartService(TXQUEUE_DISCONNECT_SERVICE, LE_MSG_TX_OVERFLOW_DISCONNECT);
+    le_msg_AddServiceCloseHandler(serviceRef, DisconnectSessionCloseHandler, NULL);
+}
@@ -0,0 +1,297 @@
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test the shared memory channel API.
+ *
+ * The ring behaviour (full ring, record sizes, statistics) is tested synchronously, then records
+ * are streamed from a producer thread to a read handler running in the main thread event loop.
+ *
+ * Copyright (C) Sierra Wireless Inc.
+ */
+//--------------------------------------------------------------------------------------------------
+
+#include "legato.h"
+#include <sys/eventfd.h>
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of records in the test rings.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RECORD_COUNT        8
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maximum record size of the test rings.
+ */
+//--------------------------------------------------------------------------------------------------
+#define RECORD_SIZE         16
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Number of records streamed from the producer thread.
+ */
+//--------------------------------------------------------------------------------------------------
+#define STREAM_COUNT        10000
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Producer side of the streaming channel.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_shmChannel_Ref_t StreamProducer;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Next sequence number expected by the consumer.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint32_t NextSequence;
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Set if a record was received out of sequence.
+ */
+//--------------------------------------------------------------------------------------------------
+static bool SequenceError;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Create a channel and attach a consumer to it.
+ */
+//--------------------------------------------------------------------------------------------------
+static void CreateChannel
+(
+    le_shmChannel_FullPolicy_t  fullPolicy,
+    size_t                      recordCount,
+    le_shmChannel_Ref_t*        producerPtr,
+    le_shmChannel_Ref_t*        consumerPtr
+)
+{
+    int memFd, eventFd;
+
+    *producerPtr = le_shmChannel_Create("test", RECORD_SIZE, recordCount, fullPolicy);
+    LE_TEST_ASSERT(*producerPtr != NULL, "Create channel");
+
+    LE_TEST_ASSERT(le_shmChannel_GetFds(*producerPtr, &memFd, &eventFd) == LE_OK,
+                   "Get channel file descriptors");
+
+    *consumerPtr = le_shmChannel_Attach("test", memFd, eventFd);
+    LE_TEST_ASSERT(*consumerPtr != NULL, "Attach to channel");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test a full ring applying backpressure, and reading records back.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestBackpressure
+(
+    void
+)
+{
+    le_shmChannel_Ref_t producer, consumer;
+    le_shmChannel_Stats_t stats;
+    uint8_t record[RECORD_SIZE + 1];
+    size_t size;
+    uint32_t i;
+    bool ok = true;
+
+    CreateChannel(LE_SHMCHANNEL_FULL_BACKPRESSURE, RECORD_COUNT, &producer, &consumer);
+
+    LE_TEST_OK(le_shmChannel_Write(producer, record, sizeof(record)) == LE_BAD_PARAMETER,
+               "Record too large refused");
+
+    for (i = 0; i < RECORD_COUNT; i++)
+    {
+        memset(record, i, sizeof(record));
+        ok = ok && (le_shmChannel_Write(producer, record, i + 1) == LE_OK);
+    }
+    LE_TEST_OK(ok, "Fill the ring");
+    LE_TEST_OK(le_shmChannel_Write(producer, record, 1) == LE_WOULD_BLOCK, "Full ring refuses");
+
+    size = 1;
+    LE_TEST_OK((le_shmChannel_Read(consumer, record, &size) == LE_OVERFLOW) && (size == 1) &&
+               (le_shmChannel_Read(consumer, record, &size) == LE_OK),
+               "Record larger than buffer left in the ring");
+
+    for (i = 1; i < RECORD_COUNT; i++)
+    {
+        size = sizeof(record);
+        ok = ok && (le_shmChannel_Read(consumer, record, &size) == LE_OK) &&
+             (size == i + 1) && (record[0] == i) && (record[i] == i);
+    }
+    LE_TEST_OK(ok, "Read records back in order");
+
+    size = sizeof(record);
+    LE_TEST_OK(le_shmChannel_Read(consumer, record, &size) == LE_WOULD_BLOCK, "Ring is empty");
+
+    le_shmChannel_GetStats(consumer, &stats);
+    LE_TEST_OK((stats.writeCount == RECORD_COUNT) && (stats.readCount == RECORD_COUNT) &&
+               (stats.fullCount == 1) && (stats.droppedCount == 0) && (stats.signalCount == 1),
+               "Statistics: %" PRIu64 " written, %" PRIu64 " read, %" PRIu64 " full, %" PRIu64
+               " dropped, %" PRIu64 " signals", stats.writeCount, stats.readCount,
+               stats.fullCount, stats.droppedCount, stats.signalCount);
+
+    le_shmChannel_Delete(consumer);
+    le_shmChannel_Delete(producer);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test a full ring dropping records.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestDrop
+(
+    void
+)
+{
+    le_shmChannel_Ref_t producer, consumer;
+    le_shmChannel_Stats_t stats;
+    uint8_t record[RECORD_SIZE] = { 0 };
+
+    // The record count is rounded up to a power of two.
+    CreateChannel(LE_SHMCHANNEL_FULL_DROP, 3, &producer, &consumer);
+
+    LE_TEST_OK((le_shmChannel_Write(producer, record, sizeof(record)) == LE_OK) &&
+               (le_shmChannel_Write(producer, record, sizeof(record)) == LE_OK) &&
+               (le_shmChannel_Write(producer, record, sizeof(record)) == LE_OK) &&
+               (le_shmChannel_Write(producer, record, sizeof(record)) == LE_OK),
+               "Fill the ring");
+    LE_TEST_OK(le_shmChannel_Write(producer, record, sizeof(record)) == LE_NO_MEMORY,
+               "Record dropped");
+
+    le_shmChannel_GetStats(producer, &stats);
+    LE_TEST_OK((stats.droppedCount == 1) && (stats.fullCount == 0), "Drop counted");
+
+    le_shmChannel_Delete(producer);
+    le_shmChannel_Delete(consumer);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test attaching to something which is not a channel.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestInvalidAttach
+(
+    void
+)
+{
+    int fd1 = eventfd(0, EFD_CLOEXEC);
+    int fd2 = eventfd(0, EFD_CLOEXEC);
+
+    LE_TEST_OK(le_shmChannel_Attach("invalid", fd1, fd2) == NULL, "Invalid channel refused");
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Producer thread: stream records, retrying when the ring is full.
+ */
+//--------------------------------------------------------------------------------------------------
+static void* ProducerThread
+(
+    void* contextPtr
+)
+{
+    uint32_t sequence;
+    le_result_t result;
+
+    LE_UNUSED(contextPtr);
+
+    for (sequence = 0; sequence < STREAM_COUNT; sequence++)
+    {
+        while ((result = le_shmChannel_Write(StreamProducer, &sequence, sizeof(sequence))) ==
+               LE_WOULD_BLOCK)
+        {
+            usleep(100);
+        }
+        LE_FATAL_IF(result != LE_OK, "Write failed: %s", LE_RESULT_TXT(result));
+    }
+
+    return NULL;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Consumer read handler.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ReadHandler
+(
+    le_shmChannel_Ref_t channelRef,
+    void*               contextPtr
+)
+{
+    uint32_t sequence;
+    size_t size = sizeof(sequence);
+
+    LE_UNUSED(contextPtr);
+
+    while (le_shmChannel_Read(channelRef, &sequence, &size) == LE_OK)
+    {
+        if ((size != sizeof(sequence)) || (sequence != NextSequence))
+        {
+            SequenceError = true;
+        }
+        NextSequence++;
+        size = sizeof(sequence);
+    }
+
+    if (NextSequence >= STREAM_COUNT)
+    {
+        le_shmChannel_Stats_t stats;
+
+        LE_TEST_OK(!SequenceError, "%" PRIu32 " records received in sequence", NextSequence);
+
+        le_shmChannel_GetStats(channelRef, &stats);
+        LE_TEST_INFO("Streaming: %" PRIu64 " records, %" PRIu64 " full, %" PRIu64 " signals",
+                     stats.readCount, stats.fullCount, stats.signalCount);
+        LE_TEST_OK(stats.signalCount <= stats.writeCount, "Consumer not signalled per record");
+
+        le_shmChannel_Delete(channelRef);
+        le_shmChannel_Delete(StreamProducer);
+
+        LE_TEST_EXIT;
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Test streaming records from another thread to the event loop.
+ */
+//--------------------------------------------------------------------------------------------------
+static void TestStreaming
+(
+    void
+)
+{
+    le_shmChannel_Ref_t consumer;
+
+    CreateChannel(LE_SHMCHANNEL_FULL_BACKPRESSURE, RECORD_COUNT, &StreamProducer, &consumer);
+
+    LE_TEST_OK(le_shmChannel_SetReadHandler(consumer, ReadHandler, NULL) == LE_OK,
+               "Set read handler");
+    LE_TEST_OK(le_shmChannel_SetReadHandler(consumer, ReadHandler, NULL) == LE_DUPLICATE,
+               "Second read handler refused");
+
+    le_thread_Start(le_thread_Create("producer", ProducerThread, NULL));
+}
+
+
+COMPONENT_INIT
+{
+    LE_TEST_PLAN(24);
+
+    TestBackpressure();
+    TestDrop();
+    TestInvalidAttach();
+    TestStreaming();
+}
@@ -123,6 +123,15 @@ static le_log_TraceRef_t TraceRef;
 
 #endif
 
+#if LE_CONFIG_IPC_TRACE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to the call trace of this API.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_TraceRef_t _IpcTraceRef;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Message to call when unsolicited message (e.g. callback) is received from server.
@@ -187,6 +196,16 @@ LE_SHARED void ifgen_{{apiBaseName}}_InitCommonData
             TraceRef = le_log_GetTraceRef("ipc");
         }
 #endif
+
+#if LE_CONFIG_IPC_TRACE
+        if (!_IpcTraceRef)
+        {
+            static const char* const funcNames[] = _MSGNAMES_{{apiBaseName}};
+
+            _IpcTraceRef = le_msg_CreateTrace("{{apiBaseName}}", false, funcNames,
+                                              NUM_ARRAY_MEMBERS(funcNames));
+        }
+#endif
     }
     _UNLOCK;
 }
@@ -422,7 +441,14 @@ LE_SHARED {{function.returnType|FormatType(useBaseName=True)}} ifgen_{{apiBaseNa
     TRACE("Sending message to server and waiting for response : %ti bytes sent",
           _msgBufPtr-_msgPtr->buffer);
 
+#if LE_CONFIG_IPC_TRACE
+    uint64_t _traceStartNs = le_msg_TraceStart(_IpcTraceRef,
+                                               _MSGID_{{apiBaseName}}_{{function.name}});
+#endif
     _responseMsgRef = le_msg_RequestSyncResponse(_msgRef);
+#if LE_CONFIG_IPC_TRACE
+    le_msg_TraceEnd(_IpcTraceRef, _MSGID_{{apiBaseName}}_{{function.name}}, _traceStartNs);
+#endif
     // It is a serious error if we don't get a valid response from the server.  Call disconnect
     // handler (if one is defined) to allow cleanup
     if (_responseMsgRef == NULL)
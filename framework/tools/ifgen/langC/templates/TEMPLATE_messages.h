@@ -40,6 +40,16 @@ _Message_t;
 #define _MSGID_{{apiBaseName}}_{{function.name}} {{loop.index0}}
 {%- endfor %}
 
+#if LE_CONFIG_IPC_TRACE
+// Function names, indexed by message ID, for IPC call tracing
+#define _MSGNAMES_{{apiBaseName}} \
+{ \
+    {%- for function in functions %}
+    "{{function.name}}", \
+    {%- endfor %}
+}
+#endif
+
 
 // Define type-safe pack/unpack functions for all enums, including included types
 {%- for type in allTypes if type is EnumType or type is BitMaskType %}
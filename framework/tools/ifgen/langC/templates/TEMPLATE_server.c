@@ -190,6 +190,15 @@ __attribute__((unused)) static pthread_mutex_t _Mutex = PTHREAD_MUTEX_INITIALIZE
 #define _UNLOCK  LE_ASSERT(pthread_mutex_unlock(&_Mutex) == 0);
 
 
+#if LE_CONFIG_IPC_TRACE
+//--------------------------------------------------------------------------------------------------
+/**
+ * Reference to the call trace of this service.
+ */
+//--------------------------------------------------------------------------------------------------
+static le_msg_TraceRef_t _IpcTraceRef;
+#endif
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Forward declaration needed by StartServer
@@ -429,6 +438,16 @@ void {{apiName}}_AdvertiseService
     TraceRef = le_log_GetTraceRef("ipc");
 #endif
 
+#if LE_CONFIG_IPC_TRACE
+    if (!_IpcTraceRef)
+    {
+        static const char* const funcNames[] = _MSGNAMES_{{apiBaseName}};
+
+        _IpcTraceRef = le_msg_CreateTrace(SERVICE_INSTANCE_NAME, true, funcNames,
+                                          NUM_ARRAY_MEMBERS(funcNames));
+    }
+#endif
+
     // Create the server data pool
     _ServerDataPool = le_mem_InitStaticPool({{apiName}}_ServerData,
                                             HIGH_SERVER_DATA_COUNT,
@@ -701,6 +720,9 @@ static void Handle_{{apiName}}_{{function.name}}
 )
 {
     {%- with error_unpack_label=Labeler("error_unpack") %}
+    {%- set useArena = not args.localService and
+                       (function.parameters|select("InParameter")|select("StringParameter")|list or
+                        function.parameters|select("InParameter")|select("ArrayParameter")|list) %}
     // Create a server command object
     {{apiName}}_ServerCmd_t* _serverCmdPtr = le_mem_ForceAlloc(_ServerCmdPool);
     _serverCmdPtr->cmdLink = LE_DLS_LINK_INIT;
@@ -719,8 +741,16 @@ static void Handle_{{apiName}}_{{function.name}}
     }
     {%- endif %}
 
+    {%- if useArena %}
+
+    // String and array parameters are allocated from the scratch arena, which is reset once the
+    // message has been handled.
+    le_arena_Ref_t _arena = le_arena_GetScratch();
+    {%- endif %}
+
     // Unpack the input parameters from the message
-    {%- call pack.UnpackInputs(function.parameters,initiatorWaits=True) %}
+    {%- call pack.UnpackInputs(function.parameters,initiatorWaits=True,
+                               arenaName="_arena" if useArena else None) %}
         goto {{error_unpack_label}};
     {%- endcall %}
     {%- if args.localService %}
@@ -763,9 +793,18 @@ static void Handle_{{apiName}}_{{function.name}}
 )
 {
     {%- with error_unpack_label=Labeler("error_unpack") %}
+    {%- set useArena = not args.localService and
+                       (any(function.parameters, "StringParameter") or
+                        any(function.parameters, "ArrayParameter")) %}
     // Get the message buffer pointer
     __attribute__((unused)) uint8_t* _msgBufPtr =
         ((_Message_t*)le_msg_GetPayloadPtr(_msgRef))->buffer;
+    {%- if useArena %}
+
+    // String and array parameters are allocated from the scratch arena, which is reset once the
+    // message has been handled.
+    le_arena_Ref_t _arena = le_arena_GetScratch();
+    {%- endif %}
 
     // Needed if we are returning a result or output values
     uint8_t* _msgBufStartPtr = _msgBufPtr;
@@ -808,7 +847,8 @@ static void Handle_{{apiName}}_{{function.name}}
     handlerRef = ({{function.parameters[0].apiType|FormatType}})serverDataPtr->handlerRef;
     le_mem_Release(serverDataPtr);
     {%- else %}
-    {%- call pack.UnpackInputs(function.parameters,initiatorWaits=True) %}
+    {%- call pack.UnpackInputs(function.parameters,initiatorWaits=True,
+                               arenaName="_arena" if useArena else None) %}
         goto {{error_unpack_label}};
     {%- endcall %}
     {%- endif %}
@@ -831,12 +871,17 @@ static void Handle_{{apiName}}_{{function.name}}
     {%- elif args.localService and parameter is ArrayParameter %}
     size_t *{{parameter.name}}SizePtr = &{{parameter.name}}Size;
     {%- elif parameter is StringParameter %}
-    char {{parameter.name}}Buffer[{{parameter.maxCount + 1}}] = { 0 };
-    char *{{parameter|FormatParameterName}} = {{parameter.name}}Buffer;
+    // Sized for the buffer of the client (terminator included), within the maximum of the API.
+    char *{{parameter|FormatParameterName}} =
+        le_arena_Alloc(_arena, (({{parameter.name}}Size > 0) &&
+                                {#- #} ({{parameter.name}}Size <= {{parameter.maxCount}})) ?
+                               {#- #} {{parameter.name}}Size : {{parameter.maxCount + 1}});
+    {{parameter|FormatParameterName}}[0] = '\0';
     {%- elif parameter is ArrayParameter %}
-    {{parameter.apiType|FormatType}} {{parameter.name}}Buffer
-        {#- #}[{{parameter.maxCount}}] = { {{parameter.apiType|FormatTypeInitializer}} };
-    {{parameter.apiType|FormatType}} *{{parameter|FormatParameterName}} = {{parameter.name}}Buffer;
+    {{parameter.apiType|FormatType}} *{{parameter|FormatParameterName}} =
+        le_arena_Alloc(_arena, {{parameter.name}}Size * sizeof(*{{parameter|FormatParameterName}}));
+    memset({{parameter|FormatParameterName}}, 0,
+           {{parameter.name}}Size * sizeof(*{{parameter|FormatParameterName}}));
     size_t *{{parameter.name}}SizePtr = &{{parameter.name}}Size;
     {%- else %}
     {{parameter.apiType|FormatType}} {{parameter.name}}Buffer = {{parameter.apiType|FormatTypeInitializer}};
@@ -936,6 +981,16 @@ static void ServerMsgRecvHandler
     // the session ref may be different for each message, hence it has to be queried each time.
     LE_CDATA_THIS->_ClientSessionRef = le_msg_GetSession(msgRef);
 
+#if LE_CONFIG_IPC_TRACE
+    // The handler may respond to, and so release, the message.
+    uint32_t _msgId = msgPtr->id;
+    uint64_t _traceStartNs = le_msg_TraceStart(_IpcTraceRef, _msgId);
+#endif
+
+    // Whatever the handler allocates from the scratch arena is released once it returns.
+    le_arena_Ref_t _arena = le_arena_GetScratch();
+    le_arena_Mark_t _arenaMark = le_arena_GetMark(_arena);
+
     // Dispatch to appropriate message handler and get response
     switch (msgPtr->id)
     {
@@ -948,6 +1003,12 @@ static void ServerMsgRecvHandler
         default: LE_ERROR("Unknowm msg id = %" PRIu32 , msgPtr->id);
     }
 
+    le_arena_ResetToMark(_arena, _arenaMark);
+
+#if LE_CONFIG_IPC_TRACE
+    le_msg_TraceEnd(_IpcTraceRef, _msgId, _traceStartNs);
+#endif
+
     // Clear the client session ref associated with the current message, since the message
     // has now been processed.
     LE_CDATA_THIS->_ClientSessionRef = 0;
@@ -203,6 +203,8 @@ static void PrintHelp
         "    app start <appName> [<options>]\n"
         "    app stop <appName>\n"
         "    app restart <appName>\n"
+        "    app pause <appName>\n"
+        "    app resume <appName>\n"
         "    app remove <appName>\n"
         "    app stopLegato\n"
         "    app restartLegato\n"
@@ -236,6 +238,12 @@ static void PrintHelp
         "    app restart <appName>\n"
         "       Restarts the specified application.\n"
         "\n"
+        "    app pause <appName>\n"
+        "       Pauses the specified application, freezing all of its processes.\n"
+        "\n"
+        "    app resume <appName>\n"
+        "       Resumes the specified paused application.\n"
+        "\n"
         "    app remove <appName>\n"
         "       Removes the specified application.\n"
         "\n"
@@ -452,6 +460,82 @@ static void RestartApp
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * Requests the Supervisor to pause an application.
+ *
+ * @note This function does not return.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PauseApp
+(
+    void
+)
+{
+    le_appCtrl_ConnectService();
+
+    switch (le_appCtrl_Pause(AppNamePtr))
+    {
+        case LE_OK:
+            exit(EXIT_SUCCESS);
+
+        case LE_NOT_FOUND:
+            printf("Application '%s' is not running.\n", AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        case LE_DUPLICATE:
+            printf("Application '%s' is already paused.\n", AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        case LE_FAULT:
+            printf("Application '%s' could not be paused. Check logs for more info.\n",
+                   AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        default:
+            INTERNAL_ERR("Unexpected response from the Supervisor.");
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Requests the Supervisor to resume a paused application.
+ *
+ * @note This function does not return.
+ */
+//--------------------------------------------------------------------------------------------------
+static void ResumeApp
+(
+    void
+)
+{
+    le_appCtrl_ConnectService();
+
+    switch (le_appCtrl_Resume(AppNamePtr))
+    {
+        case LE_OK:
+            exit(EXIT_SUCCESS);
+
+        case LE_NOT_FOUND:
+            printf("Application '%s' is not running.\n", AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        case LE_DUPLICATE:
+            printf("Application '%s' is not paused.\n", AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        case LE_FAULT:
+            printf("Application '%s' could not be resumed. Check logs for more info.\n",
+                   AppNamePtr);
+            exit(EXIT_FAILURE);
+
+        default:
+            INTERNAL_ERR("Unexpected response from the Supervisor.");
+    }
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Removes an app.
@@ -1894,6 +1978,18 @@ static void CommandArgHandler
 
         le_arg_AddPositionalCallback(AppNameArgHandler);
     }
+    else if (strcmp(command, "pause") == 0)
+    {
+        CommandFunc = PauseApp;
+
+        le_arg_AddPositionalCallback(AppNameArgHandler);
+    }
+    else if (strcmp(command, "resume") == 0)
+    {
+        CommandFunc = ResumeApp;
+
+        le_arg_AddPositionalCallback(AppNameArgHandler);
+    }
     else if (strcmp(command, "remove") == 0)
     {
         CommandFunc = RemoveApp;
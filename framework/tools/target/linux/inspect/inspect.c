@@ -21,8 +21,11 @@
 #include "addr.h"
 #include "fileDescriptor.h"
 #include "timer.h"
+#include "messagingTrace.h"
 
 #include <sys/ptrace.h>
+#include <sys/mman.h>
+#include <dirent.h>
 
 //--------------------------------------------------------------------------------------------------
 /**
@@ -89,7 +92,8 @@ typedef enum
     INSPECT_INSP_TYPE_IPC_SERVERS,
     INSPECT_INSP_TYPE_IPC_CLIENTS,
     INSPECT_INSP_TYPE_IPC_SERVERS_SESSIONS,
-    INSPECT_INSP_TYPE_IPC_CLIENTS_SESSIONS
+    INSPECT_INSP_TYPE_IPC_CLIENTS_SESSIONS,
+    INSPECT_INSP_TYPE_IPC_TRACE
 }
 InspType_t;
 
@@ -1897,6 +1901,7 @@ static void PrintHelp
         "SYNOPSIS:\n"
         "    inspect <pools|threads|timers|mutexes|semaphores> [OPTIONS] PID\n"
         "    inspect ipc <servers|clients [sessions]> [OPTIONS] PID\n"
+        "    inspect ipctrace [OPTIONS] PID\n"
         "\n"
         "DESCRIPTION:\n"
         "    inspect pools              Prints the memory pools usage for the specified process.\n"
@@ -1909,6 +1914,13 @@ static void PrintHelp
                                         " specified process.\n"
         "    inspect ipc                Prints the info of ipc in all threads for the"
                                         " specified process.\n"
+        "    inspect ipctrace           Prints the number of calls and the latency of each"
+                                        " IPC API\n"
+        "                               function used by the specified process.  Requires a"
+                                        " framework\n"
+        "                               built with LE_CONFIG_IPC_TRACE.  The process is not"
+                                        " stopped.\n"
+        "                               In verbose mode, also prints the latency histograms.\n"
         "\n"
         "OPTIONS:\n"
         "    -f\n"
@@ -1992,9 +2004,11 @@ static char SuperPoolStr[] = "";
 static ColumnInfo_t MemPoolTableInfo[] =
 {
     {"TOTAL BLKS",  "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
+    {"MAX BLKS",    "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"USED BLKS",   "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"MAX USED",    "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"OVERFLOWS",   "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
+    {"TRIMMED",     "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"ALLOCS",      "%*s",  NULL, "%*"PRIu64"", sizeof(uint64_t),            false, 0, true},
     {"BLK BYTES",   "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
     {"USED BYTES",  "%*s",  NULL, "%*zu",       sizeof(size_t),              false, 0, true},
@@ -2070,7 +2084,11 @@ static ColumnInfo_t SessionObjTableInfo[] =
     {"INTERFACE NAME", "%*s", NULL, "%*s", LIMIT_MAX_IPC_INTERFACE_NAME_BYTES, true,  0, true},
     {"STATE",          "%*s", NULL, "%*s", 0,                                  true,  0, true},
     {"THREAD NAME",    "%*s", NULL, "%*s", MAX_THREAD_NAME_SIZE,               true,  0, true},
-    {"FD",             "%*s", NULL, "%*d", sizeof(int),                        false, 0, false}
+    {"FD",             "%*s", NULL, "%*d", sizeof(int),                        false, 0, false},
+    {"TX QUEUED",      "%*s", NULL, "%*zu", sizeof(size_t),                    false, 0, true},
+    {"TX PEAK",        "%*s", NULL, "%*zu", sizeof(size_t),                    false, 0, false},
+    {"TX DROPPED",     "%*s", NULL, "%*zu", sizeof(size_t),                    false, 0, false},
+    {"TX COALESCED",   "%*s", NULL, "%*zu", sizeof(size_t),                    false, 0, false}
 };
 static size_t SessionObjTableInfoSize = NUM_ARRAY_MEMBERS(SessionObjTableInfo);
 
@@ -3088,12 +3106,16 @@ static int PrintMemPoolInfo
         // copies of these. The same applies to other PrintXXXInfo functions.
         FillSizeTColField (le_mem_GetObjectCount(memPool),       MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
+        FillSizeTColField (poolStats.maxNumBlocks,               MemPoolTableInfo,
+                                                                 MemPoolTableInfoSize, &index);
         FillSizeTColField (poolStats.numBlocksInUse,             MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
         FillSizeTColField (poolStats.maxNumBlocksUsed,           MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
         FillSizeTColField (poolStats.numOverflows,               MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
+        FillSizeTColField (poolStats.numTrimmed,                 MemPoolTableInfo,
+                                                                 MemPoolTableInfoSize, &index);
         FillUint64ColField(poolStats.numAllocs,                  MemPoolTableInfo,
                                                                  MemPoolTableInfoSize, &index);
         FillSizeTColField (blockSize,                            MemPoolTableInfo,
@@ -3126,12 +3148,16 @@ static int PrintMemPoolInfo
 
         ExportSizeTToJson (le_mem_GetObjectCount(memPool),  MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolStats.maxNumBlocks,          MemPoolTableInfo,
+                                                            MemPoolTableInfoSize, &index, &printed);
         ExportSizeTToJson (poolStats.numBlocksInUse,        MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
         ExportSizeTToJson (poolStats.maxNumBlocksUsed,      MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
         ExportSizeTToJson (poolStats.numOverflows,          MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
+        ExportSizeTToJson (poolStats.numTrimmed,            MemPoolTableInfo,
+                                                            MemPoolTableInfoSize, &index, &printed);
         ExportUint64ToJson(poolStats.numAllocs,             MemPoolTableInfo,
                                                             MemPoolTableInfoSize, &index, &printed);
         ExportSizeTToJson (blockSize,                       MemPoolTableInfo,
@@ -3972,6 +3998,14 @@ static int PrintSessionObjInfo
                                                  SessionObjTableInfoSize, &index);
         FillIntColField(sessionObjRef->socketFd, SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index);
+        FillSizeTColField(sessionObjRef->txQueueCount,    SessionObjTableInfo,
+                                                          SessionObjTableInfoSize, &index);
+        FillSizeTColField(sessionObjRef->txQueuePeak,     SessionObjTableInfo,
+                                                          SessionObjTableInfoSize, &index);
+        FillSizeTColField(sessionObjRef->txDropCount,     SessionObjTableInfo,
+                                                          SessionObjTableInfoSize, &index);
+        FillSizeTColField(sessionObjRef->txCoalesceCount, SessionObjTableInfo,
+                                                          SessionObjTableInfoSize, &index);
 
         PrintInfo(SessionObjTableInfo, SessionObjTableInfoSize);
         lineCount++;
@@ -4000,6 +4034,14 @@ static int PrintSessionObjInfo
                                                  SessionObjTableInfoSize, &index, &printed);
         ExportIntToJson(sessionObjRef->socketFd, SessionObjTableInfo,
                                                  SessionObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson(sessionObjRef->txQueueCount,    SessionObjTableInfo,
+                                                 SessionObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson(sessionObjRef->txQueuePeak,     SessionObjTableInfo,
+                                                 SessionObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson(sessionObjRef->txDropCount,     SessionObjTableInfo,
+                                                 SessionObjTableInfoSize, &index, &printed);
+        ExportSizeTToJson(sessionObjRef->txCoalesceCount, SessionObjTableInfo,
+                                                 SessionObjTableInfoSize, &index, &printed);
 
         printf("]");
     }
@@ -4249,6 +4291,276 @@ static void InspectFunc
 }
 
 
+//--------------------------------------------------------------------------------------------------
+/**
+ * IPC trace segment of the inspected process, mapped read-only, and its size.
+ */
+//--------------------------------------------------------------------------------------------------
+static const msgTrace_Header_t* IpcTracePtr;
+static size_t IpcTraceSize;
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Lower bound of the latency histogram buckets, in microseconds.
+ */
+//--------------------------------------------------------------------------------------------------
+static uint64_t IpcTraceBucketStart
+(
+    int bucket
+)
+{
+    return (bucket == 0) ? 0 : (uint64_t)1 << (bucket - 1);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Maps the IPC trace segment of the inspected process.  The segment is a memfd, which is found
+ * among the file descriptors of the process.
+ *
+ * Exits if the process has no IPC trace segment.
+ */
+//--------------------------------------------------------------------------------------------------
+static void MapIpcTrace
+(
+    void
+)
+{
+    char dirPath[LIMIT_MAX_PATH_BYTES];
+    char linkTarget[LIMIT_MAX_PATH_BYTES];
+    struct dirent* entryPtr;
+    int memFd = -1;
+
+    snprintf(dirPath, sizeof(dirPath), "/proc/%d/fd", PidToInspect);
+
+    DIR* dirPtr = opendir(dirPath);
+    if (dirPtr == NULL)
+    {
+        fprintf(stderr, "Can't read the file descriptors of process %d (%m).\n", PidToInspect);
+        exit(EXIT_FAILURE);
+    }
+
+    while ((memFd < 0) && ((entryPtr = readdir(dirPtr)) != NULL))
+    {
+        ssize_t len = readlinkat(dirfd(dirPtr), entryPtr->d_name, linkTarget,
+                                 sizeof(linkTarget) - 1);
+        if (len <= 0)
+        {
+            continue;
+        }
+        linkTarget[len] = '\0';
+
+        // The link reads "/memfd:<name> (deleted)".
+        if (strncmp(linkTarget, "/memfd:" MSGTRACE_MEMFD_NAME " ",
+                    sizeof("/memfd:" MSGTRACE_MEMFD_NAME " ") - 1) == 0)
+        {
+            memFd = openat(dirfd(dirPtr), entryPtr->d_name, O_RDONLY | O_CLOEXEC);
+        }
+    }
+
+    closedir(dirPtr);
+
+    if (memFd < 0)
+    {
+        fprintf(stderr, "Process %d has no IPC trace.  Is the framework built with"
+                        " LE_CONFIG_IPC_TRACE, and has the process used IPC yet?\n",
+                PidToInspect);
+        exit(EXIT_FAILURE);
+    }
+
+    struct stat st;
+    INTERNAL_ERR_IF(fstat(memFd, &st) != 0, "Can't stat IPC trace (%m).");
+
+    if ((size_t)st.st_size < sizeof(msgTrace_Header_t))
+    {
+        fprintf(stderr, "IPC trace of process %d is too small.\n", PidToInspect);
+        exit(EXIT_FAILURE);
+    }
+
+    IpcTraceSize = st.st_size;
+    IpcTracePtr = mmap(NULL, IpcTraceSize, PROT_READ, MAP_SHARED, memFd, 0);
+    INTERNAL_ERR_IF(IpcTracePtr == MAP_FAILED, "Can't map IPC trace (%m).");
+
+    fd_Close(memFd);
+
+    if ((IpcTracePtr->magic != MSGTRACE_MAGIC) || (IpcTracePtr->version != MSGTRACE_VERSION))
+    {
+        fprintf(stderr, "IPC trace of process %d has an unsupported format.\n", PidToInspect);
+        exit(EXIT_FAILURE);
+    }
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prints the IPC trace of the inspected process.
+ */
+//--------------------------------------------------------------------------------------------------
+static void PrintIpcTrace
+(
+    void
+)
+{
+    static int lineCount = 0;
+    uint32_t numEntries = __atomic_load_n(&IpcTracePtr->numEntries, __ATOMIC_ACQUIRE);
+    uint32_t i;
+    int bucket;
+
+    // Don't trust the process to keep the count within the segment.
+    if (numEntries > (IpcTraceSize - sizeof(msgTrace_Header_t)) / sizeof(msgTrace_Entry_t))
+    {
+        numEntries = (IpcTraceSize - sizeof(msgTrace_Header_t)) / sizeof(msgTrace_Entry_t);
+    }
+
+    if (!IsOutputJson)
+    {
+        if (lineCount > 0)
+        {
+            printf("%c[1G", ESCAPE_CHAR);             // Move cursor to the column 1.
+            printf("%c[%dA", ESCAPE_CHAR, lineCount); // Move cursor up to the top of the table.
+            printf("%c[0J", ESCAPE_CHAR);             // Clear Screen.
+        }
+
+        printf("\nLegato IPC Call Trace Inspector\n");
+        printf("Inspecting process %d\n", PidToInspect);
+        printf("%-6s | %-24s | %-32s | %10s | %9s | %12s | %12s\n",
+               "SIDE", "API", "FUNCTION", "CALLS", "IN FLIGHT", "MEAN (us)", "MAX (us)");
+        lineCount = 4;
+    }
+    else
+    {
+        printf("{\"InspectType\":\"IPC Call Trace\",\"Pid\":%d,\"Data\":[", PidToInspect);
+    }
+
+    bool isFirst = true;
+
+    for (i = 0; i < numEntries; i++)
+    {
+        // Take a copy, as the counters keep changing.
+        msgTrace_Entry_t entry = IpcTracePtr->entries[i];
+
+        entry.apiName[sizeof(entry.apiName) - 1] = '\0';
+        entry.funcName[sizeof(entry.funcName) - 1] = '\0';
+
+        // Only show the functions that have been called, unless in verbose mode.
+        if (!IsVerbose && (entry.count == 0) && (entry.inFlight == 0))
+        {
+            continue;
+        }
+
+        if (IsOutputJson)
+        {
+            printf("%s{\"Side\":\"%s\",\"Api\":\"%s\",\"Function\":\"%s\",\"Calls\":%" PRIu64
+                   ",\"InFlight\":%" PRIu32 ",\"TotalNs\":%" PRIu64 ",\"MaxNs\":%" PRIu64
+                   ",\"Histogram\":[",
+                   isFirst ? "" : ",", entry.isServer ? "server" : "client", entry.apiName,
+                   entry.funcName, entry.count, entry.inFlight, entry.totalNs, entry.maxNs);
+
+            for (bucket = 0; bucket < MSGTRACE_NUM_BUCKETS; bucket++)
+            {
+                printf("%s%" PRIu64, (bucket == 0) ? "" : ",", entry.buckets[bucket]);
+            }
+            printf("]}");
+            isFirst = false;
+            continue;
+        }
+
+        printf("%-6s | %-24s | %-32s | %10" PRIu64 " | %9" PRIu32 " | %12.1f | %12.1f\n",
+               entry.isServer ? "server" : "client", entry.apiName, entry.funcName, entry.count,
+               entry.inFlight, (entry.count == 0) ? 0.0 : entry.totalNs / 1000.0 / entry.count,
+               entry.maxNs / 1000.0);
+        lineCount++;
+
+        if (IsVerbose && (entry.count != 0))
+        {
+            printf("       ");
+            for (bucket = 0; bucket < MSGTRACE_NUM_BUCKETS; bucket++)
+            {
+                if (entry.buckets[bucket] == 0)
+                {
+                    continue;
+                }
+
+                if (bucket == MSGTRACE_NUM_BUCKETS - 1)
+                {
+                    printf(" >=%" PRIu64 "us:%" PRIu64,
+                           IpcTraceBucketStart(bucket), entry.buckets[bucket]);
+                }
+                else
+                {
+                    printf(" <%" PRIu64 "us:%" PRIu64,
+                           IpcTraceBucketStart(bucket + 1), entry.buckets[bucket]);
+                }
+            }
+            printf("\n");
+            lineCount++;
+        }
+    }
+
+    if (IsOutputJson)
+    {
+        printf("]}\n");
+    }
+
+    fflush(stdout);
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * IPC trace refresh timer handler.  Exits when the inspected process is gone.
+ */
+//--------------------------------------------------------------------------------------------------
+static void IpcTraceTimerHandler
+(
+    le_timer_Ref_t timerRef
+)
+{
+    if ((kill(PidToInspect, 0) != 0) && (errno == ESRCH))
+    {
+        printf("Process %d has exited.\n", PidToInspect);
+        exit(EXIT_SUCCESS);
+    }
+
+    PrintIpcTrace();
+}
+
+
+//--------------------------------------------------------------------------------------------------
+/**
+ * Prints the IPC trace of the inspected process, once or periodically.
+ */
+//--------------------------------------------------------------------------------------------------
+static void InspectIpcTrace
+(
+    void
+)
+{
+    MapIpcTrace();
+
+    PrintIpcTrace();
+
+    if (!IsFollowing)
+    {
+        exit(EXIT_SUCCESS);
+    }
+
+    le_clk_Time_t refreshInterval = { .sec = RefreshInterval, .usec = 0 };
+
+    refreshTimer = le_timer_Create("RefreshTimer");
+
+    INTERNAL_ERR_IF(le_timer_SetHandler(refreshTimer, IpcTraceTimerHandler) != LE_OK,
+                    "Could not set timer handler.\n");
+    INTERNAL_ERR_IF(le_timer_SetInterval(refreshTimer, refreshInterval) != LE_OK,
+                    "Could not set refresh time.\n");
+    INTERNAL_ERR_IF(le_timer_SetRepeat(refreshTimer, 0) != LE_OK,
+                    "Could not set timer repeat.\n");
+    INTERNAL_ERR_IF(le_timer_Start(refreshTimer) != LE_OK,
+                    "Could not start refresh timer.\n");
+}
+
+
 //--------------------------------------------------------------------------------------------------
 /**
  * Refresh timer handler.
@@ -4410,6 +4722,10 @@ static void CommandArgHandler
     {
         le_arg_AddPositionalCallback(IpcInterfaceTypeHandler);
     }
+    else if (strcmp(command, "ipctrace") == 0)
+    {
+        InspectType = INSPECT_INSP_TYPE_IPC_TRACE;
+    }
     else
     {
         fprintf(stderr, "Invalid command '%s'.\n", command);
@@ -4553,6 +4869,13 @@ COMPONENT_INIT
 
     le_arg_Scan();
 
+    // The IPC trace is read from shared memory, without attaching to the process.
+    if (InspectType == INSPECT_INSP_TYPE_IPC_TRACE)
+    {
+        InspectIpcTrace();
+        return;
+    }
+
     // Create a memory pool for iterators.
     InitIteratorPool(InspectType);
 